@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "aho-corasick.h"
+
+struct ac_automaton {
+    // Literals, kept until build
+    char **literals;
+    size_t *lengths;
+    int literal_count;
+    int literal_cap;
+
+    // Bytes that appear in literals get their own class, everything else is class 0
+    uint8_t classes[256];
+    int class_count;
+
+    // Full DFA: next state = delta[state * class_count + class]
+    int32_t *delta;
+    int32_t *terminal;  // literal id ending in this state, -1 if none
+    int32_t *output;    // first state on the suffix chain with a literal, 0 if none
+    int32_t *dict;      // next terminal state on the suffix chain, 0 if none
+    int state_count;
+    int built;
+};
+
+ac_automaton_t *ac_new(void) {
+    return calloc(1, sizeof(ac_automaton_t));
+}
+
+void ac_free(ac_automaton_t *ac) {
+    if (!ac) return;
+
+    for (int i = 0; i < ac->literal_count; i++) {
+        free(ac->literals[i]);
+    }
+    free(ac->literals);
+    free(ac->lengths);
+    free(ac->delta);
+    free(ac->terminal);
+    free(ac->output);
+    free(ac->dict);
+    free(ac);
+}
+
+int ac_add(ac_automaton_t *ac, const char *literal, size_t len) {
+    if (!ac || ac->built || !literal || len == 0) return -1;
+
+    for (int i = 0; i < ac->literal_count; i++) {
+        if (ac->lengths[i] == len && memcmp(ac->literals[i], literal, len) == 0) {
+            return i;
+        }
+    }
+
+    if (ac->literal_count == AC_MAX_LITERALS) return -1;
+
+    if (ac->literal_count == ac->literal_cap) {
+        int cap = ac->literal_cap ? ac->literal_cap * 2 : 64;
+        char **literals = realloc(ac->literals, cap * sizeof(char *));
+        if (!literals) return -1;
+        ac->literals = literals;
+
+        size_t *lengths = realloc(ac->lengths, cap * sizeof(size_t));
+        if (!lengths) return -1;
+        ac->lengths = lengths;
+
+        ac->literal_cap = cap;
+    }
+
+    char *copy = malloc(len);
+    if (!copy) return -1;
+    memcpy(copy, literal, len);
+
+    ac->literals[ac->literal_count] = copy;
+    ac->lengths[ac->literal_count] = len;
+    return ac->literal_count++;
+}
+
+int ac_build(ac_automaton_t *ac) {
+    if (!ac || ac->built) return 0;
+
+    // Byte classes
+    memset(ac->classes, 0, sizeof(ac->classes));
+    ac->class_count = 1;
+    for (int i = 0; i < ac->literal_count; i++) {
+        for (size_t k = 0; k < ac->lengths[i]; k++) {
+            unsigned char c = (unsigned char)ac->literals[i][k];
+            if (!ac->classes[c]) {
+                ac->classes[c] = (uint8_t)ac->class_count++;
+            }
+        }
+    }
+
+    // Upper bound on trie size
+    size_t max_states = 1;
+    for (int i = 0; i < ac->literal_count; i++) {
+        max_states += ac->lengths[i];
+    }
+
+    int k = ac->class_count;
+    ac->delta = malloc(max_states * k * sizeof(int32_t));
+    ac->terminal = malloc(max_states * sizeof(int32_t));
+    ac->output = calloc(max_states, sizeof(int32_t));
+    ac->dict = calloc(max_states, sizeof(int32_t));
+    int32_t *fail = calloc(max_states, sizeof(int32_t));
+    int32_t *queue = malloc(max_states * sizeof(int32_t));
+    if (!ac->delta || !ac->terminal || !ac->output || !ac->dict || !fail || !queue) {
+        free(fail);
+        free(queue);
+        return 0;
+    }
+
+    for (size_t i = 0; i < max_states * k; i++) ac->delta[i] = -1;
+    for (size_t i = 0; i < max_states; i++) ac->terminal[i] = -1;
+
+    // Trie
+    ac->state_count = 1;
+    for (int i = 0; i < ac->literal_count; i++) {
+        int32_t s = 0;
+        for (size_t j = 0; j < ac->lengths[i]; j++) {
+            int c = ac->classes[(unsigned char)ac->literals[i][j]];
+            if (ac->delta[s * k + c] < 0) {
+                ac->delta[s * k + c] = ac->state_count++;
+            }
+            s = ac->delta[s * k + c];
+        }
+        ac->terminal[s] = i;
+    }
+
+    // Failure links (BFS), missing transitions are resolved through them
+    int head = 0, tail = 0;
+    for (int c = 0; c < k; c++) {
+        int32_t v = ac->delta[c];
+        if (v < 0) {
+            ac->delta[c] = 0;
+        } else {
+            fail[v] = 0;
+            queue[tail++] = v;
+        }
+    }
+
+    while (head < tail) {
+        int32_t u = queue[head++];
+
+        int32_t f = fail[u];
+        ac->dict[u] = ac->terminal[f] >= 0 ? f : ac->dict[f];
+        ac->output[u] = ac->terminal[u] >= 0 ? u : ac->dict[u];
+
+        for (int c = 0; c < k; c++) {
+            int32_t v = ac->delta[u * k + c];
+            if (v < 0) {
+                ac->delta[u * k + c] = ac->delta[f * k + c];
+            } else {
+                fail[v] = ac->delta[f * k + c];
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    free(fail);
+    free(queue);
+
+    ac->built = 1;
+    return 1;
+}
+
+int ac_literal_count(const ac_automaton_t *ac) {
+    return ac ? ac->literal_count : 0;
+}
+
+int ac_scan(const ac_automaton_t *ac, const char *text, size_t len, int *found, int max_found) {
+    if (!ac || !ac->built || !text) return 0;
+
+    uint64_t seen[AC_MAX_LITERALS / 64] = {0};
+    const unsigned char *p = (const unsigned char *)text;
+    const int k = ac->class_count;
+    int32_t s = 0;
+    int count = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        s = ac->delta[s * k + ac->classes[p[i]]];
+
+        for (int32_t t = ac->output[s]; t; t = ac->dict[t]) {
+            int id = ac->terminal[t];
+            if (seen[id >> 6] & (1ULL << (id & 63))) continue;
+            seen[id >> 6] |= 1ULL << (id & 63);
+
+            if (count == max_found) return count;
+            found[count++] = id;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,26 @@
+#ifndef AHO_CORASICK
+#define AHO_CORASICK
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AC_MAX_LITERALS 4096
+
+typedef struct ac_automaton ac_automaton_t;
+
+ac_automaton_t *ac_new(void);
+void ac_free(ac_automaton_t *ac);
+
+// Adds a literal, returns its id (the same id for a literal added twice) or -1
+int ac_add(ac_automaton_t *ac, const char *literal, size_t len);
+
+// Builds the automaton, no literals can be added afterwards
+int ac_build(ac_automaton_t *ac);
+
+int ac_literal_count(const ac_automaton_t *ac);
+
+// Single pass over text, fills found with ids of distinct literals present in it,
+// returns their count
+int ac_scan(const ac_automaton_t *ac, const char *text, size_t len, int *found, int max_found);
+
+#endif
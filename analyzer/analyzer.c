@@ -3,75 +3,745 @@
 #include <string.h>
 #include <unistd.h>
 #include <ctype.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
 
 #include <json-c/json.h>
 
 #include "detection.h"
 #include "html-decoder.h"
+#include "request-parser.h"
+#include "arena.h"
+#include "binary-protocol.h"
+#include "thread-pool.h"
+#include "stream.h"
+#include "simd.h"
+#include "verdict-cache.h"
+#include "stats.h"
 
-request_t *parse_input(const char *json_input, size_t *out_count);
-void analyze_request(request_t *req, detection_report_t *detection_report);
-char *generate_result(detection_report_t *detection_report);
-char *process_requests(request_t *requests, size_t count);
+// Per-line arena: small default block, but a block big enough for a typical batch is kept
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_MAX_RETAINED (4 * 1024 * 1024)
+// getline() buffer above this size is released instead of reused
+#define LINE_MAX_RETAINED (1024 * 1024)
+// Pending connections of the shared server (--listen) and the zygote (--zygote)
+#define SOCKET_BACKLOG 128
+// Verdicts of a batch go out once the oldest one has waited this long (see verdict_writer_t)
+#define VERDICT_MAX_DELAY_NS (100 * 1000)
+// ...and before a request with at least this many bytes to scan
+#define VERDICT_FLUSH_BYTES (16 * 1024)
 
-int main(){
+request_t *parse_input(const char *json_input, size_t *out_count, arena_t *arena);
+void analyze_request(const ruleset_t *rules, request_t *req, detection_report_t *detection_report);
+void generate_result(const ruleset_t *rules, detection_report_t *detection_report, arena_buf_t *out);
+void process_requests(request_t *requests, size_t count, FILE *out, arena_t *arena, unsigned *announced_generation);
+static void append_rules_table(arena_buf_t *out, const ruleset_t *rules);
+static void announce_rules(arena_buf_t *out, const ruleset_t *rules, unsigned *announced_generation);
+static void handle_stream_frame(uint8_t type, const uint8_t *payload, uint32_t len, stream_table_t *streams,
+                                FILE *out, arena_t *arena, unsigned *announced_generation);
+static void write_stream_verdict(FILE *out, uint32_t id, const stream_t *stream, arena_t *arena,
+                                 unsigned *announced_generation);
+static void serve_json(FILE *in, FILE *out, arena_t *arena);
+static void serve_binary(FILE *in, FILE *out, arena_t *arena);
+static void handle_control(const char *text, size_t len, FILE *out, shm_ring_t *ring, arena_t *arena);
+static void handle_command(const char *line, FILE *out, arena_t *arena);
+static void start_reloader(void);
+static int request_reload(void);
+static void *reloader_main(void *arg);
+static void on_sighup(int sig);
+static int serve_process(const char *listen_path, int threads);
+static int listen_socket(const char *path);
+static int serve_socket(const char *path);
+static void *serve_connection(void *arg);
+static int serve_zygote(const char *path, int threads);
+static int read_zygote_commands(int fd, char *buf, size_t size, size_t *len);
+static void zygote_command(const char *line);
+static void reap_zygote_children(void);
+static void on_zygote_sighup(int sig);
+static void on_zygote_sigchld(int sig);
+
+// Batch items are analyzed in parallel when --threads is given
+static thread_pool_t *analysis_pool = NULL;
+static int binary_mode = 0;
+// Self-pipe: SIGHUP and reload commands write a byte, the reloader thread reads it and compiles
+// the rules off the request path. -1 - reloads are disabled.
+static int reload_pipe[2] = { -1, -1 };
+// Sent once per stream before anything else, a zygote child adds its pid
+static char ready_message[64] = "{\"status\":\"ready\"}";
+// SIGHUP to the zygote - it reloads between two accepts, children already forked keep their rules
+static volatile sig_atomic_t zygote_reload = 0;
+static volatile sig_atomic_t zygote_child_exited = 0;
+// Children of the zygote it did not reap yet. The pid of a child is not reused before the
+// zygote reaps it, so a kill command ({"cmd":"kill","pid":N} on its stdin, from the proxy
+// primary) for a pid in here can only hit that child.
+static pid_t *zygote_children = NULL;
+static size_t zygote_child_count = 0;
+static size_t zygote_child_capacity = 0;
+
+// Verdicts of the batch in progress. They are written as they are ready instead of after the
+// whole batch, so small requests do not wait for a large body scanned in the same batch: the
+// pending ones go out once the oldest has waited VERDICT_MAX_DELAY_NS, before a request of
+// VERDICT_FLUSH_BYTES or more is scanned, as soon as they are added while one is scanned on
+// another thread, and at the end. Items finish on the pool threads, the writer - and the
+// arena behind its buffer - is only used under the lock.
+typedef struct {
+    pthread_mutex_t lock;
+    FILE *out;
+    int binary;
+    arena_buf_t buf;
+    size_t start;       // Binary mode: offset of the open FRAME_BATCH in buf
+    int open;           // A frame (or array) of verdicts is started
+    uint32_t pending;   // Verdicts in it
+    uint64_t oldest;    // When the first of them was added
+    int written;        // Something of this batch is out already
+    int large;          // Requests of VERDICT_FLUSH_BYTES or more being scanned
+} verdict_writer_t;
+
+typedef struct {
+    size_t index;       // In the batch
+    size_t size;        // Bytes to scan
+} batch_item_t;
+
+typedef struct {
+    const ruleset_t *rules;
+    request_t *requests;
+    detection_report_t *reports;
+    batch_item_t *items;    // Scan order
+    verdict_writer_t *writer;
+} batch_t;
+
+static void analyze_item(void *ctx, size_t i);
+static int compare_items(const void *a, const void *b);
+static void add_verdict(verdict_writer_t *writer, const ruleset_t *rules, const request_t *request,
+                        detection_report_t *report, int large);
+static void begin_verdicts(verdict_writer_t *writer);
+static void flush_verdicts(verdict_writer_t *writer);
+
+int main(int argc, char **argv){
     setvbuf(stdout, NULL, _IONBF, 0); // Unbuffered stdout
     setvbuf(stderr, NULL, _IONBF, 0); // Unbuffered stderr
+
+    const char *listen_path = NULL;
+    const char *zygote_path = NULL;
+    int threads = -1;
+    long cache_entries = CACHE_DEFAULT_ENTRIES;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--binary") == 0) {
+            binary_mode = 1;
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--listen") == 0 && i + 1 < argc) {
+            listen_path = argv[++i];
+        } else if (strcmp(argv[i], "--zygote") == 0 && i + 1 < argc) {
+            zygote_path = argv[++i];
+        } else if (strcmp(argv[i], "--rules") == 0 && i + 1 < argc) {
+            set_rules_path(argv[++i]);
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            cache_entries = atol(argv[++i]);
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            fprintf(stderr, "Usage: %s [--binary] [--threads N] [--listen SOCKET_PATH | --zygote SOCKET_PATH] [--rules RULES_FILE] [--cache ENTRIES]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // A shared server uses every core unless told otherwise
+    if (threads < 0) {
+        threads = listen_path ? (int)sysconf(_SC_NPROCESSORS_ONLN) - 1 : 0;
+    }
     
-    // Compile REGEX patterns
+    // Compile REGEX patterns - one immutable copy, shared by all threads
     init_regex_patterns();
+    simd_implementation(); // Resolve the kernels before any thread uses them
+    // In the zygote before the fork - every child starts with an empty cache of its own
+    verdict_cache_init(cache_entries > 0 ? (size_t)cache_entries : 0);
 
-    // Ready signal
-    fprintf(stdout, "{\"status\":\"ready\"}\n");
+    // The zygote stays single-threaded, threads do not survive fork()
+    if (zygote_path) {
+        return serve_zygote(zygote_path, threads);
+    }
+    return serve_process(listen_path, threads);
+}
+
+// Everything after the rules are compiled - in a zygote child this runs after the fork
+static int serve_process(const char *listen_path, int threads) {
+    start_reloader();
+
+    if (threads > 0) {
+        analysis_pool = thread_pool_new(threads);
+        if (!analysis_pool) {
+            fprintf(stderr, "Could not start the thread pool, analyzing on the calling thread\n");
+        }
+    }
+
+    int status = 0;
+    if (listen_path) {
+        status = serve_socket(listen_path);
+    } else {
+        // The ready message tells the threads a batch runs on, as serve_socket() does
+        size_t used = strlen(ready_message) - 1;    // Up to the closing brace
+        snprintf(ready_message + used, sizeof(ready_message) - used, ",\"threads\":%d}",
+                 thread_pool_size(analysis_pool) + 1);
+
+        // Everything allocated for one line (or frame) lives in the arena
+        arena_t arena;
+        arena_init(&arena, ARENA_BLOCK_SIZE, ARENA_MAX_RETAINED);
+
+        if (binary_mode) {
+            serve_binary(stdin, stdout, &arena);
+        } else {
+            serve_json(stdin, stdout, &arena);
+        }
+
+        arena_destroy(&arena);
+    }
+
+    thread_pool_free(analysis_pool);
+    verdict_cache_free();
+    cleanup_regex_patterns();
+    return status;
+}
+
+static int listen_socket(const char *path) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0) {
+        perror("socket failed");
+        return -1;
+    }
+
+    unlink(path); // Left over from a previous run
+    if (bind(server, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(server, SOCKET_BACKLOG) < 0) {
+        perror("bind failed");
+        close(server);
+        return -1;
+    }
+    return server;
+}
+
+// Shared server: every connection is served like stdin/stdout of a single-client process,
+// on its own thread with its own arena. Batch items go to the common thread pool.
+static int serve_socket(const char *path) {
+    int server = listen_socket(path);
+    if (server < 0) return 1;
+
+    // A client that goes away must not take the server down
+    signal(SIGPIPE, SIG_IGN);
+
+    // Ready signal - clients connect after it
+    fprintf(stdout, "{\"status\":\"ready\",\"threads\":%d}\n", thread_pool_size(analysis_pool) + 1);
     fflush(stdout);
 
+    for (;;) {
+        int client = accept(server, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            perror("accept failed");
+            break;
+        }
+
+        int *arg = malloc(sizeof(int));
+        pthread_t thread;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+        if (!arg || (*arg = client, pthread_create(&thread, &attr, serve_connection, arg)) != 0) {
+            fprintf(stderr, "{\"error\":\"Could not serve connection\"}\n");
+            free(arg);
+            close(client);
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    close(server);
+    unlink(path);
+    return 1;
+}
+
+static void *serve_connection(void *arg) {
+    int fd = *(int *)arg;
+    free(arg);
+
+    FILE *in = fdopen(fd, "r");
+    int out_fd = dup(fd);
+    FILE *out = out_fd >= 0 ? fdopen(out_fd, "w") : NULL;
+
+    if (in && out) {
+        arena_t arena;
+        arena_init(&arena, ARENA_BLOCK_SIZE, ARENA_MAX_RETAINED);
+
+        if (binary_mode) {
+            serve_binary(in, out, &arena);
+        } else {
+            serve_json(in, out, &arena);
+        }
+
+        arena_destroy(&arena);
+    }
+
+    if (out) fclose(out); else if (out_fd >= 0) close(out_fd);
+    if (in) fclose(in); else close(fd);
+    return NULL;
+}
+
+// Zygote: compiles the rules once, then forks a child per connection. The child gets the
+// connection as stdin/stdout and runs like a spawned analyzer, the compiled rules are
+// shared with the zygote copy-on-write, so it is ready without reading the rules file.
+static int serve_zygote(const char *path, int threads) {
+    int server = listen_socket(path);
+    if (server < 0) return 1;
+
+    // No SA_RESTART - poll() returns and the reload (or reaping) runs on the zygote's only thread
+    struct sigaction action = { .sa_handler = on_zygote_sighup };
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGHUP, &action, NULL);
+    // Children are reaped here, not by the kernel - see zygote_children
+    action.sa_handler = on_zygote_sigchld;
+    sigaction(SIGCHLD, &action, NULL);
+
+    fprintf(stdout, "{\"status\":\"ready\",\"zygote\":%d}\n", (int)getpid());
+    fflush(stdout);
+
+    // Commands of the primary, until it closes stdin
+    int commands = STDIN_FILENO;
+    char command[256];
+    size_t command_len = 0;
+
+    for (;;) {
+        if (zygote_reload) {
+            zygote_reload = 0;
+            reload_regex_patterns();
+        }
+        if (zygote_child_exited) {
+            zygote_child_exited = 0;
+            reap_zygote_children();
+        }
+
+        struct pollfd fds[2] = { { server, POLLIN, 0 }, { commands, POLLIN, 0 } };
+        if (poll(fds, commands >= 0 ? 2 : 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("poll failed");
+            break;
+        }
+        if (commands >= 0 && fds[1].revents &&
+            !read_zygote_commands(commands, command, sizeof(command), &command_len)) {
+            commands = -1;
+        }
+        if (!(fds[0].revents & POLLIN)) continue;
+
+        int client = accept(server, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            perror("accept failed");
+            break;
+        }
+
+        // Room for the pid first - a child the zygote can not track could not be killed
+        if (zygote_child_count == zygote_child_capacity) {
+            size_t capacity = zygote_child_capacity ? zygote_child_capacity * 2 : 16;
+            pid_t *grown = realloc(zygote_children, capacity * sizeof(pid_t));
+            if (!grown) {
+                fprintf(stderr, "Out of memory for the zygote children, connection refused\n");
+                close(client);
+                continue;
+            }
+            zygote_children = grown;
+            zygote_child_capacity = capacity;
+        }
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(server);
+            signal(SIGCHLD, SIG_DFL);
+            signal(SIGHUP, SIG_DFL);
+
+            if (dup2(client, STDIN_FILENO) < 0 || dup2(client, STDOUT_FILENO) < 0) _exit(1);
+            close(client);
+
+            // The proxy asks the zygote to kill a stuck child by this pid
+            snprintf(ready_message, sizeof(ready_message), "{\"status\":\"ready\",\"pid\":%d}", (int)getpid());
+            exit(serve_process(NULL, threads));
+        }
+
+        if (pid < 0) perror("fork failed");
+        else zygote_children[zygote_child_count++] = pid;
+        close(client);
+    }
+
+    close(server);
+    unlink(path);
+    verdict_cache_free();
+    cleanup_regex_patterns();
+    return 1;
+}
+
+// Reads what the primary wrote and runs every complete line. 0 once stdin is closed.
+static int read_zygote_commands(int fd, char *buf, size_t size, size_t *len) {
+    ssize_t n = read(fd, buf + *len, size - 1 - *len);
+    if (n < 0) return errno == EINTR || errno == EAGAIN;
+    if (n == 0) return 0;
+    *len += (size_t)n;
+
+    char *line = buf;
+    char *newline;
+    while ((newline = memchr(line, '\n', buf + *len - line))) {
+        *newline = '\0';
+        zygote_command(line);
+        line = newline + 1;
+    }
+    *len -= (size_t)(line - buf);
+    memmove(buf, line, *len);
+    // A line longer than any command is dropped
+    if (*len == size - 1) *len = 0;
+    return 1;
+}
+
+// {"cmd":"kill","pid":N} - kills a child that is stuck, only if it is one of the zygote's
+static void zygote_command(const char *line) {
+    json_object *root = json_tokener_parse(line);
+    json_object *cmd, *pid;
+    const char *name = root && json_object_object_get_ex(root, "cmd", &cmd) ? json_object_get_string(cmd) : NULL;
+
+    if (name && strcmp(name, "kill") == 0 && json_object_object_get_ex(root, "pid", &pid)) {
+        pid_t child = (pid_t)json_object_get_int(pid);
+        for (size_t i = 0; i < zygote_child_count; i++) {
+            if (zygote_children[i] == child) {
+                kill(child, SIGKILL);
+                break;
+            }
+        }
+    }
+    json_object_put(root);
+}
+
+static void reap_zygote_children(void) {
+    pid_t pid;
+    while ((pid = waitpid(-1, NULL, WNOHANG)) > 0) {
+        for (size_t i = 0; i < zygote_child_count; i++) {
+            if (zygote_children[i] == pid) {
+                zygote_children[i] = zygote_children[--zygote_child_count];
+                break;
+            }
+        }
+    }
+}
+
+static void on_zygote_sighup(int sig) {
+    (void)sig;
+    zygote_reload = 1;
+}
+
+static void on_zygote_sigchld(int sig) {
+    (void)sig;
+    zygote_child_exited = 1;
+}
+
+// Line protocol: a JSON array of requests per line, JSON arrays of results back as they are ready
+static void serve_json(FILE *in, FILE *out, arena_t *arena) {
+    // Ready signal
+    fprintf(out, "%s\n", ready_message);
+    fflush(out);
+
     char *line = NULL;
     size_t len = 0;
     ssize_t read;
 
     // Waiting for JSON req
-    while((read = getline(&line, &len, stdin)) != -1){
+    while((read = getline(&line, &len, in)) != -1){
 
         if (read > 0 && line[read - 1] == '\n'){
             line[read - 1] = '\0';
             read--;
         }
 
-        if (read > 0) {
+        if (read > 0 && line[0] == '{') {
+            handle_command(line, out, arena);
+        } else if (read > 0) {
             size_t requests_len = 0;
-            request_t *requests = parse_input(line, &requests_len);
+            uint64_t begin = stats_now_ns();
+            request_t *requests = parse_input(line, &requests_len, arena);
+            stats_record_parse(stats_now_ns() - begin);
             // fprintf(stderr, "Analyzing %zu requests", requests_len);
 
             if (requests) {
-                char *result = process_requests(requests, requests_len);
-                if (result) {
-                    fprintf(stdout, "%s\n", result);
-                    free(result);
-                }
-
-                // Free
-                for (int i = 0; i < requests_len; i++) {
-                    free(requests[i].id);
-                    free(requests[i].url);
-                    free(requests[i].headers);
-                    free(requests[i].body);
-                }
-                free(requests);
+                process_requests(requests, requests_len, out, arena, NULL);
             }
         }
 
-        if (line) {
+        arena_reset(arena);
+
+        // The line buffer is reused, unless a huge batch made it grow
+        if (len > LINE_MAX_RETAINED) {
             free(line);
             line = NULL;
             len = 0;
         }
     }
 
-    cleanup_regex_patterns();
-    return 0;
+    free(line);
+}
+
+// Framed protocol (see binary-protocol.h): a FRAME_BATCH in, FRAME_BATCHes of verdicts back
+static void serve_binary(FILE *in, FILE *out, arena_t *arena) {
+    if (!write_control_frame(out, ready_message)) return;
+
+    // Bodies of FRAME_BATCH_SHM frames, attached on the proxy's request
+    shm_ring_t ring = { 0 };
+    // Rule ids in verdicts refer to the last rules table sent on this stream
+    unsigned announced_generation = 0;
+    // Request bodies streamed in chunks, each with its own verdict
+    stream_table_t streams;
+    stream_table_init(&streams);
+
+    uint8_t type;
+    const uint8_t *payload;
+    uint32_t payload_len;
+    int status;
+
+    while ((status = read_frame(in, arena, &type, &payload, &payload_len)) > 0) {
+        if (type == FRAME_BATCH || type == FRAME_BATCH_SHM) {
+            size_t requests_len = 0;
+            uint64_t begin = stats_now_ns();
+            request_t *requests = parse_batch_frame(type, payload, payload_len, &ring, &requests_len, arena);
+            stats_record_parse(stats_now_ns() - begin);
+
+            if (requests) {
+                process_requests(requests, requests_len, out, arena, &announced_generation);
+            } else {
+                fprintf(stderr, "{\"error\":\"Malformed batch frame\"}\n");
+            }
+        } else if (type == FRAME_CONTROL) {
+            handle_control((const char *)payload, payload_len, out, &ring, arena);
+        } else if (type == FRAME_STREAM_BEGIN || type == FRAME_STREAM_CHUNK || type == FRAME_STREAM_END ||
+                   type == FRAME_STREAM_ABORT) {
+            handle_stream_frame(type, payload, payload_len, &streams, out, arena, &announced_generation);
+        } else {
+            fprintf(stderr, "{\"error\":\"Unsupported frame type %u\"}\n", type);
+        }
+
+        arena_reset(arena);
+    }
+
+    // Framing is lost after a broken frame, the proxy reconnects (or respawns the process)
+    if (status < 0) {
+        fprintf(stderr, "{\"error\":\"Broken frame on input\"}\n");
+    }
+
+    stream_table_free(&streams);
+    shm_ring_detach(&ring);
 }
 
-request_t *parse_input(const char *json_input, size_t *out_count) {
+// Chunks are scanned on the connection's thread as they arrive. The verdict goes out after
+// the last chunk, or right away once the stream is an attack.
+static void handle_stream_frame(uint8_t type, const uint8_t *payload, uint32_t len, stream_table_t *streams,
+                                FILE *out, arena_t *arena, unsigned *announced_generation) {
+    uint32_t id;
+
+    // Streams the proxy stopped sending to are closed with an error verdict, before a new one
+    // could find the table full
+    stream_t *idle;
+    uint64_t now = stream_now_ns();
+    while ((idle = stream_find_idle(streams, now))) {
+        write_stream_verdict(out, idle->id, NULL, arena, announced_generation);
+        stream_close(streams, idle);
+    }
+
+    if (type == FRAME_STREAM_BEGIN) {
+        uint32_t max_bytes;
+        request_t head = { 0 };
+        if (!parse_stream_begin(payload, len, &id, &max_bytes, &head, arena)) {
+            fprintf(stderr, "{\"error\":\"Malformed stream frame\"}\n");
+            if (len >= 4) write_stream_verdict(out, id, NULL, arena, announced_generation);
+            return;
+        }
+
+        stream_t *stream = stream_begin(streams, id, max_bytes, &head);
+        if (!stream || stream->report.attack) {
+            write_stream_verdict(out, id, stream, arena, announced_generation);
+            if (stream) stream_close(streams, stream);
+        }
+        return;
+    }
+
+    const char *data;
+    uint32_t data_len;
+    if (!parse_stream_frame(payload, len, &id, &data, &data_len)) return;
+
+    // Streams that already have their verdict are closed, their remaining frames are dropped
+    stream_t *stream = stream_find(streams, id);
+    if (!stream) return;
+
+    // The upload was dropped, nobody waits for the verdict
+    if (type == FRAME_STREAM_ABORT) {
+        stream_close(streams, stream);
+        return;
+    }
+
+    int done = type == FRAME_STREAM_CHUNK ? stream_chunk(stream, data, data_len, arena) : 1;
+    if (done) {
+        if (type == FRAME_STREAM_END) stream_end(stream, arena);
+        write_stream_verdict(out, id, stream, arena, announced_generation);
+        stream_close(streams, stream);
+    }
+}
+
+// FRAME_STREAM_VERDICT, VERDICT_ERROR without a stream
+static void write_stream_verdict(FILE *out, uint32_t id, const stream_t *stream, arena_t *arena,
+                                 unsigned *announced_generation) {
+    arena_buf_t buf;
+    if (!arena_buf_init(&buf, arena, 64)) return;
+
+    if (stream) announce_rules(&buf, stream->rules, announced_generation);
+
+    size_t frame = frame_begin(&buf, FRAME_STREAM_VERDICT);
+    if (stream) {
+        append_verdict(&buf, id, &stream->report);
+    } else {
+        append_u32(&buf, id);
+        arena_buf_putc(&buf, VERDICT_ERROR);
+        append_u16(&buf, 0);
+        append_u16(&buf, 0);
+    }
+    frame_end(&buf, frame);
+
+    fwrite(buf.data, 1, buf.len, out);
+    fflush(out);
+}
+
+// Control commands of the binary protocol, the reply goes back as a FRAME_CONTROL
+static void handle_control(const char *text, size_t len, FILE *out, shm_ring_t *ring, arena_t *arena) {
+    json_object *root = json_tokener_parse(arena_strndup(arena, text, len));
+    json_object *cmd_obj;
+    const char *cmd = root && json_object_object_get_ex(root, "cmd", &cmd_obj)
+        ? json_object_get_string(cmd_obj) : "";
+
+    if (strcmp(cmd, "shm_attach") == 0) {
+        json_object *path, *size;
+        int ok = json_object_object_get_ex(root, "path", &path) &&
+                 json_object_object_get_ex(root, "size", &size) &&
+                 shm_ring_attach(ring, json_object_get_string(path), (size_t)json_object_get_int64(size));
+
+        write_control_frame(out, ok ? "{\"status\":\"shm_attached\"}" : "{\"error\":\"shm_attach_failed\"}");
+    } else if (strcmp(cmd, "reload") == 0) {
+        write_control_frame(out, request_reload() ? "{\"status\":\"reload_queued\"}"
+                                                  : "{\"error\":\"reload_unavailable\"}");
+    } else if (strcmp(cmd, "cache_stats") == 0) {
+        char reply[256];
+        stats_format_cache(reply, sizeof(reply));
+        write_control_frame(out, reply);
+    } else if (strcmp(cmd, "stats") == 0) {
+        char *reply = stats_format(arena);
+        write_control_frame(out, reply ? reply : "{\"error\":\"stats_failed\"}");
+    } else {
+        write_control_frame(out, "{\"error\":\"unknown_command\"}");
+    }
+
+    if (root) json_object_put(root);
+}
+
+// Control commands of the line protocol - a JSON object instead of a batch array
+static void handle_command(const char *line, FILE *out, arena_t *arena) {
+    json_object *root = json_tokener_parse(line);
+    json_object *cmd_obj;
+    const char *cmd = root && json_object_object_get_ex(root, "cmd", &cmd_obj)
+        ? json_object_get_string(cmd_obj) : "";
+
+    if (strcmp(cmd, "reload") == 0) {
+        fprintf(out, "%s\n", request_reload() ? "{\"status\":\"reload_queued\"}" : "{\"error\":\"reload_unavailable\"}");
+    } else if (strcmp(cmd, "cache_stats") == 0) {
+        char reply[256];
+        stats_format_cache(reply, sizeof(reply));
+        fprintf(out, "%s\n", reply);
+    } else if (strcmp(cmd, "stats") == 0) {
+        char *reply = stats_format(arena);
+        fprintf(out, "%s\n", reply ? reply : "{\"error\":\"stats_failed\"}");
+    } else {
+        fprintf(out, "{\"error\":\"unknown_command\"}\n");
+    }
+    fflush(out);
+
+    if (root) json_object_put(root);
+}
+
+static void start_reloader(void) {
+    // A full pipe already holds a pending reload - the write end never blocks the signal handler
+    if (pipe(reload_pipe) != 0 || fcntl(reload_pipe[1], F_SETFL, O_NONBLOCK) != 0) {
+        perror("Could not create the reload pipe, reloads are disabled");
+        if (reload_pipe[0] >= 0) close(reload_pipe[0]);
+        if (reload_pipe[1] >= 0) close(reload_pipe[1]);
+        reload_pipe[0] = reload_pipe[1] = -1;
+        return;
+    }
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, reloader_main, NULL) != 0) {
+        fprintf(stderr, "Could not start the rules reloader, reloads are disabled\n");
+        close(reload_pipe[0]);
+        close(reload_pipe[1]);
+        reload_pipe[0] = reload_pipe[1] = -1;
+        return;
+    }
+    pthread_detach(thread);
+
+    // SA_RESTART - a reload signal must not break the blocking reads on stdin
+    struct sigaction action = { .sa_handler = on_sighup, .sa_flags = SA_RESTART };
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGHUP, &action, NULL);
+}
+
+// Returns 0 if reloads are disabled. Async-signal-safe.
+static int request_reload(void) {
+    if (reload_pipe[1] < 0) return 0;
+
+    int saved_errno = errno;
+    ssize_t written = write(reload_pipe[1], "r", 1);
+    int queued = written == 1 || errno == EAGAIN;
+    errno = saved_errno;
+    return queued;
+}
+
+static void on_sighup(int sig) {
+    (void)sig;
+    request_reload();
+}
+
+// Requests that pile up during a reload are served by a single one after it - one read takes
+// every byte written in the meantime
+static void *reloader_main(void *arg) {
+    (void)arg;
+    char pending[64];
+    for (;;) {
+        ssize_t n = read(reload_pipe[0], pending, sizeof(pending));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            perror("Rules reloader stopped, reloads are disabled");
+            return NULL;
+        }
+
+        reload_regex_patterns();
+    }
+    return NULL;
+}
+
+// [{"id":..., "url":..., "headers":..., "body":..., "budget_us":N}, ...] - budget_us (optional) is the
+// time the request has left, counted from here, see BATCH_DEADLINES in binary-protocol.h
+request_t *parse_input(const char *json_input, size_t *out_count, arena_t *arena) {
+    uint64_t received = stats_now_ns();
+
     // Initialize JSON parser, and check is input typeof arr
     json_object *root = json_tokener_parse(json_input);
     if(!root || !json_object_is_type(root, json_type_array)){
@@ -83,7 +753,7 @@ request_t *parse_input(const char *json_input, size_t *out_count) {
 
     // Get the length of array
     size_t len = json_object_array_length(root);
-    request_t *requests = calloc(len, sizeof(request_t));
+    request_t *requests = arena_calloc(arena, len ? len : 1, sizeof(request_t));
     if (!requests) {
         fprintf(stderr, "{\"error\":\"Memory allocation failed\"}\n");
         json_object_put(root);
@@ -103,26 +773,33 @@ request_t *parse_input(const char *json_input, size_t *out_count) {
 
         struct json_object *id_obj;
         if (json_object_object_get_ex(obj, "id", &id_obj)) {
-            const char *raw = json_object_get_string(id_obj);
-            req->id = normalize_str(raw);
+            // Matched back by the proxy, kept as is
+            req->id = arena_strndup(arena, json_object_get_string(id_obj), json_object_get_string_len(id_obj));
         }
 
-        struct json_object *url_obj;
-        if (json_object_object_get_ex(obj, "url", &url_obj)) {
-            const char *raw = json_object_get_string(url_obj);
-            req->url = normalize_str(raw);
+        struct json_object *budget_obj;
+        if (json_object_object_get_ex(obj, "budget_us", &budget_obj)) {
+            int64_t budget = json_object_get_int64(budget_obj);
+            if (budget > 0) req->deadline = received + (uint64_t)budget * 1000;
         }
 
-        struct json_object *headers_obj;
-        if (json_object_object_get_ex(obj, "headers", &headers_obj)) {
-            const char *raw = json_object_get_string(headers_obj);
-            req->headers = normalize_str(raw);
-        }
+        struct json_object *url_obj, *headers_obj, *body_obj;
+        int has_url = json_object_object_get_ex(obj, "url", &url_obj);
+        int has_headers = json_object_object_get_ex(obj, "headers", &headers_obj);
+        int has_body = json_object_object_get_ex(obj, "body", &body_obj);
+
+        const char *url = has_url ? json_object_get_string(url_obj) : NULL;
+        const char *headers = has_headers ? json_object_get_string(headers_obj) : NULL;
+        const char *body = has_body ? json_object_get_string(body_obj) : NULL;
 
-        struct json_object *body_obj;
-        if (json_object_object_get_ex(obj, "body", &body_obj)) {
-            const char *raw = json_object_get_string(body_obj);
-            req->body = normalize_str(raw);
+        size_t url_len = url ? json_object_get_string_len(url_obj) : 0;
+        size_t headers_len = headers ? json_object_get_string_len(headers_obj) : 0;
+        size_t body_len = body ? json_object_get_string_len(body_obj) : 0;
+
+        // Every field is normalized straight into the arena
+        if (!parse_request_fields(req, url, url_len, headers, headers_len, body, body_len, arena)) {
+            fprintf(stderr, "{\"error\":\"Memory allocation failed\"}\n");
+            req->field_count = 0;
         }
     }
 
@@ -131,95 +808,225 @@ request_t *parse_input(const char *json_input, size_t *out_count) {
     return requests;
 }
 
-char *process_requests(request_t *requests, size_t req_count) {
-    struct json_object *jarray = json_object_new_array();
-
-    detection_report_t detection_report;
-    detection_report.count=0;
-    detection_report.items=NULL;
+// Scans a batch and writes the verdicts while it runs, see verdict_writer_t. announced_generation
+// is NULL in the JSON mode; in the binary mode the rules table goes first if the stream has
+// not seen this version of the rules yet.
+void process_requests(request_t *requests, size_t req_count, FILE *out, arena_t *arena,
+                      unsigned *announced_generation) {
+    verdict_writer_t writer = { .out = out, .binary = announced_generation != NULL };
+    batch_t batch = {
+        .requests = requests,
+        .reports = arena_alloc(arena, (req_count ? req_count : 1) * sizeof(detection_report_t)),
+        .items = arena_alloc(arena, (req_count ? req_count : 1) * sizeof(batch_item_t)),
+        .writer = &writer,
+    };
+    size_t initial = writer.binary ? FRAME_HEADER_SIZE + 4 + 16 * req_count : 256 * (req_count + 1);
+    if (!batch.reports || !batch.items || !arena_buf_init(&writer.buf, arena, initial)) return;
 
+    // Findings point into the ruleset, it is held until they are serialized
+    ruleset_t *rules = ruleset_acquire();
+    batch.rules = rules;
+    if (writer.binary) announce_rules(&writer.buf, rules, announced_generation);
 
+    // Smallest first - a large body is scanned after the requests that are quick to answer
     for (size_t i = 0; i < req_count; i++) {
-        analyze_request(&requests[i], &detection_report);
-        char *req_output = generate_result(&detection_report);
+        batch.items[i].index = i;
+        batch.items[i].size = 0;
+        for (size_t f = 0; f < requests[i].field_count; f++) {
+            batch.items[i].size += requests[i].fields[f].value_len;
+        }
+    }
+    qsort(batch.items, req_count, sizeof(batch_item_t), compare_items);
 
-        struct json_object *jobj = json_object_new_object();
+    pthread_mutex_init(&writer.lock, NULL);
+    uint64_t begin = stats_now_ns();
+    thread_pool_run(analysis_pool, req_count, analyze_item, &batch);
+    uint64_t scanned = stats_now_ns();
 
-        if (requests[i].id) {
-            json_object_object_add(jobj, "id", json_object_new_string(requests[i].id));
-        } else {
-            json_object_object_add(jobj, "id", json_object_new_string(""));
-        }
+    // An empty batch still gets its (empty) answer
+    if (!writer.written && !writer.pending) begin_verdicts(&writer);
+    flush_verdicts(&writer);
+    pthread_mutex_destroy(&writer.lock);
 
-        if (req_output) {
-            json_object_object_add(jobj, "result", json_object_new_string(req_output));
-            free(req_output);
-        } else {
-            json_object_object_add(jobj, "result", json_object_new_string(""));
-        }
+    ruleset_release(rules);
+    stats_record_batch(req_count, begin, scanned);
+}
+
+// Rules table as a FRAME_CONTROL, if the stream has not seen this version of the rules yet
+static void announce_rules(arena_buf_t *out, const ruleset_t *rules, unsigned *announced_generation) {
+    if (ruleset_generation(rules) == *announced_generation) return;
+
+    size_t table = frame_begin(out, FRAME_CONTROL);
+    append_rules_table(out, rules);
+    frame_end(out, table);
+    *announced_generation = ruleset_generation(rules);
+}
+
+// {"status":"rules","generation":N,"rules":[[rule id,attack,description],...]}
+static void append_rules_table(arena_buf_t *out, const ruleset_t *rules) {
+    char head[64];
+    int head_len = snprintf(head, sizeof(head), "{\"status\":\"rules\",\"generation\":%u,\"rules\":[",
+                            ruleset_generation(rules));
+    arena_buf_append(out, head, head_len);
 
-        json_object_array_add(jarray, jobj);
-        free(detection_report.items);
-        detection_report.items = NULL;
-        detection_report.count = 0;
+    for (int i = 0; i < ruleset_pattern_count(rules); i++) {
+        const CompiledRegexPattern *pattern = ruleset_pattern(rules, i);
+        char id[16];
+        int id_len = snprintf(id, sizeof(id), "%s[%d,", i > 0 ? "," : "", pattern->rule_id);
+
+        arena_buf_append(out, id, id_len);
+        arena_buf_append_json(out, pattern->attack, strlen(pattern->attack));
+        arena_buf_putc(out, ',');
+        arena_buf_append_json(out, pattern->description, strlen(pattern->description));
+        arena_buf_putc(out, ']');
     }
+    arena_buf_append(out, "]}", 2);
+}
 
-    // Conver JSON array to string
-    const char *json_str = json_object_to_json_string_ext(jarray, JSON_C_TO_STRING_PLAIN);
-    char *output = strdup(json_str); // hard copy
+static void analyze_item(void *ctx, size_t i) {
+    batch_t *batch = ctx;
+    const batch_item_t *item = &batch->items[i];
+    request_t *request = &batch->requests[item->index];
+    detection_report_t *report = &batch->reports[item->index];
+
+    // The verdicts ready so far do not wait for this one, nor do those the other threads
+    // finish while it is scanned
+    int large = item->size >= VERDICT_FLUSH_BYTES;
+    if (large) {
+        pthread_mutex_lock(&batch->writer->lock);
+        flush_verdicts(batch->writer);
+        batch->writer->large++;
+        pthread_mutex_unlock(&batch->writer->lock);
+    }
+
+    report->count = 0;
+    report->score = 0;
+    memset(report->reported, 0, sizeof(report->reported));
+    report->deadline = request->deadline;
+    report->incomplete = 0;
+    memset(report->skipped, 0, sizeof(report->skipped));
+    analyze_request(batch->rules, request, report);
+    report->attack = report_is_attack(batch->rules, report);
+    if (report->incomplete) stats_record_incomplete();
+
+    add_verdict(batch->writer, batch->rules, request, report, large);
+}
 
-    // Free memory
-    json_object_put(jarray);
-    return output;
+static int compare_items(const void *a, const void *b) {
+    size_t size_a = ((const batch_item_t *)a)->size;
+    size_t size_b = ((const batch_item_t *)b)->size;
+    return size_a < size_b ? -1 : size_a > size_b;
 }
 
-void analyze_request(request_t *request, detection_report_t *detection_report){
+// Adds the verdict to the pending ones, they go out once the oldest has waited long enough
+// or right away while a large request is scanned. large - the verdict is of one.
+static void add_verdict(verdict_writer_t *writer, const ruleset_t *rules, const request_t *request,
+                        detection_report_t *report, int large) {
+    pthread_mutex_lock(&writer->lock);
+    if (large) writer->large--;
 
-    if (request->url) {
-        analyze(request->url, "url", detection_report);
-        // Add other functions
+    if (!writer->pending) {
+        begin_verdicts(writer);
+        writer->oldest = stats_now_ns();
     }
+    writer->pending++;
 
-    if (request->headers) {
-        analyze(request->headers, "headers", detection_report);
-        // Add other functions
+    arena_buf_t *out = &writer->buf;
+    if (writer->binary) {
+        append_verdict(out, request->seq, report);
+    } else {
+        // The proxy expects the result as a JSON string
+        arena_buf_t result;
+        if (writer->pending > 1) arena_buf_putc(out, ',');
+        arena_buf_append(out, "{\"id\":", 6);
+        const char *id = request->id ? request->id : "";
+        arena_buf_append_json(out, id, strlen(id));
+        arena_buf_append(out, ",\"result\":", 10);
+        if (arena_buf_init(&result, out->arena, 128)) {
+            generate_result(rules, report, &result);
+            arena_buf_append_json(out, result.data, result.len);
+        } else {
+            arena_buf_append(out, "\"\"", 2);
+        }
+        arena_buf_putc(out, '}');
     }
 
-    if (request->body) {
-        analyze(request->body, "body", detection_report);
-        // Add other functions
+    if (writer->large > 0 || stats_now_ns() - writer->oldest >= VERDICT_MAX_DELAY_NS) flush_verdicts(writer);
+    pthread_mutex_unlock(&writer->lock);
+}
+
+// Opens the FRAME_BATCH (or the JSON array) of the next verdicts
+static void begin_verdicts(verdict_writer_t *writer) {
+    if (writer->binary) {
+        writer->start = frame_begin(&writer->buf, FRAME_BATCH);
+        append_u32(&writer->buf, 0);
+    } else {
+        arena_buf_putc(&writer->buf, '[');
     }
+    writer->open = 1;
 }
 
-char *generate_result(detection_report_t *detection_report) {
-    struct json_object *root = json_object_new_object();
+// Writes out what is pending - under the lock, or once the pool threads are done
+static void flush_verdicts(verdict_writer_t *writer) {
+    if (writer->open) {
+        if (writer->binary) {
+            put_u32(&writer->buf, writer->start + FRAME_HEADER_SIZE, writer->pending);
+            frame_end(&writer->buf, writer->start);
+        } else {
+            arena_buf_append(&writer->buf, "]\n", 2);
+        }
+        writer->open = 0;
+    }
+    if (!writer->buf.len) return;
 
-    if (detection_report->count == 0) {
-        json_object_object_add(root, "status", json_object_new_string("clean"));
-        json_object_object_add(root, "findings", json_object_new_array());
-    } else {
-        json_object_object_add(root, "status", json_object_new_string("attack"));
+    fwrite(writer->buf.data, 1, writer->buf.len, writer->out);
+    fflush(writer->out);
 
-        struct json_object *arr = json_object_new_array();
+    writer->buf.len = 0;
+    writer->pending = 0;
+    writer->written = 1;
+}
 
-        for (size_t i = 0; i < detection_report->count; i++) {
-            struct json_object *item = json_object_new_object();
+void analyze_request(const ruleset_t *rules, request_t *request, detection_report_t *detection_report){
 
-            json_object_object_add(item, "attack",
-                                   json_object_new_string(detection_report->items[i].attack));
-            json_object_object_add(item, "location",
-                                   json_object_new_string(detection_report->items[i].location));
-            json_object_object_add(item, "severity",
-                                   json_object_new_string(detection_report->items[i].description));
+    analyze_fields(rules, request->fields, request->field_count, detection_report);
+    // Add other functions
+}
 
-            json_object_array_add(arr, item);
-        }
+// An incomplete verdict adds "incomplete":true and the categories whose rules all ran
+void generate_result(const ruleset_t *rules, detection_report_t *detection_report, arena_buf_t *out) {
+    // In scoring mode findings below the block threshold come with a clean status
+    char head[64];
+    int head_len = snprintf(head, sizeof(head), "{\"status\":\"%s\",\"score\":%d,\"findings\":[",
+                            detection_report->attack ? "attack" : "clean", detection_report->score);
+    arena_buf_append(out, head, head_len);
+
+    for (size_t i = 0; i < detection_report->count; i++) {
+        const detection_t *item = &detection_report->items[i];
 
-        json_object_object_add(root, "findings", arr);
+        if (i > 0) arena_buf_putc(out, ',');
+        arena_buf_append(out, "{\"attack\":", 10);
+        arena_buf_append_json(out, item->attack, strlen(item->attack));
+        arena_buf_append(out, ",\"location\":", 12);
+        const char *location = location_name(item->location);
+        arena_buf_append_json(out, location, strlen(location));
+        arena_buf_append(out, ",\"severity\":", 12);
+        arena_buf_append_json(out, item->description, strlen(item->description));
+        arena_buf_putc(out, '}');
     }
+    arena_buf_putc(out, ']');
+
+    if (detection_report->incomplete) {
+        const char *categories[MAX_PATTERNS];
+        int count = report_evaluated_categories(rules, detection_report, categories, MAX_PATTERNS);
+
+        arena_buf_append(out, ",\"incomplete\":true,\"evaluated\":[", 32);
+        for (int i = 0; i < count; i++) {
+            if (i > 0) arena_buf_putc(out, ',');
+            arena_buf_append_json(out, categories[i], strlen(categories[i]));
+        }
+        arena_buf_putc(out, ']');
+    }
+    arena_buf_putc(out, '}');
+}
 
-    const char *tmp = json_object_to_json_string_ext(root, JSON_C_TO_STRING_PLAIN);
-    char *output = strdup(tmp);
-    json_object_put(root);
-    return output;
-}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+#define ARENA_ALIGN 16
+#define ALIGN_UP(n) (((n) + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1))
+
+static arena_block_t *new_block(size_t size) {
+    arena_block_t *block = malloc(sizeof(arena_block_t) + size);
+    if (!block) return NULL;
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+void arena_init(arena_t *arena, size_t block_size, size_t max_retained) {
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->block_size = block_size;
+    arena->max_retained = max_retained < block_size ? block_size : max_retained;
+    arena->peak = 0;
+}
+
+void arena_reset(arena_t *arena) {
+    if (!arena->head) return;
+
+    // Free everything past the first block
+    arena_block_t *block = arena->head->next;
+    while (block) {
+        arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head->next = NULL;
+
+    // If the last line did not fit, size the kept block so the next one does (up to a limit)
+    if (arena->peak > arena->head->size && arena->head->size < arena->max_retained) {
+        size_t size = arena->peak < arena->max_retained ? ALIGN_UP(arena->peak) : arena->max_retained;
+        arena_block_t *bigger = new_block(size);
+        if (bigger) {
+            free(arena->head);
+            arena->head = bigger;
+        }
+    }
+
+    arena->head->used = 0;
+    arena->current = arena->head;
+    arena->peak = 0;
+}
+
+void arena_destroy(arena_t *arena) {
+    arena_block_t *block = arena->head;
+    while (block) {
+        arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->peak = 0;
+}
+
+void *arena_alloc(arena_t *arena, size_t size) {
+    size = ALIGN_UP(size ? size : 1);
+
+    arena_block_t *block = arena->current;
+    if (!block || block->size - block->used < size) {
+        // Oversized requests get a block of their own
+        arena_block_t *fresh = new_block(size > arena->block_size ? size : arena->block_size);
+        if (!fresh) return NULL;
+
+        if (block) {
+            block->next = fresh;
+        } else {
+            arena->head = fresh;
+        }
+        arena->current = block = fresh;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += size;
+    arena->peak += size;
+    return ptr;
+}
+
+void *arena_calloc(arena_t *arena, size_t count, size_t size) {
+    if (size && count > SIZE_MAX / size) return NULL;
+
+    void *ptr = arena_alloc(arena, count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+char *arena_strndup(arena_t *arena, const char *src, size_t len) {
+    char *copy = arena_alloc(arena, len + 1);
+    if (!copy) return NULL;
+
+    memcpy(copy, src, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+void *arena_grow(arena_t *arena, void *ptr, size_t old_size, size_t new_size) {
+    if (!ptr) return arena_alloc(arena, new_size);
+    if (new_size <= old_size) return ptr;
+
+    arena_block_t *block = arena->current;
+    size_t old_aligned = ALIGN_UP(old_size ? old_size : 1);
+    size_t new_aligned = ALIGN_UP(new_size);
+
+    // Last allocation of the current block - extend it in place
+    if (block && (char *)ptr + old_aligned == block->data + block->used &&
+        block->used - old_aligned + new_aligned <= block->size) {
+        block->used += new_aligned - old_aligned;
+        arena->peak += new_aligned - old_aligned;
+        return ptr;
+    }
+
+    void *fresh = arena_alloc(arena, new_size);
+    if (!fresh) return NULL;
+    memcpy(fresh, ptr, old_size);
+    return fresh;
+}
+
+int arena_buf_init(arena_buf_t *buf, arena_t *arena, size_t initial) {
+    buf->arena = arena;
+    buf->len = 0;
+    buf->cap = initial ? initial : 64;
+    buf->data = arena_alloc(arena, buf->cap);
+    return buf->data != NULL;
+}
+
+int arena_buf_append(arena_buf_t *buf, const char *src, size_t len) {
+    if (buf->len + len + 1 > buf->cap) {
+        size_t cap = buf->cap * 2;
+        while (cap < buf->len + len + 1) cap *= 2;
+
+        char *data = arena_grow(buf->arena, buf->data, buf->cap, cap);
+        if (!data) return 0;
+        buf->data = data;
+        buf->cap = cap;
+    }
+
+    memcpy(buf->data + buf->len, src, len);
+    buf->len += len;
+    buf->data[buf->len] = '\0';
+    return 1;
+}
+
+int arena_buf_putc(arena_buf_t *buf, char c) {
+    return arena_buf_append(buf, &c, 1);
+}
+
+// Appends str as a quoted JSON string
+int arena_buf_append_json(arena_buf_t *out, const char *str, size_t len) {
+    static const char hex[] = "0123456789abcdef";
+
+    arena_buf_putc(out, '"');
+
+    size_t start = 0;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)str[i];
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+        arena_buf_append(out, str + start, i - start);
+        start = i + 1;
+
+        char esc[6] = {'\\', (char)c, 0, 0, 0, 0};
+        size_t esc_len = 2;
+        switch (c) {
+            case '"': case '\\': break;
+            case '\n': esc[1] = 'n'; break;
+            case '\r': esc[1] = 'r'; break;
+            case '\t': esc[1] = 't'; break;
+            case '\b': esc[1] = 'b'; break;
+            case '\f': esc[1] = 'f'; break;
+            default:
+                esc[1] = 'u'; esc[2] = '0'; esc[3] = '0';
+                esc[4] = hex[c >> 4]; esc[5] = hex[c & 0xF];
+                esc_len = 6;
+        }
+        arena_buf_append(out, esc, esc_len);
+    }
+    arena_buf_append(out, str + start, len - start);
+
+    return arena_buf_putc(out, '"');
+}
@@ -0,0 +1,49 @@
+#ifndef ARENA
+#define ARENA
+
+#include <stddef.h>
+
+// Bump allocator for everything that lives as long as one stdin line.
+// Allocations are never freed one by one - arena_reset() drops them all.
+
+typedef struct arena_block {
+    struct arena_block *next;
+    size_t size;
+    size_t used;
+    char data[];
+} arena_block_t;
+
+typedef struct {
+    arena_block_t *head;     // First block, kept across resets
+    arena_block_t *current;
+    size_t block_size;       // Default size of a new block
+    size_t max_retained;     // Upper bound for the block kept after a reset
+    size_t peak;             // Bytes handed out since the last reset
+} arena_t;
+
+// Growable byte buffer inside an arena, appends extend it in place when possible
+typedef struct {
+    arena_t *arena;
+    char *data;
+    size_t len;
+    size_t cap;
+} arena_buf_t;
+
+void arena_init(arena_t *arena, size_t block_size, size_t max_retained);
+void arena_reset(arena_t *arena);
+void arena_destroy(arena_t *arena);
+
+void *arena_alloc(arena_t *arena, size_t size);
+void *arena_calloc(arena_t *arena, size_t count, size_t size);
+char *arena_strndup(arena_t *arena, const char *src, size_t len);
+
+// Resizes the most recent allocation in place if it fits, otherwise copies it
+void *arena_grow(arena_t *arena, void *ptr, size_t old_size, size_t new_size);
+
+int arena_buf_init(arena_buf_t *buf, arena_t *arena, size_t initial);
+int arena_buf_append(arena_buf_t *buf, const char *src, size_t len);
+int arena_buf_putc(arena_buf_t *buf, char c);
+// Appends str as a quoted JSON string
+int arena_buf_append_json(arena_buf_t *buf, const char *str, size_t len);
+
+#endif
@@ -0,0 +1,200 @@
+#include <string.h>
+
+#include "binary-protocol.h"
+#include "request-parser.h"
+#include "stats.h"
+
+typedef struct {
+    const uint8_t *data;
+    uint32_t len;
+    uint32_t pos;
+} reader_t;
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int read_u32(reader_t *r, uint32_t *value) {
+    if (r->len - r->pos < 4) return 0;
+    *value = get_u32(r->data + r->pos);
+    r->pos += 4;
+    return 1;
+}
+
+// Length-prefixed field, points into the payload
+static int read_field(reader_t *r, const char **field, uint32_t *field_len) {
+    if (!read_u32(r, field_len) || r->len - r->pos < *field_len) return 0;
+    *field = (const char *)(r->data + r->pos);
+    r->pos += *field_len;
+    return 1;
+}
+
+// Body of a FRAME_BATCH_SHM request, either inline or a slice of the ring
+static int read_body(reader_t *r, const shm_ring_t *ring, const char **body, uint32_t *body_len) {
+    if (r->pos == r->len) return 0;
+    uint8_t kind = r->data[r->pos++];
+
+    if (kind == BODY_INLINE) return read_field(r, body, body_len);
+    if (kind != BODY_SHM) return 0;
+
+    uint32_t offset;
+    if (!read_u32(r, &offset) || !read_u32(r, body_len)) return 0;
+    *body = shm_ring_slice(ring, offset, *body_len);
+    return *body != NULL;
+}
+
+int read_frame(FILE *in, arena_t *arena, uint8_t *type, const uint8_t **payload, uint32_t *len) {
+    uint8_t header[FRAME_HEADER_SIZE];
+
+    size_t got = fread(header, 1, FRAME_HEADER_SIZE, in);
+    if (got == 0 && feof(in)) return 0;
+    if (got != FRAME_HEADER_SIZE) return -1;
+
+    *len = get_u32(header);
+    *type = header[4];
+    if (*len > FRAME_MAX_PAYLOAD) return -1;
+
+    uint8_t *data = arena_alloc(arena, *len ? *len : 1);
+    if (!data) return -1;
+    if (fread(data, 1, *len, in) != *len) return -1;
+
+    *payload = data;
+    return 1;
+}
+
+request_t *parse_batch_frame(uint8_t type, const uint8_t *payload, uint32_t len, const shm_ring_t *ring,
+                             size_t *out_count, arena_t *arena) {
+    reader_t r = { payload, len, 0 };
+    uint64_t received = stats_now_ns();
+    uint32_t count;
+
+    *out_count = 0;
+    if (!read_u32(&r, &count)) return NULL;
+    int deadlines = (count & BATCH_DEADLINES) != 0;
+    count &= ~BATCH_DEADLINES;
+    // Every request takes at least 16 bytes, which also bounds the allocation below
+    if (count > (len - r.pos) / 16) return NULL;
+
+    request_t *requests = arena_calloc(arena, count ? count : 1, sizeof(request_t));
+    if (!requests) return NULL;
+
+    for (uint32_t i = 0; i < count; i++) {
+        request_t *req = &requests[i];
+        const char *url, *headers, *body;
+        uint32_t url_len, headers_len, body_len, budget = 0;
+
+        if (!read_u32(&r, &req->seq) ||
+            (deadlines && !read_u32(&r, &budget)) ||
+            !read_field(&r, &url, &url_len) ||
+            !read_field(&r, &headers, &headers_len) ||
+            !(type == FRAME_BATCH_SHM ? read_body(&r, ring, &body, &body_len)
+                                      : read_field(&r, &body, &body_len))) {
+            return NULL;
+        }
+        req->deadline = budget ? received + budget * 1000ULL : 0;
+
+        // Same fields as in the JSON mode
+        if (!parse_request_fields(req, url, url_len, headers, headers_len, body, body_len, arena)) return NULL;
+    }
+
+    if (r.pos != r.len) return NULL;
+
+    *out_count = count;
+    return requests;
+}
+
+int parse_stream_begin(const uint8_t *payload, uint32_t len, uint32_t *id, uint32_t *max_bytes,
+                       request_t *head, arena_t *arena) {
+    reader_t r = { payload, len, 0 };
+    const char *url, *headers;
+    uint32_t url_len, headers_len;
+
+    if (!read_u32(&r, id) || !read_u32(&r, max_bytes) ||
+        !read_field(&r, &url, &url_len) || !read_field(&r, &headers, &headers_len) || r.pos != r.len) {
+        return 0;
+    }
+
+    head->seq = *id;
+    return parse_request_fields(head, url, url_len, headers, headers_len, NULL, 0, arena);
+}
+
+int parse_stream_frame(const uint8_t *payload, uint32_t len, uint32_t *id, const char **data, uint32_t *data_len) {
+    reader_t r = { payload, len, 0 };
+    if (!read_u32(&r, id)) return 0;
+
+    *data = (const char *)(payload + r.pos);
+    *data_len = len - r.pos;
+    return 1;
+}
+
+size_t frame_begin(arena_buf_t *out, uint8_t type) {
+    size_t start = out->len;
+    char header[FRAME_HEADER_SIZE] = { 0, 0, 0, 0, (char)type };
+    arena_buf_append(out, header, FRAME_HEADER_SIZE);
+    return start;
+}
+
+void frame_end(arena_buf_t *out, size_t start) {
+    uint32_t len = (uint32_t)(out->len - start - FRAME_HEADER_SIZE);
+    uint8_t *p = (uint8_t *)out->data + start;
+    p[0] = len & 0xFF;
+    p[1] = (len >> 8) & 0xFF;
+    p[2] = (len >> 16) & 0xFF;
+    p[3] = (len >> 24) & 0xFF;
+}
+
+void append_u16(arena_buf_t *out, uint16_t value) {
+    char bytes[2] = { (char)(value & 0xFF), (char)(value >> 8) };
+    arena_buf_append(out, bytes, 2);
+}
+
+void append_u32(arena_buf_t *out, uint32_t value) {
+    char bytes[4] = {
+        (char)(value & 0xFF), (char)((value >> 8) & 0xFF),
+        (char)((value >> 16) & 0xFF), (char)((value >> 24) & 0xFF)
+    };
+    arena_buf_append(out, bytes, 4);
+}
+
+void put_u32(arena_buf_t *out, size_t offset, uint32_t value) {
+    uint8_t *p = (uint8_t *)out->data + offset;
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+void append_verdict(arena_buf_t *out, uint32_t id, const detection_report_t *report) {
+    append_u32(out, id);
+    arena_buf_putc(out, (char)((report->attack ? VERDICT_ATTACK : VERDICT_CLEAN) |
+                               (report->incomplete ? VERDICT_INCOMPLETE : 0)));
+    append_u16(out, (uint16_t)(report->score > UINT16_MAX ? UINT16_MAX : report->score));
+    append_u16(out, (uint16_t)report->count);
+
+    for (size_t i = 0; i < report->count; i++) {
+        append_u16(out, (uint16_t)report->items[i].rule_id);
+        arena_buf_putc(out, (char)report->items[i].location);
+    }
+    if (!report->incomplete) return;
+
+    // Rules that did not run, the proxy knows their categories from the rules table
+    int skipped = 0;
+    for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+        skipped += __builtin_popcountll(report->skipped[w]);
+    }
+    append_u16(out, (uint16_t)skipped);
+    for (int id = 0; id < MAX_PATTERNS; id++) {
+        if (report->skipped[id >> 6] >> (id & 63) & 1) append_u16(out, (uint16_t)id);
+    }
+}
+
+int write_control_frame(FILE *out, const char *text) {
+    size_t len = strlen(text);
+    uint8_t header[FRAME_HEADER_SIZE] = {
+        len & 0xFF, (len >> 8) & 0xFF, (len >> 16) & 0xFF, (len >> 24) & 0xFF, FRAME_CONTROL
+    };
+
+    if (fwrite(header, 1, FRAME_HEADER_SIZE, out) != FRAME_HEADER_SIZE) return 0;
+    if (fwrite(text, 1, len, out) != len) return 0;
+    return fflush(out) == 0;
+}
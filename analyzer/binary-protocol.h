@@ -0,0 +1,109 @@
+#ifndef BINARY_PROTOCOL
+#define BINARY_PROTOCOL
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "models.h"
+#include "arena.h"
+#include "shm-ring.h"
+
+// Framed binary protocol, selected with --binary. All integers are little-endian.
+//
+// Frame:   u32 payload length | u8 type | payload
+//
+// FRAME_BATCH, proxy -> analyzer:
+//          u32 count, per request: u32 id | u32 len, url | u32 len, headers | u32 len, body
+//          With BATCH_DEADLINES set in the count, every id is followed by u32 budget: the
+//          microseconds the request has left (0 - no deadline), counted from when the analyzer
+//          reads the frame. A scan that runs out of it stops, the verdict is incomplete.
+// FRAME_BATCH, analyzer -> proxy:
+//          u32 count, per request: u32 id | u8 status | u16 score | u16 findings,
+//          per finding: u16 rule id (index in the rules file) | u8 location (location_t)
+//          With VERDICT_INCOMPLETE set in the status: u16 count | u16 rule id per rule that
+//          did not run on some part of the request
+//          The verdicts of one request batch can come in several frames, in any order - they
+//          are sent as they are ready. The proxy may send the next batch before they arrive,
+//          batches are scanned one after the other in the order they came.
+// FRAME_BATCH_SHM, proxy -> analyzer:
+//          as FRAME_BATCH, but the body is u8 kind followed by
+//          BODY_INLINE: u32 len, body | BODY_SHM: u32 offset, u32 len (a slice of the shared ring)
+//          The verdicts come back in a regular FRAME_BATCH.
+// FRAME_CONTROL, both directions:
+//          JSON text, e.g. the {"status":"ready"} signal or
+//          {"cmd":"shm_attach","path":...,"size":...} -> {"status":"shm_attached"},
+//          {"cmd":"reload"} -> {"status":"reload_queued"},
+//          {"cmd":"cache_stats"} -> {"status":"cache_stats","hits":N,"misses":N,...},
+//          {"cmd":"stats"} -> {"status":"stats",...} (see stats_format() in stats.c). Before the first verdicts on a
+//          new version of the rules: {"status":"rules","generation":N,"rules":[[id,attack,description],...]}
+//
+// Streamed bodies (see stream.h), proxy -> analyzer:
+// FRAME_STREAM_BEGIN:  u32 stream id | u32 max body bytes to inspect (0 - default) | u32 len, url | u32 len, headers
+// FRAME_STREAM_CHUNK:  u32 stream id | body bytes (the rest of the payload)
+// FRAME_STREAM_END:    u32 stream id
+// FRAME_STREAM_ABORT:  u32 stream id - the client dropped the upload, the stream is closed
+//                      without a verdict
+// FRAME_STREAM_VERDICT, analyzer -> proxy:
+//          one verdict as in FRAME_BATCH, the id is the stream id. Sent after FRAME_STREAM_END,
+//          or as soon as the stream is an attack - the stream is closed then and its later
+//          frames are ignored. VERDICT_ERROR if the stream could not be opened, or if it was
+//          closed after STREAM_IDLE_TIMEOUT_NS without a frame.
+
+#define FRAME_HEADER_SIZE 5
+#define FRAME_BATCH 1
+#define FRAME_CONTROL 2
+#define FRAME_BATCH_SHM 3
+#define FRAME_STREAM_BEGIN 4
+#define FRAME_STREAM_CHUNK 5
+#define FRAME_STREAM_END 6
+#define FRAME_STREAM_VERDICT 7
+#define FRAME_STREAM_ABORT 8
+
+#define BODY_INLINE 0
+#define BODY_SHM 1
+
+// Frames above this size are treated as a broken stream
+#define FRAME_MAX_PAYLOAD (256u * 1024 * 1024)
+
+#define VERDICT_CLEAN 0
+#define VERDICT_ATTACK 1
+#define VERDICT_ERROR 2
+// Flag on VERDICT_CLEAN / VERDICT_ATTACK - the deadline passed before every rule ran
+#define VERDICT_INCOMPLETE 0x80
+
+// Flag on the count of a FRAME_BATCH / FRAME_BATCH_SHM request - every request carries a budget
+#define BATCH_DEADLINES 0x80000000u
+
+// Reads one frame, its payload is allocated in the arena.
+// Returns 1 on success, 0 on a clean EOF and -1 on a truncated or oversized frame.
+int read_frame(FILE *in, arena_t *arena, uint8_t *type, const uint8_t **payload, uint32_t *len);
+
+// Splits a FRAME_BATCH or FRAME_BATCH_SHM payload into requests, every field is normalized
+// into the arena (ring slices are read in place). Returns NULL if the payload is malformed.
+request_t *parse_batch_frame(uint8_t type, const uint8_t *payload, uint32_t len, const shm_ring_t *ring,
+                             size_t *out_count, arena_t *arena);
+
+// FRAME_STREAM_BEGIN payload -> stream id, inspection limit and the head of the request
+// (url and headers as fields). Returns 0 if the payload is malformed.
+int parse_stream_begin(const uint8_t *payload, uint32_t len, uint32_t *id, uint32_t *max_bytes,
+                       request_t *head, arena_t *arena);
+// FRAME_STREAM_CHUNK / FRAME_STREAM_END / FRAME_STREAM_ABORT payload -> stream id and the data after it
+int parse_stream_frame(const uint8_t *payload, uint32_t len, uint32_t *id, const char **data, uint32_t *data_len);
+
+// Reserves the frame header, frame_end() fills it in once the payload is written
+size_t frame_begin(arena_buf_t *out, uint8_t type);
+void frame_end(arena_buf_t *out, size_t start);
+
+void append_u16(arena_buf_t *out, uint16_t value);
+void append_u32(arena_buf_t *out, uint32_t value);
+// Overwrites 4 bytes at offset, for a count known only after the items are written
+void put_u32(arena_buf_t *out, size_t offset, uint32_t value);
+
+// Appends the verdict of one request to a FRAME_BATCH payload
+void append_verdict(arena_buf_t *out, uint32_t id, const detection_report_t *report);
+
+// Writes text as a single FRAME_CONTROL frame
+int write_control_frame(FILE *out, const char *text);
+
+#endif
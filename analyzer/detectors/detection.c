@@ -1,50 +1,360 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <strings.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "detection.h"
+#include "fingerprint.h"
 #include "html-decoder.h"
+#include "transforms.h"
+#include "simd.h"
+#include "aho-corasick.h"
+#include "verdict-cache.h"
 
+// Shortest literal the prefilter extracts from a pattern
+#define PREFILTER_MIN_ATOM_LEN 1
+// "Any of these literals" clauses kept per rule, all of them must hold for the rule to run
+#define PREFILTER_MAX_CLAUSES 2
+#define MAX_CLAUSES (MAX_PATTERNS * PREFILTER_MAX_CLAUSES)
+// Up to this many candidates are matched one by one, above it the set is cheaper
+#define PREFILTER_DIRECT_MAX 2
+// Scoring mode: one by one, in the adaptive order, the scan can stop at the block threshold
+#define SCORING_DIRECT_MAX 8
+// Transform stage buffer of a thread above this size is released
+#define SCRATCH_MAX_RETAINED (1024 * 1024)
+// Rule evaluations between two recomputations of the adaptive order
+#define REORDER_INTERVAL 4096
+// Distinct transform stages of a ruleset ("transforms" of the rules, common prefixes shared)
+#define MAX_TRANSFORM_CHAINS 32
 
-CompiledRegexPattern compiled_patterns[128];
+// How far an input got in analyze()
+#define SCAN_PREFILTERED 0  // No rule of the location can match, RE2 did not run
+#define SCAN_SET 1          // One RE2::Set pass over the candidates
+#define SCAN_DIRECT 2       // The candidates one by one
+#define SCAN_EXPIRED 3      // The deadline of the request passed before the rules ran
 
-static int patterns_initialized = 0;
-static int pattern_count = 0;
+typedef struct {
+    uint64_t bits[MAX_PATTERNS / 64];
+} rule_mask_t;
 
+typedef struct {
+    uint64_t bits[MAX_CLAUSES / 64];
+} clause_mask_t;
+
+// Stage of a transform chain - the text of the parent stage put through one transform
+typedef struct {
+    int parent;
+    transform_t transform;
+} transform_stage_t;
+
+// Texts of the transform chains during one scan, each computed on first use. Stages that
+// change nothing point at their parent's text.
+typedef struct {
+    const char *text[MAX_TRANSFORM_CHAINS];
+    size_t len[MAX_TRANSFORM_CHAINS];
+    uint32_t computed;          // Bit per stage
+    uint32_t filtered;          // Bit per stage whose prefilter result is in candidates
+    rule_mask_t candidates[MAX_TRANSFORM_CHAINS];
+} transform_memo_t;
+
+// Everything compiled from one version of the rules file. Immutable once published -
+// a reload builds a new ruleset and swaps the pointer, batches that already hold the
+// old one finish on it and the last release frees it. The runtime statistics and the
+// rule order derived from them are the only parts written afterwards.
+struct ruleset {
+    CompiledRegexPattern patterns[MAX_PATTERNS];
+    int pattern_count;
+    unsigned generation;
+    int refs;   // Guarded by rules_lock
+
+    // Scoring mode: findings add their severity, the scan stops once the score reaches
+    // the threshold and only then is the request an attack. 0 - every rule runs, any hit blocks.
+    int block_threshold;
+    // Counted since the rules were loaded, the stats command reads them
+    rule_stats_t rule_stats[MAX_PATTERNS][LOCATION_COUNT];
+    location_stats_t location_stats[LOCATION_COUNT];
+    // Adaptive order - cheap, high-yield rules first. Double buffered, order_current
+    // selects the published one.
+    int order[2][MAX_PATTERNS];
+    int order_current;
+    int reordering;
+    uint64_t order_clock;
+
+    // Rules that run on a location ("locations" of the rule, default all of them) and
+    // one RE2::Set of those rules per location. Locations with the same rules share a set.
+    rule_mask_t location_rules[LOCATION_COUNT];
+    re2_set_t *location_sets[LOCATION_COUNT];
+    int set_rules[LOCATION_COUNT][MAX_PATTERNS];    // index in the set -> index in patterns
+    // Rules limited to some header / parameter names ("fields")
+    rule_mask_t field_rules;
+    // Lexical detectors ("detector" instead of "pattern") per location, they run ahead of
+    // the regex rules. Those with "replaces" stand in for the regex rules of their category.
+    rule_mask_t location_detectors[LOCATION_COUNT];
+    rule_mask_t replacing_detectors;
+    // Transform chains ("transforms") as a trie of stages. Stage 0 is the normalized input,
+    // every rule runs on it. A rule with transforms also runs on the text of the stage its
+    // chain ends at - a transform only adds matches, it never hides what the input shows.
+    transform_stage_t chains[MAX_TRANSFORM_CHAINS];
+    int chain_count;
+    rule_mask_t chain_rules[MAX_TRANSFORM_CHAINS];  // stage -> rules that run on its text
+    // Bytes the stages start their work on (transform_trigger()), count -1 if there are more
+    // than simd_find_any() looks for
+    char chain_triggers[4];
+    int chain_trigger_count;
+
+    // RE2 options of the rules and of the location sets ("re2" in the rules file)
+    re2_options_t pattern_options;
+    re2_options_t set_options;
+
+    // Headers nobody attacks through, never inspected ("header_skip")
+    char **header_skip;
+    int header_skip_count;
+
+    // Literal prefilter - one Aho-Corasick pass tells which rules can possibly match.
+    // Every rule is reduced to clauses ("at least one of these literals is present"),
+    // taken from the rule's "keywords" or extracted from the pattern at load time.
+    ac_automaton_t *literal_matcher;
+    clause_mask_t *literal_clauses;             // literal id -> clauses it satisfies
+    clause_mask_t rule_clauses[MAX_PATTERNS];   // clauses a rule requires
+    rule_mask_t unfiltered_rules;               // rules without required literals
+    int clause_count;
+};
+
+static const char *rules_path = DEFAULT_RULES_PATH;
+
+// Texts of the transform stages, one buffer per stage and thread - analysis runs on the pool
+// threads, without an arena
+static __thread char *transform_buffers[MAX_TRANSFORM_CHAINS];
+static __thread size_t transform_buffer_sizes[MAX_TRANSFORM_CHAINS];
+
+// The published ruleset. Readers take a reference under the lock, which is held
+// only for the pointer load and the increment.
+static ruleset_t *current_rules = NULL;
+static unsigned last_generation = 0;
+static pthread_mutex_t rules_lock = PTHREAD_MUTEX_INITIALIZER;
+// Serializes reloads (SIGHUP and control messages can ask at the same time)
+static pthread_mutex_t reload_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static ruleset_t *load_ruleset(const char *path);
+static void free_ruleset(ruleset_t *rules);
+static void publish_ruleset(ruleset_t *rules);
+static int build_location_sets(ruleset_t *rules);
+static re2_set_t *build_pattern_set(ruleset_t *rules, const rule_mask_t *members, int *set_rules);
+static unsigned parse_locations(struct json_object *rule, const char *pattern);
+static void parse_regex_options(struct json_object *root, re2_options_t *pattern_options, re2_options_t *set_options);
+static void strip_wildcards(char *pattern);
+static int rule_applies_to_field(const CompiledRegexPattern *pattern, const char *field);
+static void add_detector(ruleset_t *rules, struct json_object *rule, int i);
+static void replace_regex_rules(ruleset_t *rules);
+static int parse_transforms(ruleset_t *rules, struct json_object *rule, const char *pattern);
+static int transformed_text(const ruleset_t *rules, transform_memo_t *memo, int chain, location_t location);
+static void add_chain_triggers(ruleset_t *rules, const char *trigger);
+static const rule_mask_t *stage_candidates(const ruleset_t *rules, transform_memo_t *memo, int chain);
+static void release_transform_buffers(void);
+static int run_detectors(const ruleset_t *rules, transform_memo_t *memo, location_t location,
+                         detection_report_t *findings);
+static int build_prefilter(ruleset_t *rules);
+static int extract_clauses(ruleset_t *rules, int rule);
+static int add_clause(ruleset_t *rules, int rule, const char **literals, int count);
+static void free_prefilter(ruleset_t *rules);
+static int prefilter_candidates(const ruleset_t *rules, const char *input, size_t len, rule_mask_t *candidates);
+static char **parse_string_list(struct json_object *object, const char *key, int *out_count);
+static void free_string_list(char **list, int count);
+static void add_finding(detection_report_t *findings, const ruleset_t *rules, int i, location_t location);
+static void analyze_cached(const ruleset_t *rules, const char *text, size_t len, location_t location,
+                           detection_report_t *findings);
+static void sort_ids(int *ids, int count);
+static void analyze_scored(const ruleset_t *rules, const char *input, size_t len, rule_mask_t *candidates,
+                           location_t location, detection_report_t *findings);
+static int evaluate_scored(ruleset_t *rules, int i, const char *input, size_t len, location_t location,
+                           detection_report_t *findings);
+static void reorder_rules(ruleset_t *rules);
+static int evaluate_rule(const ruleset_t *rules, int i, const char *input, size_t len, location_t location);
+static int scan_input(const ruleset_t *rules, const char *input, size_t len, location_t location,
+                      const char *field, detection_report_t *findings);
+static int scan_chain(const ruleset_t *rules, transform_memo_t *memo, int chain, location_t location,
+                      const char *field, detection_report_t *findings);
+static int deadline_passed(const detection_report_t *findings);
+static void skip_rules(const ruleset_t *rules, const rule_mask_t *left, const char *field,
+                       detection_report_t *findings);
+
+static inline int mask_test(const rule_mask_t *mask, int id) {
+    return (mask->bits[id >> 6] >> (id & 63)) & 1;
+}
+
+static inline void mask_set(rule_mask_t *mask, int id) {
+    mask->bits[id >> 6] |= 1ULL << (id & 63);
+}
+
+static inline void mask_clear(rule_mask_t *mask, int id) {
+    mask->bits[id >> 6] &= ~(1ULL << (id & 63));
+}
+
+static inline int mask_count(const rule_mask_t *mask) {
+    int count = 0;
+    for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+        count += __builtin_popcountll(mask->bits[w]);
+    }
+    return count;
+}
+
+
+void set_rules_path(const char *path) {
+    rules_path = path;
+}
 
 int init_regex_patterns() {
-    if (patterns_initialized) {
+    pthread_mutex_lock(&rules_lock);
+    int initialized = current_rules != NULL;
+    pthread_mutex_unlock(&rules_lock);
+    if (initialized) {
         return 1;
     }
-    
-    pattern_count = 0;
 
-    char* json_data = read_file("proxy/rules/regex_patterns.json");
+    ruleset_t *rules = load_ruleset(rules_path);
+    int ok = rules != NULL;
+
+    // Without a rules file the analyzer still runs, with nothing to match
+    if (!rules) {
+        rules = calloc(1, sizeof(ruleset_t));
+        if (!rules) return 0;
+        rules->generation = ++last_generation;
+    }
+
+    publish_ruleset(rules);
+    return ok;
+}
+
+int reload_regex_patterns() {
+    pthread_mutex_lock(&reload_lock);
+
+    ruleset_t *rules = load_ruleset(rules_path);
+    if (rules) {
+        fprintf(stderr, "Rules reloaded from %s: %d patterns, generation %u\n",
+                rules_path, rules->pattern_count, rules->generation);
+        publish_ruleset(rules);
+    } else {
+        fprintf(stderr, "Rules reload from %s failed, keeping the current rules\n", rules_path);
+    }
+
+    pthread_mutex_unlock(&reload_lock);
+    return rules != NULL;
+}
+
+void cleanup_regex_patterns() {
+    pthread_mutex_lock(&rules_lock);
+    ruleset_t *rules = current_rules;
+    current_rules = NULL;
+    pthread_mutex_unlock(&rules_lock);
+
+    ruleset_release(rules);
+}
+
+ruleset_t *ruleset_acquire() {
+    pthread_mutex_lock(&rules_lock);
+    ruleset_t *rules = current_rules;
+    if (rules) rules->refs++;
+    pthread_mutex_unlock(&rules_lock);
+    return rules;
+}
+
+void ruleset_release(ruleset_t *rules) {
+    if (!rules) return;
+
+    pthread_mutex_lock(&rules_lock);
+    int last = --rules->refs == 0;
+    pthread_mutex_unlock(&rules_lock);
+
+    if (last) free_ruleset(rules);
+}
+
+unsigned ruleset_generation(const ruleset_t *rules) {
+    return rules ? rules->generation : 0;
+}
+
+int ruleset_block_threshold(const ruleset_t *rules) {
+    return rules ? rules->block_threshold : 0;
+}
+
+const rule_stats_t *ruleset_rule_stats(const ruleset_t *rules, int i, location_t location) {
+    return &rules->rule_stats[i][location];
+}
+
+const location_stats_t *ruleset_location_stats(const ruleset_t *rules, location_t location) {
+    return &rules->location_stats[location];
+}
+
+int ruleset_pattern_count(const ruleset_t *rules) {
+    return rules ? rules->pattern_count : 0;
+}
+
+const CompiledRegexPattern *ruleset_pattern(const ruleset_t *rules, int i) {
+    return &rules->patterns[i];
+}
+
+// The published ruleset holds one reference of its own
+static void publish_ruleset(ruleset_t *rules) {
+    rules->refs = 1;
+
+    pthread_mutex_lock(&rules_lock);
+    ruleset_t *old = current_rules;
+    current_rules = rules;
+    pthread_mutex_unlock(&rules_lock);
+
+    ruleset_release(old);
+}
+
+// Reads and compiles the rules file, NULL if it can not be used
+static ruleset_t *load_ruleset(const char *path) {
+    char* json_data = read_file(path);
     if (!json_data) {
-        fprintf(stderr, "Could not read regex_patterns.json\n");
-        return 0;
+        fprintf(stderr, "Could not read %s\n", path);
+        return NULL;
     }
 
     struct json_object* root = json_tokener_parse(json_data);
     free(json_data);
     if (!root) {
         fprintf(stderr, "JSON parse error\n");
-        return 0;
+        return NULL;
     }
 
-    struct json_object* rules;
-    if (!json_object_object_get_ex(root, "rules", &rules) ||
-        !json_object_is_type(rules, json_type_array)) {
+    struct json_object* rules_json;
+    if (!json_object_object_get_ex(root, "rules", &rules_json) ||
+        !json_object_is_type(rules_json, json_type_array)) {
         fprintf(stderr, "rules is not array\n");
         json_object_put(root);
-        return 0;
+        return NULL;
+    }
+
+    ruleset_t *rules = calloc(1, sizeof(ruleset_t));
+    if (!rules) {
+        json_object_put(root);
+        return NULL;
+    }
+    rules->chain_count = 1;
+
+    parse_regex_options(root, &rules->pattern_options, &rules->set_options);
+
+    int n_rules = json_object_array_length(rules_json);
+    if (n_rules > MAX_PATTERNS) {
+        fprintf(stderr, "Too many rules (%d), only the first %d are loaded\n", n_rules, MAX_PATTERNS);
+        n_rules = MAX_PATTERNS;
     }
 
-    int n_rules = json_object_array_length(rules);
     for (int i = 0; i < n_rules; i++) {
-        struct json_object *rule = json_object_array_get_idx(rules, i);
+        struct json_object *rule = json_object_array_get_idx(rules_json, i);
         struct json_object *pattern, *desc, *severity, *category;
 
+        if (json_object_object_get_ex(rule, "detector", NULL)) {
+            add_detector(rules, rule, i);
+            continue;
+        }
+
         if (json_object_object_get_ex(rule, "pattern", &pattern) &&
             json_object_object_get_ex(rule, "description", &desc) &&
             json_object_object_get_ex(rule, "severity", &severity) &&
@@ -58,74 +368,1108 @@ int init_regex_patterns() {
             // fprintf(stderr, "Pattern: %s\nDesc: %s\nSeverity: %d\nCategory: %s\n\n",
             //        pat, dsc, sev, cat);
 
-            re2_pattern_t* regex = re2_compile(pat);
-        
+            // "literal": true - the pattern is a plain string
+            re2_options_t options = rules->pattern_options;
+            struct json_object *literal;
+            options.literal = json_object_object_get_ex(rule, "literal", &literal) &&
+                              json_object_get_boolean(literal);
+
+            int chain = parse_transforms(rules, rule, pat);
+            if (chain < 0) continue;
+
+            char *source = strdup(pat);
+            if (source && !options.literal) strip_wildcards(source);
+            re2_pattern_t* regex = source ? re2_compile_options(source, &options) : NULL;
+            free(source);
+
             if (regex && re2_is_valid(regex)) {
-                compiled_patterns[pattern_count].compiled_regex = regex;
-                compiled_patterns[pattern_count].description = strdup(dsc);
-                compiled_patterns[pattern_count].attack = strdup(cat); // Attack type
-                compiled_patterns[pattern_count].severity = sev;
-                pattern_count++;
+                CompiledRegexPattern *compiled = &rules->patterns[rules->pattern_count];
+                compiled->compiled_regex = regex;
+                compiled->description = strdup(dsc);
+                compiled->attack = strdup(cat); // Attack type
+                compiled->severity = sev;
+                compiled->rule_id = i;
+                compiled->keywords = parse_string_list(rule, "keywords", &compiled->keyword_count);
+                compiled->locations = parse_locations(rule, pat);
+                compiled->fields = parse_string_list(rule, "fields", &compiled->field_count);
+                compiled->chain = chain;
+
+                for (int l = 0; l < LOCATION_COUNT; l++) {
+                    if (compiled->locations & (1u << l)) mask_set(&rules->location_rules[l], rules->pattern_count);
+                }
+                if (compiled->fields) mask_set(&rules->field_rules, rules->pattern_count);
+                mask_set(&rules->chain_rules[0], rules->pattern_count);
+                mask_set(&rules->chain_rules[chain], rules->pattern_count);
+                rules->pattern_count++;
             } else {
                 fprintf(stderr, "Failed to compile pattern: %s\n", pat);
                 if (regex) re2_free(regex);
             }
-        }        
+        }
+    }
+
+    struct json_object *threshold;
+    if (json_object_object_get_ex(root, "block_threshold", &threshold)) {
+        rules->block_threshold = json_object_get_int(threshold);
     }
-    
+    rules->header_skip = parse_string_list(root, "header_skip", &rules->header_skip_count);
+
     json_object_put(root);
-    patterns_initialized = 1;
-    return 1;
+    replace_regex_rules(rules);
+
+    // Until there are statistics - file order
+    for (int i = 0; i < rules->pattern_count; i++) {
+        rules->order[0][i] = i;
+    }
+
+    if (!build_location_sets(rules)) {
+        fprintf(stderr, "Could not build pattern set, falling back to per-pattern matching\n");
+    }
+
+    if (!build_prefilter(rules)) {
+        fprintf(stderr, "Could not build literal prefilter, every input is scanned\n");
+    }
+
+    pthread_mutex_lock(&rules_lock);
+    rules->generation = ++last_generation;
+    pthread_mutex_unlock(&rules_lock);
+    return rules;
 }
 
-void cleanup_regex_patterns() {
-    if (!patterns_initialized) return;
-    
-    for (int i = 0; i < pattern_count; i++) {
-        if (compiled_patterns[i].compiled_regex) {
-            re2_free(compiled_patterns[i].compiled_regex);
-            compiled_patterns[i].compiled_regex = NULL;
+static void free_ruleset(ruleset_t *rules) {
+    for (int i = 0; i < rules->pattern_count; i++) {
+        CompiledRegexPattern *pattern = &rules->patterns[i];
+
+        re2_free(pattern->compiled_regex);
+        free((void*)pattern->description);
+        free((void*)pattern->attack);
+
+        free_string_list(pattern->keywords, pattern->keyword_count);
+        free_string_list(pattern->fields, pattern->field_count);
+    }
+
+    free_prefilter(rules);
+    free_string_list(rules->header_skip, rules->header_skip_count);
+
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        re2_set_t *set = rules->location_sets[l];
+        if (!set) continue;
+
+        // Shared sets are freed once
+        for (int k = l; k < LOCATION_COUNT; k++) {
+            if (rules->location_sets[k] == set) rules->location_sets[k] = NULL;
+        }
+        re2_set_free(set);
+    }
+    free(rules);
+}
+
+int ruleset_skips_header(const ruleset_t *rules, const char *name) {
+    if (!rules || !name) return 0;
+
+    for (int i = 0; i < rules->header_skip_count; i++) {
+        if (strcmp(rules->header_skip[i], name) == 0) return 1;
+    }
+    return 0;
+}
+
+void analyze_fields(const ruleset_t *rules, const field_t *fields, size_t count, detection_report_t *findings) {
+    if (!rules) return;
+
+    // Every value on its own - a class like \s or [^'] would carry a match from one field
+    // into the next. A rule that hits several fields of a location is still one finding.
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        for (size_t i = 0; i < count; i++) {
+            const field_t *field = &fields[i];
+            if (field->location != (location_t)l) continue;
+            if (field->location == LOCATION_HEADERS && ruleset_skips_header(rules, field->name)) continue;
+
+            analyze_cached(rules, field->value, field->value_len, (location_t)l, findings);
+        }
+    }
+
+    // Rules limited to some fields, on the named fields alone
+    if (mask_count(&rules->field_rules) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            const field_t *field = &fields[i];
+            if (!field->name) continue;
+            if (field->location == LOCATION_HEADERS && ruleset_skips_header(rules, field->name)) continue;
+
+            analyze(rules, field->value, field->value_len, field->location, field->name, findings);
+        }
+    }
+
+    release_transform_buffers();
+}
+
+void analyze(const ruleset_t *rules, const char *input, size_t len, location_t location, const char *field,
+             detection_report_t *findings) {
+
+    if (!rules || !input || len == 0) {
+        return;
+    }
+
+    // Scoring mode - the verdict is already final, the remaining locations are skipped
+    if (rules->block_threshold > 0 && findings->score >= rules->block_threshold) {
+        return;
+    }
+
+    // Out of time - nothing of this location runs
+    if (deadline_passed(findings)) {
+        rule_mask_t left;
+        for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+            left.bits[w] = field ? rules->location_rules[location].bits[w] & rules->field_rules.bits[w]
+                                 : (rules->location_rules[location].bits[w] & ~rules->field_rules.bits[w]) |
+                                   rules->location_detectors[location].bits[w];
+        }
+        skip_rules(rules, &left, field, findings);
+        return;
+    }
+
+    uint64_t begin = stats_now_ns();
+    int outcome = scan_input(rules, input, len, location, field, findings);
+
+    location_stats_t *stats = (location_stats_t *)&rules->location_stats[location];
+    if (outcome == SCAN_PREFILTERED) __atomic_add_fetch(&stats->prefiltered, 1, __ATOMIC_RELAXED);
+    if (outcome == SCAN_SET) __atomic_add_fetch(&stats->set_scans, 1, __ATOMIC_RELAXED);
+    latency_record(&stats->latency, stats_now_ns() - begin);
+}
+
+// The work of analyze(), returns how far the input got (SCAN_*)
+static int scan_input(const ruleset_t *rules, const char *input, size_t len, location_t location,
+                      const char *field, detection_report_t *findings) {
+    transform_memo_t memo;
+    memo.text[0] = input;
+    memo.len[0] = len;
+    memo.computed = 1;
+    memo.filtered = 0;
+
+    // Lexical detectors - one pass each, ahead of the regex rules
+    if (!field && run_detectors(rules, &memo, location, findings)) {
+        return SCAN_DIRECT;
+    }
+
+    int outcome = scan_chain(rules, &memo, 0, location, field, findings);
+
+    // Rules with transforms, each chain computed once for all of its rules and only if
+    // one of them runs here
+    rule_mask_t applicable;
+    for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+        applicable.bits[w] = rules->location_rules[location].bits[w] &
+            (field ? rules->field_rules.bits[w] : ~rules->field_rules.bits[w]);
+    }
+    // No stage changes text without any of their trigger bytes - one pass instead of one per stage
+    if (rules->chain_trigger_count > 0 &&
+        simd_find_any(input, len, rules->chain_triggers, rules->chain_trigger_count) == len) {
+        return outcome;
+    }
+    for (int c = 1; c < rules->chain_count; c++) {
+        if (rules->block_threshold > 0 && findings->score >= rules->block_threshold) break;
+
+        uint64_t any = 0;
+        for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+            any |= rules->chain_rules[c].bits[w] & applicable.bits[w];
+        }
+        if (!any) continue;
+
+        // Out of time - the stage is not computed, its rules are left out
+        if (deadline_passed(findings)) {
+            rule_mask_t left;
+            for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+                left.bits[w] = rules->chain_rules[c].bits[w] & applicable.bits[w];
+            }
+            skip_rules(rules, &left, field, findings);
+            continue;
+        }
+        if (!transformed_text(rules, &memo, c, location)) continue;
+        // Nothing changed - its rules already ran on this text
+        if (memo.text[c] == memo.text[0]) continue;
+
+        int chain_outcome = scan_chain(rules, &memo, c, location, field, findings);
+        if (outcome == SCAN_PREFILTERED) outcome = chain_outcome;
+    }
+    return outcome;
+}
+
+// The rules of one stage, on the text of that stage
+static int scan_chain(const ruleset_t *rules, transform_memo_t *memo, int chain, location_t location,
+                      const char *field, detection_report_t *findings) {
+    const char *input = memo->text[chain];
+    size_t len = memo->len[chain];
+
+    // Only the rules of this stage and location. Without a field name the rules that are
+    // not limited to fields, with one the rules limited to it.
+    rule_mask_t due;
+    for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+        due.bits[w] = rules->chain_rules[chain].bits[w] & rules->location_rules[location].bits[w] &
+            (field ? rules->field_rules.bits[w] : ~rules->field_rules.bits[w]);
+    }
+    if (deadline_passed(findings)) {
+        skip_rules(rules, &due, field, findings);
+        return SCAN_EXPIRED;
+    }
+
+    // Prefilter - inputs without any of the required literals never reach RE2
+    rule_mask_t candidates = *stage_candidates(rules, memo, chain);
+
+    for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+        candidates.bits[w] &= due.bits[w];
+    }
+    if (field) {
+        for (int i = 0; i < rules->pattern_count; i++) {
+            if (mask_test(&candidates, i) && !rule_applies_to_field(&rules->patterns[i], field)) {
+                mask_clear(&candidates, i);
+            }
+        }
+    }
+
+    int candidate_count = mask_count(&candidates);
+    if (candidate_count == 0) {
+        return SCAN_PREFILTERED;
+    }
+
+    if (rules->block_threshold > 0 && candidate_count <= SCORING_DIRECT_MAX) {
+        analyze_scored(rules, input, len, &candidates, location, findings);
+        return SCAN_DIRECT;
+    }
+
+    // Single scan over the input - per-rule work runs only for the rules that hit
+    // Only the set of the input itself - stage texts run rule by rule
+    int hits[MAX_PATTERNS];
+    int hit_count = -1;
+    re2_set_t *set = chain == 0 ? rules->location_sets[location] : NULL;
+    if (set && candidate_count > PREFILTER_DIRECT_MAX) {
+        hit_count = re2_set_match(set, input, len, hits, MAX_PATTERNS);
+    }
+
+    if (hit_count >= 0) {
+        sort_ids(hits, hit_count); // Keep findings in rule order, the set keeps the rules in order
+
+        for (int h = 0; h < hit_count; h++) {
+            int rule = rules->set_rules[location][hits[h]];
+            if (mask_test(&candidates, rule)) {
+                __atomic_add_fetch((uint64_t *)&rules->rule_stats[rule][location].matches, 1, __ATOMIC_RELAXED);
+                add_finding(findings, rules, rule, location);
+            }
+        }
+        return SCAN_SET;
+    }
+
+    // Few candidates, or the set is not available (or its DFA ran out of memory) - scan pattern by pattern
+    for (int i = 0; i < rules->pattern_count; i++) {
+        if (!mask_test(&candidates, i)) continue;
+
+        // Out of time - the candidates that did not run yet are left out
+        if (deadline_passed(findings)) {
+            skip_rules(rules, &candidates, NULL, findings);
+            break;
+        }
+        mask_clear(&candidates, i);
+
+        if (evaluate_rule(rules, i, input, len, location)) {
+            add_finding(findings, rules, i, location);
+            // fprintf(stderr, "✓ MATCH: %s\n", rules->patterns[i].description);
+        }
+    }
+    return SCAN_DIRECT;
+}
+
+// Runs one rule and records its statistics, 1 once the score reached the block threshold
+static int evaluate_scored(ruleset_t *rules, int i, const char *input, size_t len, location_t location,
+                           detection_report_t *findings) {
+    if (!evaluate_rule(rules, i, input, len, location)) return 0;
+
+    add_finding(findings, rules, i, location);
+    return findings->score >= rules->block_threshold;
+}
+
+// One rule on its own, timed
+static int evaluate_rule(const ruleset_t *rules, int i, const char *input, size_t len, location_t location) {
+    const CompiledRegexPattern *pattern = &rules->patterns[i];
+    uint64_t begin = stats_now_ns();
+    int hit = pattern->detector ? detector_scan((detector_t)pattern->detector, input, len)
+                                : re2_matches(pattern->compiled_regex, input, len);
+
+    // Statistics are the mutable part of a published ruleset
+    rule_stats_t *stats = (rule_stats_t *)&rules->rule_stats[i][location];
+    __atomic_add_fetch(&stats->evaluations, 1, __ATOMIC_RELAXED);
+    latency_record(&stats->latency, stats_now_ns() - begin);
+    if (hit) __atomic_add_fetch(&stats->matches, 1, __ATOMIC_RELAXED);
+
+    return hit;
+}
+
+// Candidates one by one in the adaptive order, until the score reaches the block threshold.
+// The order can be republished while it is read - every candidate is cleared from the mask
+// once it ran, and whatever a mixed up order skipped runs at the end.
+static void analyze_scored(const ruleset_t *rules, const char *input, size_t len, rule_mask_t *candidates,
+                           location_t location, detection_report_t *findings) {
+    // Statistics are the mutable part of a published ruleset
+    ruleset_t *live = (ruleset_t *)rules;
+    const int *order = rules->order[__atomic_load_n(&live->order_current, __ATOMIC_ACQUIRE)];
+    uint64_t evaluations = 0;
+    int done = 0;
+    int expired = 0;
+
+    for (int k = 0; k < rules->pattern_count && !done && !expired; k++) {
+        int i = __atomic_load_n(&order[k], __ATOMIC_RELAXED);
+        if (i < 0 || i >= rules->pattern_count || !mask_test(candidates, i)) continue;
+        if ((expired = deadline_passed(findings))) break;
+
+        mask_clear(candidates, i);
+        evaluations++;
+        done = evaluate_scored(live, i, input, len, location, findings);
+    }
+
+    for (int i = 0; i < rules->pattern_count && !done && !expired; i++) {
+        if (!mask_test(candidates, i)) continue;
+        if ((expired = deadline_passed(findings))) break;
+
+        mask_clear(candidates, i);
+        evaluations++;
+        done = evaluate_scored(live, i, input, len, location, findings);
+    }
+
+    // Out of time - the candidates still in the mask did not run
+    if (expired) skip_rules(rules, candidates, NULL, findings);
+
+    // Whoever crosses an interval boundary recomputes the order
+    uint64_t before = __atomic_fetch_add(&live->order_clock, evaluations, __ATOMIC_RELAXED);
+    if (before / REORDER_INTERVAL != (before + evaluations) / REORDER_INTERVAL) {
+        reorder_rules(live);
+    }
+}
+
+static double rule_priority(const ruleset_t *rules, int i) {
+    uint64_t evaluations = 0, hits = 0, cost = 0;
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        const rule_stats_t *stats = &rules->rule_stats[i][l];
+        evaluations += __atomic_load_n(&stats->evaluations, __ATOMIC_RELAXED);
+        hits += __atomic_load_n(&stats->matches, __ATOMIC_RELAXED);
+        cost += __atomic_load_n(&stats->latency.total_ns, __ATOMIC_RELAXED);
+    }
+
+    // Expected score per nanosecond, rules that never ran start with an even chance
+    double yield = rules->patterns[i].severity * (hits + 1.0) / (evaluations + 2.0);
+    double mean_cost = evaluations ? (double)cost / evaluations : 1.0;
+    return yield / (mean_cost > 1.0 ? mean_cost : 1.0);
+}
+
+static void reorder_rules(ruleset_t *rules) {
+    if (__atomic_exchange_n(&rules->reordering, 1, __ATOMIC_ACQUIRE)) return;
+
+    int count = rules->pattern_count;
+    double priority[MAX_PATTERNS];
+    int order[MAX_PATTERNS];
+    for (int i = 0; i < count; i++) {
+        priority[i] = rule_priority(rules, i);
+        order[i] = i;
+    }
+
+    // Insertion sort, highest priority first - at most MAX_PATTERNS rules
+    for (int i = 1; i < count; i++) {
+        int id = order[i];
+        int j = i - 1;
+        while (j >= 0 && priority[order[j]] < priority[id]) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = id;
+    }
+
+    int next = 1 - __atomic_load_n(&rules->order_current, __ATOMIC_RELAXED);
+    for (int i = 0; i < count; i++) {
+        __atomic_store_n(&rules->order[next][i], order[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&rules->order_current, next, __ATOMIC_RELEASE);
+    __atomic_store_n(&rules->reordering, 0, __ATOMIC_RELEASE);
+}
+
+
+// Whole-location pass through the verdict cache - the same text always hits the same rules
+static void analyze_cached(const ruleset_t *rules, const char *text, size_t len, location_t location,
+                           detection_report_t *findings) {
+    int threshold = rules->block_threshold;
+    if (len == 0 || (threshold > 0 && findings->score >= threshold)) return;
+
+    uint8_t hits[CACHE_HITS_MAX];
+    int count = 0;
+    if (verdict_cache_lookup(rules->generation, location, text, len, hits, &count)) {
+        __atomic_add_fetch((uint64_t *)&rules->location_stats[location].cache_hits, 1, __ATOMIC_RELAXED);
+        // Stops where the scan itself would have stopped
+        for (int k = 0; k < count && !(threshold > 0 && findings->score >= threshold); k++) {
+            __atomic_add_fetch((uint64_t *)&rules->rule_stats[hits[k]][location].matches, 1, __ATOMIC_RELAXED);
+            add_finding(findings, rules, hits[k], location);
         }
+        return;
+    }
+
+    int before = findings->count;
+    analyze(rules, text, len, location, NULL, findings);
+
+    // A scan cut short (block threshold, full report, deadline) does not know every rule that hits
+    count = findings->count - before;
+    if ((threshold > 0 && findings->score >= threshold) || findings->count == MAX_DETECTIONS ||
+        count > CACHE_HITS_MAX || !verdict_cache_enabled() || deadline_passed(findings)) {
+        return;
+    }
+    for (int k = 0; k < count; k++) {
+        hits[k] = (uint8_t)findings->items[before + k].pattern;
+    }
+    verdict_cache_insert(rules->generation, location, text, len, hits, count);
+}
+
+static void add_finding(detection_report_t *findings, const ruleset_t *rules, int i, location_t location) {
+    const CompiledRegexPattern *pattern = &rules->patterns[i];
+    uint64_t *reported = &findings->reported[location][pattern->rule_id >> 6];
+    uint64_t bit = 1ULL << (pattern->rule_id & 63);
+    if ((*reported & bit) || findings->count == MAX_DETECTIONS) return;
+
+    *reported |= bit;
+    findings->score += pattern->severity;
+
+    findings->items[findings->count++] = (detection_t){
+        .attack = pattern->attack,
+        .description = pattern->description,
+        .rule_id = pattern->rule_id,
+        .pattern = i,
+        .location = location,
+    };
+}
+
+// Time is checked between locations, transform stages and rules - a single RE2 run (or
+// the RE2::Set pass of a location) is not interrupted
+static int deadline_passed(const detection_report_t *findings) {
+    return findings->deadline && stats_now_ns() >= findings->deadline;
+}
+
+// Rules that were due on an input but did not run, the report becomes incomplete
+static void skip_rules(const ruleset_t *rules, const rule_mask_t *left, const char *field,
+                       detection_report_t *findings) {
+    for (int i = 0; i < rules->pattern_count; i++) {
+        if (!mask_test(left, i)) continue;
+        if (field && !rule_applies_to_field(&rules->patterns[i], field)) continue;
+
+        int id = rules->patterns[i].rule_id;
+        findings->skipped[id >> 6] |= 1ULL << (id & 63);
+        findings->incomplete = 1;
+    }
+}
+
+int report_evaluated_categories(const ruleset_t *rules, const detection_report_t *report,
+                                const char **categories, int max) {
+    int count = 0;
+
+    for (int i = 0; i < rules->pattern_count && count < max; i++) {
+        const char *category = rules->patterns[i].attack;
+
+        // Each category where its first rule is
+        int first = 1;
+        for (int k = 0; k < i && first; k++) {
+            first = strcmp(rules->patterns[k].attack, category) != 0;
+        }
+        if (!first) continue;
+
+        int complete = 1;
+        for (int k = i; k < rules->pattern_count && complete; k++) {
+            int id = rules->patterns[k].rule_id;
+            complete = strcmp(rules->patterns[k].attack, category) != 0 || !(report->skipped[id >> 6] >> (id & 63) & 1);
+        }
+        if (complete) categories[count++] = category;
+    }
+    return count;
+}
 
-        if (compiled_patterns[i].description) {
-            free((void*)compiled_patterns[i].description);
-            compiled_patterns[i].description = NULL;
+int report_is_attack(const ruleset_t *rules, const detection_report_t *report) {
+    int threshold = ruleset_block_threshold(rules);
+    return threshold > 0 ? report->score >= threshold : report->count > 0;
+}
+
+const char *location_name(location_t location) {
+    switch (location) {
+        case LOCATION_URL: return "url";
+        case LOCATION_HEADERS: return "headers";
+        case LOCATION_BODY: return "body";
+    }
+    return "unknown";
+}
+
+// Every rule of a location goes into its set, those with transforms too - their hits on
+// the untransformed input are dropped by the candidate mask of scan_chain(). Leaving them
+// out changes the set the DFA is built from and measured slower, not faster.
+static int build_location_sets(ruleset_t *rules) {
+    int ok = 1;
+    rule_mask_t members[LOCATION_COUNT];
+
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        for (int w = 0; w < MAX_PATTERNS / 64; w++) {
+            members[l].bits[w] = rules->location_rules[l].bits[w];
+        }
+
+        // Same rules as an earlier location - same set
+        int shared = -1;
+        for (int k = 0; k < l && shared < 0; k++) {
+            if (memcmp(&members[k], &members[l], sizeof(rule_mask_t)) == 0) shared = k;
+        }
+
+        if (shared >= 0) {
+            rules->location_sets[l] = rules->location_sets[shared];
+            memcpy(rules->set_rules[l], rules->set_rules[shared], sizeof(rules->set_rules[l]));
+        } else if (mask_count(&members[l]) > 0) {
+            rules->location_sets[l] = build_pattern_set(rules, &members[l], rules->set_rules[l]);
+            ok &= rules->location_sets[l] != NULL;
+        }
+    }
+    return ok;
+}
+
+// RE2::Set of the member rules, in rule order
+static re2_set_t *build_pattern_set(ruleset_t *rules, const rule_mask_t *members, int *set_rules) {
+    re2_set_t *set = re2_set_new_options(&rules->set_options);
+    if (!set) return NULL;
+
+    int size = 0;
+    for (int i = 0; i < rules->pattern_count; i++) {
+        if (!mask_test(members, i)) continue;
+
+        const char *pat = re2_pattern_string(rules->patterns[i].compiled_regex);
+        if (re2_set_add(set, pat) != size) {
+            re2_set_free(set);
+            return NULL;
         }
-        if (compiled_patterns[i].attack) {
-            free((void*)compiled_patterns[i].attack);
-            compiled_patterns[i].attack = NULL;
+        set_rules[size++] = i;
+    }
+
+    if (!re2_set_compile(set)) {
+        re2_set_free(set);
+        return NULL;
+    }
+    return set;
+}
+
+// Optional "re2" object of the rules file - the memory budget of every rule ("max_mem") and
+// of every location set ("set_max_mem") in bytes, "longest_match" and "latin1". Rules never
+// need their submatches, they are compiled without captures.
+static void parse_regex_options(struct json_object *root, re2_options_t *pattern_options, re2_options_t *set_options) {
+    re2_options_init(pattern_options);
+    pattern_options->never_capture = 1;
+    *set_options = *pattern_options;
+    set_options->max_mem = RE2_SET_MAX_MEM;
+
+    struct json_object *options, *value;
+    if (!json_object_object_get_ex(root, "re2", &options) ||
+        !json_object_is_type(options, json_type_object)) {
+        return;
+    }
+
+    if (json_object_object_get_ex(options, "max_mem", &value) && json_object_get_int64(value) > 0) {
+        pattern_options->max_mem = json_object_get_int64(value);
+    }
+    if (json_object_object_get_ex(options, "set_max_mem", &value) && json_object_get_int64(value) > 0) {
+        set_options->max_mem = json_object_get_int64(value);
+    }
+    if (json_object_object_get_ex(options, "longest_match", &value)) {
+        pattern_options->longest_match = set_options->longest_match = json_object_get_boolean(value);
+    }
+    if (json_object_object_get_ex(options, "latin1", &value)) {
+        pattern_options->latin1 = set_options->latin1 = json_object_get_boolean(value);
+    }
+}
+
+// Many rules are written as ".*attack.*". For a search that only asks whether the pattern
+// matches anywhere the wildcards change nothing, but the DFA has to run them over the rest
+// of the input. They are taken off both ends at the top level, after leading flags like "(?i)".
+static void strip_wildcards(char *pattern) {
+    char *body = pattern;
+    while (body[0] == '(' && body[1] == '?') {
+        size_t flags = 2;
+        while (isalpha((unsigned char)body[flags]) || body[flags] == '-') flags++;
+        if (flags == 2 || body[flags] != ')') break;
+        body += flags + 1;
+    }
+
+    size_t skip = 0;
+    while (body[skip] == '.' && body[skip + 1] == '*') {
+        skip += body[skip + 2] == '?' ? 3 : 2;
+    }
+    memmove(body, body + skip, strlen(body + skip) + 1);
+
+    size_t len = strlen(body);
+    for (;;) {
+        size_t cut = len >= 3 && strcmp(body + len - 3, ".*?") == 0 ? 3 :
+                     len >= 2 && strcmp(body + len - 2, ".*") == 0 ? 2 : 0;
+        if (!cut) break;
+
+        // An escaped dot is a literal one
+        size_t backslashes = 0;
+        while (len - cut > backslashes && body[len - cut - backslashes - 1] == '\\') backslashes++;
+        if (backslashes % 2) break;
+
+        len -= cut;
+        body[len] = '\0';
+    }
+}
+
+// Optional "locations" rule field, e.g. ["url", "body"] - all locations without it
+static unsigned parse_locations(struct json_object *rule, const char *pattern) {
+    unsigned all = (1u << LOCATION_COUNT) - 1;
+    struct json_object *locations;
+
+    if (!json_object_object_get_ex(rule, "locations", &locations) ||
+        !json_object_is_type(locations, json_type_array)) {
+        return all;
+    }
+
+    unsigned result = 0;
+    int n = json_object_array_length(locations);
+    for (int k = 0; k < n; k++) {
+        const char *name = json_object_get_string(json_object_array_get_idx(locations, k));
+        int found = 0;
+
+        for (int l = 0; l < LOCATION_COUNT && name; l++) {
+            if (strcasecmp(name, location_name((location_t)l)) == 0) {
+                result |= 1u << l;
+                found = 1;
+            }
         }
+        if (!found) fprintf(stderr, "Unknown location %s of pattern: %s\n", name ? name : "(null)", pattern);
     }
-    
-    patterns_initialized = 0;
-    pattern_count = 0;
+
+    // A rule that would never run is a mistake in the file - keep the old behaviour
+    return result ? result : all;
+}
+
+static int rule_applies_to_field(const CompiledRegexPattern *pattern, const char *field) {
+    for (int k = 0; k < pattern->field_count; k++) {
+        if (strcmp(pattern->fields[k], field) == 0) return 1;
+    }
+    return 0;
 }
 
-void analyze(const char *input, const char *location, detection_report_t *findings) {
-    
-    if (!input || strlen(input) == 0) {
+// {"detector": "sqli" | "xss", "description", "severity", "category", optional "locations",
+// "transforms" and "replaces"} - a lexical detector (fingerprint.h) in place of a pattern.
+// The shipped rules file has none: next to the regex rules a detector costs a lexer pass on
+// every input, with "replaces" it does not catch all the regex rules catch yet.
+static void add_detector(ruleset_t *rules, struct json_object *rule, int i) {
+    struct json_object *name, *desc, *severity, *category, *replaces;
+    if (!json_object_object_get_ex(rule, "detector", &name) ||
+        !json_object_object_get_ex(rule, "description", &desc) ||
+        !json_object_object_get_ex(rule, "severity", &severity) ||
+        !json_object_object_get_ex(rule, "category", &category)) {
+        return;
+    }
+
+    const char *detector_name = json_object_get_string(name);
+    detector_t detector = detector_from_name(detector_name);
+    if (detector == DETECTOR_NONE) {
+        fprintf(stderr, "Unknown detector: %s\n", detector_name ? detector_name : "(null)");
         return;
     }
+    int chain = parse_transforms(rules, rule, detector_name);
+    if (chain < 0) return;
+
+    int id = rules->pattern_count;
+    CompiledRegexPattern *compiled = &rules->patterns[id];
+    compiled->detector = detector;
+    compiled->description = strdup(json_object_get_string(desc));
+    compiled->attack = strdup(json_object_get_string(category));
+    compiled->severity = json_object_get_int(severity);
+    compiled->rule_id = i;
+    compiled->locations = parse_locations(rule, detector_name);
+    compiled->chain = chain;
+
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        if (compiled->locations & (1u << l)) mask_set(&rules->location_detectors[l], id);
+    }
+    if (json_object_object_get_ex(rule, "replaces", &replaces) && json_object_get_boolean(replaces)) {
+        mask_set(&rules->replacing_detectors, id);
+    }
+    rules->pattern_count++;
+}
+
+// Regex rules of a category with a replacing detector no longer run where the detector does
+static void replace_regex_rules(ruleset_t *rules) {
+    for (int d = 0; d < rules->pattern_count; d++) {
+        if (!mask_test(&rules->replacing_detectors, d)) continue;
+        const CompiledRegexPattern *detector = &rules->patterns[d];
+
+        for (int i = 0; i < rules->pattern_count; i++) {
+            const CompiledRegexPattern *pattern = &rules->patterns[i];
+            if (pattern->detector || strcmp(pattern->attack, detector->attack) != 0) continue;
+
+            for (int l = 0; l < LOCATION_COUNT; l++) {
+                if (detector->locations & (1u << l)) mask_clear(&rules->location_rules[l], i);
+            }
+        }
+    }
+}
 
-    if (!patterns_initialized) {
-        init_regex_patterns();
+// Detectors of the location, 1 once the score reached the block threshold
+static int run_detectors(const ruleset_t *rules, transform_memo_t *memo, location_t location,
+                         detection_report_t *findings) {
+    rule_mask_t left = rules->location_detectors[location];
+
+    for (int i = 0; i < rules->pattern_count; i++) {
+        if (!mask_test(&left, i)) continue;
+
+        // Out of time - the detectors that did not run yet are left out
+        if (deadline_passed(findings)) {
+            skip_rules(rules, &left, NULL, findings);
+            return 0;
+        }
+        mask_clear(&left, i);
+
+        // On the input and, with transforms, on the text of the detector's stage
+        int chain = rules->patterns[i].chain;
+        int hit = evaluate_rule(rules, i, memo->text[0], memo->len[0], location);
+        if (!hit && chain > 0 && transformed_text(rules, memo, chain, location) && memo->text[chain] != memo->text[0]) {
+            hit = evaluate_rule(rules, i, memo->text[chain], memo->len[chain], location);
+        }
+
+        if (hit) {
+            add_finding(findings, rules, i, location);
+            if (rules->block_threshold > 0 && findings->score >= rules->block_threshold) return 1;
+        }
     }
+    return 0;
+}
 
-    for (int i = 0; i < pattern_count; i++) {
-        int start, end;
-   
-        if (re2_find(compiled_patterns[i].compiled_regex, input, &start, &end)) {
+// Optional "transforms" rule field, e.g. ["url_decode", "remove_comments"] - the stage the
+// chain ends at, 0 without transforms, -1 if the chain can not be used
+static int parse_transforms(ruleset_t *rules, struct json_object *rule, const char *pattern) {
+    struct json_object *transforms;
+    if (!json_object_object_get_ex(rule, "transforms", &transforms)) return 0;
+    if (!json_object_is_type(transforms, json_type_array)) {
+        fprintf(stderr, "transforms is not array in pattern: %s\n", pattern);
+        return -1;
+    }
 
-            findings->items = realloc(findings->items, (findings->count + 1) * sizeof(detection_t));
+    // Chains with a common prefix share its stages
+    int stage = 0;
+    int n = json_object_array_length(transforms);
+    for (int k = 0; k < n; k++) {
+        const char *name = json_object_get_string(json_object_array_get_idx(transforms, k));
+        int transform = transform_from_name(name);
+        if (transform < 0) {
+            fprintf(stderr, "Unknown transform %s of pattern: %s\n", name ? name : "(null)", pattern);
+            return -1;
+        }
 
-            findings->items[findings->count++] = (detection_t){
-                .attack = compiled_patterns[i].attack,
-                .description = compiled_patterns[i].description,
-                .location = location,
-            };
+        int next = 0;
+        for (int c = 1; c < rules->chain_count && !next; c++) {
+            if (rules->chains[c].parent == stage && rules->chains[c].transform == (transform_t)transform) next = c;
+        }
+        if (!next) {
+            if (rules->chain_count == MAX_TRANSFORM_CHAINS) {
+                fprintf(stderr, "Too many transform chains (%d), skipping pattern: %s\n", MAX_TRANSFORM_CHAINS, pattern);
+                return -1;
+            }
+            next = rules->chain_count++;
+            rules->chains[next] = (transform_stage_t){ stage, (transform_t)transform };
+            add_chain_triggers(rules, transform_trigger((transform_t)transform));
+        }
+        stage = next;
+    }
+    return stage;
+}
+
+static void add_chain_triggers(ruleset_t *rules, const char *trigger) {
+    for (; *trigger && rules->chain_trigger_count >= 0; trigger++) {
+        if (memchr(rules->chain_triggers, *trigger, rules->chain_trigger_count)) continue;
+        if (rules->chain_trigger_count == 4) {
+            rules->chain_trigger_count = -1;
+            break;
+        }
+        rules->chain_triggers[rules->chain_trigger_count++] = *trigger;
+    }
+}
+
+// Makes sure memo has the text of a stage - its parent's first. 0 if there was no memory for it.
+static int transformed_text(const ruleset_t *rules, transform_memo_t *memo, int chain, location_t location) {
+    if (memo->computed & (1u << chain)) return 1;
+
+    int parent = rules->chains[chain].parent;
+    if (!transformed_text(rules, memo, parent, location)) return 0;
+    const char *src = memo->text[parent];
+    size_t len = memo->len[parent];
+
+    if (len + 1 > transform_buffer_sizes[chain]) {
+        char *grown = realloc(transform_buffers[chain], len + 1);
+        if (!grown) return 0;
+        transform_buffers[chain] = grown;
+        transform_buffer_sizes[chain] = len + 1;
+    }
+
+    size_t written = transform_apply(rules->chains[chain].transform, src, len, transform_buffers[chain]);
+    if (written == TRANSFORM_UNCHANGED) {
+        memo->text[chain] = src;
+        memo->len[chain] = len;
+    } else {
+        memo->text[chain] = transform_buffers[chain];
+        memo->len[chain] = written;
+    }
+    memo->computed |= 1u << chain;
+    __atomic_add_fetch((uint64_t *)&rules->location_stats[location].transforms, 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+// Prefilter result of the text of a stage, computed once per scan. A stage that changed
+// nothing has the result of its parent.
+static const rule_mask_t *stage_candidates(const ruleset_t *rules, transform_memo_t *memo, int chain) {
+    if (memo->filtered & (1u << chain)) return &memo->candidates[chain];
+
+    int parent = rules->chains[chain].parent;
+    if (chain > 0 && memo->text[chain] == memo->text[parent]) {
+        memo->candidates[chain] = *stage_candidates(rules, memo, parent);
+    } else {
+        prefilter_candidates(rules, memo->text[chain], memo->len[chain], &memo->candidates[chain]);
+    }
+    memo->filtered |= 1u << chain;
+    return &memo->candidates[chain];
+}
+
+static void release_transform_buffers(void) {
+    for (int c = 0; c < MAX_TRANSFORM_CHAINS; c++) {
+        if (transform_buffer_sizes[c] <= SCRATCH_MAX_RETAINED) continue;
+
+        free(transform_buffers[c]);
+        transform_buffers[c] = NULL;
+        transform_buffer_sizes[c] = 0;
+    }
+}
+
+// Returns the number of rules whose literals appear in input and marks them in candidates
+static int prefilter_candidates(const ruleset_t *rules, const char *input, size_t len, rule_mask_t *candidates) {
+    memset(candidates, 0, sizeof(rule_mask_t));
+
+    if (!rules->literal_matcher) {
+        for (int i = 0; i < rules->pattern_count; i++) {
+            mask_set(candidates, i);
+        }
+        return rules->pattern_count;
+    }
+
+    int found[AC_MAX_LITERALS];
+    int found_count = ac_scan(rules->literal_matcher, input, len, found, AC_MAX_LITERALS);
+
+    clause_mask_t satisfied = {0};
+    for (int f = 0; f < found_count; f++) {
+        for (int w = 0; w < MAX_CLAUSES / 64; w++) {
+            satisfied.bits[w] |= rules->literal_clauses[found[f]].bits[w];
+        }
+    }
+
+    int count = 0;
+    for (int i = 0; i < rules->pattern_count; i++) {
+        if (rules->patterns[i].detector) continue;
+
+        int pass = mask_test(&rules->unfiltered_rules, i);
+        if (!pass) {
+            uint64_t missing = 0;
+            for (int w = 0; w < MAX_CLAUSES / 64; w++) {
+                missing |= rules->rule_clauses[i].bits[w] & ~satisfied.bits[w];
+            }
+            pass = !missing;
+        }
+
+        if (pass) {
+            mask_set(candidates, i);
+            count++;
+        }
+    }
+    return count;
+}
+
+static int build_prefilter(ruleset_t *rules) {
+    rules->literal_matcher = ac_new();
+    rules->literal_clauses = calloc(AC_MAX_LITERALS, sizeof(clause_mask_t));
+    memset(rules->rule_clauses, 0, sizeof(rules->rule_clauses));
+    memset(&rules->unfiltered_rules, 0, sizeof(rules->unfiltered_rules));
+    rules->clause_count = 0;
+
+    if (!rules->literal_matcher || !rules->literal_clauses) {
+        free_prefilter(rules);
+        return 0;
+    }
+
+    for (int i = 0; i < rules->pattern_count; i++) {
+        const CompiledRegexPattern *pattern = &rules->patterns[i];
+        if (pattern->detector) continue;
+
+        int ok;
+        if (pattern->keyword_count > 0) {
+            ok = add_clause(rules, i, (const char **)pattern->keywords, pattern->keyword_count);
+        } else {
+            ok = extract_clauses(rules, i);
+        }
+
+        if (!ok) {
+            free_prefilter(rules);
+            return 0;
+        }
+    }
+
+    if (!ac_build(rules->literal_matcher)) {
+        free_prefilter(rules);
+        return 0;
+    }
+    return 1;
+}
+
+// FilteredRE2 gives the AND/OR tree of literals a pattern depends on. It is too slow to
+// evaluate per input, so it is reduced here to a few minimal clauses: starting from all
+// atoms, drop atoms (short, i.e. common, ones first) while their absence alone still
+// rules the pattern out. The next clause is searched with the previous ones dropped first.
+static int extract_clauses(ruleset_t *rules, int rule) {
+    re2_filter_t *filter = re2_filter_new(PREFILTER_MIN_ATOM_LEN);
+    if (!filter) return 0;
+
+    const char *pat = re2_pattern_string(rules->patterns[rule].compiled_regex);
+    int atom_count = re2_filter_add(filter, pat) == 0 ? re2_filter_compile(filter) : -1;
+
+    int ids[1];
+    if (atom_count <= 0 || re2_filter_candidates(filter, NULL, 0, ids, 1) > 0) {
+        mask_set(&rules->unfiltered_rules, rule); // Nothing is required - always evaluated
+        re2_filter_free(filter);
+        return 1;
+    }
+
+    const char **atoms = malloc(atom_count * sizeof(char *));
+    int *order = malloc(atom_count * sizeof(int));
+    int *present = malloc(atom_count * sizeof(int));
+    char *in_clause = malloc(atom_count);
+    char *used = calloc(atom_count, 1);
+    if (!atoms || !order || !present || !in_clause || !used) {
+        free(atoms); free(order); free(present); free(in_clause); free(used);
+        re2_filter_free(filter);
+        return 0;
+    }
+
+    for (int a = 0; a < atom_count; a++) {
+        atoms[a] = re2_filter_atom(filter, a);
+    }
+
+    int ok = 1;
+    for (int c = 0; c < PREFILTER_MAX_CLAUSES && ok; c++) {
+        // Atoms already used by a clause go first, then the shortest (most common) ones
+        for (int x = 0; x < atom_count; x++) {
+            int a = x, y = x - 1;
+            while (y >= 0 && (used[order[y]] < used[a] ||
+                   (used[order[y]] == used[a] && strlen(atoms[order[y]]) > strlen(atoms[a])))) {
+                order[y + 1] = order[y];
+                y--;
+            }
+            order[y + 1] = a;
+        }
+
+        memset(in_clause, 1, atom_count);
+        for (int k = 0; k < atom_count; k++) {
+            int a = order[k];
+            in_clause[a] = 0;
+
+            int present_count = 0;
+            for (int x = 0; x < atom_count; x++) {
+                if (!in_clause[x]) present[present_count++] = x;
+            }
+            if (re2_filter_candidates(filter, present, present_count, ids, 1) > 0) {
+                in_clause[a] = 1; // Needed - without it the clause no longer rules the pattern out
+            }
+        }
+
+        const char *clause[AC_MAX_LITERALS];
+        int clause_len = 0;
+        int is_new = 0;
+        for (int a = 0; a < atom_count; a++) {
+            if (!in_clause[a]) continue;
+            if (!used[a]) is_new = 1;
+            used[a] = 1;
+            clause[clause_len++] = atoms[a];
+        }
+
+        if (!is_new) break;
+        ok = add_clause(rules, rule, clause, clause_len);
+    }
+
+    free(atoms); free(order); free(present); free(in_clause); free(used);
+    re2_filter_free(filter);
+    return ok;
+}
+
+static int add_clause(ruleset_t *rules, int rule, const char **literals, int count) {
+    if (rules->clause_count == MAX_CLAUSES) return 0;
+
+    int clause = rules->clause_count++;
+    rules->rule_clauses[rule].bits[clause >> 6] |= 1ULL << (clause & 63);
+
+    for (int k = 0; k < count; k++) {
+        int lit = ac_add(rules->literal_matcher, literals[k], strlen(literals[k]));
+        if (lit < 0) return 0;
+        rules->literal_clauses[lit].bits[clause >> 6] |= 1ULL << (clause & 63);
+    }
+    return 1;
+}
+
+static void free_prefilter(ruleset_t *rules) {
+    if (rules->literal_matcher) {
+        ac_free(rules->literal_matcher);
+        rules->literal_matcher = NULL;
+    }
+    free(rules->literal_clauses);
+    rules->literal_clauses = NULL;
+    rules->clause_count = 0;
+}
+
+// Optional array of strings ("keywords", "fields", "header_skip") - lowercased like the
+// normalized input, empty entries are ignored
+static char **parse_string_list(struct json_object *object, const char *key, int *out_count) {
+    struct json_object *list;
+    *out_count = 0;
+
+    if (!json_object_object_get_ex(object, key, &list) ||
+        !json_object_is_type(list, json_type_array)) {
+        return NULL;
+    }
+
+    int n = json_object_array_length(list);
+    if (n == 0) return NULL;
+
+    char **result = calloc(n, sizeof(char *));
+    if (!result) return NULL;
+
+    for (int k = 0; k < n; k++) {
+        const char *kw = json_object_get_string(json_object_array_get_idx(list, k));
+        if (!kw || !*kw) continue;
+
+        char *copy = strdup(kw);
+        for (char *c = copy; *c; c++) {
+            *c = (char)tolower((unsigned char)*c);
+        }
+        result[(*out_count)++] = copy;
+    }
+
+    if (*out_count == 0) {
+        free(result);
+        return NULL;
+    }
+    return result;
+}
+
+static void free_string_list(char **list, int count) {
+    for (int k = 0; k < count; k++) {
+        free(list[k]);
+    }
+    free(list);
+}
 
-            // fprintf(stderr, "✓ MATCH: %s\n", compiled_patterns[i].description);
+static void sort_ids(int *ids, int count) {
+    for (int i = 1; i < count; i++) {
+        int id = ids[i];
+        int j = i - 1;
+        while (j >= 0 && ids[j] > id) {
+            ids[j + 1] = ids[j];
+            j--;
         }
+        ids[j + 1] = id;
     }
 }
 
@@ -5,12 +5,51 @@
 
 #include "re2_wrapper.h"
 #include "models.h"
+#include "stats.h"
 
-extern CompiledRegexPattern compiled_patterns[128];
+#define DEFAULT_RULES_PATH "proxy/rules/regex_patterns.json"
 
+// Compiled rules, see detection.c. Analysis runs on a reference taken with
+// ruleset_acquire(), a reload never changes a ruleset somebody holds.
+typedef struct ruleset ruleset_t;
+
+// Rules file read by init/reload, must outlive the process (e.g. an argv entry)
+void set_rules_path(const char *path);
 int init_regex_patterns();
+// Compiles the rules file again and swaps it in, the current rules stay on failure
+int reload_regex_patterns();
 void cleanup_regex_patterns();
-void analyze(const char *input, const char *location, detection_report_t *findings);
+
+ruleset_t *ruleset_acquire();
+void ruleset_release(ruleset_t *rules);
+unsigned ruleset_generation(const ruleset_t *rules);
+int ruleset_pattern_count(const ruleset_t *rules);
+int ruleset_block_threshold(const ruleset_t *rules);
+const CompiledRegexPattern *ruleset_pattern(const ruleset_t *rules, int i);
+// Counted since the ruleset was loaded, a reload starts from zero
+const rule_stats_t *ruleset_rule_stats(const ruleset_t *rules, int i, location_t location);
+const location_stats_t *ruleset_location_stats(const ruleset_t *rules, location_t location);
+
+// Header names of the "header_skip" list are not inspected
+int ruleset_skips_header(const ruleset_t *rules, const char *name);
+
+// Runs the rules on the fields of a request, every value on its own. A rule that hits several
+// values of a location is one finding; rules limited to some fields ("fields") run on those
+// fields alone.
+// With a deadline in the report the scan stops once it passed, see detection_report_t.
+void analyze_fields(const ruleset_t *rules, const field_t *fields, size_t count, detection_report_t *findings);
+
+// Runs the rules of the location on one input. Without a field name the rules that are not
+// limited to fields, with one the rules limited to that field.
+void analyze(const ruleset_t *rules, const char *input, size_t len, location_t location, const char *field,
+             detection_report_t *findings);
+// Verdict of a finished report - score against the block threshold in scoring mode
+int report_is_attack(const ruleset_t *rules, const detection_report_t *report);
+// Categories of an incomplete report none of whose rules was skipped, each once in rule order.
+// Returns how many were written to categories, at most max.
+int report_evaluated_categories(const ruleset_t *rules, const detection_report_t *report,
+                                const char **categories, int max);
+const char *location_name(location_t location);
 char* read_file(const char* filename);
 
-#endif
\ No newline at end of file
+#endif
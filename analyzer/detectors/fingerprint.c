@@ -0,0 +1,633 @@
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "fingerprint.h"
+
+// ---------------- SQL ----------------
+
+// Token classes:
+//  s string    1 number, null, true, false    v @variable    n name    f function (name followed by '(')
+//  k keyword   E statement (select, drop, ...)    U union    B order / group (by)
+//  o operator  & logic (and, or, &&, ||)    c comment to the end    ( ) , ; . as they are    X anything else
+
+typedef struct {
+    const char *word;
+    char token;
+} sql_word_t;
+
+// Sorted, bsearch
+static const sql_word_t sql_words[] = {
+    { "all", 'k' },
+    { "alter", 'E' },
+    { "and", '&' },
+    { "as", 'k' },
+    { "asc", 'k' },
+    { "between", 'o' },
+    { "by", 'k' },
+    { "call", 'E' },
+    { "case", 'k' },
+    { "create", 'E' },
+    { "declare", 'E' },
+    { "delay", 'k' },
+    { "delete", 'E' },
+    { "desc", 'k' },
+    { "distinct", 'k' },
+    { "div", 'o' },
+    { "drop", 'E' },
+    { "dumpfile", 'k' },
+    { "else", 'k' },
+    { "end", 'k' },
+    { "exec", 'E' },
+    { "execute", 'E' },
+    { "false", '1' },
+    { "from", 'k' },
+    { "grant", 'E' },
+    { "group", 'B' },
+    { "having", 'k' },
+    { "in", 'o' },
+    { "insert", 'E' },
+    { "into", 'k' },
+    { "is", 'o' },
+    { "join", 'k' },
+    { "like", 'o' },
+    { "limit", 'k' },
+    { "mod", 'o' },
+    { "not", 'o' },
+    { "null", '1' },
+    { "offset", 'k' },
+    { "or", '&' },
+    { "order", 'B' },
+    { "outfile", 'k' },
+    { "procedure", 'k' },
+    { "regexp", 'o' },
+    { "rename", 'E' },
+    { "revoke", 'E' },
+    { "rlike", 'o' },
+    { "select", 'E' },
+    { "set", 'k' },
+    { "shutdown", 'E' },
+    { "sounds", 'o' },
+    { "table", 'k' },
+    { "then", 'k' },
+    { "top", 'k' },
+    { "true", '1' },
+    { "truncate", 'E' },
+    { "union", 'U' },
+    { "update", 'E' },
+    { "values", 'k' },
+    { "waitfor", 'E' },
+    { "when", 'k' },
+    { "where", 'k' },
+    { "xor", '&' },
+};
+
+// Fingerprints of injections, sorted (strcmp), bsearch. An entry matches every fingerprint
+// that starts with it - "sUE" is any union select right after a string.
+static const char *const sqli_fingerprints[] = {
+    "1&(E", "1&1o", "1&f(", "1&so", "1&vo", "1)&(1", "1)&(s", "1)&f(", "1))&(", "1);E", "1)UE",
+    "1;E", "1B1c", "1UE", "s&(E", "s&1c", "s&1o", "s&f(", "s&noo", "s&o1", "s&sc", "s&so",
+    "s&ss", "s&vo", "s(E", "s)&(", "s)&f(", "s))&(", "s))UE", "s);E", "s)B1c", "s)UE", "s)c", "s;E",
+    "sB1c", "sUE", "sk1o1", "skks",
+};
+
+// Shapes that ordinary text has as well, they count only in a quote context.
+// Where the value continues a quoted string - admin'# is "sc", "hello" #tag is not:
+static const char *const sqli_string_fingerprints[] = { "sc" };
+// Where the value holds a quote - rock and 2-3 players is "n&1o1" too:
+static const char *const sqli_quote_fingerprints[] = { "n&1o1" };
+
+// Longest keyword, longer words are names
+#define SQL_WORD_MAX 16
+
+typedef struct {
+    const char *text;
+    size_t len;
+    size_t pos;
+} sql_lexer_t;
+
+static int compare_word(const void *key, const void *entry) {
+    return strcmp((const char *)key, ((const sql_word_t *)entry)->word);
+}
+
+static int compare_string(const void *key, const void *entry) {
+    return strcmp((const char *)key, *(const char *const *)entry);
+}
+
+static inline int is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline int is_word_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || is_digit(c) || c == '_' || c == '$' ||
+           (unsigned char)c >= 0x80;
+}
+
+static inline int is_space(char c) {
+    // '+' - a space the url decoding left alone
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f' || c == '+';
+}
+
+// Position after the closing quote, a doubled quote or a backslash escapes it. The end of
+// the text if the string never closes.
+static size_t string_end(const char *s, size_t len, size_t pos, char quote) {
+    while (pos < len) {
+        if (s[pos] == '\\') {
+            pos += 2;
+            continue;
+        }
+        if (s[pos] == quote) {
+            if (pos + 1 < len && s[pos + 1] == quote) {
+                pos += 2;
+                continue;
+            }
+            return pos + 1;
+        }
+        pos++;
+    }
+    return len;
+}
+
+static char word_token(const char *word, size_t len) {
+    if (len > SQL_WORD_MAX) return 'n';
+
+    char key[SQL_WORD_MAX + 1];
+    for (size_t k = 0; k < len; k++) {
+        char c = word[k];
+        key[k] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    }
+    key[len] = '\0';
+
+    const sql_word_t *found = bsearch(key, sql_words, sizeof(sql_words) / sizeof(sql_words[0]),
+                                      sizeof(sql_word_t), compare_word);
+    return found ? found->token : 'n';
+}
+
+static inline int word_is(const char *word, size_t len, const char *literal) {
+    return strlen(literal) == len && strncasecmp(word, literal, len) == 0;
+}
+
+// Next token class, 0 at the end. word / word_len - the text of the token.
+static char sql_next(sql_lexer_t *lx, const char **word, size_t *word_len) {
+    const char *s = lx->text;
+    size_t len = lx->len;
+
+    for (;;) {
+        while (lx->pos < len && is_space(s[lx->pos])) lx->pos++;
+        if (lx->pos >= len) return 0;
+
+        size_t start = lx->pos;
+        char c = s[start];
+        char next = start + 1 < len ? s[start + 1] : '\0';
+        *word = s + start;
+        *word_len = 1;
+
+        if (c == '/' && next == '*') {
+            // MySQL runs /*!50000 ... */ as code - only the opener goes
+            if (start + 2 < len && s[start + 2] == '!') {
+                lx->pos = start + 3;
+                while (lx->pos < len && is_digit(s[lx->pos])) lx->pos++;
+                continue;
+            }
+            // A closed comment separates tokens (un/**/ion is two words), an open one hides the rest
+            for (size_t k = start + 2; k + 1 < len; k++) {
+                if (s[k] == '*' && s[k + 1] == '/') {
+                    lx->pos = k + 2;
+                    break;
+                }
+            }
+            if (lx->pos != start) continue;
+            lx->pos = len;
+            return 'c';
+        }
+        if (c == '*' && next == '/') {
+            lx->pos = start + 2;    // End of a /*! comment
+            continue;
+        }
+        if ((c == '-' && next == '-') || c == '#') {
+            lx->pos = len;
+            return 'c';
+        }
+
+        if (c == '\'' || c == '"') {
+            lx->pos = string_end(s, len, start + 1, c);
+            *word_len = lx->pos - start;
+            return 's';
+        }
+        if (c == '`') {
+            lx->pos = string_end(s, len, start + 1, c);
+            *word_len = lx->pos - start;
+            return 'n';
+        }
+
+        if (is_digit(c) || (c == '.' && is_digit(next))) {
+            size_t p = start;
+            if (c == '0' && (next == 'x' || next == 'X' || next == 'b' || next == 'B')) {
+                p += 2;
+                while (p < len && is_word_char(s[p])) p++;
+            } else {
+                while (p < len && is_digit(s[p])) p++;
+                if (p < len && s[p] == '.') {
+                    p++;
+                    while (p < len && is_digit(s[p])) p++;
+                }
+                if (p + 1 < len && (s[p] == 'e' || s[p] == 'E') &&
+                    (is_digit(s[p + 1]) || ((s[p + 1] == '-' || s[p + 1] == '+') && p + 2 < len && is_digit(s[p + 2])))) {
+                    p += 2;
+                    while (p < len && is_digit(s[p])) p++;
+                }
+            }
+            lx->pos = p;
+            *word_len = p - start;
+            return '1';
+        }
+
+        if (c == '@') {
+            size_t p = start + 1;
+            if (p < len && s[p] == '@') p++;
+            while (p < len && (is_word_char(s[p]) || s[p] == '.')) p++;
+            lx->pos = p;
+            *word_len = p - start;
+            return 'v';
+        }
+
+        if (is_word_char(c)) {
+            size_t p = start;
+            // schema.table is one name
+            while (p < len && (is_word_char(s[p]) || (s[p] == '.' && p + 1 < len && is_word_char(s[p + 1])))) p++;
+            lx->pos = p;
+            *word_len = p - start;
+
+            char token = word_token(*word, *word_len);
+            if (token == 'n') {
+                while (p < len && is_space(s[p])) p++;
+                if (p < len && s[p] == '(') token = 'f';
+            }
+            return token;
+        }
+
+        // Operators, the longest one
+        lx->pos = start + 1;
+        if ((c == '|' && next == '|') || (c == '&' && next == '&')) {
+            lx->pos = start + 2;
+            *word_len = 2;
+            return '&';
+        }
+        if (c == '<' && next == '=' && start + 2 < len && s[start + 2] == '>') {
+            lx->pos = start + 3;
+            *word_len = 3;
+            return 'o';
+        }
+        if ((c == '<' && (next == '=' || next == '>' || next == '<')) || (c == '>' && (next == '=' || next == '>')) ||
+            (c == '!' && next == '=') || (c == ':' && next == '=') || (c == '=' && next == '=')) {
+            lx->pos = start + 2;
+            *word_len = 2;
+            return 'o';
+        }
+        if (strchr("=<>!-*/%^|&~", c)) return 'o';
+        if (strchr("(),;.", c)) return c;
+        return 'X';
+    }
+}
+
+int sqli_fingerprint(const char *text, size_t len, char quote, char *out) {
+    sql_lexer_t lx = { text, len, 0 };
+    int n = 0;
+
+    // The value is the rest of a string literal - up to its closing quote it is one string
+    if (quote) {
+        lx.pos = string_end(text, len, 0, quote);
+        out[n++] = 's';
+    }
+
+    while (n < SQLI_FINGERPRINT_MAX) {
+        const char *word;
+        size_t word_len;
+        char token = sql_next(&lx, &word, &word_len);
+        if (!token) break;
+
+        char prev = n > 0 ? out[n - 1] : '\0';
+        // union all / union distinct, order by / group by - one token
+        if (prev == 'U' && (word_is(word, word_len, "all") || word_is(word, word_len, "distinct"))) continue;
+        if (prev == 'B' && word_is(word, word_len, "by")) continue;
+        // Unary - ! ~ change nothing about the shape
+        if (token == 'o' && word_len == 1 && (*word == '-' || *word == '!' || *word == '~') &&
+            (prev == '\0' || prev == 'o' || prev == '(' || prev == '&' || prev == ',')) {
+            continue;
+        }
+
+        out[n++] = token;
+        if (token == 'c') break;
+    }
+
+    out[n] = '\0';
+    return n;
+}
+
+// Whether the fingerprint or one of its prefixes is in the table
+static int fingerprint_in(const char *fingerprint, int len, const char *const *table, size_t count) {
+    char prefix[SQLI_FINGERPRINT_MAX + 1];
+    memcpy(prefix, fingerprint, len);
+
+    for (int n = len; n >= 2; n--) {
+        prefix[n] = '\0';
+        if (bsearch(prefix, table, count, sizeof(char *), compare_string)) return 1;
+    }
+    return 0;
+}
+
+#define FINGERPRINT_IN(fingerprint, len, table) \
+    fingerprint_in(fingerprint, len, table, sizeof(table) / sizeof(table[0]))
+
+int sqli_is_injection(const char *text, size_t len) {
+    char fingerprint[SQLI_FINGERPRINT_MAX + 1];
+    int quoted = memchr(text, '\'', len) || memchr(text, '"', len);
+
+    int n = sqli_fingerprint(text, len, '\0', fingerprint);
+    if (FINGERPRINT_IN(fingerprint, n, sqli_fingerprints)) return 1;
+    if (quoted && FINGERPRINT_IN(fingerprint, n, sqli_quote_fingerprints)) return 1;
+
+    // Breaking out of a quoted string needs the quote
+    for (const char *quote = "'\""; *quote; quote++) {
+        if (!memchr(text, *quote, len)) continue;
+
+        n = sqli_fingerprint(text, len, *quote, fingerprint);
+        if (FINGERPRINT_IN(fingerprint, n, sqli_fingerprints) ||
+            FINGERPRINT_IN(fingerprint, n, sqli_string_fingerprints)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// ---------------- HTML ----------------
+
+// Tags that run or load code by themselves, sorted
+static const char *const xss_tags[] = {
+    "applet", "base", "embed", "frame", "frameset", "iframe", "import", "isindex",
+    "link", "meta", "object", "script", "vmlframe", "xml", "xss",
+};
+
+// Attributes whose value is a url, sorted
+static const char *const xss_url_attributes[] = {
+    "action", "background", "codebase", "data", "dynsrc", "formaction", "href", "lowsrc",
+    "poster", "src", "xlink:href",
+};
+
+// Event handlers, sorted - outside of a tag a name alone is too weak, only these count
+static const char *const xss_events[] = {
+    "onabort", "onafterprint", "onanimationend", "onanimationstart", "onbeforeunload", "onblur",
+    "onchange", "onclick", "oncontextmenu", "oncopy", "oncut", "ondblclick", "ondrag", "ondrop",
+    "onerror", "onfocus", "onfocusin", "onhashchange", "oninput", "oninvalid", "onkeydown",
+    "onkeypress", "onkeyup", "onload", "onmessage", "onmousedown", "onmouseenter", "onmouseleave",
+    "onmousemove", "onmouseout", "onmouseover", "onmouseup", "onpageshow", "onpaste", "onpointerdown",
+    "onpointerenter", "onpointerover", "onreset", "onresize", "onscroll", "onsearch", "onselect",
+    "onstart", "onsubmit", "ontoggle", "ontransitionend", "onunload", "onwheel",
+};
+
+#define HTML_NAME_MAX 32
+
+static int data_url_type(const char *rest, size_t len);
+
+// Copies a name (lowercased, truncated) for the table lookups
+static void copy_name(const char *text, size_t len, char *out) {
+    if (len > HTML_NAME_MAX) len = HTML_NAME_MAX;
+    for (size_t k = 0; k < len; k++) {
+        char c = text[k];
+        out[k] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    }
+    out[len] = '\0';
+}
+
+static int in_table(const char *name, const char *const *table, size_t count) {
+    return bsearch(name, table, count, sizeof(char *), compare_string) != NULL;
+}
+
+#define IN_TABLE(name, table) in_table(name, table, sizeof(table) / sizeof(table[0]))
+
+static inline int is_html_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '/';
+}
+
+// Whether text contains the lowercase literal, case-insensitively
+static int contains(const char *text, size_t len, const char *literal) {
+    size_t n = strlen(literal);
+    for (size_t k = 0; k + n <= len; k++) {
+        if (strncasecmp(text + k, literal, n) == 0) return 1;
+    }
+    return 0;
+}
+
+// bare - the value is not known to be a url ("javascript: the good parts" is text): the script
+// has to start right after the scheme and a data: url needs its media type or the ','
+static int dangerous_url(const char *value, size_t len, int bare) {
+    while (len > 0 && (*value == ' ' || *value == '\t')) {
+        value++;
+        len--;
+    }
+
+    static const char *const script_schemes[] = { "javascript:", "vbscript:", "livescript:" };
+    for (size_t k = 0; k < sizeof(script_schemes) / sizeof(script_schemes[0]); k++) {
+        size_t n = strlen(script_schemes[k]);
+        if (len < n || strncasecmp(value, script_schemes[k], n) != 0) continue;
+        return !bare || (len > n && !is_space(value[n]));
+    }
+
+    if (len >= 5 && strncasecmp(value, "data:", 5) == 0) {
+        if (len >= 11 && strncasecmp(value + 5, "image/", 6) == 0) return 0;
+        return !bare || data_url_type(value + 5, len - 5);
+    }
+    return 0;
+}
+
+// Whether a data: url goes on with its media type (text/html;base64,...) or straight with ','
+static int data_url_type(const char *rest, size_t len) {
+    if (len > 0 && rest[0] == ',') return 1;
+
+    size_t p = 0;
+    while (p < len && ((rest[p] >= 'a' && rest[p] <= 'z') || (rest[p] >= 'A' && rest[p] <= 'Z'))) p++;
+    if (p == 0 || p >= len || rest[p] != '/') return 0;
+
+    size_t subtype = ++p;
+    while (p < len && (is_word_char(rest[p]) || rest[p] == '+' || rest[p] == '-' || rest[p] == '.')) p++;
+    return p > subtype && (p == len || rest[p] == ';' || rest[p] == ',');
+}
+
+// in_tag - inside a tag every on* handler counts, after an attribute breakout only the known ones
+static int dangerous_attribute(const char *name, size_t name_len, const char *value, size_t value_len, int in_tag) {
+    char key[HTML_NAME_MAX + 1];
+    copy_name(name, name_len, key);
+
+    if (name_len > 2 && key[0] == 'o' && key[1] == 'n') {
+        if (value_len == 0) return 0;
+        return (in_tag && name_len > 4) || IN_TABLE(key, xss_events);
+    }
+    if (IN_TABLE(key, xss_url_attributes)) return dangerous_url(value, value_len, 0);
+    if (strcmp(key, "style") == 0) {
+        return contains(value, value_len, "expression(") || contains(value, value_len, "javascript:") ||
+               contains(value, value_len, "-moz-binding") || contains(value, value_len, "behavior:");
+    }
+    if (strcmp(key, "srcdoc") == 0) return memchr(value, '<', value_len) != NULL;
+    return 0;
+}
+
+// Attributes from *pos to the end of the tag, 1 on a dangerous one. *pos ends after the '>'.
+static int html_attributes(const char *s, size_t len, size_t *pos, int in_tag) {
+    size_t p = *pos;
+
+    while (p < len) {
+        while (p < len && is_html_space(s[p])) p++;
+        if (p >= len) break;
+        if (s[p] == '>') {
+            p++;
+            break;
+        }
+
+        size_t name = p;
+        while (p < len && !is_html_space(s[p]) && s[p] != '>' && s[p] != '=' && (p == name || (s[p] != '"' && s[p] != '\''))) p++;
+        size_t name_len = p - name;
+        if (name_len == 0) {
+            p++;    // A stray '=' or quote
+            continue;
+        }
+
+        size_t q = p;
+        while (q < len && (s[q] == ' ' || s[q] == '\t')) q++;
+        const char *value = s + p;
+        size_t value_len = 0;
+        if (q < len && s[q] == '=') {
+            q++;
+            while (q < len && (s[q] == ' ' || s[q] == '\t')) q++;
+            if (q < len && (s[q] == '"' || s[q] == '\'' || s[q] == '`')) {
+                char quote = s[q++];
+                const char *end = memchr(s + q, quote, len - q);
+                value = s + q;
+                value_len = end ? (size_t)(end - value) : len - q;
+                p = q + value_len + (end ? 1 : 0);
+            } else {
+                value = s + q;
+                while (q < len && s[q] != ' ' && s[q] != '\t' && s[q] != '>') q++;
+                value_len = (size_t)(s + q - value);
+                p = q;
+            }
+        }
+
+        if (dangerous_attribute(s + name, name_len, value, value_len, in_tag)) return 1;
+    }
+
+    *pos = p;
+    return 0;
+}
+
+// Text with markup - the value lands between tags
+static int html_text(const char *s, size_t len) {
+    size_t p = 0;
+
+    while (p < len) {
+        const char *open = memchr(s + p, '<', len - p);
+        if (!open) return 0;
+        p = (size_t)(open - s) + 1;
+        if (p >= len) return 0;
+
+        char c = s[p];
+        if (c == '!' || c == '/' || c == '?') {
+            // Comment, closing tag, doctype, processing instruction - skipped
+            const char *end;
+            if (c == '!' && p + 2 < len && s[p + 1] == '-' && s[p + 2] == '-') {
+                end = NULL;
+                for (size_t k = p + 3; k + 2 < len && !end; k++) {
+                    if (s[k] == '-' && s[k + 1] == '-' && s[k + 2] == '>') end = s + k + 2;
+                }
+            } else {
+                end = memchr(s + p, '>', len - p);
+            }
+            if (!end) return 0;
+            p = (size_t)(end - s) + 1;
+            continue;
+        }
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))) continue;
+
+        size_t name = p;
+        while (p < len && !is_html_space(s[p]) && s[p] != '>') p++;
+
+        char tag[HTML_NAME_MAX + 1];
+        copy_name(s + name, p - name, tag);
+        if (IN_TABLE(tag, xss_tags)) return 1;
+
+        if (html_attributes(s, len, &p, 1)) return 1;
+    }
+    return 0;
+}
+
+int xss_is_injection(const char *text, size_t len) {
+    if (dangerous_url(text, len, 1)) return 1;
+    if (memchr(text, '<', len) && html_text(text, len)) return 1;
+
+    // The value closes an attribute value and adds attributes of its own
+    const char *quote = NULL;
+    for (size_t k = 0; k < len && !quote; k++) {
+        if (text[k] == '"' || text[k] == '\'') quote = text + k;
+    }
+    if (quote) {
+        size_t pos = (size_t)(quote - text) + 1;
+        if (html_attributes(text, len, &pos, 0)) return 1;
+    }
+    return 0;
+}
+
+// ---------------- Values ----------------
+
+detector_t detector_from_name(const char *name) {
+    if (!name) return DETECTOR_NONE;
+    if (strcasecmp(name, "sqli") == 0) return DETECTOR_SQLI;
+    if (strcasecmp(name, "xss") == 0) return DETECTOR_XSS;
+    return DETECTOR_NONE;
+}
+
+static inline int detect(detector_t detector, const char *text, size_t len) {
+    return detector == DETECTOR_SQLI ? sqli_is_injection(text, len) : xss_is_injection(text, len);
+}
+
+// The value, then the last segment of a path (/users/1 or 1=1) and the values of its
+// name=value pairs (after the '?' of a url)
+static int scan_value(detector_t detector, const char *text, size_t len) {
+    if (len == 0) return 0;
+    if (detect(detector, text, len)) return 1;
+
+    const char *query = memchr(text, '?', len);
+    const char *end = text + len;
+    if (*text == '/') {
+        const char *path_end = query ? query : end;
+        const char *segment = path_end;
+        while (segment > text && segment[-1] != '/') segment--;
+        if (segment > text + 1 && detect(detector, segment, path_end - segment)) return 1;
+    }
+
+    const char *p = query ? query + 1 : text;
+    if (!memchr(p, '=', len - (size_t)(p - text))) return 0;
+
+    while (p < end) {
+        const char *pair_end = memchr(p, '&', end - p);
+        if (!pair_end) pair_end = end;
+
+        const char *eq = memchr(p, '=', pair_end - p);
+        if (eq && detect(detector, eq + 1, pair_end - eq - 1)) return 1;
+        p = pair_end + 1;
+    }
+    return 0;
+}
+
+int detector_scan(detector_t detector, const char *text, size_t len) {
+    if (detector == DETECTOR_NONE || !text) return 0;
+
+    const char *p = text;
+    const char *end = text + len;
+    while (p < end) {
+        const char *line_end = memchr(p, '\n', end - p);
+        if (!line_end) line_end = end;
+
+        if (scan_value(detector, p, line_end - p)) return 1;
+        p = line_end + 1;
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef FINGERPRINT_H
+#define FINGERPRINT_H
+
+#include <stddef.h>
+
+// Lexical detectors, in the spirit of libinjection. Instead of dozens of regular expressions
+// over the text, a value is lexed once into token classes and the shape of the tokens decides:
+//  - SQL: the first SQLI_FINGERPRINT_MAX token classes form a fingerprint ("s&sos" for
+//    1' or '1'='1), looked up in a sorted table of fingerprint prefixes of known injections.
+//    The value is lexed as is and as if it continued a quoted string, the usual context.
+//  - HTML: tags, attribute names and values are checked against sorted tables of the
+//    dangerous ones (<script, on* handlers, javascript: urls, ...). The value is lexed as
+//    text and as if it broke out of an attribute value.
+// Input is normalized (lowercase, decoded), see normalize_into().
+
+typedef enum {
+    DETECTOR_NONE = 0,
+    DETECTOR_SQLI = 1,
+    DETECTOR_XSS = 2,
+} detector_t;
+
+// Token classes of a fingerprint, the table holds up to this many
+#define SQLI_FINGERPRINT_MAX 5
+
+// "sqli" / "xss" of the rules file, DETECTOR_NONE for anything else
+detector_t detector_from_name(const char *name);
+
+// A location as analyze() gets it - values separated by '\n'. Every value is inspected
+// whole and, if it holds "name=value" pairs (a url, an urlencoded body), pair by pair.
+int detector_scan(detector_t detector, const char *text, size_t len);
+
+// One value. quote - the string delimiter the value is assumed to start inside of, 0 - none.
+// out receives the fingerprint (SQLI_FINGERPRINT_MAX + 1 bytes), returns its length.
+int sqli_fingerprint(const char *text, size_t len, char quote, char *out);
+int sqli_is_injection(const char *text, size_t len);
+int xss_is_injection(const char *text, size_t len);
+
+#endif
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# Generates analyzer/html-entities.h - every HTML5 named character reference as a static
+# trie, so the decoder walks it byte by byte with no table built at runtime.
+#   python3 analyzer/gen-entities.py [entities.json] > analyzer/html-entities.h
+# Without an argument the list is Python's html.entities.html5, a copy of the WHATWG
+# entities.json (https://html.spec.whatwg.org/entities.json).
+import json
+import sys
+from collections import deque
+from html.entities import html5
+
+
+def load(path):
+    if not path:
+        return dict(html5)
+    with open(path, encoding='utf-8') as f:
+        # {"&amp;": {"codepoints": [38], "characters": "&"}, ...}
+        return {name[1:]: entry['characters'] for name, entry in json.load(f).items()}
+
+
+def build(entities):
+    # Trie in breadth-first order - the children of a node are consecutive nodes
+    children = {'': set()}
+    for name in entities:
+        for k in range(1, len(name) + 1):
+            children.setdefault(name[:k], set())
+            children[name[:k - 1]].add(name[k - 1])
+
+    order = []
+    queue = deque([''])
+    while queue:
+        prefix = queue.popleft()
+        order.append(prefix)
+        for c in sorted(children[prefix]):
+            queue.append(prefix + c)
+    index = {prefix: i for i, prefix in enumerate(order)}
+
+    values = bytearray()
+    offsets = {}
+    nodes = []
+    for prefix in order:
+        kids = sorted(children[prefix])
+        first = index[prefix + kids[0]] if kids else 0
+        value = entities[prefix].encode('utf-8') if prefix in entities else b''
+        if value and value not in offsets:
+            offsets[value] = len(values)
+            values += value
+        nodes.append((first, len(kids), len(value), offsets.get(value, 0)))
+    return order, nodes, bytes(values)
+
+
+def c_string(data):
+    return ''.join('\\x%02x' % b for b in data)
+
+
+def main():
+    entities = load(sys.argv[1] if len(sys.argv) > 1 else None)
+    order, nodes, values = build(entities)
+    longest = max(len(v.encode('utf-8')) for v in entities.values())
+
+    out = sys.stdout
+    out.write('// Generated by analyzer/gen-entities.py - do not edit\n')
+    out.write('// %d named character references (%d of them legacy, without the \';\')\n\n' %
+              (len(entities), sum(1 for name in entities if not name.endswith(';'))))
+    out.write('#ifndef HTML_ENTITIES\n#define HTML_ENTITIES\n\n#include <stdint.h>\n\n')
+    out.write('// Longest UTF-8 value of a named reference\n')
+    out.write('#define ENTITY_VALUE_MAX %d\n\n' % longest)
+    out.write('// Node 0 is the root. children: the nodes first .. first + count - 1,\n')
+    out.write('// entity_labels[node] is the byte that leads to a node. value_len 0 - no reference ends here.\n')
+    out.write('typedef struct {\n    uint16_t first;\n    uint8_t count;\n    uint8_t value_len;\n'
+              '    uint16_t value;     // Offset in entity_values\n} entity_node_t;\n\n')
+
+    out.write('static const entity_node_t entity_nodes[%d] = {\n' % len(nodes))
+    for k in range(0, len(nodes), 4):
+        row = nodes[k:k + 4]
+        out.write('    ' + ' '.join('{%d,%d,%d,%d},' % node for node in row) + '\n')
+    out.write('};\n\n')
+
+    labels = ''.join(prefix[-1] if prefix else '#' for prefix in order)
+    out.write('static const char entity_labels[%d] =\n' % (len(order) + 1))
+    for k in range(0, len(labels), 96):
+        out.write('    "%s"\n' % labels[k:k + 96])
+    out.write('    ;\n\n')
+
+    out.write('static const char entity_values[%d] =\n' % (len(values) + 1))
+    for k in range(0, len(values), 24):
+        out.write('    "%s"\n' % c_string(values[k:k + 24]))
+    out.write('    ;\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,10 @@
+#ifndef HASH
+#define HASH
+
+#include <stddef.h>
+#include <stdint.h>
+
+// XXH64 (xxHash, 64-bit variant) - fast non-cryptographic hash of a byte string
+uint64_t xxh64(const void *data, size_t len, uint64_t seed);
+
+#endif
@@ -4,96 +4,124 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
-#include <uri_encode.h>
 #include <ctype.h>
-#include <json-c/json.h>
 
 #include "html-decoder.h"
+#include "html-entities.h"
+#include "simd.h"
 
-char *extract_json_values(const char *text) {
-    struct json_object *parsed = json_tokener_parse(text);
-    if (!parsed) return NULL;
+static size_t utf8_encode(uint32_t cp, char *out, size_t out_size);
+static bool lookup_entity(const char *src, size_t len, const char **value, size_t *value_len, size_t *consumed);
+static size_t match_entity(const char *src, size_t len, char *out, size_t *consumed);
 
-    // Get the total length
-    size_t total_len = 0;
-    json_object_object_foreach(parsed, k1, v1) {
-        const char *value_str = json_object_get_string(v1);
-        if (value_str) {
-            total_len += strlen(value_str) + 1;
+// Hex value of a byte, -1 if it is not a hex digit
+static inline int hex_value(unsigned char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Next URI-decoded byte (%XX), invalid escapes are copied as they are
+static inline unsigned char uri_next(const char *src, size_t len, size_t *pos) {
+    size_t i = *pos;
+    if (src[i] == '%' && i + 2 < len) {
+        int hi = hex_value((unsigned char)src[i + 1]);
+        int lo = hex_value((unsigned char)src[i + 2]);
+        if (hi >= 0 && lo >= 0) {
+            *pos = i + 3;
+            return (unsigned char)(hi << 4 | lo);
         }
     }
+    *pos = i + 1;
+    return (unsigned char)src[i];
+}
 
-    if (total_len == 0) {
-        json_object_put(parsed);
-        return NULL;
-    }
+// Last stage: drop control chars, collapse spaces, lowercase
+#define EMIT(c) do {                                            \
+        unsigned char ch_ = (c);                                \
+        if (ch_ < 0x20 || ch_ == 0x7F) break;                   \
+        if (ch_ == ' ') {                                       \
+            if (!in_space) dst[j++] = ' ';                      \
+            in_space = 1;                                       \
+            break;                                              \
+        }                                                       \
+        dst[j++] = (ch_ >= 'A' && ch_ <= 'Z') ? ch_ + 32 : ch_; \
+        in_space = 0;                                           \
+    } while (0)
 
-    // 2. Allocate buffer
-    char *result = malloc(total_len + 1);
-    if (!result) {
-        json_object_put(parsed);
-        return NULL;
+// URI decode -> HTML entity decode -> control/whitespace/lowercase in a single pass.
+// dst must hold NORMALIZED_SIZE(len) bytes, the result is NUL terminated.
+size_t normalize_into(const char *src, size_t len, char *dst, size_t dst_size) {
+    if (!src || !dst || dst_size < NORMALIZED_SIZE(len)) {
+        if (dst && dst_size) dst[0] = '\0';
+        return 0;
     }
 
-    char *p = result;
-    json_object_object_foreach(parsed, k2, v2) {
-        const char *value_str = json_object_get_string(v2);
-        if (value_str) {
-            size_t len = strlen(value_str);
-            memcpy(p, value_str, len);
-            p += len;
-            *p++ = ' '; 
+    // Fast path - without '%' and '&' nothing has to be decoded
+    bool escapes = simd_find_any(src, len, "%&", 2) < len;
+
+    size_t j = 0;
+    int in_space = 0;
+    size_t pos = 0;
+
+    while (pos < len) {
+        // Plain bytes are lowercased and copied a vector at a time
+        size_t run = simd_normalize_run(src + pos, len - pos, dst + j, in_space, escapes);
+        if (run) {
+            pos += run;
+            j += run;
+            in_space = dst[j - 1] == ' ';
+            if (pos == len) break;
         }
-    }
-    *p = '\0';
 
-    json_object_put(parsed);
-    return result;
-}
+        unsigned char c = escapes ? uri_next(src, len, &pos) : (unsigned char)src[pos++];
 
-char *normalize_str(const char *src) {
-    if (!src) return NULL;
-    size_t len = strlen(src);
+        if (c != '&') {
+            EMIT(c);
+            continue;
+        }
 
-    // URI decode
-    char *buf1 = malloc(len + 1);  // +1 za '\0'
-    if (!buf1) return NULL;
-    size_t out_len = uri_decode(src, len, buf1);
-    buf1[out_len] = '\0'; 
-
-    // HTML entity decode
-    char *buf2 = malloc(out_len + 1);
-    if (!buf2) {
-        free(buf1);
-        return NULL;
-    }
-    size_t html_len = html_entity_decode(buf1, out_len, buf2, out_len + 1);
-    buf2[html_len] = '\0';
-    free(buf1);
-
-    // whitespace + lowercase
-    char *dst = malloc(html_len + 1);
-    if (!dst) {
-        free(buf2);
-        return NULL;
-    }
+        // Entity - look ahead on the URI-decoded stream
+        char look[ENTITY_MAX_LEN];
+        size_t after[ENTITY_MAX_LEN];
+        size_t n = 0, p = pos;
+        look[n] = '&';
+        after[n++] = pos;
+        while (n < ENTITY_MAX_LEN && p < len) {
+            look[n] = (char)uri_next(src, len, &p);
+            after[n++] = p;
+            if (look[n - 1] == ';') break;
+        }
 
-    size_t j = 0;
-    int in_space = 0;
-    for (size_t i = 0; i < html_len; i++) {
-        unsigned char c = (unsigned char)buf2[i];
-        if (iscntrl(c)) continue;
-        if (isspace(c)) {
-            if (!in_space) dst[j++] = ' ';
-            in_space = 1;
+        char value[ENTITY_VALUE_MAX];
+        size_t consumed;
+        size_t written = match_entity(look, n, value, &consumed);
+        if (written) {
+            for (size_t k = 0; k < written; k++) {
+                EMIT((unsigned char)value[k]);
+            }
+            pos = after[consumed - 1];
             continue;
         }
-        dst[j++] = (char)tolower(c);
-        in_space = 0;
+
+        EMIT('&');
     }
+
     dst[j] = '\0';
-    free(buf2);
+    return j;
+}
+
+#undef EMIT
 
+char *normalize_str(const char *src) {
+    if (!src) return NULL;
+    size_t len = strlen(src);
+
+    char *dst = malloc(NORMALIZED_SIZE(len));
+    if (!dst) return NULL;
+
+    normalize_into(src, len, dst, NORMALIZED_SIZE(len));
     return dst;
 }
 
@@ -101,38 +129,28 @@ size_t html_entity_decode(const char *src, size_t len, char *dst, size_t dst_siz
     size_t i = 0, j = 0;
 
     while (i < len) {
+        // Jump to the next '&', everything before it is copied as is
+        size_t run = simd_find_any(src + i, len - i, "&", 1);
+        if (run) {
+            if (j + 1 >= dst_size) break;
+            if (run > dst_size - j - 1) run = dst_size - j - 1;
+            memcpy(dst + j, src + i, run);
+            i += run;
+            j += run;
+            if (i == len || j + 1 >= dst_size) break;
+        }
+
         if (src[i] == '&') {
-            // 1. Named entities
-            uint32_t cp;
+            char value[ENTITY_VALUE_MAX];
             size_t consumed;
-            if (lookup_entity(src + i, len - i, &cp, &consumed)) {
-                size_t written = utf8_encode(cp, dst + j, dst_size - j);
-                if (!written) break;
+            size_t written = match_entity(src + i, len - i, value, &consumed);
+            if (written) {
+                if (written >= dst_size - j) break;
+                memcpy(dst + j, value, written);
                 j += written;
                 i += consumed;
                 continue;
             }
-
-            // 2. Numeric entities
-            if (i + 3 < len && src[i+1] == '#') {
-                int base = 10;
-                size_t k = i + 2;
-                if (k < len && (src[k] == 'x' || src[k] == 'X')) {
-                    base = 16;
-                    k++;
-                }
-
-                char *endptr;
-                long cp_long = strtol(src + k, &endptr, base);
-                if (endptr && *endptr == ';' && cp_long > 0 && cp_long <= 0x10FFFF) {
-                    cp = (uint32_t)cp_long;
-                    size_t written = utf8_encode(cp, dst + j, dst_size - j);
-                    if (!written) break;
-                    j += written;
-                    i = (endptr - src) + 1;
-                    continue;
-                }
-            }
         }
 
         // default: copy char as an UTF-8 byte
@@ -147,6 +165,47 @@ size_t html_entity_decode(const char *src, size_t len, char *dst, size_t dst_siz
     return j;
 }
 
+// Named or numeric (&#N; / &#xH;) entity at the start of src. Its UTF-8 goes to out
+// (ENTITY_VALUE_MAX bytes), returns the length, 0 - no entity.
+static size_t match_entity(const char *src, size_t len, char *out, size_t *consumed) {
+    // 1. Named entities
+    const char *value;
+    size_t value_len;
+    if (lookup_entity(src, len, &value, &value_len, consumed)) {
+        memcpy(out, value, value_len);
+        return value_len;
+    }
+
+    // 2. Numeric entities
+    if (len < 4 || src[0] != '&' || src[1] != '#') {
+        return 0;
+    }
+
+    size_t k = 2;
+    uint32_t base = 10;
+    if (src[k] == 'x' || src[k] == 'X') {
+        base = 16;
+        k++;
+    }
+
+    size_t digits_start = k;
+    uint32_t cp = 0;
+    while (k < len) {
+        int d = hex_value((unsigned char)src[k]);
+        if (d < 0 || (uint32_t)d >= base) break;
+        cp = cp * base + d;
+        if (cp > 0x10FFFF) return 0;
+        k++;
+    }
+
+    if (k == digits_start || k >= len || src[k] != ';' || cp == 0) {
+        return 0;
+    }
+
+    *consumed = k + 1;
+    return utf8_encode(cp, out, ENTITY_VALUE_MAX);
+}
+
 static size_t utf8_encode(uint32_t cp, char *out, size_t out_size) {
     if (cp <= 0x7F) {
         if (out_size < 1) return 0;
@@ -174,23 +233,36 @@ static size_t utf8_encode(uint32_t cp, char *out, size_t out_size) {
     return 0; // nevalidan codepoint
 }
 
-static const Entity entities[] = {
-    {"lt", '<'}, {"gt", '>'}, {"amp", '&'},
-    {"quot", '"'}, {"apos", '\''},
-    {"nbsp", 0x00A0}, {"copy", 0x00A9}, {"euro", 0x20AC},
-};
-
-static bool lookup_entity(const char *src, size_t len, uint32_t *out_cp, size_t *consumed) {
-    for (size_t i = 0; i < sizeof(entities)/sizeof(entities[0]); i++) {
-        size_t nlen = strlen(entities[i].name);
-        if (len >= nlen + 2 && src[0] == '&' &&
-            strncmp(src + 1, entities[i].name, nlen) == 0 &&
-            src[1+nlen] == ';') {
-            *out_cp = entities[i].codepoint;
-            *consumed = nlen + 2;
-            return true;
+// Longest named reference at src - the walk down the trie of html-entities.h follows src
+// byte by byte and remembers the last node a reference ends at ("&notin;" over "&not").
+static bool lookup_entity(const char *src, size_t len, const char **value, size_t *value_len, size_t *consumed) {
+    if (len < 2 || src[0] != '&') return false;
+
+    unsigned node = 0;
+    size_t matched = 0;
+    unsigned matched_node = 0;
+    for (size_t k = 1; k < len; k++) {
+        const entity_node_t *current = &entity_nodes[node];
+        const char *child = current->count ? memchr(entity_labels + current->first, src[k], current->count) : NULL;
+        if (!child) break;
+
+        node = (unsigned)(child - entity_labels);
+        if (entity_nodes[node].value_len) {
+            matched = k + 1;
+            matched_node = node;
         }
     }
-    return false;
-}
+    if (!matched) return false;
 
+    // A legacy reference (no ';') followed by '=' or an alphanumeric stays text, as in an
+    // attribute value - "?a=1&copy=2" is a parameter, not "a=1(c)=2"
+    if (src[matched - 1] != ';' && matched < len &&
+        (isalnum((unsigned char)src[matched]) || src[matched] == '=')) {
+        return false;
+    }
+
+    *value = entity_values + entity_nodes[matched_node].value;
+    *value_len = entity_nodes[matched_node].value_len;
+    *consumed = matched;
+    return true;
+}
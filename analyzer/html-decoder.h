@@ -6,10 +6,15 @@
 
 #include "models.h"
 
+// Decoding grows the input by at most one byte per five: the longest named references
+// for their length (&nLt; / &nGt;, 5 bytes) decode to 6 UTF-8 bytes, everything else shrinks
+#define NORMALIZED_SIZE(len) ((len) + (len) / 5 + 1)
+
+// Longest "&...;" sequence the decoder looks at
+#define ENTITY_MAX_LEN 40
+
 size_t html_entity_decode(const char *src, size_t len, char *dst, size_t dst_size);
-static size_t utf8_encode(uint32_t cp, char *out, size_t out_size);
-static bool lookup_entity(const char *src, size_t len, uint32_t *out_cp, size_t *consumed);
+size_t normalize_into(const char *src, size_t len, char *dst, size_t dst_size);
 char *normalize_str(const char *src);
-char *extract_json_values(const char *text);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,2780 @@
+// Generated by analyzer/gen-entities.py - do not edit
+// 2231 named character references (106 of them legacy, without the ';')
+
+#ifndef HTML_ENTITIES
+#define HTML_ENTITIES
+
+#include <stdint.h>
+
+// Longest UTF-8 value of a named reference
+#define ENTITY_VALUE_MAX 6
+
+// Node 0 is the root. children: the nodes first .. first + count - 1,
+// entity_labels[node] is the byte that leads to a node. value_len 0 - no reference ends here.
+typedef struct {
+    uint16_t first;
+    uint8_t count;
+    uint8_t value_len;
+    uint16_t value;     // Offset in entity_values
+} entity_node_t;
+
+static const entity_node_t entity_nodes[9854] = {
+    {1,52,0,0}, {53,16,0,0}, {69,8,0,0}, {77,14,0,0},
+    {91,11,0,0}, {102,16,0,0}, {118,5,0,0}, {123,12,0,0},
+    {135,8,0,0}, {143,14,0,0}, {157,5,0,0}, {162,7,0,0},
+    {169,11,0,0}, {180,8,0,0}, {188,9,0,0}, {197,14,0,0},
+    {211,9,0,0}, {220,4,0,0}, {224,12,0,0}, {236,13,0,0},
+    {249,11,0,0}, {260,14,0,0}, {274,9,0,0}, {283,5,0,0},
+    {288,4,0,0}, {292,9,0,0}, {301,8,0,0}, {309,16,0,0},
+    {325,16,0,0}, {341,15,0,0}, {356,19,0,0}, {375,18,0,0},
+    {393,12,0,0}, {405,17,0,0}, {422,10,0,0}, {432,15,0,0},
+    {447,6,0,0}, {453,8,0,0}, {461,23,0,0}, {484,14,0,0},
+    {498,24,0,0}, {522,18,0,0}, {540,12,0,0}, {552,6,0,0},
+    {558,21,0,0}, {579,19,0,0}, {598,13,0,0}, {611,18,0,0},
+    {629,15,0,0}, {644,7,0,0}, {651,14,0,0}, {665,8,0,0},
+    {673,10,0,0}, {683,1,0,0}, {684,1,0,0}, {685,1,0,0},
+    {686,1,0,0}, {687,2,0,0}, {689,1,0,0}, {690,1,0,0},
+    {691,1,0,0}, {692,1,0,0}, {693,1,0,0}, {694,2,0,0},
+    {696,1,0,0}, {697,1,0,0}, {698,2,0,0}, {700,1,0,0},
+    {701,1,0,0}, {702,2,0,0}, {704,1,0,0}, {705,3,0,0},
+    {708,1,0,0}, {709,1,0,0}, {710,1,0,0}, {711,1,0,0},
+    {712,1,0,0}, {713,1,0,0}, {714,1,0,0}, {715,3,0,0},
+    {718,4,0,0}, {722,1,0,0}, {723,2,0,0}, {725,1,0,0},
+    {726,1,0,0}, {727,1,0,0}, {728,1,0,0}, {729,4,0,0},
+    {733,1,0,0}, {734,1,0,0}, {735,1,0,0}, {736,2,0,0},
+    {738,1,0,0}, {739,1,0,0}, {740,1,0,0}, {741,3,0,0},
+    {744,2,0,0}, {746,1,0,0}, {747,1,0,0}, {748,2,0,0},
+    {750,4,0,0}, {754,2,0,0}, {756,1,0,0}, {757,1,0,0},
+    {758,1,0,0}, {759,3,0,0}, {762,1,0,0}, {763,1,0,0},
+    {764,1,0,0}, {765,1,0,0}, {766,2,0,0}, {768,2,0,0},
+    {770,1,0,0}, {771,1,0,0}, {772,2,0,0}, {774,1,0,0},
+    {775,1,0,0}, {776,2,0,0}, {778,1,0,0}, {779,1,0,0},
+    {780,1,0,0}, {781,3,0,0}, {784,1,0,0}, {785,1,0,0},
+    {786,1,1,0}, {787,1,0,0}, {788,1,0,0}, {789,3,0,0},
+    {792,1,0,0}, {793,1,0,0}, {794,1,0,0}, {795,1,0,0},
+    {796,1,0,0}, {797,1,0,0}, {798,1,0,0}, {799,1,0,0},
+    {800,2,0,0}, {802,1,0,0}, {803,1,0,0}, {804,1,0,0},
+    {805,2,0,0}, {807,2,0,0}, {809,1,0,0}, {810,1,0,0},
+    {811,1,0,0}, {812,1,0,0}, {813,1,0,0}, {814,2,0,0},
+    {816,1,0,0}, {817,1,0,0}, {818,1,0,0}, {819,3,0,0},
+    {822,2,0,0}, {824,3,0,0}, {827,1,0,0}, {828,1,0,0},
+    {829,2,0,0}, {831,2,0,0}, {833,1,0,0}, {834,1,0,0},
+    {835,2,0,0}, {837,1,0,0}, {838,1,0,0}, {839,1,0,0},
+    {840,1,0,0}, {841,2,0,0}, {843,1,0,0}, {844,1,0,0},
+    {845,1,0,0}, {846,1,0,0}, {847,1,1,1}, {848,5,0,0},
+    {853,3,0,0}, {856,2,0,0}, {858,1,0,0}, {859,2,0,0},
+    {861,1,0,0}, {862,3,0,0}, {865,3,0,0}, {868,1,0,0},
+    {869,1,0,0}, {870,1,0,0}, {871,2,0,0}, {873,1,0,0},
+    {874,1,0,0}, {875,1,0,0}, {876,1,0,0}, {877,1,0,0},
+    {878,1,0,0}, {879,1,0,0}, {880,3,0,0}, {883,3,0,0},
+    {886,1,0,0}, {887,4,0,0}, {891,1,0,0}, {892,1,0,0},
+    {893,1,0,0}, {894,1,0,0}, {895,1,0,0}, {896,2,0,0},
+    {898,1,0,0}, {899,1,0,0}, {900,1,0,0}, {901,3,0,0},
+    {904,1,0,0}, {905,1,0,0}, {906,1,0,0}, {907,2,0,0},
+    {909,1,0,0}, {910,1,0,0}, {911,1,0,0}, {912,1,0,0},
+    {913,1,0,0}, {914,1,0,0}, {915,1,0,0}, {916,1,0,0},
+    {917,1,0,0}, {918,2,0,0}, {920,4,0,0}, {924,2,0,0},
+    {926,1,0,0}, {927,1,0,0}, {928,1,0,0}, {929,1,0,0},
+    {930,1,0,0}, {931,1,0,0}, {932,3,0,0}, {935,3,0,0},
+    {938,2,0,0}, {940,1,0,0}, {941,1,0,0}, {942,1,0,0},
+    {943,2,0,0}, {945,1,0,0}, {946,2,0,0}, {948,1,0,0},
+    {949,2,0,0}, {951,1,0,0}, {952,1,0,0}, {953,5,0,0},
+    {958,1,0,0}, {959,1,0,0}, {960,1,0,0}, {961,1,0,0},
+    {962,1,0,0}, {963,2,0,0}, {965,1,0,0}, {966,1,0,0},
+    {967,4,0,0}, {971,1,0,0}, {972,1,0,0}, {973,2,0,0},
+    {975,2,0,0}, {977,3,0,0}, {980,1,0,0}, {981,2,0,0},
+    {983,1,0,0}, {984,1,0,0}, {985,1,0,0}, {986,2,0,0},
+    {988,2,0,0}, {990,1,0,0}, {991,2,0,0}, {993,1,0,0},
+    {994,1,0,0}, {995,1,0,0}, {996,1,0,0}, {997,2,0,0},
+    {999,2,0,0}, {1001,8,0,0}, {1009,1,0,0}, {1010,1,0,0},
+    {1011,1,0,0}, {1012,1,0,0}, {1013,1,0,0}, {1014,1,0,0},
+    {1015,1,0,0}, {1016,1,0,0}, {1017,2,0,0}, {1019,1,0,0},
+    {1020,1,0,0}, {1021,1,0,0}, {1022,1,0,0}, {1023,1,0,0},
+    {1024,1,0,0}, {1025,1,0,0}, {1026,1,0,0}, {1027,1,0,0},
+    {1028,1,0,0}, {1029,1,0,0}, {1030,1,0,0}, {1031,1,0,0},
+    {1032,1,0,0}, {1033,1,0,0}, {1034,1,0,0}, {1035,1,0,0},
+    {1036,2,0,0}, {1038,1,0,0}, {1039,1,0,0}, {1040,1,0,0},
+    {1041,1,0,0}, {1042,1,0,0}, {1043,1,0,0}, {1044,2,0,0},
+    {1046,1,0,0}, {1047,2,0,0}, {1049,1,0,0}, {1050,1,0,0},
+    {1051,1,0,0}, {1052,1,0,0}, {1053,1,0,0}, {1054,6,0,0},
+    {1060,1,0,0}, {1061,2,0,0}, {1063,1,0,0}, {1064,2,0,0},
+    {1066,2,0,0}, {1068,2,0,0}, {1070,2,0,0}, {1072,7,0,0},
+    {1079,1,0,0}, {1080,3,0,0}, {1083,1,0,0}, {1084,1,0,0},
+    {1085,2,0,0}, {1087,1,0,0}, {1088,2,0,0}, {1090,1,0,0},
+    {1091,2,0,0}, {1093,1,0,0}, {1094,5,0,0}, {1099,1,0,0},
+    {1100,1,0,0}, {1101,1,0,0}, {1102,3,0,0}, {1105,2,0,0},
+    {1107,4,0,0}, {1111,1,0,0}, {1112,2,0,0}, {1114,4,0,0},
+    {1118,2,0,0}, {1120,3,0,0}, {1123,4,0,0}, {1127,1,0,0},
+    {1128,3,0,0}, {1131,1,0,0}, {1132,3,0,0}, {1135,1,0,0},
+    {1136,1,0,0}, {1137,4,0,0}, {1141,2,0,0}, {1143,2,0,0},
+    {1145,1,0,0}, {1146,7,0,0}, {1153,2,0,0}, {1155,1,0,0},
+    {1156,1,0,0}, {1157,1,0,0}, {1158,4,0,0}, {1162,2,0,0},
+    {1164,2,0,0}, {1166,3,0,0}, {1169,3,0,0}, {1172,2,0,0},
+    {1174,1,0,0}, {1175,5,0,0}, {1180,1,0,0}, {1181,1,0,0},
+    {1182,5,0,0}, {1187,2,0,0}, {1189,3,0,0}, {1192,2,0,0},
+    {1194,2,0,0}, {1196,1,0,0}, {1197,2,0,0}, {1199,2,0,0},
+    {1201,2,0,0}, {1203,4,0,0}, {1207,1,0,0}, {1208,1,0,0},
+    {1209,2,0,0}, {1211,3,0,0}, {1214,4,0,0}, {1218,3,0,0},
+    {1221,2,0,0}, {1223,2,0,0}, {1225,3,0,0}, {1228,4,0,0},
+    {1232,2,0,0}, {1234,3,0,0}, {1237,2,0,0}, {1239,2,0,0},
+    {1241,3,0,0}, {1244,1,0,0}, {1245,1,0,0}, {1246,1,0,0},
+    {1247,3,0,0}, {1250,1,0,0}, {1251,1,0,0}, {1252,3,0,0},
+    {1255,1,0,0}, {1256,2,0,0}, {1258,1,0,0}, {1259,2,0,0},
+    {1261,1,0,0}, {1262,2,0,0}, {1264,3,0,0}, {1267,1,0,0},
+    {1268,2,0,0}, {1270,1,0,0}, {1271,4,0,0}, {1275,1,0,0},
+    {1276,2,0,0}, {1278,1,0,0}, {1279,1,0,0}, {1280,4,0,0},
+    {1284,4,0,0}, {1288,1,0,0}, {1289,1,0,0}, {1290,2,0,0},
+    {1292,6,1,0}, {1298,2,0,0}, {1300,1,0,0}, {1301,4,0,0},
+    {1305,1,0,0}, {1306,1,0,0}, {1307,3,0,0}, {1310,1,0,0},
+    {1311,1,0,0}, {1312,5,0,0}, {1317,3,0,0}, {1320,2,0,0},
+    {1322,1,0,0}, {1323,3,0,0}, {1326,2,0,0}, {1328,2,0,0},
+    {1330,1,0,0}, {1331,4,0,0}, {1335,1,0,0}, {1336,3,0,0},
+    {1339,5,0,0}, {1344,4,0,0}, {1348,1,0,0}, {1349,1,0,0},
+    {1350,2,0,0}, {1352,2,0,0}, {1354,2,0,0}, {1356,2,0,0},
+    {1358,1,0,0}, {1359,1,0,0}, {1360,1,0,0}, {1361,2,0,0},
+    {1363,1,0,0}, {1364,1,0,0}, {1365,2,0,0}, {1367,1,0,0},
+    {1368,1,0,0}, {1369,1,0,0}, {1370,1,0,0}, {1371,1,0,0},
+    {1372,1,0,0}, {1373,3,0,0}, {1376,1,0,0}, {1377,2,0,0},
+    {1379,1,0,0}, {1380,9,0,0}, {1389,3,0,0}, {1392,4,0,0},
+    {1396,4,0,0}, {1400,5,0,0}, {1405,3,0,0}, {1408,2,0,0},
+    {1410,2,0,0}, {1412,1,0,0}, {1413,5,0,0}, {1418,2,0,0},
+    {1420,4,0,0}, {1424,8,0,0}, {1432,1,0,0}, {1433,5,0,0},
+    {1438,6,0,0}, {1444,8,1,1}, {1452,1,0,0}, {1453,2,0,0},
+    {1455,1,0,0}, {1456,4,0,0}, {1460,2,0,0}, {1462,1,0,0},
+    {1463,1,0,0}, {1464,1,0,0}, {1465,1,0,0}, {1466,3,0,0},
+    {1469,2,0,0}, {1471,1,0,0}, {1472,2,0,0}, {1474,1,0,0},
+    {1475,2,0,0}, {1477,3,0,0}, {1480,2,0,0}, {1482,3,0,0},
+    {1485,1,0,0}, {1486,2,0,0}, {1488,5,0,0}, {1493,2,0,0},
+    {1495,5,0,0}, {1500,1,0,0}, {1501,7,0,0}, {1508,1,0,0},
+    {1509,4,0,0}, {1513,3,0,0}, {1516,3,0,0}, {1519,1,0,0},
+    {1520,7,0,0}, {1527,1,0,0}, {1528,2,0,0}, {1530,3,0,0},
+    {1533,4,0,0}, {1537,7,0,0}, {1544,4,0,0}, {1548,2,0,0},
+    {1550,9,0,0}, {1559,3,0,0}, {1562,1,0,0}, {1563,2,0,0},
+    {1565,2,0,0}, {1567,5,0,0}, {1572,1,0,0}, {1573,2,0,0},
+    {1575,3,0,0}, {1578,2,0,0}, {1580,1,0,0}, {1581,4,0,0},
+    {1585,3,0,0}, {1588,1,0,0}, {1589,3,0,0}, {1592,7,0,0},
+    {1599,3,0,0}, {1602,1,0,0}, {1603,1,0,0}, {1604,1,0,0},
+    {1605,1,0,0}, {1606,1,0,0}, {1607,1,0,0}, {1608,1,0,0},
+    {1609,3,0,0}, {1612,3,0,0}, {1615,2,0,0}, {1617,1,0,0},
+    {1618,3,0,0}, {1621,10,0,0}, {1631,2,0,0}, {1633,1,0,0},
+    {1634,1,0,0}, {1635,1,0,0}, {1636,1,0,0}, {1637,1,0,0},
+    {1638,1,0,0}, {1639,3,0,0}, {1642,3,0,0}, {1645,1,0,0},
+    {1646,1,0,0}, {1647,7,0,0}, {1654,3,0,0}, {1657,4,0,0},
+    {1661,4,0,0}, {1665,3,0,0}, {1668,3,0,0}, {1671,2,0,0},
+    {1673,3,0,0}, {1676,3,0,0}, {1679,1,0,0}, {1680,1,0,0},
+    {1681,4,0,0}, {1685,2,0,0}, {1687,1,0,0}, {1688,4,0,0},
+    {1692,3,0,0}, {1695,1,0,0}, {1696,1,0,0}, {1697,1,0,0},
+    {1698,1,0,0}, {1699,10,0,0}, {1709,1,0,0}, {1710,7,0,0},
+    {1717,1,0,0}, {1718,4,0,0}, {1722,2,0,0}, {1724,1,0,0},
+    {1725,4,0,0}, {1729,3,0,0}, {1732,1,0,0}, {1733,3,0,0},
+    {1736,1,0,0}, {1737,4,0,0}, {1741,2,0,0}, {1743,5,0,0},
+    {1748,3,0,0}, {1751,1,0,0}, {1752,2,0,0}, {1754,1,0,0},
+    {1755,3,0,0}, {1758,1,0,0}, {1759,1,0,0}, {1760,1,0,0},
+    {1761,4,0,0}, {1765,3,0,0}, {1768,3,0,0}, {1771,1,0,0},
+    {1772,3,0,0}, {1775,3,0,0}, {1778,2,0,0}, {1780,1,0,0},
+    {1781,1,0,0}, {1782,2,0,0}, {1784,1,0,0}, {1785,2,0,0},
+    {1787,3,0,0}, {1790,2,0,0}, {1792,1,0,0}, {1793,2,0,0},
+    {1795,2,0,0}, {1797,2,0,0}, {1799,2,0,0}, {1801,6,0,0},
+    {1807,3,0,0}, {1810,1,0,0}, {1811,3,0,0}, {1814,2,0,0},
+    {1816,1,0,0}, {1817,1,0,0}, {1818,1,0,0}, {1819,1,0,0},
+    {1820,2,0,0}, {1822,1,0,0}, {1823,1,0,0}, {1824,3,0,0},
+    {1827,1,0,0}, {1828,1,0,0}, {1829,1,0,0}, {1830,1,0,0},
+    {1831,1,0,0}, {1832,1,0,0}, {1833,2,0,0}, {1835,1,0,0},
+    {1836,1,0,0}, {1837,2,0,0}, {1839,1,0,0}, {1840,1,0,0},
+    {1841,1,0,0}, {1842,2,0,0}, {1844,1,0,0}, {1845,3,0,0},
+    {1848,1,0,0}, {1849,1,0,0}, {1850,2,0,0}, {1852,1,0,0},
+    {1853,2,0,0}, {1855,1,0,0}, {1856,1,0,0}, {1857,3,0,0},
+    {1860,2,0,0}, {1862,2,0,0}, {1864,2,0,0}, {1866,1,0,0},
+    {1867,1,0,0}, {1868,1,0,0}, {1869,2,0,0}, {1871,1,0,0},
+    {1872,1,0,0}, {1873,1,0,0}, {1874,1,0,0}, {1875,1,0,0},
+    {1876,2,0,0}, {1878,1,0,0}, {1879,2,0,0}, {1881,1,0,0},
+    {1882,2,0,0}, {1884,1,0,0}, {1885,1,0,0}, {1886,1,0,0},
+    {1887,1,0,0}, {1888,1,0,0}, {1889,2,0,0}, {1891,1,0,0},
+    {1892,1,1,2}, {1893,1,0,0}, {1894,1,0,0}, {1895,1,0,0},
+    {1896,1,0,0}, {1897,1,0,0}, {1898,1,0,0}, {1899,1,0,0},
+    {1900,1,0,0}, {1901,1,0,0}, {1902,1,0,0}, {1903,1,0,0},
+    {1904,1,0,0}, {1905,1,0,0}, {1906,1,0,0}, {1907,1,0,0},
+    {1908,1,0,0}, {1909,1,0,0}, {1910,1,0,0}, {1911,2,0,0},
+    {1913,1,0,0}, {1914,1,0,0}, {1915,1,0,0}, {1916,1,0,0},
+    {1917,1,0,0}, {1918,1,0,0}, {1919,1,0,0}, {1920,1,0,0},
+    {1921,1,0,0}, {1922,1,0,0}, {1923,1,0,0}, {1924,1,0,0},
+    {1925,2,0,0}, {1927,1,0,0}, {1928,1,0,0}, {1929,1,0,0},
+    {1930,1,0,0}, {1931,1,0,0}, {1932,1,0,0}, {1933,1,0,0},
+    {1934,1,0,0}, {1935,1,0,0}, {1936,1,0,0}, {1937,1,0,0},
+    {1938,2,0,0}, {1940,1,0,0}, {1941,3,0,0}, {1944,2,0,0},
+    {1946,1,0,0}, {1947,1,0,0}, {1948,1,0,0}, {1949,2,0,0},
+    {0,0,3,3}, {1951,1,0,0}, {1952,1,0,0}, {1953,1,0,0},
+    {1954,1,0,0}, {1955,1,0,0}, {1956,1,0,0}, {1957,1,0,0},
+    {1958,1,0,0}, {1959,1,0,0}, {1960,2,0,0}, {1962,1,0,0},
+    {1963,2,0,0}, {1965,1,0,0}, {1966,1,0,0}, {1967,3,0,0},
+    {1970,1,0,0}, {1971,1,0,0}, {1972,1,0,0}, {1973,1,0,0},
+    {1974,1,0,0}, {1975,1,2,6}, {1976,1,0,0}, {1977,1,0,0},
+    {1978,1,0,0}, {1979,1,0,0}, {1980,1,0,0}, {1981,1,0,0},
+    {1982,1,0,0}, {1983,1,0,0}, {1984,1,0,0}, {1985,1,0,0},
+    {1986,1,0,0}, {1987,1,0,0}, {1988,1,0,0}, {1989,2,0,0},
+    {1991,1,0,0}, {1992,1,0,0}, {1993,1,0,0}, {1994,1,0,0},
+    {1995,1,0,0}, {1996,1,0,0}, {1997,1,0,0}, {1998,1,0,0},
+    {1999,1,0,0}, {2000,1,0,0}, {2001,1,0,0}, {2002,1,0,0},
+    {2003,1,0,0}, {2004,1,0,0}, {0,0,1,0}, {2005,1,0,0},
+    {2006,1,0,0}, {2007,1,0,0}, {2008,1,0,0}, {2009,1,0,0},
+    {2010,1,0,0}, {2011,1,0,0}, {0,0,3,8}, {2012,1,0,0},
+    {2013,1,0,0}, {2014,1,0,0}, {0,0,3,11}, {2015,1,0,0},
+    {2016,1,0,0}, {2017,1,0,0}, {2018,1,0,0}, {2019,1,0,0},
+    {2020,1,0,0}, {2021,1,0,0}, {2022,1,0,0}, {2023,1,0,0},
+    {2024,1,0,0}, {2025,1,0,0}, {2026,1,0,0}, {2027,1,0,0},
+    {2028,1,0,0}, {2029,1,0,0}, {2030,1,0,0}, {2031,1,0,0},
+    {2032,1,0,0}, {2033,1,0,0}, {2034,1,0,0}, {0,0,3,14},
+    {2035,2,0,0}, {2037,1,0,0}, {2038,2,0,0}, {2040,1,0,0},
+    {2041,1,0,0}, {2042,1,0,0}, {2043,1,0,0}, {2044,1,0,0},
+    {2045,1,0,0}, {2046,1,0,0}, {2047,1,0,0}, {2048,1,0,0},
+    {2049,1,0,0}, {2050,1,0,0}, {2051,1,0,0}, {2052,1,0,0},
+    {2053,1,0,0}, {2054,1,0,0}, {2055,1,0,0}, {2056,1,0,0},
+    {2057,1,0,0}, {2058,1,0,0}, {2059,1,0,0}, {2060,1,0,0},
+    {2061,1,0,0}, {2062,1,0,0}, {2063,1,0,0}, {0,0,1,1},
+    {2064,1,0,0}, {2065,1,0,0}, {2066,1,0,0}, {2067,1,0,0},
+    {2068,1,0,0}, {2069,1,0,0}, {2070,1,0,0}, {2071,1,0,0},
+    {2072,1,0,0}, {2073,1,0,0}, {2074,1,0,0}, {0,0,3,17},
+    {2075,1,0,0}, {2076,1,0,0}, {2077,1,0,0}, {2078,1,0,0},
+    {2079,1,0,0}, {2080,1,0,0}, {2081,1,0,0}, {2082,1,0,0},
+    {0,0,3,20}, {2083,1,0,0}, {2084,1,0,0}, {2085,1,0,0},
+    {2086,1,0,0}, {2087,1,0,0}, {2088,1,0,0}, {2089,1,0,0},
+    {2090,1,0,0}, {0,0,2,23}, {2091,1,0,0}, {2092,1,0,0},
+    {2093,1,0,0}, {2094,1,0,0}, {2095,1,0,0}, {2096,1,0,0},
+    {2097,1,0,0}, {2098,1,0,0}, {2099,1,0,0}, {2100,1,0,0},
+    {2101,1,0,0}, {2102,1,0,0}, {2103,13,0,0}, {2116,1,0,0},
+    {2117,1,0,0}, {0,0,2,25}, {2118,1,0,0}, {2119,1,0,0},
+    {2120,1,0,0}, {2121,1,0,0}, {2122,1,0,0}, {2123,1,0,0},
+    {2124,1,0,0}, {2125,1,0,0}, {2126,1,0,0}, {2127,1,0,0},
+    {2128,1,0,0}, {2129,1,0,0}, {0,0,3,27}, {2130,1,0,0},
+    {2131,1,0,0}, {2132,2,0,0}, {2134,1,0,0}, {2135,1,0,0},
+    {2136,1,0,0}, {2137,1,0,0}, {2138,1,0,0}, {2139,1,0,0},
+    {0,0,2,30}, {2140,1,0,0}, {2141,1,0,0}, {2142,1,0,0},
+    {0,0,3,32}, {2143,1,0,0}, {2144,1,0,0}, {2145,2,0,0},
+    {2147,1,0,0}, {2148,1,0,0}, {2149,1,0,0}, {2150,1,0,0},
+    {2151,1,0,0}, {2152,1,0,0}, {2153,1,0,0}, {2154,1,2,35},
+    {2155,1,0,0}, {2156,1,0,0}, {2157,1,0,0}, {2158,1,0,0},
+    {2159,1,0,0}, {2160,1,0,0}, {0,0,3,37}, {2161,1,0,0},
+    {2162,1,0,0}, {2163,1,0,0}, {2164,1,0,0}, {2165,1,0,0},
+    {2166,1,0,0}, {2167,1,0,0}, {2168,1,0,0}, {2169,1,0,0},
+    {2170,1,0,0}, {2171,1,0,0}, {2172,1,0,0}, {2173,1,0,0},
+    {2174,1,0,0}, {0,0,3,40}, {2175,1,0,0}, {2176,1,0,0},
+    {2177,1,0,0}, {2178,1,0,0}, {2179,1,0,0}, {2180,1,0,0},
+    {2181,1,0,0}, {2182,1,0,0}, {2183,1,0,0}, {2184,1,0,0},
+    {2185,1,0,0}, {2186,1,0,0}, {2187,1,0,0}, {2188,2,0,0},
+    {2190,2,0,0}, {2192,1,0,0}, {2193,3,0,0}, {2196,1,0,0},
+    {2197,1,0,0}, {2198,1,0,0}, {2199,1,0,0}, {2200,1,0,0},
+    {2201,1,0,0}, {2202,1,0,0}, {2203,1,0,0}, {2204,1,0,0},
+    {2205,1,0,0}, {2206,2,0,0}, {2208,2,0,0}, {2210,1,0,0},
+    {2211,1,0,0}, {2212,1,0,0}, {2213,1,0,0}, {2214,1,0,0},
+    {2215,1,0,0}, {2216,1,0,0}, {2217,2,0,0}, {2219,1,0,0},
+    {2220,1,0,0}, {2221,1,0,0}, {2222,1,0,0}, {2223,1,0,0},
+    {2224,1,0,0}, {2225,1,0,0}, {2226,1,0,0}, {2227,1,0,0},
+    {2228,1,0,0}, {2229,1,0,0}, {2230,1,0,0}, {2231,1,0,0},
+    {2232,1,0,0}, {2233,1,0,0}, {2234,1,0,0}, {2235,1,0,0},
+    {2236,1,0,0}, {2237,1,0,0}, {2238,1,0,0}, {2239,1,0,0},
+    {2240,1,0,0}, {2241,1,0,0}, {2242,1,0,0}, {2243,1,0,0},
+    {2244,1,0,0}, {2245,1,0,0}, {2246,3,0,0}, {2249,1,0,0},
+    {2250,1,0,0}, {2251,1,0,0}, {2252,1,0,0}, {2253,1,0,0},
+    {2254,1,0,0}, {2255,1,0,0}, {2256,1,0,0}, {2257,1,0,0},
+    {2258,1,0,0}, {0,0,2,43}, {2259,1,0,0}, {2260,1,0,0},
+    {2261,1,0,0}, {2262,1,0,0}, {2263,1,0,0}, {2264,1,0,0},
+    {2265,1,0,0}, {2266,1,0,0}, {2267,1,0,0}, {2268,1,0,0},
+    {2269,1,0,0}, {2270,1,0,0}, {2271,1,0,0}, {2272,1,0,0},
+    {2273,1,0,0}, {2274,1,0,0}, {2275,1,0,0}, {2276,1,0,0},
+    {2277,1,0,0}, {2278,1,0,0}, {2279,1,0,0}, {2280,1,0,0},
+    {2281,1,0,0}, {2282,1,0,0}, {0,0,3,45}, {2283,1,0,0},
+    {2284,1,0,0}, {2285,1,0,0}, {2286,1,0,0}, {2287,1,0,0},
+    {2288,1,0,0}, {0,0,3,48}, {2289,1,0,0}, {2290,1,0,0},
+    {2291,2,0,0}, {2293,1,0,0}, {2294,2,0,0}, {2296,1,1,2},
+    {2297,5,0,0}, {2302,7,0,0}, {2309,1,0,0}, {2310,1,0,0},
+    {0,0,3,51}, {2311,1,0,0}, {2312,1,0,0}, {2313,1,0,0},
+    {2314,1,0,0}, {2315,1,0,0}, {2316,1,0,0}, {2317,1,0,0},
+    {2318,1,0,0}, {2319,1,0,0}, {2320,1,0,0}, {2321,1,0,0},
+    {2322,1,0,0}, {2323,1,0,0}, {2324,1,0,0}, {2325,1,0,0},
+    {2326,1,0,0}, {2327,2,0,0}, {2329,1,0,0}, {2330,1,0,0},
+    {2331,1,0,0}, {2332,1,0,0}, {2333,1,0,0}, {2334,1,0,0},
+    {2335,1,0,0}, {2336,1,0,0}, {2337,3,0,0}, {2340,1,0,0},
+    {2341,7,0,0}, {2348,1,0,0}, {2349,2,0,0}, {2351,2,0,0},
+    {2353,1,0,0}, {2354,2,0,0}, {2356,1,0,0}, {2357,1,0,0},
+    {2358,2,0,0}, {2360,1,0,0}, {2361,12,0,0}, {2373,1,0,0},
+    {2374,1,0,0}, {2375,1,0,0}, {2376,1,0,0}, {2377,1,0,0},
+    {2378,1,0,0}, {2379,1,0,0}, {2380,1,0,0}, {2381,1,0,0},
+    {2382,1,0,0}, {2383,6,0,0}, {2389,2,0,0}, {2391,2,0,0},
+    {2393,1,0,0}, {2394,1,0,0}, {2395,1,0,0}, {2396,1,0,0},
+    {2397,1,0,0}, {2398,1,0,0}, {2399,1,0,0}, {2400,1,0,0},
+    {2401,1,0,0}, {2402,1,0,0}, {2403,1,0,0}, {2404,7,0,0},
+    {2411,1,0,0}, {2412,1,0,0}, {2413,2,0,0}, {2415,2,0,0},
+    {2417,3,0,0}, {2420,1,0,0}, {2421,1,0,0}, {2422,1,0,0},
+    {2423,2,0,0}, {2425,1,0,0}, {2426,1,0,0}, {2427,2,0,0},
+    {2429,1,0,0}, {2430,6,0,0}, {2436,4,0,0}, {2440,1,0,0},
+    {2441,1,0,0}, {2442,1,0,0}, {2443,1,0,0}, {2444,1,0,0},
+    {2445,1,0,0}, {2446,1,0,0}, {2447,1,0,0}, {2448,1,0,0},
+    {2449,1,0,0}, {2450,1,0,0}, {2451,1,0,0}, {2452,1,0,0},
+    {2453,1,0,0}, {2454,1,0,0}, {0,0,3,54}, {2455,2,0,0},
+    {2457,1,0,0}, {2458,1,2,57}, {2459,1,0,0}, {2460,1,0,0},
+    {2461,1,0,0}, {2462,1,0,0}, {2463,1,0,0}, {2464,1,0,0},
+    {2465,1,0,0}, {2466,1,0,0}, {2467,1,0,0}, {2468,3,0,0},
+    {2471,1,0,0}, {2472,2,0,0}, {2474,1,0,0}, {2475,1,0,0},
+    {2476,5,0,0}, {2481,1,0,0}, {2482,1,0,0}, {2483,1,0,0},
+    {2484,2,0,0}, {2486,2,0,0}, {2488,1,0,0}, {2489,1,0,0},
+    {2490,1,0,0}, {2491,1,0,0}, {2492,1,0,0}, {2493,1,0,0},
+    {2494,1,0,0}, {2495,1,0,0}, {2496,1,0,0}, {2497,1,0,0},
+    {2498,1,0,0}, {2499,1,0,0}, {2500,1,0,0}, {2501,1,0,0},
+    {2502,1,0,0}, {2503,1,0,0}, {2504,1,0,0}, {2505,1,0,0},
+    {0,0,3,59}, {2506,1,0,0}, {2507,1,0,0}, {0,0,3,62},
+    {2508,1,0,0}, {2509,2,0,0}, {0,0,3,65}, {2511,1,0,0},
+    {2512,1,0,0}, {2513,2,0,0}, {2515,1,0,0}, {2516,1,0,0},
+    {2517,1,0,0}, {2518,1,0,0}, {2519,1,0,0}, {2520,1,0,0},
+    {2521,1,0,0}, {2522,1,0,0}, {2523,1,0,0}, {2524,1,0,0},
+    {2525,2,0,0}, {2527,2,0,0}, {2529,3,0,0}, {2532,1,0,0},
+    {2533,1,0,0}, {2534,1,0,0}, {2535,1,0,0}, {2536,1,0,0},
+    {2537,1,0,0}, {2538,1,0,0}, {2539,1,2,68}, {2540,1,0,0},
+    {2541,1,0,0}, {2542,1,0,0}, {2543,1,0,0}, {2544,2,0,0},
+    {2546,1,0,0}, {2547,1,0,0}, {2548,1,0,0}, {2549,1,0,0},
+    {2550,2,0,0}, {2552,1,0,0}, {2553,1,0,0}, {2554,1,0,0},
+    {2555,1,0,0}, {2556,1,0,0}, {2557,1,0,0}, {2558,1,0,0},
+    {2559,1,0,0}, {2560,2,0,0}, {2562,1,0,0}, {2563,2,0,0},
+    {2565,1,0,0}, {2566,1,0,0}, {0,0,3,70}, {2567,1,0,0},
+    {2568,1,0,0}, {2569,1,0,0}, {2570,1,0,0}, {2571,1,0,0},
+    {2572,1,0,0}, {2573,1,0,0}, {2574,1,0,0}, {0,0,3,73},
+    {2575,1,0,0}, {2576,3,0,0}, {2579,4,0,0}, {2583,1,0,0},
+    {0,0,3,11}, {2584,1,0,0}, {2585,1,0,0}, {2586,1,0,0},
+    {0,0,3,76}, {2587,1,0,0}, {2588,1,0,0}, {2589,1,0,0},
+    {2590,1,0,0}, {2591,1,0,0}, {2592,2,0,0}, {2594,1,0,0},
+    {2595,1,0,0}, {2596,1,0,0}, {2597,1,0,0}, {2598,1,0,0},
+    {0,0,1,0}, {2599,2,0,0}, {2601,1,0,0}, {2602,1,0,0},
+    {2603,1,0,0}, {2604,5,0,0}, {2609,1,0,0}, {2610,1,0,0},
+    {2611,1,0,0}, {2612,1,0,0}, {2613,1,0,0}, {2614,1,0,0},
+    {2615,2,0,0}, {2617,1,0,0}, {2618,1,0,0}, {2619,1,0,0},
+    {2620,1,0,0}, {2621,1,0,0}, {2622,1,0,0}, {2623,2,0,0},
+    {2625,1,0,0}, {2626,1,0,0}, {2627,1,0,0}, {2628,1,0,0},
+    {2629,1,0,0}, {2630,1,0,0}, {2631,1,0,0}, {2632,1,0,0},
+    {2633,1,0,0}, {2634,1,0,0}, {2635,1,0,0}, {0,0,3,79},
+    {2636,1,0,0}, {2637,1,0,0}, {2638,1,0,0}, {2639,1,0,0},
+    {2640,1,0,0}, {2641,1,0,0}, {2642,1,0,0}, {0,0,3,82},
+    {2643,2,0,0}, {2645,1,0,0}, {2646,1,0,0}, {2647,1,0,0},
+    {2648,3,0,0}, {2651,1,0,0}, {2652,1,0,0}, {0,0,3,85},
+    {2653,1,0,0}, {2654,1,0,0}, {2655,1,0,0}, {2656,5,0,0},
+    {2661,1,0,0}, {2662,1,0,0}, {2663,1,0,0}, {2664,1,0,0},
+    {2665,1,0,0}, {2666,1,0,0}, {2667,1,0,0}, {2668,1,0,0},
+    {0,0,3,88}, {2669,1,0,0}, {2670,1,0,0}, {2671,1,0,0},
+    {2672,1,0,0}, {2673,1,0,0}, {2674,1,0,0}, {2675,1,0,0},
+    {2676,1,0,0}, {2677,1,0,0}, {2678,1,0,0}, {2679,1,0,0},
+    {2680,1,0,0}, {2681,1,0,0}, {2682,1,0,0}, {2683,1,0,0},
+    {2684,1,0,0}, {2685,1,0,0}, {2686,1,0,0}, {2687,1,0,0},
+    {2688,1,0,0}, {2689,1,0,0}, {2690,1,0,0}, {2691,1,0,0},
+    {2692,1,0,0}, {0,0,3,91}, {2693,1,0,0}, {2694,1,0,0},
+    {2695,1,0,0}, {2696,1,0,0}, {2697,1,0,0}, {2698,1,0,0},
+    {2699,1,0,0}, {2700,1,0,0}, {2701,1,0,0}, {2702,1,0,0},
+    {2703,3,0,0}, {2706,1,0,0}, {2707,1,0,0}, {2708,2,0,0},
+    {2710,1,0,0}, {2711,2,0,0}, {2713,1,0,0}, {2714,1,0,0},
+    {2715,1,0,0}, {2716,1,0,0}, {2717,2,0,0}, {2719,1,0,0},
+    {0,0,3,94}, {2720,1,0,0}, {2721,1,0,0}, {2722,3,0,0},
+    {2725,5,0,0}, {2730,1,0,0}, {2731,1,0,0}, {2732,1,0,0},
+    {0,0,3,97}, {2733,1,0,0}, {2734,1,0,0}, {2735,1,0,0},
+    {2736,1,0,0}, {0,0,3,20}, {2737,1,0,0}, {2738,1,0,0},
+    {2739,1,0,0}, {2740,1,0,0}, {2741,1,0,0}, {2742,1,0,0},
+    {2743,1,0,0}, {2744,1,0,0}, {2745,2,0,0}, {2747,1,0,0},
+    {2748,2,0,0}, {2750,1,0,0}, {2751,1,0,0}, {2752,1,0,0},
+    {2753,3,0,0}, {2756,1,0,0}, {2757,2,0,0}, {2759,3,0,0},
+    {2762,1,0,0}, {2763,1,0,0}, {2764,1,0,0}, {2765,1,0,0},
+    {2766,1,0,0}, {2767,1,0,0}, {2768,1,0,0}, {2769,1,0,0},
+    {2770,1,0,0}, {2771,1,0,0}, {2772,2,0,0}, {2774,1,0,0},
+    {0,0,1,1}, {2775,2,0,0}, {2777,1,0,0}, {2778,1,0,0},
+    {2779,1,0,0}, {2780,1,0,0}, {2781,1,0,0}, {2782,2,0,0},
+    {2784,2,0,0}, {2786,1,0,0}, {2787,1,0,0}, {2788,1,0,0},
+    {2789,1,0,0}, {2790,2,0,0}, {2792,2,0,0}, {2794,1,0,0},
+    {2795,1,0,0}, {2796,1,0,0}, {2797,1,0,0}, {2798,1,0,0},
+    {2799,1,0,0}, {2800,1,0,0}, {2801,1,0,0}, {2802,4,0,0},
+    {2806,1,0,0}, {2807,1,0,0}, {2808,1,0,0}, {2809,1,0,0},
+    {2810,1,0,0}, {2811,1,0,0}, {0,0,3,100}, {2812,1,0,0},
+    {2813,1,0,0}, {0,0,2,103}, {2814,1,0,0}, {2815,1,0,0},
+    {2816,1,0,0}, {2817,2,0,0}, {2819,1,0,0}, {2820,1,0,0},
+    {2821,2,0,0}, {2823,1,0,0}, {2824,1,0,0}, {2825,1,0,0},
+    {2826,1,0,0}, {2827,1,0,0}, {2828,1,0,0}, {2829,5,0,0},
+    {2834,1,0,0}, {2835,1,0,0}, {2836,1,0,0}, {2837,2,0,0},
+    {2839,1,0,0}, {2840,1,0,0}, {2841,1,0,0}, {2842,1,0,0},
+    {2843,1,0,0}, {0,0,3,105}, {2844,1,0,0}, {2845,1,0,0},
+    {2846,1,0,0}, {2847,1,0,0}, {2848,2,0,0}, {2850,1,0,0},
+    {2851,1,0,0}, {2852,1,0,0}, {2853,3,0,0}, {2856,1,0,0},
+    {2857,2,0,0}, {2859,1,0,0}, {2860,1,0,0}, {2861,1,0,0},
+    {0,0,3,108}, {2862,2,0,0}, {2864,1,0,0}, {2865,1,0,0},
+    {2866,1,0,0}, {2867,1,0,0}, {2868,1,0,0}, {2869,1,0,0},
+    {2870,4,0,0}, {2874,1,0,0}, {2875,2,0,0}, {2877,1,0,0},
+    {2878,1,0,0}, {2879,3,2,111}, {2882,1,0,0}, {2883,1,0,0},
+    {2884,3,0,0}, {2887,1,0,0}, {2888,1,0,0}, {2889,1,0,0},
+    {2890,1,0,0}, {2891,4,0,0}, {2895,1,0,0}, {2896,1,0,0},
+    {2897,1,0,0}, {2898,1,0,0}, {2899,1,0,0}, {2900,3,0,0},
+    {2903,1,0,0}, {2904,1,0,0}, {2905,1,0,0}, {2906,1,0,0},
+    {0,0,2,113}, {2907,3,0,0}, {2910,1,0,0}, {2911,1,0,0},
+    {2912,1,0,0}, {2913,1,0,0}, {2914,2,0,0}, {2916,1,0,0},
+    {2917,3,0,0}, {2920,2,0,0}, {2922,1,0,0}, {2923,1,0,0},
+    {2924,1,0,0}, {2925,1,0,0}, {0,0,3,115}, {2926,1,0,0},
+    {2927,1,0,0}, {2928,1,0,0}, {2929,1,0,0}, {2930,1,0,0},
+    {2931,1,0,0}, {2932,1,0,0}, {2933,1,0,0}, {2934,1,0,0},
+    {2935,1,0,0}, {2936,1,0,0}, {2937,1,0,0}, {2938,1,0,0},
+    {2939,1,0,0}, {2940,1,0,0}, {2941,1,0,0}, {2942,1,0,0},
+    {2943,1,0,0}, {2944,1,0,0}, {2945,2,0,0}, {2947,1,0,0},
+    {2948,1,0,0}, {2949,1,0,0}, {2950,1,0,0}, {2951,3,0,0},
+    {2954,1,0,0}, {2955,1,0,0}, {2956,1,0,0}, {2957,1,0,0},
+    {0,0,3,118}, {2958,1,0,0}, {2959,4,0,0}, {2963,1,0,0},
+    {2964,1,0,0}, {2965,1,0,0}, {2966,1,0,0}, {2967,1,0,0},
+    {2968,1,0,0}, {2969,1,0,0}, {2970,2,0,0}, {2972,1,0,0},
+    {2973,1,0,0}, {2974,4,0,0}, {2978,1,0,0}, {2979,5,0,0},
+    {2984,1,0,0}, {2985,2,0,0}, {2987,1,0,0}, {2988,1,0,0},
+    {0,0,2,121}, {2989,1,0,0}, {2990,1,0,0}, {2991,1,0,0},
+    {2992,1,0,0}, {0,0,2,123}, {2993,1,0,0}, {2994,1,0,0},
+    {2995,1,0,0}, {0,0,3,125}, {2996,1,0,0}, {2997,1,0,0},
+    {2998,1,0,0}, {2999,2,0,0}, {3001,1,0,0}, {3002,3,0,0},
+    {3005,3,0,0}, {3008,1,0,0}, {3009,1,0,0}, {3010,1,0,0},
+    {3011,1,0,0}, {3012,1,0,0}, {3013,1,0,0}, {3014,1,0,0},
+    {3015,1,0,0}, {3016,1,0,0}, {3017,1,0,0}, {3018,1,0,0},
+    {3019,1,0,0}, {3020,1,0,0}, {3021,1,0,0}, {3022,1,0,0},
+    {3023,1,0,0}, {3024,1,0,0}, {3025,1,0,0}, {3026,2,0,0},
+    {3028,1,0,0}, {3029,1,0,0}, {3030,1,0,0}, {3031,1,0,0},
+    {3032,1,0,0}, {3033,2,0,0}, {3035,1,0,0}, {3036,1,0,0},
+    {3037,2,0,0}, {3039,1,0,0}, {3040,2,0,0}, {3042,1,0,0},
+    {3043,1,0,0}, {3044,1,0,0}, {3045,1,0,0}, {3046,1,0,0},
+    {3047,1,0,0}, {3048,1,0,0}, {3049,1,0,0}, {3050,1,2,35},
+    {3051,1,0,0}, {3052,1,0,0}, {3053,1,0,0}, {3054,1,0,0},
+    {3055,2,0,0}, {3057,1,0,0}, {3058,1,0,0}, {3059,1,0,0},
+    {3060,1,0,0}, {3061,1,0,0}, {3062,1,0,0}, {3063,1,0,0},
+    {3064,1,0,0}, {3065,2,0,0}, {3067,1,0,0}, {3068,3,0,0},
+    {3071,1,0,0}, {3072,1,0,0}, {3073,1,0,0}, {3074,1,0,0},
+    {3075,1,0,0}, {3076,1,0,0}, {3077,1,0,0}, {3078,2,0,0},
+    {3080,1,0,0}, {3081,1,0,0}, {3082,1,0,0}, {3083,1,0,0},
+    {0,0,3,128}, {3084,1,0,0}, {3085,1,0,0}, {0,0,3,131},
+    {3086,1,0,0}, {3087,2,0,0}, {3089,1,0,0}, {3090,2,0,0},
+    {3092,1,0,0}, {3093,3,0,0}, {3096,1,0,0}, {3097,1,0,0},
+    {3098,1,0,0}, {3099,1,0,0}, {3100,1,0,0}, {3101,1,0,0},
+    {3102,1,0,0}, {3103,1,0,0}, {3104,1,0,0}, {3105,1,0,0},
+    {3106,1,0,0}, {3107,2,0,0}, {3109,1,0,0}, {3110,2,0,0},
+    {3112,1,0,0}, {3113,1,2,134}, {3114,1,0,0}, {3115,8,0,0},
+    {3123,1,0,0}, {3124,2,0,0}, {3126,1,0,0}, {3127,2,0,0},
+    {3129,2,0,0}, {3131,1,0,0}, {3132,2,0,0}, {3134,1,0,0},
+    {3135,2,0,0}, {3137,2,0,0}, {3139,1,0,0}, {3140,3,0,0},
+    {3143,1,0,0}, {3144,1,0,0}, {3145,1,0,0}, {3146,1,0,0},
+    {3147,1,0,0}, {3148,1,0,0}, {3149,2,0,0}, {3151,9,0,0},
+    {3160,1,0,0}, {3161,1,0,0}, {3162,1,0,0}, {3163,13,0,0},
+    {3176,1,0,0}, {3177,1,0,0}, {3178,1,0,0}, {3179,1,0,0},
+    {3180,1,0,0}, {3181,1,0,0}, {3182,1,0,0}, {3183,1,0,0},
+    {3184,1,0,0}, {3185,1,0,0}, {3186,1,0,0}, {3187,1,0,0},
+    {3188,1,0,0}, {3189,2,0,0}, {3191,2,0,0}, {3193,2,0,0},
+    {3195,1,0,0}, {3196,1,0,0}, {3197,1,0,0}, {3198,1,0,0},
+    {3199,1,0,0}, {3200,4,0,0}, {3204,1,0,0}, {3205,1,0,0},
+    {3206,1,0,0}, {3207,7,0,0}, {3214,1,0,0}, {3215,2,0,0},
+    {3217,1,0,0}, {3218,1,0,0}, {3219,1,0,0}, {3220,1,0,0},
+    {3221,1,0,0}, {3222,1,0,0}, {3223,1,0,0}, {3224,1,0,0},
+    {3225,2,0,0}, {3227,1,0,0}, {3228,1,0,0}, {3229,1,0,0},
+    {3230,1,0,0}, {3231,1,0,0}, {3232,1,0,0}, {3233,1,0,0},
+    {3234,1,0,0}, {3235,1,0,0}, {3236,1,0,0}, {3237,2,0,0},
+    {3239,1,0,0}, {3240,1,0,0}, {3241,1,2,136}, {3242,1,0,0},
+    {3243,1,0,0}, {3244,1,0,0}, {3245,1,0,0}, {3246,1,0,0},
+    {3247,1,0,0}, {3248,1,0,0}, {3249,1,0,0}, {3250,2,0,0},
+    {3252,1,0,0}, {3253,1,0,0}, {3254,1,0,0}, {3255,1,0,0},
+    {3256,1,0,0}, {3257,1,0,0}, {3258,1,0,0}, {3259,1,0,0},
+    {3260,1,0,0}, {3261,1,0,0}, {3262,1,0,0}, {3263,1,0,0},
+    {3264,1,0,0}, {3265,7,0,0}, {3272,1,0,0}, {3273,1,0,0},
+    {3274,3,0,0}, {3277,1,0,0}, {3278,2,0,0}, {3280,1,0,0},
+    {3281,1,0,0}, {3282,1,0,0}, {3283,1,0,0}, {3284,1,0,0},
+    {3285,1,0,0}, {3286,1,0,0}, {3287,2,0,0}, {3289,1,0,0},
+    {3290,1,0,0}, {3291,2,0,0}, {3293,1,0,0}, {3294,1,0,0},
+    {3295,1,0,0}, {0,0,3,138}, {0,0,3,141}, {3296,1,0,0},
+    {3297,1,0,0}, {3298,1,0,0}, {3299,1,0,0}, {3300,1,0,0},
+    {3301,1,0,0}, {3302,1,0,0}, {3303,1,0,0}, {3304,1,0,0},
+    {0,0,2,144}, {3305,1,0,0}, {3306,1,0,0}, {3307,1,0,0},
+    {3308,1,0,0}, {3309,1,0,0}, {3310,2,0,0}, {3312,1,0,0},
+    {3313,1,0,0}, {3314,1,0,0}, {3315,1,0,0}, {3316,1,0,0},
+    {3317,1,0,0}, {3318,1,0,0}, {3319,1,0,0}, {3320,1,0,0},
+    {3321,2,0,0}, {3323,1,0,0}, {3324,1,0,0}, {3325,1,2,146},
+    {3326,1,0,0}, {3327,1,0,0}, {3328,1,0,0}, {3329,1,0,0},
+    {3330,1,0,0}, {3331,1,0,0}, {3332,1,0,0}, {3333,1,0,0},
+    {3334,1,0,0}, {3335,1,0,0}, {3336,1,0,0}, {3337,1,0,0},
+    {3338,1,0,0}, {3339,1,0,0}, {3340,1,0,0}, {3341,1,0,0},
+    {3342,1,0,0}, {3343,1,0,0}, {3344,1,0,0}, {3345,1,0,0},
+    {0,0,1,2}, {3346,1,0,0}, {3347,1,0,0}, {3348,1,0,0},
+    {0,0,2,148}, {0,0,4,150}, {3349,1,0,0}, {3350,1,0,0},
+    {3351,1,0,0}, {0,0,3,154}, {3352,1,0,0}, {3353,1,0,0},
+    {3354,1,0,0}, {3355,1,0,0}, {3356,1,0,0}, {3357,1,0,0},
+    {3358,1,0,0}, {3359,1,2,157}, {3360,1,0,0}, {3361,1,0,0},
+    {3362,1,0,0}, {0,0,2,159}, {3363,1,0,0}, {3364,1,0,0},
+    {3365,1,0,0}, {0,0,4,161}, {3366,1,0,0}, {3367,1,0,0},
+    {3368,1,0,0}, {3369,1,0,0}, {3370,1,0,0}, {3371,1,2,165},
+    {3372,1,0,0}, {0,0,3,167}, {3373,1,0,0}, {3374,1,0,0},
+    {3375,1,0,0}, {3376,1,0,0}, {3377,1,0,0}, {3378,1,0,0},
+    {3379,1,0,0}, {3380,1,0,0}, {3381,1,0,0}, {0,0,3,170},
+    {0,0,2,173}, {3382,1,0,0}, {3383,1,0,0}, {3384,1,0,0},
+    {3385,1,0,0}, {3386,1,0,0}, {3387,1,0,0}, {3388,1,0,0},
+    {3389,1,0,0}, {3390,1,0,0}, {3391,1,0,0}, {3392,1,0,0},
+    {3393,1,0,0}, {0,0,3,175}, {3394,1,0,0}, {3395,1,0,0},
+    {3396,1,0,0}, {3397,1,0,0}, {3398,1,0,0}, {3399,1,0,0},
+    {3400,1,0,0}, {3401,1,0,0}, {3402,1,0,0}, {0,0,2,178},
+    {0,0,3,180}, {3403,1,0,0}, {0,0,4,183}, {3404,1,0,0},
+    {3405,1,0,0}, {3406,1,0,0}, {3407,1,0,0}, {0,0,2,136},
+    {3408,1,0,0}, {3409,1,0,0}, {3410,1,0,0}, {3411,6,0,0},
+    {3417,1,0,0}, {3418,1,0,0}, {0,0,2,187}, {0,0,2,6},
+    {3419,1,0,0}, {3420,1,0,0}, {3421,1,0,0}, {0,0,2,189},
+    {3422,1,0,0}, {0,0,4,191}, {3423,1,0,0}, {3424,1,0,0},
+    {3425,1,0,0}, {3426,1,0,0}, {3427,1,0,0}, {3428,1,0,0},
+    {3429,1,0,0}, {3430,1,0,0}, {3431,1,0,0}, {3432,1,0,0},
+    {3433,1,0,0}, {0,0,2,195}, {3434,1,2,197}, {3435,1,0,0},
+    {3436,1,0,0}, {0,0,2,199}, {0,0,4,201}, {3437,1,0,0},
+    {3438,1,0,0}, {3439,1,0,0}, {3440,1,0,0}, {3441,1,0,0},
+    {3442,1,0,0}, {3443,1,0,0}, {3444,1,0,0}, {3445,1,0,0},
+    {3446,1,0,0}, {0,0,2,205}, {3447,1,0,0}, {0,0,4,207},
+    {3448,1,0,0}, {3449,1,0,0}, {3450,1,0,0}, {3451,1,0,0},
+    {3452,1,0,0}, {0,0,1,211}, {3453,1,0,0}, {0,0,3,212},
+    {3454,1,0,0}, {3455,1,0,0}, {3456,1,0,0}, {3457,1,0,0},
+    {3458,1,0,0}, {3459,2,0,0}, {3461,1,0,0}, {3462,1,0,0},
+    {3463,1,0,0}, {3464,1,0,0}, {3465,1,0,0}, {0,0,2,215},
+    {3466,1,0,0}, {0,0,3,14}, {3467,1,0,0}, {3468,1,0,0},
+    {3469,1,0,0}, {3470,1,0,0}, {0,0,3,217}, {3471,2,0,0},
+    {3473,1,0,0}, {3474,1,0,0}, {3475,1,0,0}, {3476,1,0,0},
+    {3477,1,0,0}, {3478,1,0,0}, {3479,1,0,0}, {3480,1,2,220},
+    {3481,1,0,0}, {0,0,2,222}, {0,0,4,224}, {3482,1,0,0},
+    {3483,1,0,0}, {3484,1,0,0}, {3485,1,0,0}, {3486,1,0,0},
+    {3487,1,0,0}, {3488,1,0,0}, {3489,1,0,0}, {0,0,2,228},
+    {0,0,4,230}, {3490,1,0,0}, {3491,1,0,0}, {3492,1,0,0},
+    {3493,1,0,0}, {3494,1,0,0}, {3495,1,0,0}, {3496,1,0,0},
+    {3497,1,0,0}, {3498,1,0,0}, {3499,1,0,0}, {0,0,2,234},
+    {3500,10,0,0}, {3510,6,0,0}, {0,0,4,236}, {3516,1,0,0},
+    {3517,1,0,0}, {3518,4,0,0}, {3522,1,0,0}, {3523,1,0,0},
+    {3524,1,0,0}, {0,0,3,240}, {3525,1,0,0}, {0,0,3,243},
+    {0,0,2,246}, {3526,1,0,0}, {3527,1,0,0}, {0,0,4,248},
+    {3528,1,0,0}, {3529,1,0,0}, {3530,1,0,0}, {3531,1,0,0},
+    {3532,1,0,0}, {3533,1,0,0}, {3534,1,0,0}, {0,0,2,252},
+    {3535,1,0,0}, {3536,1,0,0}, {3537,1,0,0}, {0,0,4,254},
+    {3538,1,0,0}, {3539,1,0,0}, {3540,1,0,0}, {0,0,3,258},
+    {3541,2,0,0}, {3543,1,0,0}, {3544,3,0,0}, {3547,1,0,0},
+    {3548,1,0,0}, {3549,1,0,0}, {3550,1,0,0}, {3551,1,0,0},
+    {3552,2,0,0}, {3554,2,0,0}, {3556,1,0,0}, {3557,1,0,0},
+    {3558,1,0,0}, {3559,1,0,0}, {3560,1,0,0}, {3561,1,0,0},
+    {3562,1,0,0}, {0,0,2,261}, {3563,1,0,0}, {0,0,4,263},
+    {3564,1,0,0}, {3565,1,0,0}, {3566,1,0,0}, {3567,1,0,0},
+    {3568,1,0,0}, {3569,1,0,0}, {3570,1,0,0}, {3571,1,0,0},
+    {3572,1,0,0}, {3573,1,0,0}, {3574,1,2,267}, {3575,2,0,0},
+    {3577,1,0,0}, {0,0,2,269}, {0,0,4,271}, {0,0,2,275},
+    {3578,1,0,0}, {3579,1,0,0}, {3580,1,0,0}, {3581,1,0,0},
+    {3582,1,0,0}, {3583,1,0,0}, {3584,1,0,0}, {3585,1,0,0},
+    {0,0,2,277}, {3586,1,1,279}, {0,0,4,280}, {3587,1,0,0},
+    {3588,1,0,0}, {3589,1,0,0}, {0,0,2,35}, {3590,1,0,0},
+    {3591,1,0,0}, {3592,2,0,0}, {3594,1,0,0}, {3595,1,0,0},
+    {0,0,2,284}, {3596,1,0,0}, {0,0,3,37}, {0,0,2,286},
+    {3597,1,0,0}, {3598,1,0,0}, {3599,1,0,0}, {3600,1,0,0},
+    {3601,1,0,0}, {0,0,3,288}, {3602,1,0,0}, {3603,1,0,0},
+    {3604,1,0,0}, {3605,1,0,0}, {3606,1,0,0}, {3607,1,0,0},
+    {3608,1,0,0}, {3609,1,0,0}, {0,0,2,291}, {0,0,4,293},
+    {3610,1,0,0}, {3611,1,0,0}, {3612,1,0,0}, {3613,1,0,0},
+    {3614,1,0,0}, {3615,1,0,0}, {3616,1,0,0}, {3617,1,0,0},
+    {0,0,3,297}, {3618,1,0,0}, {3619,1,0,0}, {3620,1,0,0},
+    {0,0,3,300}, {0,0,3,303}, {3621,1,0,0}, {3622,1,0,0},
+    {3623,1,0,0}, {3624,1,0,0}, {3625,1,0,0}, {3626,1,0,0},
+    {0,0,1,306}, {0,0,2,307}, {3627,1,0,0}, {3628,1,0,0},
+    {0,0,2,309}, {0,0,4,311}, {3629,1,0,0}, {3630,1,0,0},
+    {3631,1,0,0}, {3632,1,0,0}, {3633,1,0,0}, {3634,1,0,0},
+    {3635,1,0,0}, {3636,1,0,0}, {3637,1,0,0}, {3638,1,0,0},
+    {3639,2,0,0}, {3641,1,0,0}, {3642,1,0,0}, {3643,1,0,0},
+    {0,0,2,315}, {3644,1,0,0}, {0,0,4,317}, {3645,1,0,0},
+    {3646,1,0,0}, {3647,1,0,0}, {3648,1,0,0}, {3649,1,0,0},
+    {3650,1,0,0}, {3651,1,0,0}, {3652,1,0,0}, {3653,1,0,0},
+    {3654,1,0,0}, {3655,1,0,0}, {3656,1,0,0}, {3657,1,0,0},
+    {3658,2,0,0}, {3660,1,0,0}, {3661,1,0,0}, {3662,1,0,0},
+    {3663,1,2,321}, {3664,1,0,0}, {3665,1,0,0}, {0,0,2,323},
+    {3666,1,0,0}, {0,0,3,325}, {3667,1,0,0}, {3668,2,0,0},
+    {3670,1,0,0}, {0,0,4,328}, {3671,1,0,0}, {3672,1,0,0},
+    {3673,1,0,0}, {3674,1,0,0}, {3675,1,0,0}, {0,0,4,332},
+    {3676,1,0,0}, {3677,1,0,0}, {0,0,4,336}, {3678,1,0,0},
+    {3679,1,0,0}, {3680,1,0,0}, {3681,1,0,0}, {3682,1,0,0},
+    {3683,1,0,0}, {3684,1,0,0}, {0,0,2,340}, {0,0,4,342},
+    {3685,1,0,0}, {3686,1,0,0}, {3687,1,0,0}, {3688,1,0,0},
+    {3689,1,0,0}, {3690,1,0,0}, {0,0,2,346}, {3691,1,0,0},
+    {3692,1,0,0}, {3693,1,0,0}, {0,0,3,348}, {3694,1,0,0},
+    {3695,1,0,0}, {3696,1,0,0}, {3697,1,0,0}, {0,0,5,351},
+    {0,0,3,356}, {3698,1,0,0}, {3699,1,0,0}, {0,0,2,359},
+    {3700,1,0,0}, {0,0,4,361}, {3701,1,0,0}, {3702,1,0,0},
+    {3703,1,0,0}, {3704,1,0,0}, {3705,1,0,0}, {3706,1,0,0},
+    {0,0,1,2}, {0,0,3,365}, {3707,1,0,0}, {3708,1,0,0},
+    {3709,1,0,0}, {3710,1,0,0}, {0,0,3,368}, {3711,1,0,0},
+    {3712,1,0,0}, {3713,1,0,0}, {3714,1,0,0}, {3715,2,0,0},
+    {3717,1,0,0}, {3718,1,0,0}, {3719,1,0,0}, {0,0,3,371},
+    {3720,1,0,0}, {0,0,3,374}, {3721,1,0,0}, {3722,1,0,0},
+    {3723,1,0,0}, {3724,1,0,0}, {3725,1,0,0}, {0,0,1,377},
+    {3726,1,0,0}, {3727,1,0,0}, {3728,1,2,378}, {3729,1,0,0},
+    {3730,1,0,0}, {3731,1,0,0}, {3732,4,0,0}, {3736,1,0,0},
+    {3737,1,0,0}, {3738,2,0,0}, {3740,1,0,0}, {0,0,2,380},
+    {3741,1,0,0}, {3742,1,0,0}, {3743,1,0,0}, {3744,1,0,0},
+    {3745,1,0,0}, {3746,1,0,0}, {3747,1,0,0}, {3748,1,0,0},
+    {0,0,4,382}, {3749,3,0,0}, {3752,3,0,0}, {3755,2,0,0},
+    {3757,1,0,0}, {3758,1,0,0}, {3759,1,0,0}, {3760,1,0,0},
+    {3761,1,0,0}, {3762,1,0,0}, {3763,1,0,0}, {3764,2,0,0},
+    {3766,1,0,0}, {3767,1,0,0}, {0,0,4,386}, {3768,1,0,0},
+    {3769,1,0,0}, {3770,1,0,0}, {0,0,3,390}, {3771,1,0,0},
+    {3772,1,0,0}, {3773,4,0,0}, {3777,5,0,0}, {3782,4,0,0},
+    {3786,7,0,0}, {3793,1,0,0}, {3794,4,0,0}, {3798,5,0,0},
+    {3803,1,0,0}, {3804,1,0,0}, {3805,1,0,0}, {3806,4,0,0},
+    {3810,7,0,0}, {3817,1,0,0}, {3818,1,0,0}, {3819,1,0,0},
+    {3820,1,0,0}, {3821,1,0,0}, {3822,2,0,0}, {3824,3,0,0},
+    {3827,2,0,0}, {3829,3,0,0}, {3832,1,0,0}, {0,0,3,393},
+    {3833,1,0,0}, {3834,1,0,0}, {3835,2,0,0}, {3837,1,0,0},
+    {3838,1,0,0}, {3839,1,0,0}, {3840,1,0,0}, {3841,1,0,0},
+    {3842,1,0,0}, {3843,1,0,0}, {3844,1,0,0}, {3845,1,0,0},
+    {3846,1,0,0}, {3847,1,0,0}, {3848,1,0,0}, {3849,2,2,396},
+    {0,0,4,398}, {3851,1,0,0}, {3852,1,0,0}, {0,0,2,402},
+    {0,0,3,404}, {3853,1,0,0}, {3854,3,0,0}, {3857,1,0,0},
+    {3858,1,0,0}, {3859,1,0,0}, {3860,1,0,0}, {3861,1,0,0},
+    {3862,1,0,0}, {3863,1,0,0}, {3864,3,0,0}, {3867,2,0,0},
+    {3869,1,0,0}, {3870,1,0,0}, {3871,1,0,0}, {3872,2,2,165},
+    {3874,1,0,0}, {3875,1,0,0}, {3876,1,0,0}, {3877,2,0,0},
+    {3879,2,0,0}, {3881,1,0,0}, {3882,1,0,0}, {3883,1,0,0},
+    {3884,1,0,0}, {3885,1,0,0}, {0,0,3,407}, {3886,1,0,0},
+    {3887,2,0,0}, {3889,1,0,0}, {3890,1,0,0}, {3891,1,0,0},
+    {3892,1,0,0}, {3893,1,0,0}, {3894,1,0,0}, {3895,1,0,0},
+    {3896,1,0,0}, {3897,1,0,0}, {3898,1,0,0}, {3899,1,0,0},
+    {3900,1,0,0}, {3901,1,0,0}, {3902,1,0,0}, {3903,1,0,0},
+    {3904,1,0,0}, {3905,1,0,0}, {3906,2,0,0}, {3908,1,0,0},
+    {3909,1,0,0}, {3910,1,0,0}, {0,0,2,410}, {3911,1,0,0},
+    {3912,1,0,0}, {3913,1,0,0}, {0,0,2,57}, {3914,1,0,0},
+    {3915,1,0,0}, {3916,1,0,0}, {0,0,4,412}, {3917,2,0,0},
+    {3919,3,0,0}, {0,0,2,136}, {3922,1,0,0}, {3923,1,0,0},
+    {0,0,2,416}, {3924,1,0,0}, {3925,1,0,0}, {3926,1,0,0},
+    {3927,1,0,0}, {3928,1,0,0}, {3929,1,0,0}, {3930,1,0,0},
+    {0,0,2,418}, {3931,1,0,0}, {3932,1,0,0}, {3933,1,0,0},
+    {3934,1,0,0}, {3935,1,0,0}, {3936,3,0,0}, {3939,1,0,0},
+    {3940,1,0,0}, {3941,1,0,0}, {3942,1,0,0}, {3943,1,0,0},
+    {3944,1,0,0}, {3945,1,0,0}, {3946,1,0,0}, {3947,2,0,0},
+    {3949,1,0,0}, {3950,1,0,0}, {3951,1,0,0}, {3952,1,0,0},
+    {3953,1,0,0}, {3954,1,0,0}, {3955,1,0,0}, {3956,1,0,0},
+    {3957,1,0,0}, {3958,1,0,0}, {3959,2,0,0}, {3961,1,0,0},
+    {0,0,2,420}, {3962,1,0,0}, {3963,1,0,0}, {0,0,4,422},
+    {3964,1,0,0}, {0,0,3,426}, {3965,1,0,0}, {3966,1,0,0},
+    {0,0,3,429}, {0,0,3,432}, {3967,1,0,0}, {3968,1,0,0},
+    {3969,1,0,0}, {3970,2,0,0}, {0,0,2,435}, {3972,1,0,0},
+    {3973,1,0,0}, {3974,1,0,0}, {3975,2,0,0}, {3977,1,0,0},
+    {3978,3,0,0}, {3981,1,0,0}, {3982,1,0,0}, {3983,1,0,0},
+    {3984,1,0,0}, {3985,1,0,0}, {3986,1,0,0}, {3987,1,0,0},
+    {3988,1,0,0}, {3989,1,0,0}, {3990,1,0,0}, {3991,1,0,0},
+    {3992,1,0,0}, {3993,1,0,0}, {0,0,2,437}, {0,0,2,68},
+    {3994,1,2,439}, {3995,1,0,0}, {3996,1,0,0}, {3997,1,0,0},
+    {3998,1,0,0}, {3999,1,0,0}, {4000,1,0,0}, {0,0,2,441},
+    {4001,1,0,0}, {4002,1,0,0}, {4003,1,0,0}, {4004,1,0,0},
+    {0,0,4,443}, {4005,1,0,0}, {4006,1,0,0}, {4007,1,0,0},
+    {4008,1,0,0}, {4009,1,0,0}, {4010,1,0,0}, {4011,1,0,0},
+    {4012,1,0,0}, {4013,2,0,0}, {4015,1,0,0}, {4016,6,0,0},
+    {4022,1,0,0}, {4023,1,0,0}, {4024,1,0,0}, {0,0,3,447},
+    {4025,1,0,0}, {4026,1,0,0}, {0,0,3,450}, {4027,1,0,0},
+    {4028,1,0,0}, {0,0,2,453}, {4029,1,0,0}, {0,0,3,455},
+    {0,0,3,73}, {4030,1,0,0}, {4031,1,0,0}, {0,0,3,458},
+    {4032,1,0,0}, {4033,1,0,0}, {4034,2,0,0}, {0,0,4,461},
+    {0,0,3,8}, {4036,1,0,0}, {4037,1,0,0}, {0,0,3,465},
+    {0,0,3,468}, {0,0,3,471}, {0,0,3,474}, {4038,2,0,0},
+    {0,0,3,477}, {4040,2,0,0}, {4042,1,0,0}, {4043,1,0,0},
+    {4044,1,0,0}, {4045,1,0,0}, {4046,3,0,0}, {4049,1,0,0},
+    {4050,1,0,0}, {4051,1,0,0}, {4052,1,0,0}, {4053,1,0,0},
+    {4054,2,0,0}, {4056,1,0,0}, {4057,1,0,0}, {4058,1,0,0},
+    {4059,1,0,0}, {4060,1,0,0}, {4061,1,0,0}, {4062,1,0,0},
+    {4063,1,0,0}, {4064,1,0,0}, {4065,1,0,0}, {4066,1,0,0},
+    {4067,3,0,0}, {4070,1,0,0}, {4071,1,0,0}, {4072,1,0,0},
+    {4073,1,0,0}, {4074,1,0,0}, {0,0,4,480}, {4075,1,0,0},
+    {4076,1,0,0}, {4077,1,0,0}, {4078,1,0,0}, {4079,2,0,0},
+    {4081,1,0,0}, {4082,1,0,0}, {4083,1,0,0}, {4084,1,0,0},
+    {4085,1,0,0}, {4086,1,0,0}, {4087,1,0,0}, {4088,1,0,0},
+    {4089,1,0,0}, {0,0,2,484}, {4090,1,0,0}, {4091,1,0,0},
+    {0,0,3,486}, {0,0,4,489}, {4092,1,0,0}, {4093,1,0,0},
+    {4094,1,0,0}, {4095,1,0,0}, {4096,1,0,0}, {4097,1,0,0},
+    {4098,1,0,0}, {4099,3,0,0}, {4102,1,0,0}, {4103,1,0,0},
+    {4104,1,0,0}, {4105,1,0,0}, {4106,1,0,0}, {4107,1,0,0},
+    {0,0,3,493}, {4108,1,0,0}, {4109,2,0,0}, {4111,1,0,0},
+    {4112,1,0,0}, {4113,1,0,0}, {4114,1,0,0}, {4115,1,0,0},
+    {4116,1,0,0}, {4117,1,0,0}, {4118,1,0,0}, {4119,1,0,0},
+    {4120,5,0,0}, {4125,1,0,0}, {4126,1,0,0}, {4127,1,2,496},
+    {4128,1,0,0}, {0,0,2,498}, {0,0,4,500}, {4129,1,0,0},
+    {4130,1,0,0}, {4131,1,0,0}, {4132,1,0,0}, {4133,1,0,0},
+    {4134,1,0,0}, {4135,1,0,0}, {0,0,2,504}, {0,0,4,506},
+    {4136,1,0,0}, {4137,1,0,0}, {4138,1,0,0}, {4139,1,0,0},
+    {4140,1,0,0}, {4141,1,0,0}, {4142,1,0,0}, {4143,1,0,0},
+    {4144,1,0,0}, {0,0,3,510}, {4145,1,0,0}, {4146,1,0,0},
+    {4147,1,0,0}, {4148,1,0,0}, {4149,1,0,0}, {4150,3,0,0},
+    {0,0,3,513}, {4153,1,0,0}, {4154,8,0,0}, {0,0,3,516},
+    {4162,1,0,0}, {4163,2,0,0}, {4165,1,0,0}, {4166,1,0,0},
+    {4167,1,0,0}, {4168,2,0,0}, {4170,1,0,0}, {4171,1,0,0},
+    {4172,1,0,0}, {4173,1,0,0}, {0,0,2,519}, {4174,1,0,0},
+    {4175,1,0,0}, {4176,1,0,0}, {4177,1,0,0}, {4178,1,0,0},
+    {4179,5,0,0}, {0,0,3,521}, {0,0,3,94}, {4184,1,0,0},
+    {4185,1,0,0}, {0,0,3,524}, {4186,1,0,0}, {4187,1,0,0},
+    {4188,2,0,0}, {4190,5,0,0}, {4195,1,0,0}, {4196,1,0,0},
+    {0,0,4,527}, {0,0,3,531}, {4197,2,0,0}, {4199,1,0,0},
+    {4200,1,0,0}, {4201,1,0,0}, {4202,1,0,0}, {4203,1,0,0},
+    {4204,1,0,0}, {4205,1,0,0}, {4206,1,0,0}, {0,0,3,534},
+    {4207,2,0,0}, {0,0,3,537}, {4209,2,0,0}, {4211,1,0,0},
+    {4212,1,0,0}, {4213,1,0,0}, {4214,1,0,0}, {4215,3,0,0},
+    {4218,1,0,0}, {4219,1,0,0}, {4220,1,0,0}, {4221,1,0,0},
+    {4222,1,0,0}, {4223,1,0,0}, {4224,1,0,0}, {0,0,3,540},
+    {4225,1,0,0}, {4226,1,0,0}, {4227,2,0,0}, {4229,1,0,0},
+    {4230,1,0,0}, {4231,1,0,0}, {0,0,3,543}, {4232,1,0,0},
+    {4233,1,0,0}, {4234,1,0,0}, {0,0,3,240}, {4235,3,0,0},
+    {4238,1,0,0}, {4239,1,0,0}, {4240,1,0,0}, {4241,1,0,0},
+    {4242,1,0,0}, {4243,1,0,0}, {4244,1,0,0}, {4245,1,0,0},
+    {4246,1,0,0}, {4247,1,0,0}, {4248,1,0,0}, {4249,3,0,0},
+    {4252,1,0,0}, {4253,1,0,0}, {4254,1,0,0}, {4255,1,0,0},
+    {4256,1,0,0}, {4257,1,2,546}, {4258,1,0,0}, {4259,2,0,0},
+    {0,0,3,548}, {4261,1,0,0}, {4262,1,0,0}, {4263,1,0,0},
+    {0,0,2,551}, {4264,1,0,0}, {4265,1,0,0}, {0,0,4,553},
+    {0,0,3,557}, {4266,1,0,0}, {0,0,3,560}, {4267,1,0,0},
+    {4268,1,0,0}, {4269,1,0,0}, {4270,1,0,0}, {4271,1,0,0},
+    {4272,1,0,0}, {4273,1,0,0}, {4274,1,0,0}, {4275,1,0,0},
+    {4276,1,0,0}, {4277,1,0,0}, {4278,1,0,0}, {4279,1,0,0},
+    {0,0,5,563}, {0,0,6,568}, {4280,1,0,0}, {4281,1,0,0},
+    {0,0,5,574}, {0,0,6,579}, {4282,1,0,0}, {4283,1,0,0},
+    {4284,1,0,0}, {4285,1,0,0}, {4286,1,0,0}, {4287,1,0,0},
+    {4288,1,0,0}, {0,0,3,585}, {4289,1,0,0}, {4290,1,0,0},
+    {4291,1,0,0}, {4292,1,0,0}, {4293,1,0,0}, {4294,1,2,588},
+    {4295,1,0,0}, {4296,1,0,0}, {4297,1,0,0}, {4298,1,0,0},
+    {4299,1,0,0}, {4300,1,0,0}, {0,0,2,590}, {4301,1,0,0},
+    {4302,1,0,0}, {4303,2,0,0}, {4305,1,0,0}, {4306,1,0,0},
+    {4307,1,0,0}, {4308,1,0,0}, {4309,1,0,0}, {0,0,4,592},
+    {0,0,5,596}, {0,0,3,601}, {4310,3,0,0}, {4313,1,0,0},
+    {4314,1,0,0}, {0,0,3,604}, {4315,1,0,0}, {4316,1,0,0},
+    {4317,1,0,0}, {4318,1,0,0}, {0,0,3,607}, {4319,1,0,0},
+    {0,0,3,108}, {4320,1,0,0}, {4321,1,0,0}, {0,0,5,610},
+    {4322,1,0,0}, {4323,1,0,0}, {0,0,3,615}, {4324,1,0,0},
+    {4325,3,0,0}, {4328,2,0,0}, {4330,1,0,0}, {0,0,3,618},
+    {4331,1,0,0}, {4332,1,0,0}, {4333,1,0,0}, {0,0,2,111},
+    {4334,1,0,0}, {4335,1,0,0}, {4336,4,0,0}, {4340,1,0,0},
+    {0,0,3,621}, {4341,1,0,0}, {4342,2,0,0}, {4344,1,0,0},
+    {4345,1,0,0}, {4346,1,0,0}, {4347,1,0,0}, {0,0,3,624},
+    {4348,1,0,0}, {4349,1,0,0}, {4350,1,0,0}, {4351,1,0,0},
+    {4352,2,0,0}, {4354,1,0,0}, {4355,1,0,0}, {4356,1,0,0},
+    {4357,4,0,0}, {4361,1,0,0}, {4362,4,0,0}, {4366,1,0,0},
+    {4367,1,0,0}, {4368,1,0,0}, {4369,1,0,0}, {0,0,1,627},
+    {4370,1,0,0}, {4371,1,0,0}, {4372,1,0,0}, {4373,1,0,0},
+    {4374,1,0,0}, {4375,1,0,0}, {4376,1,0,0}, {4377,1,0,0},
+    {4378,1,0,0}, {4379,1,0,0}, {4380,1,0,0}, {4381,2,0,0},
+    {4383,1,0,0}, {4384,1,0,0}, {4385,1,0,0}, {4386,1,0,0},
+    {4387,2,0,0}, {4389,1,0,0}, {4390,1,0,0}, {4391,1,0,0},
+    {4392,2,0,0}, {0,0,2,628}, {4394,1,0,0}, {4395,1,0,0},
+    {4396,1,0,0}, {4397,1,0,0}, {4398,1,0,0}, {4399,1,0,0},
+    {4400,1,0,0}, {0,0,4,630}, {4401,1,0,0}, {4402,1,0,0},
+    {0,0,3,634}, {4403,1,0,0}, {0,0,2,637}, {4404,1,0,0},
+    {4405,1,0,0}, {4406,1,0,0}, {4407,1,0,0}, {4408,1,0,0},
+    {0,0,3,639}, {4409,1,0,0}, {4410,1,0,0}, {4411,1,0,0},
+    {4412,1,0,0}, {4413,1,0,0}, {4414,1,0,0}, {4415,1,0,0},
+    {4416,1,0,0}, {4417,1,0,0}, {4418,1,0,0}, {0,0,3,642},
+    {4419,1,0,0}, {4420,1,2,645}, {4421,1,2,647}, {4422,1,0,0},
+    {4423,1,0,0}, {4424,1,0,0}, {0,0,3,649}, {4425,1,0,0},
+    {4426,1,0,0}, {4427,1,0,0}, {4428,1,0,0}, {4429,1,0,0},
+    {4430,1,2,652}, {4431,1,0,0}, {0,0,3,654}, {4432,2,2,657},
+    {4434,2,0,0}, {4436,1,0,0}, {0,0,2,659}, {4437,1,0,0},
+    {4438,1,0,0}, {4439,1,0,0}, {4440,1,0,0}, {4441,1,0,0},
+    {0,0,4,661}, {0,0,2,665}, {4442,1,0,0}, {4443,1,0,0},
+    {4444,1,0,0}, {4445,1,0,0}, {0,0,2,667}, {4446,2,0,0},
+    {4448,9,0,0}, {4457,1,0,0}, {4458,1,0,0}, {4459,1,0,0},
+    {0,0,3,669}, {4460,1,0,0}, {4461,1,0,0}, {0,0,3,672},
+    {4462,6,0,0}, {4468,1,0,0}, {4469,1,0,0}, {4470,1,0,0},
+    {4471,1,0,0}, {4472,1,0,0}, {4473,3,0,0}, {4476,2,0,0},
+    {4478,1,0,0}, {4479,1,0,0}, {4480,1,0,0}, {0,0,2,675},
+    {4481,1,0,0}, {0,0,4,677}, {4482,1,0,0}, {4483,1,0,0},
+    {4484,1,0,0}, {4485,1,0,0}, {4486,2,0,0}, {4488,1,0,0},
+    {4489,1,1,279}, {4490,1,0,0}, {4491,1,0,0}, {4492,1,0,0},
+    {4493,1,0,0}, {4494,1,0,0}, {4495,1,0,0}, {4496,1,0,0},
+    {4497,1,0,0}, {4498,1,0,0}, {4499,4,0,0}, {4503,1,0,0},
+    {4504,11,0,0}, {4515,1,0,0}, {4516,1,0,0}, {4517,1,0,0},
+    {4518,1,0,0}, {4519,1,0,0}, {4520,2,0,0}, {4522,1,0,0},
+    {4523,1,0,0}, {4524,1,0,0}, {4525,1,0,0}, {0,0,2,681},
+    {4526,1,0,0}, {4527,1,0,0}, {4528,1,0,0}, {4529,1,0,0},
+    {4530,4,0,0}, {4534,1,0,0}, {0,0,2,35}, {4535,1,0,0},
+    {4536,1,0,0}, {0,0,4,683}, {4537,2,0,0}, {0,0,2,687},
+    {4539,1,0,0}, {4540,1,0,0}, {4541,1,0,0}, {4542,1,0,0},
+    {4543,1,0,0}, {4544,1,0,0}, {0,0,3,689}, {4545,1,0,0},
+    {4546,1,0,0}, {4547,1,0,0}, {4548,1,0,0}, {4549,1,0,0},
+    {4550,1,0,0}, {4551,1,0,0}, {4552,1,0,0}, {4553,1,0,0},
+    {4554,2,0,0}, {4556,1,0,0}, {4557,1,0,0}, {4558,1,0,0},
+    {4559,1,0,0}, {0,0,3,288}, {4560,1,0,0}, {4561,1,0,0},
+    {4562,1,0,0}, {4563,1,0,0}, {4564,4,0,0}, {4568,1,0,0},
+    {4569,1,0,0}, {4570,1,0,0}, {0,0,3,692}, {4571,1,0,0},
+    {4572,1,0,0}, {4573,1,0,0}, {0,0,3,695}, {4574,1,0,0},
+    {4575,1,0,0}, {4576,1,0,0}, {4577,1,0,0}, {4578,1,0,0},
+    {4579,1,0,0}, {4580,1,0,0}, {0,0,2,698}, {4581,3,0,0},
+    {4584,1,0,0}, {4585,2,0,0}, {4587,1,2,700}, {4588,1,0,0},
+    {4589,1,0,0}, {4590,2,0,0}, {4592,1,0,0}, {0,0,4,702},
+    {4593,1,0,0}, {4594,1,0,0}, {4595,1,0,0}, {4596,1,0,0},
+    {4597,1,0,0}, {0,0,2,134}, {4598,1,0,0}, {0,0,3,706},
+    {4599,1,0,0}, {4600,2,0,0}, {4602,2,0,0}, {4604,2,0,0},
+    {4606,1,0,0}, {4607,1,0,0}, {4608,1,0,0}, {4609,1,0,0},
+    {4610,1,0,0}, {4611,1,0,0}, {4612,1,0,0}, {4613,1,0,0},
+    {4614,1,0,0}, {0,0,3,709}, {4615,2,0,0}, {4617,1,0,0},
+    {0,0,1,712}, {4618,2,0,0}, {4620,1,0,0}, {4621,1,0,0},
+    {4622,1,0,0}, {4623,1,0,0}, {4624,1,0,0}, {4625,2,0,0},
+    {0,0,3,713}, {4627,1,0,0}, {4628,1,0,0}, {4629,1,0,0},
+    {4630,1,0,0}, {4631,1,0,0}, {4632,1,0,0}, {4633,1,0,0},
+    {4634,2,0,0}, {4636,1,0,0}, {4637,1,0,0}, {0,0,3,716},
+    {4638,1,0,0}, {4639,1,0,0}, {4640,2,0,0}, {4642,1,0,0},
+    {4643,2,0,0}, {4645,1,0,0}, {4646,1,0,0}, {4647,3,0,0},
+    {4650,6,0,0}, {0,0,3,300}, {4656,1,0,0}, {4657,1,2,719},
+    {4658,1,2,721}, {4659,1,2,723}, {0,0,3,725}, {4660,1,0,0},
+    {4661,2,0,0}, {4663,2,0,0}, {4665,1,0,0}, {4666,1,0,0},
+    {4667,1,0,0}, {4668,2,0,0}, {4670,1,0,0}, {4671,3,0,0},
+    {4674,1,0,0}, {4675,2,0,0}, {4677,1,0,0}, {4678,1,0,0},
+    {4679,1,0,0}, {0,0,2,728}, {4680,1,0,0}, {4681,1,0,0},
+    {4682,1,0,0}, {0,0,2,730}, {4683,1,0,0}, {4684,1,0,0},
+    {0,0,4,732}, {4685,1,0,0}, {4686,1,0,0}, {4687,1,0,0},
+    {4688,1,0,0}, {4689,1,0,0}, {4690,1,0,0}, {4691,1,0,0},
+    {4692,1,0,0}, {4693,1,0,0}, {4694,1,0,0}, {4695,1,0,0},
+    {0,0,3,736}, {4696,1,0,0}, {4697,1,0,0}, {4698,2,0,0},
+    {4700,1,0,0}, {4701,1,0,0}, {4702,1,0,0}, {4703,1,0,0},
+    {4704,1,0,0}, {4705,1,0,0}, {4706,1,0,0}, {4707,1,0,0},
+    {4708,1,0,0}, {4709,1,0,0}, {4710,1,0,0}, {4711,1,0,0},
+    {4712,1,0,0}, {4713,1,0,0}, {4714,1,0,0}, {4715,1,0,0},
+    {4716,1,0,0}, {4717,1,0,0}, {4718,1,0,0}, {4719,1,0,0},
+    {4720,1,0,0}, {4721,1,0,0}, {4722,1,0,0}, {4723,1,0,0},
+    {0,0,2,739}, {4724,1,0,0}, {4725,1,0,0}, {4726,1,0,0},
+    {4727,1,0,0}, {0,0,4,741}, {4728,1,0,0}, {4729,2,0,0},
+    {4731,1,0,0}, {4732,1,0,0}, {4733,1,0,0}, {4734,1,0,0},
+    {4735,1,0,0}, {0,0,2,136}, {4736,1,0,0}, {4737,1,0,0},
+    {4738,1,0,0}, {4739,1,0,0}, {4740,1,0,0}, {4741,1,0,0},
+    {4742,3,0,0}, {4745,1,0,0}, {4746,1,0,0}, {4747,1,0,0},
+    {4748,1,0,0}, {4749,1,0,0}, {4750,1,0,0}, {4751,1,0,0},
+    {4752,1,0,0}, {4753,2,0,0}, {4755,1,0,0}, {4756,1,2,745},
+    {4757,1,0,0}, {4758,1,0,0}, {4759,2,0,0}, {4761,1,0,0},
+    {4762,1,0,0}, {4763,1,0,0}, {4764,1,0,0}, {4765,1,0,0},
+    {4766,3,0,0}, {4769,2,0,0}, {4771,2,0,0}, {4773,2,0,0},
+    {0,0,2,747}, {4775,1,0,0}, {0,0,3,118}, {4776,1,0,0},
+    {4777,1,0,0}, {4778,1,0,0}, {4779,1,0,0}, {4780,1,0,0},
+    {0,0,4,749}, {4781,1,0,0}, {4782,2,0,0}, {4784,1,0,0},
+    {4785,1,0,0}, {4786,1,0,0}, {4787,1,0,0}, {4788,1,0,0},
+    {4789,1,0,0}, {4790,1,0,0}, {4791,1,0,0}, {4792,1,0,0},
+    {4793,1,0,0}, {4794,1,0,0}, {0,0,4,753}, {4795,1,0,0},
+    {4796,1,0,0}, {4797,1,0,0}, {4798,1,0,0}, {4799,1,0,0},
+    {4800,1,0,0}, {4801,1,0,0}, {0,0,4,757}, {4802,1,0,0},
+    {4803,1,0,0}, {4804,1,0,0}, {4805,1,0,0}, {4806,1,0,0},
+    {4807,1,0,0}, {4808,1,0,0}, {4809,1,0,0}, {4810,1,0,0},
+    {4811,1,0,0}, {4812,1,0,0}, {4813,1,0,0}, {4814,1,0,0},
+    {4815,1,0,0}, {4816,1,0,0}, {4817,1,0,0}, {4818,1,0,0},
+    {4819,1,0,0}, {4820,1,0,0}, {4821,1,0,0}, {4822,1,0,0},
+    {0,0,2,761}, {0,0,2,146}, {0,0,4,763}, {4823,1,0,0},
+    {4824,1,0,0}, {4825,1,0,0}, {4826,1,0,0}, {4827,1,2,767},
+    {4828,1,0,0}, {4829,1,0,0}, {0,0,2,769}, {4830,1,0,0},
+    {4831,1,0,0}, {4832,1,0,0}, {0,0,4,771}, {4833,1,0,0},
+    {4834,1,0,0}, {4835,1,0,0}, {4836,1,0,0}, {0,0,3,775},
+    {4837,1,0,0}, {4838,1,2,778}, {4839,1,0,0}, {4840,1,0,0},
+    {4841,1,2,780}, {4842,1,0,0}, {4843,1,0,0}, {4844,1,0,0},
+    {4845,1,0,0}, {0,0,4,782}, {4846,1,0,0}, {4847,1,2,786},
+    {0,0,4,788}, {4848,1,0,0}, {4849,1,0,0}, {0,0,2,157},
+    {4850,1,0,0}, {0,0,3,792}, {4851,1,0,0}, {4852,1,0,0},
+    {4853,1,0,0}, {0,0,2,795}, {0,0,4,797}, {4854,1,0,0},
+    {0,0,3,801}, {4855,1,0,0}, {0,0,2,804}, {0,0,2,165},
+    {4856,1,0,0}, {4857,1,0,0}, {4858,1,0,0}, {4859,1,0,0},
+    {4860,1,0,0}, {4861,1,0,0}, {4862,1,0,0}, {0,0,2,806},
+    {4863,1,0,0}, {4864,1,0,0}, {4865,1,0,0}, {4866,1,0,0},
+    {4867,1,0,0}, {4868,2,0,0}, {4870,1,0,0}, {4871,1,0,0},
+    {4872,1,0,0}, {0,0,3,808}, {4873,1,0,0}, {4874,1,0,0},
+    {4875,1,0,0}, {0,0,4,811}, {4876,1,0,0}, {4877,1,0,0},
+    {0,0,2,815}, {0,0,2,817}, {0,0,2,819}, {4878,1,0,0},
+    {0,0,3,821}, {4879,1,0,0}, {4880,1,0,0}, {4881,1,0,0},
+    {4882,1,0,0}, {4883,1,0,0}, {4884,1,0,0}, {0,0,4,824},
+    {4885,1,0,0}, {4886,1,0,0}, {4887,1,0,0}, {4888,1,0,0},
+    {4889,1,0,0}, {4890,1,0,0}, {4891,1,0,0}, {4892,1,0,0},
+    {4893,1,0,0}, {0,0,4,828}, {4894,1,0,0}, {4895,1,0,0},
+    {4896,1,0,0}, {4897,1,2,832}, {0,0,2,834}, {4898,1,0,0},
+    {4899,1,0,0}, {4900,1,0,0}, {4901,2,0,0}, {4903,1,0,0},
+    {0,0,4,836}, {4904,1,0,0}, {4905,2,0,0}, {4907,1,0,0},
+    {0,0,3,840}, {0,0,3,843}, {0,0,2,197}, {4908,1,0,0},
+    {4909,1,0,0}, {4910,1,0,0}, {0,0,4,846}, {4911,1,0,0},
+    {4912,1,0,0}, {0,0,3,850}, {0,0,2,853}, {4913,2,0,0},
+    {4915,1,0,0}, {4916,1,0,0}, {4917,1,0,0}, {0,0,2,855},
+    {0,0,4,857}, {4918,1,0,0}, {0,0,4,861}, {4919,1,0,0},
+    {4920,1,0,0}, {4921,1,0,0}, {4922,1,0,0}, {0,0,3,865},
+    {4923,1,0,0}, {0,0,3,868}, {4924,1,0,0}, {4925,1,0,0},
+    {4926,1,0,0}, {0,0,2,871}, {4927,1,0,0}, {0,0,2,873},
+    {4928,1,0,0}, {4929,1,2,875}, {0,0,2,877}, {4930,1,0,0},
+    {4931,1,0,0}, {4932,1,0,0}, {4933,1,0,0}, {4934,1,0,0},
+    {4935,1,0,0}, {4936,1,0,0}, {4937,1,0,0}, {0,0,4,879},
+    {0,0,2,883}, {0,0,3,885}, {4938,1,0,0}, {4939,1,0,0},
+    {0,0,2,220}, {4940,1,0,0}, {0,0,4,888}, {0,0,4,892},
+    {4941,1,0,0}, {4942,1,0,0}, {0,0,2,896}, {0,0,2,898},
+    {4943,1,0,0}, {4944,1,0,0}, {0,0,4,900}, {0,0,4,904},
+    {0,0,2,908}, {4945,1,0,0}, {4946,1,0,0}, {0,0,3,910},
+    {4947,1,0,0}, {0,0,3,913}, {4948,1,0,0}, {4949,1,0,0},
+    {4950,2,0,0}, {4952,1,0,0}, {4953,1,0,0}, {4954,1,0,0},
+    {4955,1,0,0}, {4956,2,0,0}, {4958,1,0,0}, {4959,1,0,0},
+    {4960,1,0,0}, {4961,1,0,0}, {4962,1,0,0}, {4963,1,0,0},
+    {4964,1,0,0}, {4965,1,0,0}, {4966,1,0,0}, {4967,1,0,0},
+    {4968,1,0,0}, {4969,1,0,0}, {4970,1,0,0}, {4971,1,0,0},
+    {4972,1,0,0}, {4973,1,0,0}, {0,0,4,916}, {4974,2,0,0},
+    {0,0,3,920}, {4976,1,0,0}, {4977,1,0,0}, {4978,1,0,0},
+    {4979,1,0,0}, {0,0,4,923}, {0,0,3,927}, {0,0,2,930},
+    {4980,1,0,0}, {4981,1,0,0}, {4982,1,0,0}, {4983,1,0,0},
+    {4984,1,0,0}, {4985,1,0,0}, {4986,1,0,0}, {4987,1,0,0},
+    {0,0,3,932}, {4988,1,0,0}, {4989,1,0,0}, {4990,1,0,0},
+    {4991,1,0,0}, {4992,1,0,0}, {4993,1,0,0}, {4994,1,0,0},
+    {4995,1,0,0}, {4996,2,0,0}, {4998,1,0,0}, {4999,1,0,0},
+    {5000,1,0,0}, {5001,1,0,0}, {5002,1,0,0}, {5003,3,0,0},
+    {5006,1,0,0}, {5007,1,0,0}, {0,0,4,935}, {5008,1,0,0},
+    {5009,1,0,0}, {5010,1,0,0}, {5011,1,2,939}, {5012,1,0,0},
+    {5013,1,0,0}, {5014,1,0,0}, {5015,1,0,0}, {5016,1,0,0},
+    {0,0,4,941}, {5017,1,0,0}, {0,0,4,945}, {5018,1,0,0},
+    {5019,1,0,0}, {5020,1,0,0}, {0,0,2,267}, {5021,2,0,0},
+    {5023,1,0,0}, {5024,1,0,0}, {5025,1,0,0}, {5026,1,0,0},
+    {0,0,3,949}, {5027,1,0,0}, {5028,1,0,0}, {5029,1,0,0},
+    {5030,1,0,0}, {0,0,4,952}, {0,0,1,279}, {0,0,3,956},
+    {0,0,4,959}, {5031,1,0,0}, {5032,1,0,0}, {0,0,3,963},
+    {0,0,3,966}, {5033,1,0,0}, {5034,1,0,0}, {5035,1,0,0},
+    {5036,1,0,0}, {5037,8,0,0}, {0,0,3,969}, {5045,1,0,0},
+    {5046,1,0,0}, {0,0,3,972}, {5047,1,0,0}, {5048,1,0,0},
+    {0,0,2,975}, {5049,1,0,0}, {5050,1,0,0}, {5051,1,0,0},
+    {5052,1,0,0}, {5053,1,0,0}, {5054,4,0,0}, {5058,1,0,0},
+    {5059,1,0,0}, {0,0,4,977}, {0,0,3,981}, {5060,1,0,0},
+    {0,0,4,984}, {0,0,3,988}, {5061,1,0,0}, {5062,1,0,0},
+    {5063,1,0,0}, {5064,1,0,0}, {5065,1,0,0}, {5066,1,2,991},
+    {5067,1,0,0}, {5068,1,0,0}, {0,0,2,993}, {5069,1,0,0},
+    {5070,1,0,0}, {5071,1,0,0}, {5072,1,0,0}, {5073,1,0,0},
+    {5074,1,0,0}, {5075,4,0,0}, {0,0,4,995}, {5079,1,0,0},
+    {0,0,4,999}, {5080,1,0,0}, {5081,1,0,0}, {0,0,3,1003},
+    {5082,1,0,0}, {5083,1,0,0}, {5084,1,0,0}, {5085,1,2,1006},
+    {5086,1,0,0}, {5087,1,0,0}, {5088,1,0,0}, {5089,2,0,0},
+    {5091,2,0,0}, {5093,1,0,0}, {0,0,4,1008}, {5094,1,0,0},
+    {5095,1,0,0}, {5096,1,0,0}, {5097,2,0,0}, {5099,1,0,0},
+    {5100,1,0,0}, {5101,2,0,0}, {0,0,2,1012}, {5103,1,0,0},
+    {5104,1,0,0}, {0,0,4,1014}, {5105,1,0,0}, {0,0,2,321},
+    {5106,1,0,0}, {0,0,3,1018}, {5107,2,0,0}, {5109,1,0,0},
+    {0,0,3,1021}, {5110,1,0,0}, {5111,1,0,0}, {0,0,4,1024},
+    {0,0,4,1028}, {5112,1,0,0}, {5113,1,0,0}, {5114,1,0,0},
+    {0,0,4,1032}, {0,0,4,1036}, {0,0,4,1040}, {0,0,4,1044},
+    {0,0,2,1048}, {0,0,2,1050}, {0,0,2,1052}, {5115,1,0,0},
+    {5116,1,0,0}, {0,0,4,1054}, {0,0,4,1058}, {0,0,2,1062},
+    {0,0,2,1064}, {5117,1,0,0}, {5118,1,0,0}, {0,0,2,1066},
+    {5119,1,0,0}, {0,0,2,1068}, {0,0,3,1070}, {0,0,4,1073},
+    {5120,1,0,0}, {5121,1,0,0}, {5122,1,2,1077}, {5123,1,2,1079},
+    {5124,1,2,1081}, {5125,1,0,0}, {5126,1,0,0}, {5127,1,0,0},
+    {5128,1,0,0}, {5129,1,0,0}, {5130,1,0,0}, {5131,1,0,0},
+    {0,0,3,1083}, {5132,1,0,0}, {0,0,3,1086}, {0,0,3,1089},
+    {5133,1,0,0}, {5134,1,0,0}, {5135,2,0,0}, {5137,1,0,0},
+    {5138,1,0,0}, {5139,1,0,0}, {5140,1,0,0}, {0,0,4,1092},
+    {5141,1,0,0}, {0,0,3,1096}, {0,0,1,1099}, {5142,1,0,0},
+    {5143,1,2,1100}, {0,0,4,1102}, {5144,2,0,0}, {5146,1,0,0},
+    {0,0,2,378}, {5147,1,0,0}, {5148,1,0,0}, {0,0,3,1106},
+    {5149,1,0,0}, {5150,1,0,0}, {5151,1,0,0}, {5152,1,0,0},
+    {5153,1,0,0}, {5154,1,0,0}, {0,0,3,1109}, {5155,1,0,0},
+    {5156,1,0,0}, {5157,1,0,0}, {5158,1,0,0}, {5159,1,0,0},
+    {5160,1,0,0}, {5161,1,0,0}, {0,0,2,1112}, {0,0,3,1114},
+    {5162,1,0,0}, {5163,1,0,0}, {5164,1,0,0}, {5165,1,0,0},
+    {5166,1,0,0}, {5167,1,0,0}, {5168,1,0,0}, {5169,1,0,0},
+    {5170,1,0,0}, {5171,1,0,0}, {5172,1,0,0}, {5173,1,0,0},
+    {5174,1,0,0}, {5175,1,0,0}, {5176,3,0,0}, {5179,1,0,0},
+    {5180,1,0,0}, {5181,1,0,0}, {5182,1,0,0}, {5183,1,0,0},
+    {5184,1,0,0}, {0,0,3,1117}, {0,0,4,1120}, {5185,1,0,0},
+    {5186,1,0,0}, {5187,1,0,0}, {5188,1,0,0}, {5189,1,0,0},
+    {5190,1,0,0}, {0,0,3,1124}, {5191,1,0,0}, {5192,1,0,0},
+    {5193,1,0,0}, {5194,1,0,0}, {5195,1,0,0}, {5196,1,0,0},
+    {5197,1,0,0}, {5198,1,0,0}, {0,0,3,1127}, {5199,1,0,0},
+    {5200,1,0,0}, {5201,1,0,0}, {5202,1,0,0}, {5203,1,0,0},
+    {5204,1,0,0}, {5205,1,0,0}, {5206,1,0,0}, {5207,1,0,0},
+    {5208,1,0,0}, {5209,1,0,0}, {0,0,3,1130}, {5210,1,0,0},
+    {5211,1,0,0}, {5212,1,0,0}, {5213,1,0,0}, {5214,1,0,0},
+    {5215,1,0,0}, {5216,1,0,0}, {5217,1,0,0}, {5218,1,0,0},
+    {5219,1,0,0}, {5220,1,0,0}, {0,0,3,1133}, {5221,1,0,0},
+    {5222,1,0,0}, {5223,1,0,0}, {5224,1,0,0}, {5225,1,0,0},
+    {5226,1,0,0}, {5227,1,0,0}, {5228,1,0,0}, {5229,1,0,0},
+    {0,0,4,1136}, {5230,1,0,0}, {0,0,3,1140}, {5231,1,0,0},
+    {0,0,1,1143}, {5232,1,0,0}, {5233,1,0,0}, {0,0,3,1144},
+    {5234,1,0,0}, {0,0,3,1147}, {5235,1,0,0}, {5236,2,0,0},
+    {5238,1,0,0}, {5239,1,0,0}, {5240,1,0,0}, {5241,1,0,0},
+    {5242,1,0,0}, {5243,1,0,0}, {0,0,6,1150}, {5244,1,0,0},
+    {5245,1,0,0}, {5246,1,0,0}, {5247,1,0,0}, {5248,1,0,0},
+    {5249,1,0,0}, {5250,2,0,0}, {0,0,2,1156}, {5252,1,2,1158},
+    {5253,1,0,0}, {0,0,2,396}, {5254,1,0,0}, {0,0,2,1160},
+    {5255,2,0,0}, {0,0,3,1162}, {0,0,2,1165}, {5257,1,0,0},
+    {5258,1,0,0}, {0,0,3,1167}, {5259,1,0,0}, {5260,1,0,0},
+    {5261,1,0,0}, {5262,2,0,0}, {5264,2,0,0}, {5266,2,0,0},
+    {0,0,3,1170}, {5268,1,0,0}, {5269,1,0,0}, {0,0,3,1173},
+    {5270,1,0,0}, {5271,1,0,0}, {0,0,4,1176}, {5272,1,0,0},
+    {0,0,2,165}, {5273,1,0,0}, {5274,1,0,0}, {5275,1,0,0},
+    {0,0,4,1180}, {0,0,3,1184}, {5276,1,0,0}, {0,0,3,1187},
+    {5277,1,0,0}, {5278,1,0,0}, {5279,1,0,0}, {5280,1,0,0},
+    {5281,1,0,0}, {5282,1,0,0}, {5283,1,0,0}, {5284,1,0,0},
+    {5285,1,0,0}, {5286,1,0,0}, {5287,1,0,0}, {0,0,6,1190},
+    {5288,1,0,0}, {5289,3,0,0}, {5292,1,0,0}, {5293,1,0,0},
+    {5294,1,0,0}, {5295,1,0,0}, {5296,1,0,0}, {5297,1,0,0},
+    {5298,1,0,0}, {0,0,3,1196}, {0,0,3,1199}, {5299,1,0,0},
+    {5300,1,0,0}, {0,0,3,1202}, {0,0,3,1205}, {5301,1,0,0},
+    {5302,1,0,0}, {5303,1,0,0}, {5304,1,0,0}, {5305,1,0,0},
+    {5306,1,0,0}, {5307,1,0,0}, {5308,1,0,0}, {5309,1,0,0},
+    {5310,1,0,0}, {5311,1,0,0}, {5312,1,0,0}, {0,0,3,1208},
+    {5313,1,0,0}, {5314,1,0,0}, {5315,1,0,0}, {5316,1,0,0},
+    {5317,1,0,0}, {5318,1,0,0}, {0,0,2,1211}, {5319,1,0,0},
+    {5320,1,0,0}, {5321,1,0,0}, {0,0,4,1213}, {5322,2,0,0},
+    {5324,1,0,0}, {5325,1,0,0}, {5326,1,0,0}, {5327,1,0,0},
+    {5328,1,0,0}, {5329,1,0,0}, {5330,1,0,0}, {5331,1,0,0},
+    {5332,1,0,0}, {5333,1,0,0}, {0,0,4,1217}, {0,0,2,1221},
+    {0,0,3,1223}, {5334,1,0,0}, {5335,1,0,0}, {0,0,3,1226},
+    {5336,1,0,0}, {5337,1,0,0}, {5338,1,0,0}, {5339,1,0,0},
+    {0,0,2,1229}, {5340,1,0,0}, {5341,1,0,0}, {0,0,3,1231},
+    {5342,1,0,0}, {5343,1,0,0}, {5344,1,0,0}, {0,0,3,1234},
+    {5345,1,2,1237}, {5346,1,0,0}, {0,0,2,1239}, {5347,1,0,0},
+    {5348,1,0,0}, {5349,1,0,0}, {5350,1,0,0}, {5351,1,0,0},
+    {5352,1,0,0}, {5353,3,0,0}, {5356,2,0,0}, {0,0,3,1241},
+    {0,0,3,1244}, {5358,1,0,0}, {0,0,4,1247}, {0,0,3,1251},
+    {5359,1,0,0}, {5360,1,0,0}, {0,0,2,1254}, {5361,1,0,0},
+    {5362,1,0,0}, {5363,1,0,0}, {5364,1,0,0}, {5365,1,0,0},
+    {5366,1,0,0}, {5367,1,0,0}, {5368,1,0,0}, {5369,2,0,0},
+    {5371,1,0,0}, {5372,1,0,0}, {5373,1,0,0}, {0,0,3,1256},
+    {5374,1,0,0}, {0,0,3,1259}, {0,0,2,439}, {0,0,3,1262},
+    {0,0,1,1265}, {5375,1,0,0}, {5376,1,0,0}, {5377,1,0,0},
+    {5378,1,0,0}, {5379,1,0,0}, {5380,1,0,0}, {5381,1,0,0},
+    {5382,1,0,0}, {5383,1,0,0}, {5384,1,0,0}, {0,0,3,1266},
+    {5385,1,0,0}, {5386,1,0,0}, {0,0,2,1269}, {0,0,4,1271},
+    {5387,1,0,0}, {0,0,3,1275}, {5388,1,0,0}, {5389,1,0,0},
+    {5390,6,0,0}, {5396,2,0,0}, {5398,3,0,0}, {5401,1,0,0},
+    {5402,2,0,0}, {5404,1,0,0}, {5405,1,0,0}, {5406,1,0,0},
+    {0,0,4,1278}, {5407,1,0,0}, {5408,2,0,0}, {5410,1,0,0},
+    {5411,1,0,0}, {0,0,2,1282}, {0,0,3,70}, {5412,1,0,0},
+    {5413,1,0,0}, {5414,1,0,0}, {0,0,6,1284}, {5415,1,0,0},
+    {5416,1,0,0}, {0,0,2,1290}, {0,0,3,1292}, {5417,1,0,0},
+    {0,0,3,477}, {5418,1,0,0}, {5419,1,0,0}, {0,0,4,1295},
+    {5420,1,0,0}, {0,0,3,1299}, {0,0,3,1302}, {5421,1,0,0},
+    {5422,1,0,0}, {0,0,3,1305}, {5423,1,0,0}, {5424,1,0,0},
+    {5425,1,0,0}, {5426,1,0,0}, {5427,1,0,0}, {5428,1,0,0},
+    {5429,1,0,0}, {5430,2,0,0}, {5432,1,0,0}, {5433,1,0,0},
+    {5434,1,0,0}, {0,0,6,1308}, {0,0,3,486}, {5435,1,0,0},
+    {0,0,2,1314}, {5436,1,0,0}, {5437,1,0,0}, {0,0,3,1316},
+    {5438,1,0,0}, {5439,1,0,0}, {0,0,3,1319}, {5440,1,0,0},
+    {5441,1,0,0}, {5442,1,0,0}, {5443,1,0,0}, {5444,1,0,0},
+    {5445,1,0,0}, {5446,1,0,0}, {5447,1,0,0}, {5448,1,0,0},
+    {5449,1,0,0}, {0,0,4,1322}, {5450,1,0,0}, {0,0,4,1326},
+    {5451,1,0,0}, {5452,1,0,0}, {5453,1,0,0}, {5454,1,0,0},
+    {5455,1,0,0}, {5456,1,2,1330}, {0,0,2,1332}, {5457,1,2,1334},
+    {5458,1,0,0}, {5459,1,0,0}, {5460,1,0,0}, {5461,1,0,0},
+    {5462,1,0,0}, {5463,1,0,0}, {5464,1,0,0}, {5465,1,0,0},
+    {5466,1,0,0}, {5467,1,0,0}, {5468,1,0,0}, {0,0,3,1336},
+    {5469,1,0,0}, {5470,1,0,0}, {5471,2,0,0}, {5473,1,0,0},
+    {5474,1,0,0}, {5475,1,0,0}, {5476,1,0,0}, {5477,1,0,0},
+    {5478,1,0,0}, {0,0,2,1339}, {5479,1,0,0}, {0,0,4,1341},
+    {0,0,2,1345}, {5480,1,0,0}, {5481,1,0,0}, {0,0,4,1347},
+    {0,0,3,85}, {5482,1,0,0}, {5483,1,0,0}, {5484,2,0,0},
+    {5486,1,0,0}, {5487,1,0,0}, {5488,1,0,0}, {0,0,2,496},
+    {5489,1,0,0}, {5490,1,0,0}, {0,0,4,1351}, {0,0,4,1355},
+    {5491,1,0,0}, {5492,1,0,0}, {5493,2,0,0}, {5495,1,0,0},
+    {5496,1,0,0}, {0,0,2,1359}, {0,0,2,1361}, {0,0,4,1363},
+    {0,0,4,1367}, {5497,1,0,0}, {0,0,3,1371}, {5498,1,0,0},
+    {5499,1,0,0}, {0,0,3,1374}, {5500,1,0,0}, {5501,1,0,0},
+    {5502,1,0,0}, {5503,1,0,0}, {0,0,3,1377}, {5504,1,0,0},
+    {5505,1,0,0}, {5506,1,2,1380}, {0,0,3,1382}, {5507,2,0,0},
+    {5509,1,0,0}, {5510,1,0,0}, {5511,1,0,0}, {5512,1,0,0},
+    {5513,1,0,0}, {5514,1,0,0}, {5515,1,0,0}, {0,0,3,1385},
+    {5516,1,0,0}, {5517,1,0,0}, {5518,1,0,0}, {5519,2,0,0},
+    {5521,1,0,0}, {5522,1,0,0}, {5523,1,0,0}, {5524,1,0,0},
+    {5525,1,0,0}, {0,0,1,1388}, {0,0,3,1389}, {5526,2,0,0},
+    {5528,1,0,0}, {5529,1,0,0}, {0,0,3,1392}, {5530,1,0,0},
+    {5531,1,0,0}, {5532,1,0,0}, {5533,1,0,0}, {5534,1,0,0},
+    {0,0,3,91}, {5535,1,0,0}, {5536,1,0,0}, {5537,1,0,0},
+    {0,0,6,1395}, {5538,1,0,0}, {5539,1,0,0}, {5540,1,0,0},
+    {5541,1,0,0}, {5542,1,0,0}, {5543,1,0,0}, {5544,1,0,0},
+    {5545,1,0,0}, {5546,1,0,0}, {5547,2,0,0}, {5549,1,0,0},
+    {0,0,2,1401}, {5550,1,0,0}, {5551,1,0,0}, {5552,1,0,0},
+    {5553,1,0,0}, {5554,1,0,0}, {5555,1,0,0}, {0,0,3,1403},
+    {5556,1,0,0}, {0,0,3,537}, {5557,1,0,0}, {5558,1,0,0},
+    {5559,1,0,0}, {5560,1,0,0}, {5561,1,0,0}, {5562,1,0,0},
+    {5563,1,0,0}, {5564,1,0,0}, {5565,1,0,0}, {5566,1,0,0},
+    {0,0,4,1406}, {5567,1,0,0}, {5568,1,0,0}, {5569,1,0,0},
+    {5570,1,0,0}, {5571,1,0,0}, {0,0,3,1410}, {0,0,1,1413},
+    {5572,1,0,0}, {5573,1,0,0}, {5574,1,0,0}, {5575,2,0,0},
+    {5577,1,0,0}, {5578,1,0,0}, {0,0,4,1414}, {0,0,3,1418},
+    {5579,1,0,0}, {5580,1,0,0}, {0,0,1,1421}, {5581,2,0,0},
+    {5583,1,0,0}, {0,0,3,1422}, {5584,1,0,0}, {5585,1,0,0},
+    {5586,1,0,0}, {5587,1,0,0}, {5588,1,0,0}, {5589,1,0,0},
+    {5590,1,0,0}, {0,0,3,1425}, {5591,1,0,0}, {5592,1,0,0},
+    {5593,1,0,0}, {5594,1,0,0}, {5595,1,0,0}, {0,0,6,1428},
+    {5596,1,0,0}, {0,0,2,546}, {0,0,3,1434}, {0,0,3,1437},
+    {5597,1,0,0}, {5598,1,0,0}, {5599,1,0,0}, {5600,1,0,0},
+    {5601,1,0,0}, {5602,1,0,0}, {5603,1,2,1440}, {5604,1,0,0},
+    {5605,1,0,0}, {5606,1,0,0}, {5607,3,0,0}, {0,0,3,1442},
+    {0,0,3,1445}, {5610,1,0,0}, {5611,1,0,0}, {0,0,4,1448},
+    {0,0,4,1452}, {5612,1,0,0}, {5613,1,0,0}, {5614,1,0,0},
+    {0,0,5,1456}, {5615,2,0,0}, {0,0,5,1461}, {5617,1,0,0},
+    {5618,1,0,0}, {5619,1,0,0}, {5620,1,0,0}, {5621,1,0,0},
+    {0,0,6,1466}, {0,0,5,1472}, {5622,1,0,0}, {5623,1,0,0},
+    {5624,1,0,0}, {5625,2,0,0}, {0,0,2,588}, {5627,2,0,0},
+    {0,0,3,1477}, {5629,1,0,0}, {5630,1,0,0}, {5631,2,0,0},
+    {0,0,3,1480}, {5633,1,0,0}, {5634,1,0,0}, {5635,1,0,0},
+    {5636,2,0,0}, {5638,1,0,0}, {5639,1,0,0}, {5640,1,0,0},
+    {5641,1,0,0}, {5642,1,0,0}, {0,0,3,601}, {5643,1,0,0},
+    {5644,1,0,0}, {0,0,5,1483}, {5645,1,0,0}, {0,0,3,604},
+    {5646,1,0,0}, {5647,1,0,0}, {5648,1,0,0}, {0,0,3,1488},
+    {0,0,2,1491}, {5649,1,0,0}, {5650,1,0,0}, {0,0,3,1493},
+    {5651,2,0,0}, {0,0,3,615}, {5653,1,0,0}, {5654,1,0,0},
+    {0,0,5,1496}, {5655,1,0,0}, {5656,1,0,0}, {5657,2,0,0},
+    {0,0,3,1501}, {0,0,4,1504}, {5659,4,0,0}, {5663,2,0,0},
+    {0,0,3,1508}, {5665,1,0,0}, {5666,1,0,0}, {5667,1,0,0},
+    {5668,1,0,0}, {5669,1,0,0}, {0,0,5,1511}, {5670,2,0,0},
+    {5672,1,0,0}, {5673,3,0,0}, {5676,1,0,0}, {5677,2,0,0},
+    {5679,1,0,0}, {0,0,5,1516}, {0,0,4,1521}, {5680,1,0,0},
+    {0,0,3,1525}, {5681,2,0,0}, {5683,1,0,0}, {5684,1,0,0},
+    {5685,2,0,0}, {0,0,3,1528}, {5687,1,0,0}, {5688,1,0,0},
+    {5689,1,0,0}, {5690,2,0,0}, {0,0,3,1531}, {5692,1,0,0},
+    {5693,1,0,0}, {5694,1,0,0}, {0,0,3,1534}, {5695,1,0,0},
+    {0,0,3,1537}, {5696,1,0,0}, {5697,1,0,0}, {5698,1,0,0},
+    {5699,1,0,0}, {5700,1,0,0}, {0,0,6,1540}, {5701,1,0,0},
+    {0,0,6,1546}, {0,0,4,1552}, {5702,1,0,0}, {5703,1,0,0},
+    {0,0,6,1556}, {0,0,4,1562}, {5704,1,0,0}, {5705,1,0,0},
+    {5706,1,0,0}, {5707,1,0,0}, {5708,1,0,0}, {5709,1,0,0},
+    {5710,2,0,0}, {5712,1,0,0}, {5713,1,0,0}, {0,0,3,1566},
+    {0,0,3,1569}, {5714,1,2,1572}, {5715,1,0,0}, {5716,1,0,0},
+    {0,0,3,1574}, {0,0,3,1577}, {5717,1,0,0}, {5718,1,0,0},
+    {5719,1,0,0}, {0,0,2,1580}, {5720,1,0,0}, {5721,1,0,0},
+    {0,0,3,1582}, {5722,1,0,0}, {5723,1,0,0}, {5724,1,0,0},
+    {5725,1,0,0}, {5726,1,0,0}, {5727,1,0,0}, {5728,1,0,0},
+    {0,0,3,1585}, {5729,1,0,0}, {0,0,4,1588}, {0,0,3,1592},
+    {5730,1,0,0}, {5731,1,0,0}, {5732,1,0,0}, {5733,2,0,0},
+    {0,0,2,645}, {0,0,2,647}, {5735,1,0,0}, {0,0,3,1595},
+    {5736,1,0,0}, {0,0,3,1598}, {5737,1,0,0}, {0,0,3,1601},
+    {5738,1,0,0}, {5739,1,0,0}, {0,0,2,652}, {5740,1,0,0},
+    {0,0,2,657}, {5741,1,0,0}, {5742,1,0,0}, {5743,1,0,0},
+    {0,0,3,1604}, {5744,1,0,0}, {5745,1,0,0}, {5746,1,0,0},
+    {0,0,3,390}, {5747,1,0,0}, {0,0,2,1607}, {5748,1,0,0},
+    {5749,1,0,0}, {5750,1,0,0}, {5751,1,0,0}, {5752,1,0,0},
+    {0,0,1,1609}, {5753,1,0,0}, {5754,1,0,0}, {5755,1,0,0},
+    {5756,2,0,0}, {5758,1,0,0}, {5759,1,0,0}, {5760,1,0,0},
+    {5761,1,0,0}, {5762,1,0,0}, {0,0,4,1610}, {5763,1,2,1614},
+    {0,0,3,1616}, {5764,1,0,0}, {0,0,3,125}, {5765,1,0,0},
+    {5766,1,0,0}, {5767,1,0,0}, {5768,3,0,0}, {5771,1,0,0},
+    {5772,2,0,0}, {0,0,3,1619}, {5774,1,0,0}, {5775,1,0,0},
+    {0,0,3,1622}, {5776,1,0,0}, {5777,1,0,0}, {5778,1,0,0},
+    {0,0,3,1625}, {5779,1,0,0}, {5780,1,0,0}, {5781,1,0,0},
+    {0,0,4,1628}, {5782,1,0,0}, {0,0,3,1632}, {0,0,4,1635},
+    {5783,1,0,0}, {0,0,4,1639}, {5784,1,0,0}, {5785,1,0,0},
+    {5786,2,0,0}, {0,0,1,279}, {5788,1,0,0}, {0,0,3,1643},
+    {5789,1,0,0}, {5790,1,0,0}, {0,0,3,1646}, {0,0,5,1649},
+    {5791,1,0,0}, {5792,1,0,0}, {5793,1,0,0}, {0,0,3,1654},
+    {5794,1,0,0}, {5795,1,0,0}, {5796,1,0,0}, {5797,1,2,1657},
+    {0,0,3,1659}, {5798,1,0,0}, {5799,2,0,0}, {5801,1,0,0},
+    {5802,1,0,0}, {5803,1,0,0}, {5804,1,0,0}, {5805,1,0,0},
+    {5806,1,0,0}, {5807,1,0,0}, {5808,1,0,0}, {5809,1,0,0},
+    {5810,2,0,0}, {5812,1,0,0}, {5813,1,0,0}, {5814,2,0,0},
+    {5816,1,0,0}, {5817,1,0,0}, {5818,1,0,0}, {5819,1,0,0},
+    {5820,1,0,0}, {0,0,1,1662}, {0,0,3,1663}, {5821,1,0,0},
+    {5822,2,0,0}, {0,0,3,1666}, {0,0,3,37}, {5824,1,0,0},
+    {5825,1,0,0}, {5826,1,0,0}, {0,0,3,1669}, {5827,1,0,0},
+    {5828,1,0,0}, {5829,1,0,0}, {5830,2,0,0}, {0,0,2,1672},
+    {5832,6,0,0}, {0,0,2,1674}, {5838,1,0,0}, {5839,1,0,0},
+    {5840,1,0,0}, {5841,1,0,0}, {5842,1,0,0}, {5843,1,0,0},
+    {5844,1,0,0}, {5845,1,0,0}, {5846,1,0,0}, {0,0,4,1676},
+    {5847,1,0,0}, {5848,1,0,0}, {0,0,1,1680}, {5849,1,0,0},
+    {5850,1,0,0}, {5851,1,0,0}, {5852,1,0,0}, {0,0,4,1681},
+    {0,0,1,1685}, {5853,2,0,0}, {5855,1,0,0}, {5856,1,0,0},
+    {0,0,3,1686}, {5857,1,0,0}, {5858,1,0,0}, {5859,1,0,0},
+    {5860,1,0,0}, {5861,1,0,0}, {5862,1,0,0}, {0,0,3,1689},
+    {5863,1,0,0}, {5864,1,0,0}, {5865,1,0,0}, {5866,1,0,0},
+    {0,0,3,1692}, {5867,1,0,0}, {5868,1,0,0}, {5869,1,0,0},
+    {5870,1,0,0}, {0,0,3,1695}, {5871,1,0,0}, {5872,1,0,0},
+    {5873,1,0,0}, {5874,1,0,0}, {5875,2,0,0}, {0,0,2,700},
+    {0,0,1,1698}, {5877,1,0,0}, {5878,1,0,0}, {5879,1,0,0},
+    {0,0,3,1699}, {5880,1,0,0}, {5881,1,0,0}, {5882,1,0,0},
+    {0,0,2,1702}, {5883,2,0,0}, {5885,3,0,0}, {5888,1,0,0},
+    {0,0,3,1704}, {5889,1,0,0}, {0,0,3,1707}, {5890,1,0,0},
+    {0,0,3,1710}, {5891,1,0,0}, {5892,1,0,0}, {5893,1,0,0},
+    {5894,1,0,0}, {5895,1,0,0}, {5896,1,0,0}, {5897,1,0,0},
+    {5898,1,0,0}, {0,0,3,560}, {5899,1,0,0}, {0,0,3,1713},
+    {5900,1,0,0}, {5901,1,0,0}, {0,0,3,1716}, {5902,1,0,0},
+    {0,0,4,1719}, {5903,1,0,0}, {0,0,3,654}, {5904,2,0,0},
+    {5906,2,0,0}, {5908,3,0,0}, {5911,3,0,0}, {5914,2,0,0},
+    {0,0,3,1723}, {5916,1,0,0}, {0,0,4,1726}, {5917,1,0,0},
+    {5918,1,0,0}, {5919,1,0,0}, {0,0,3,1730}, {5920,1,0,0},
+    {5921,1,0,0}, {5922,1,0,0}, {0,0,3,1733}, {5923,1,0,0},
+    {0,0,3,1736}, {5924,1,0,0}, {5925,1,0,0}, {5926,1,0,0},
+    {5927,1,0,0}, {5928,1,0,0}, {5929,1,0,0}, {5930,1,0,0},
+    {5931,1,0,0}, {5932,2,0,0}, {0,0,3,131}, {5934,1,0,0},
+    {5935,1,0,0}, {5936,1,0,0}, {5937,3,0,0}, {5940,1,0,0},
+    {0,0,3,1739}, {0,0,2,719}, {0,0,2,721}, {0,0,2,723},
+    {0,0,3,1742}, {5941,1,0,0}, {5942,1,0,0}, {0,0,3,1745},
+    {5943,1,0,0}, {5944,2,0,0}, {5946,1,0,0}, {5947,1,0,0},
+    {5948,1,0,0}, {5949,1,0,0}, {5950,1,0,0}, {5951,1,0,0},
+    {5952,1,0,0}, {5953,2,0,0}, {5955,1,0,0}, {5956,1,0,0},
+    {5957,2,0,0}, {5959,1,0,0}, {5960,1,2,1748}, {5961,1,0,0},
+    {0,0,3,1750}, {5962,1,0,0}, {5963,1,0,0}, {0,0,3,1753},
+    {5964,1,0,0}, {5965,2,0,0}, {5967,3,0,0}, {5970,2,0,0},
+    {5972,1,0,0}, {5973,1,0,0}, {5974,1,0,0}, {5975,1,2,1756},
+    {5976,1,0,0}, {5977,3,2,1758}, {0,0,3,1760}, {0,0,3,1763},
+    {5980,1,0,0}, {5981,1,0,0}, {0,0,4,1766}, {5982,1,0,0},
+    {0,0,3,1770}, {5983,1,0,0}, {5984,1,0,0}, {5985,1,0,0},
+    {5986,1,0,0}, {0,0,3,1773}, {5987,1,0,0}, {5988,1,0,0},
+    {5989,1,0,0}, {5990,1,0,0}, {5991,1,0,0}, {0,0,4,1776},
+    {0,0,2,1780}, {5992,1,0,0}, {5993,1,0,0}, {5994,1,0,0},
+    {5995,1,0,0}, {0,0,3,1782}, {0,0,3,1785}, {5996,1,0,0},
+    {0,0,3,1788}, {5997,1,0,0}, {5998,1,0,0}, {5999,1,2,1791},
+    {6000,1,0,0}, {6001,1,0,0}, {6002,1,0,0}, {6003,1,0,0},
+    {6004,1,0,0}, {6005,1,0,0}, {6006,1,0,0}, {6007,1,0,0},
+    {6008,1,0,0}, {6009,1,0,0}, {6010,1,0,0}, {6011,1,0,0},
+    {6012,1,0,0}, {0,0,4,1793}, {6013,1,0,0}, {6014,1,0,0},
+    {6015,1,0,0}, {6016,1,0,0}, {0,0,2,1797}, {6017,1,0,0},
+    {6018,1,0,0}, {6019,1,0,0}, {6020,1,0,0}, {6021,1,0,0},
+    {6022,1,0,0}, {6023,1,0,0}, {0,0,4,1799}, {6024,1,0,0},
+    {6025,1,0,0}, {0,0,3,1803}, {6026,1,0,0}, {6027,1,0,0},
+    {0,0,2,745}, {6028,1,0,0}, {0,0,3,1806}, {0,0,3,1809},
+    {6029,1,0,0}, {6030,1,0,0}, {6031,1,0,0}, {6032,1,0,0},
+    {6033,1,0,0}, {6034,1,0,0}, {6035,1,0,0}, {6036,1,0,0},
+    {6037,1,0,0}, {0,0,3,1812}, {6038,1,0,0}, {6039,1,0,0},
+    {6040,2,0,0}, {6042,1,0,0}, {6043,1,0,0}, {6044,1,0,0},
+    {6045,1,0,0}, {6046,1,0,0}, {6047,1,0,0}, {6048,1,0,0},
+    {0,0,1,1815}, {6049,1,0,0}, {6050,1,0,0}, {6051,1,0,0},
+    {0,0,4,1816}, {6052,1,0,0}, {6053,1,0,0}, {0,0,4,1820},
+    {6054,2,0,0}, {6056,2,0,0}, {6058,1,0,0}, {6059,1,0,0},
+    {6060,1,0,0}, {6061,2,0,0}, {6063,1,0,0}, {0,0,4,1824},
+    {6064,1,0,0}, {0,0,4,1828}, {0,0,3,1832}, {6065,1,0,0},
+    {0,0,3,1835}, {6066,1,0,0}, {6067,1,0,0}, {6068,1,0,0},
+    {6069,1,0,0}, {6070,1,0,0}, {0,0,3,1838}, {0,0,3,1841},
+    {6071,1,0,0}, {0,0,4,1844}, {6072,1,0,0}, {6073,1,0,0},
+    {6074,1,0,0}, {6075,1,0,0}, {0,0,4,1848}, {6076,1,0,0},
+    {6077,1,0,0}, {6078,1,0,0}, {0,0,3,325}, {6079,1,0,0},
+    {6080,1,0,0}, {0,0,2,1852}, {6081,1,0,0}, {0,0,2,1854},
+    {0,0,4,1856}, {0,0,4,1860}, {0,0,2,1864}, {0,0,2,767},
+    {6082,1,0,0}, {6083,1,0,0}, {0,0,2,1866}, {6084,1,0,0},
+    {0,0,2,1868}, {0,0,2,1870}, {6085,1,0,0}, {0,0,4,1872},
+    {0,0,4,1876}, {0,0,3,1880}, {0,0,2,778}, {6086,1,2,1883},
+    {6087,1,0,0}, {0,0,2,780}, {6088,1,2,1885}, {0,0,2,1887},
+    {0,0,2,1889}, {0,0,2,1891}, {6089,1,0,0}, {0,0,2,786},
+    {6090,1,0,0}, {6091,1,2,1893}, {6092,1,0,0}, {6093,1,0,0},
+    {6094,1,0,0}, {6095,1,0,0}, {0,0,2,1895}, {6096,1,0,0},
+    {6097,1,0,0}, {6098,1,0,0}, {6099,1,0,0}, {6100,1,0,0},
+    {6101,1,2,1897}, {0,0,2,1899}, {6102,1,0,0}, {6103,1,0,0},
+    {6104,1,0,0}, {6105,4,0,0}, {6109,1,0,0}, {6110,1,0,0},
+    {0,0,3,1901}, {6111,1,0,0}, {6112,1,0,0}, {6113,1,0,0},
+    {6114,1,0,0}, {6115,1,0,0}, {6116,1,0,0}, {0,0,3,1904},
+    {6117,1,0,0}, {6118,1,0,0}, {6119,1,0,0}, {0,0,3,1907},
+    {6120,1,0,0}, {0,0,2,1910}, {6121,1,0,0}, {6122,1,0,0},
+    {6123,1,0,0}, {6124,1,0,0}, {6125,1,0,0}, {6126,6,0,0},
+    {6132,1,0,0}, {6133,1,0,0}, {6134,1,0,0}, {6135,1,0,0},
+    {6136,1,0,0}, {6137,1,0,0}, {6138,1,0,0}, {6139,1,2,1912},
+    {6140,1,0,0}, {0,0,2,832}, {6141,1,2,1914}, {6142,1,0,0},
+    {0,0,2,1916}, {6143,1,0,0}, {6144,1,0,0}, {0,0,2,1918},
+    {6145,1,0,0}, {0,0,3,1920}, {6146,1,0,0}, {6147,1,0,0},
+    {6148,1,0,0}, {6149,1,0,0}, {6150,2,0,0}, {6152,1,0,0},
+    {6153,1,0,0}, {0,0,2,1923}, {6154,1,0,0}, {6155,1,0,0},
+    {6156,1,0,0}, {0,0,2,1925}, {6157,1,0,0}, {6158,1,0,0},
+    {0,0,2,1927}, {0,0,2,1929}, {6159,1,0,0}, {6160,1,0,0},
+    {6161,1,0,0}, {6162,1,0,0}, {6163,1,0,0}, {0,0,2,1931},
+    {6164,1,2,1933}, {0,0,2,875}, {6165,1,2,1935}, {0,0,2,1937},
+    {6166,1,0,0}, {6167,1,0,0}, {6168,1,0,0}, {6169,1,0,0},
+    {6170,1,0,0}, {0,0,2,1939}, {6171,1,0,0}, {0,0,2,1941},
+    {0,0,2,1943}, {6172,1,0,0}, {0,0,2,1945}, {0,0,2,1947},
+    {6173,1,0,0}, {6174,1,0,0}, {6175,1,0,0}, {6176,1,0,0},
+    {6177,1,0,0}, {6178,1,0,0}, {6179,1,0,0}, {6180,1,0,0},
+    {6181,1,0,0}, {6182,2,0,0}, {6184,1,0,0}, {6185,1,0,0},
+    {6186,1,0,0}, {6187,1,0,0}, {6188,3,0,0}, {6191,1,0,0},
+    {6192,1,0,0}, {6193,1,0,0}, {6194,1,0,0}, {6195,1,0,0},
+    {6196,1,0,0}, {6197,1,0,0}, {6198,1,0,0}, {6199,1,0,0},
+    {6200,1,0,0}, {6201,1,0,0}, {6202,1,0,0}, {6203,1,0,0},
+    {6204,1,0,0}, {6205,1,0,0}, {6206,1,0,0}, {6207,1,0,0},
+    {6208,1,0,0}, {6209,1,0,0}, {6210,1,0,0}, {6211,1,0,0},
+    {6212,1,0,0}, {6213,1,0,0}, {6214,1,0,0}, {6215,1,0,0},
+    {6216,2,0,0}, {6218,1,0,0}, {6219,1,0,0}, {6220,1,0,0},
+    {6221,1,0,0}, {6222,1,0,0}, {6223,1,0,0}, {6224,1,0,0},
+    {6225,1,0,0}, {6226,1,0,0}, {6227,1,0,0}, {6228,1,0,0},
+    {6229,1,0,0}, {6230,1,0,0}, {6231,1,0,0}, {6232,1,0,0},
+    {6233,1,0,0}, {6234,1,0,0}, {6235,1,0,0}, {6236,1,0,0},
+    {6237,1,0,0}, {6238,1,0,0}, {6239,1,0,0}, {6240,1,0,0},
+    {6241,1,2,1949}, {0,0,2,1951}, {6242,1,2,1953}, {0,0,2,939},
+    {6243,1,0,0}, {6244,1,2,1955}, {0,0,2,1957}, {0,0,2,637},
+    {6245,1,0,0}, {6246,1,0,0}, {6247,1,2,1959}, {6248,1,2,1961},
+    {6249,1,0,0}, {6250,1,0,0}, {6251,1,0,0}, {6252,1,0,0},
+    {6253,1,0,0}, {6254,1,0,0}, {6255,1,0,0}, {6256,1,0,0},
+    {0,0,3,1963}, {6257,1,0,0}, {6258,1,0,0}, {0,0,3,1966},
+    {6259,1,0,0}, {6260,1,0,0}, {6261,1,0,0}, {6262,1,0,0},
+    {6263,1,0,0}, {6264,2,0,0}, {6266,1,0,0}, {6267,1,0,0},
+    {6268,1,0,0}, {6269,2,0,0}, {6271,1,0,0}, {6272,1,0,0},
+    {6273,1,0,0}, {6274,1,0,0}, {6275,1,0,0}, {6276,1,0,0},
+    {6277,1,0,0}, {6278,1,0,0}, {6279,1,0,0}, {6280,1,0,0},
+    {6281,1,0,0}, {0,0,2,1969}, {6282,1,0,0}, {6283,1,0,0},
+    {6284,1,0,0}, {6285,1,0,0}, {0,0,2,1971}, {6286,1,0,0},
+    {6287,4,0,0}, {6291,2,0,0}, {6293,1,0,0}, {6294,1,0,0},
+    {6295,1,0,0}, {6296,1,0,0}, {0,0,2,991}, {0,0,3,1973},
+    {0,0,2,1976}, {6297,1,0,0}, {6298,1,0,0}, {6299,1,0,0},
+    {0,0,2,1978}, {6300,1,0,0}, {6301,1,0,0}, {0,0,3,706},
+    {6302,1,0,0}, {6303,1,0,0}, {6304,1,0,0}, {6305,1,0,0},
+    {6306,1,0,0}, {6307,1,2,1980}, {6308,1,0,0}, {0,0,2,1982},
+    {6309,1,0,0}, {0,0,2,1006}, {6310,1,0,0}, {6311,1,2,1984},
+    {0,0,2,1986}, {6312,2,0,0}, {6314,1,0,0}, {0,0,3,1835},
+    {6315,1,0,0}, {0,0,2,1988}, {6316,1,0,0}, {6317,1,0,0},
+    {6318,1,0,0}, {0,0,3,390}, {6319,1,0,0}, {6320,1,0,0},
+    {6321,1,0,0}, {6322,1,0,0}, {6323,1,0,0}, {6324,1,0,0},
+    {0,0,2,1990}, {6325,1,0,0}, {0,0,3,1992}, {0,0,3,1995},
+    {6326,1,0,0}, {6327,1,0,0}, {6328,1,0,0}, {6329,1,0,0},
+    {6330,1,0,0}, {0,0,2,1998}, {0,0,3,2000}, {6331,1,2,2003},
+    {0,0,2,2005}, {6332,1,0,0}, {6333,1,0,0}, {6334,1,0,0},
+    {6335,1,2,2007}, {6336,1,0,0}, {0,0,2,1077}, {0,0,2,1079},
+    {0,0,2,1081}, {6337,1,2,2009}, {6338,1,0,0}, {0,0,3,2011},
+    {0,0,2,2014}, {0,0,2,2016}, {0,0,3,2018}, {6339,1,0,0},
+    {6340,1,0,0}, {0,0,3,368}, {6341,2,0,0}, {0,0,3,2021},
+    {6343,1,0,0}, {6344,1,0,0}, {0,0,2,786}, {6345,1,0,0},
+    {0,0,2,2024}, {6346,1,0,0}, {6347,2,0,0}, {0,0,2,1100},
+    {0,0,3,51}, {6349,1,0,0}, {6350,1,2,2026}, {6351,1,0,0},
+    {0,0,3,2028}, {6352,1,0,0}, {6353,1,0,0}, {6354,1,0,0},
+    {6355,1,0,0}, {6356,1,0,0}, {6357,2,0,0}, {6359,1,0,0},
+    {0,0,3,2031}, {0,0,3,2034}, {6360,2,0,0}, {6362,1,0,0},
+    {0,0,2,2037}, {6363,1,0,0}, {6364,1,0,0}, {6365,1,0,0},
+    {6366,1,0,0}, {6367,1,0,0}, {6368,1,0,0}, {6369,1,0,0},
+    {6370,1,0,0}, {6371,1,0,0}, {6372,1,0,0}, {6373,1,0,0},
+    {6374,1,0,0}, {6375,1,0,0}, {6376,1,0,0}, {6377,1,0,0},
+    {6378,1,0,0}, {6379,1,0,0}, {6380,1,0,0}, {0,0,3,2039},
+    {0,0,3,2042}, {0,0,3,2045}, {0,0,3,2048}, {0,0,3,2051},
+    {6381,1,0,0}, {6382,1,0,0}, {6383,1,0,0}, {0,0,3,2054},
+    {0,0,3,2057}, {0,0,3,2060}, {0,0,3,2063}, {0,0,3,2066},
+    {0,0,3,2069}, {0,0,3,2072}, {0,0,3,2075}, {0,0,3,2078},
+    {0,0,3,2081}, {0,0,3,2084}, {0,0,3,2087}, {0,0,3,2090},
+    {0,0,3,2093}, {0,0,3,2096}, {0,0,3,2099}, {0,0,3,2102},
+    {0,0,3,2105}, {6384,1,0,0}, {0,0,3,2108}, {0,0,3,2111},
+    {0,0,3,2114}, {0,0,3,2117}, {0,0,3,2120}, {0,0,3,2123},
+    {0,0,3,2126}, {0,0,3,2129}, {6385,1,0,0}, {6386,1,0,0},
+    {6387,1,0,0}, {0,0,3,2132}, {0,0,3,2135}, {0,0,3,2138},
+    {0,0,3,2141}, {0,0,3,2144}, {0,0,3,2147}, {0,0,3,2150},
+    {0,0,3,2153}, {0,0,3,2156}, {0,0,3,2159}, {6388,1,0,0},
+    {0,0,2,1895}, {6389,1,2,2162}, {0,0,3,2164}, {0,0,3,2167},
+    {0,0,3,2170}, {6390,1,0,0}, {6391,1,0,0}, {0,0,3,2173},
+    {0,0,3,2176}, {6392,1,0,0}, {6393,1,0,0}, {6394,1,0,0},
+    {6395,1,0,0}, {6396,1,0,0}, {6397,1,0,0}, {6398,1,0,0},
+    {0,0,3,2179}, {0,0,2,1927}, {0,0,3,2182}, {6399,1,0,0},
+    {6400,1,2,2185}, {0,0,2,2187}, {0,0,3,2189}, {6401,1,0,0},
+    {0,0,2,1158}, {6402,1,0,0}, {6403,1,0,0}, {0,0,3,2192},
+    {6404,1,0,0}, {6405,1,0,0}, {6406,2,0,0}, {6408,1,0,0},
+    {6409,1,0,0}, {6410,1,0,0}, {0,0,3,2195}, {6411,1,0,0},
+    {0,0,1,2198}, {6412,2,0,0}, {0,0,1,2199}, {6414,1,0,0},
+    {6415,1,0,0}, {6416,2,0,0}, {6418,1,0,0}, {6419,1,0,0},
+    {6420,1,0,0}, {6421,1,0,0}, {0,0,3,2200}, {0,0,3,2203},
+    {0,0,3,2206}, {0,0,3,2209}, {0,0,3,2212}, {6422,2,0,0},
+    {0,0,3,2215}, {0,0,3,2218}, {6424,2,0,0}, {6426,1,0,0},
+    {6427,1,0,0}, {6428,1,0,0}, {6429,1,0,0}, {0,0,3,2221},
+    {6430,2,0,0}, {6432,1,0,0}, {6433,1,0,0}, {6434,1,0,0},
+    {6435,1,2,2224}, {6436,1,0,0}, {0,0,3,2226}, {0,0,3,2229},
+    {6437,1,0,0}, {0,0,3,2232}, {6438,1,0,0}, {6439,1,0,0},
+    {6440,1,0,0}, {0,0,3,2235}, {6441,1,0,0}, {0,0,2,2238},
+    {6442,1,0,0}, {6443,1,0,0}, {0,0,3,2240}, {6444,1,0,0},
+    {0,0,2,2243}, {6445,1,0,0}, {6446,1,0,0}, {0,0,3,2245},
+    {0,0,3,2248}, {6447,1,0,0}, {0,0,3,2251}, {6448,1,0,0},
+    {0,0,3,2254}, {6449,2,2,416}, {6451,1,0,0}, {6452,1,0,0},
+    {6453,1,0,0}, {6454,1,0,0}, {0,0,3,2257}, {6455,1,0,0},
+    {6456,1,0,0}, {6457,1,0,0}, {6458,1,0,0}, {6459,1,0,0},
+    {6460,1,0,0}, {6461,1,0,0}, {6462,1,0,0}, {6463,1,0,0},
+    {6464,1,0,0}, {6465,1,0,0}, {6466,1,0,0}, {0,0,3,2260},
+    {0,0,3,2263}, {0,0,3,2266}, {0,0,3,2269}, {6467,1,0,0},
+    {6468,1,0,0}, {0,0,3,2272}, {6469,1,2,2275}, {6470,1,0,0},
+    {6471,1,0,0}, {0,0,2,1237}, {6472,1,0,0}, {0,0,3,2277},
+    {6473,1,2,2280}, {6474,1,0,0}, {6475,1,0,0}, {6476,1,0,0},
+    {0,0,2,2282}, {0,0,3,2284}, {6477,1,0,0}, {6478,1,0,0},
+    {6479,1,0,0}, {6480,1,0,0}, {0,0,2,2287}, {6481,1,0,0},
+    {0,0,3,2289}, {6482,1,0,0}, {0,0,2,2292}, {6483,1,0,0},
+    {6484,1,0,0}, {0,0,3,1259}, {6485,1,0,0}, {6486,1,0,0},
+    {6487,1,0,0}, {0,0,3,2294}, {6488,1,0,0}, {6489,1,0,0},
+    {0,0,3,2297}, {0,0,3,2300}, {0,0,3,2257}, {0,0,3,2303},
+    {6490,1,0,0}, {6491,1,0,0}, {6492,1,0,0}, {6493,1,0,0},
+    {6494,1,0,0}, {0,0,3,2306}, {6495,1,0,0}, {0,0,3,2309},
+    {0,0,2,2312}, {0,0,3,2314}, {0,0,3,2317}, {6496,1,0,0},
+    {0,0,3,2320}, {6497,1,0,0}, {6498,1,2,1314}, {6499,1,0,0},
+    {6500,1,2,2323}, {6501,1,0,0}, {6502,1,0,0}, {6503,1,0,0},
+    {6504,1,0,0}, {6505,1,0,0}, {6506,1,2,2325}, {6507,1,0,0},
+    {6508,1,0,0}, {6509,1,0,0}, {6510,1,0,0}, {6511,1,0,0},
+    {6512,1,0,0}, {0,0,3,2327}, {0,0,3,2330}, {6513,1,0,0},
+    {0,0,2,2333}, {6514,1,0,0}, {6515,1,0,0}, {0,0,2,2335},
+    {6516,1,0,0}, {0,0,3,2337}, {6517,2,0,0}, {6519,1,0,0},
+    {0,0,3,2340}, {6520,1,0,0}, {0,0,3,474}, {0,0,3,2343},
+    {0,0,1,2346}, {0,0,3,2347}, {0,0,3,2350}, {0,0,3,2353},
+    {0,0,3,2356}, {6521,1,0,0}, {6522,1,0,0}, {6523,1,0,0},
+    {6524,1,0,0}, {6525,1,0,0}, {6526,1,0,0}, {6527,1,0,0},
+    {6528,1,0,0}, {6529,1,0,0}, {6530,1,0,0}, {6531,1,0,0},
+    {6532,1,0,0}, {6533,1,0,0}, {6534,1,0,0}, {0,0,3,2359},
+    {0,0,2,2362}, {6535,2,0,0}, {6537,1,0,0}, {6538,1,0,0},
+    {6539,1,0,0}, {6540,1,0,0}, {0,0,3,2364}, {6541,1,0,0},
+    {6542,1,0,0}, {6543,1,0,0}, {6544,1,0,0}, {6545,1,0,0},
+    {6546,1,0,0}, {6547,1,0,0}, {6548,1,0,0}, {6549,1,2,2367},
+    {0,0,2,1330}, {0,0,2,1334}, {6550,1,2,2369}, {6551,1,0,0},
+    {0,0,3,1760}, {6552,1,0,0}, {0,0,3,2371}, {0,0,2,2374},
+    {0,0,2,2376}, {0,0,3,14}, {6553,1,0,0}, {6554,1,0,0},
+    {0,0,2,2378}, {0,0,2,2380}, {6555,1,0,0}, {0,0,3,2382},
+    {6556,1,0,0}, {6557,1,0,0}, {6558,1,0,0}, {6559,1,0,0},
+    {6560,1,0,0}, {6561,1,0,0}, {6562,1,0,0}, {0,0,2,2385},
+    {0,0,3,2387}, {6563,1,2,2390}, {0,0,3,2392}, {6564,1,0,0},
+    {0,0,3,2395}, {6565,1,0,0}, {0,0,3,85}, {6566,1,0,0},
+    {0,0,2,2398}, {0,0,2,2400}, {0,0,2,2402}, {6567,1,0,0},
+    {0,0,2,2404}, {0,0,2,2406}, {6568,1,0,0}, {6569,1,0,0},
+    {6570,1,0,0}, {0,0,3,2408}, {6571,1,0,0}, {0,0,3,2411},
+    {6572,1,0,0}, {6573,1,0,0}, {6574,1,0,0}, {6575,1,0,0},
+    {0,0,3,2414}, {6576,1,0,0}, {0,0,2,1380}, {0,0,3,2417},
+    {6577,1,0,0}, {6578,1,0,0}, {6579,1,0,0}, {6580,1,0,0},
+    {6581,1,0,0}, {6582,1,0,0}, {6583,1,0,0}, {6584,1,0,0},
+    {0,0,6,2420}, {0,0,3,2426}, {0,0,3,2429}, {6585,1,0,0},
+    {6586,1,0,0}, {0,0,3,2432}, {6587,2,0,0}, {6589,1,0,0},
+    {6590,1,0,0}, {0,0,3,2435}, {0,0,3,2438}, {6591,1,0,0},
+    {6592,1,0,0}, {6593,1,0,0}, {6594,1,0,0}, {6595,1,0,0},
+    {6596,1,0,0}, {6597,1,0,0}, {6598,1,0,0}, {6599,1,0,0},
+    {0,0,3,2441}, {6600,2,0,0}, {6602,1,0,0}, {6603,1,0,0},
+    {6604,1,0,0}, {6605,2,0,0}, {6607,1,0,0}, {6608,1,0,0},
+    {6609,1,0,0}, {6610,1,0,0}, {0,0,3,2444}, {0,0,3,2447},
+    {6611,1,0,0}, {0,0,3,2450}, {0,0,3,2453}, {6612,1,0,0},
+    {6613,1,0,0}, {0,0,3,2456}, {6614,1,0,0}, {6615,2,0,0},
+    {6617,1,0,0}, {0,0,3,534}, {0,0,3,2459}, {0,0,3,2462},
+    {0,0,3,2465}, {0,0,3,2468}, {6618,1,0,0}, {6619,1,0,0},
+    {6620,1,0,0}, {6621,1,0,0}, {0,0,3,2471}, {6622,1,0,0},
+    {6623,1,0,0}, {6624,1,0,0}, {6625,1,0,0}, {6626,1,0,0},
+    {6627,1,0,0}, {0,0,3,2474}, {6628,1,0,0}, {0,0,3,2477},
+    {6629,1,0,0}, {0,0,3,2480}, {6630,1,0,0}, {0,0,3,2483},
+    {0,0,3,2486}, {0,0,3,2489}, {6631,1,0,0}, {6632,1,0,0},
+    {0,0,3,2492}, {0,0,3,2495}, {6633,1,0,0}, {6634,1,0,0},
+    {6635,1,0,0}, {6636,1,0,0}, {6637,1,0,0}, {0,0,3,2498},
+    {0,0,3,2501}, {6638,1,0,0}, {6639,1,0,0}, {6640,1,0,0},
+    {0,0,3,2504}, {6641,1,0,0}, {6642,4,0,0}, {6646,1,0,0},
+    {6647,1,0,0}, {0,0,3,2507}, {6648,1,0,0}, {0,0,2,1440},
+    {6649,1,0,0}, {6650,1,0,0}, {6651,1,2,2510}, {0,0,3,2512},
+    {6652,1,0,0}, {6653,2,0,0}, {6655,1,0,0}, {6656,1,0,0},
+    {6657,1,0,0}, {6658,1,0,0}, {0,0,3,2515}, {6659,1,0,0},
+    {6660,1,0,0}, {6661,1,0,0}, {6662,1,0,0}, {6663,1,0,0},
+    {0,0,3,180}, {6664,1,0,0}, {0,0,5,2518}, {0,0,2,2523},
+    {6665,1,0,0}, {0,0,3,2525}, {6666,1,0,0}, {0,0,5,2528},
+    {6667,1,0,0}, {6668,1,0,0}, {6669,1,0,0}, {0,0,3,2533},
+    {6670,1,0,0}, {0,0,3,2536}, {0,0,3,2539}, {6671,1,0,0},
+    {0,0,3,2542}, {6672,1,0,0}, {0,0,5,2545}, {6673,1,0,0},
+    {6674,1,0,0}, {0,0,5,2550}, {6675,2,0,0}, {0,0,5,596},
+    {6677,1,0,0}, {0,0,3,2555}, {0,0,3,2558}, {0,0,3,2561},
+    {0,0,3,2564}, {0,0,3,2567}, {0,0,3,2570}, {6678,1,0,0},
+    {6679,1,0,0}, {0,0,5,610}, {6680,1,0,0}, {0,0,3,618},
+    {0,0,3,2573}, {0,0,3,2576}, {6681,1,0,0}, {0,0,3,2579},
+    {6682,1,0,0}, {6683,1,0,0}, {6684,3,0,0}, {0,0,3,2582},
+    {6687,3,0,0}, {6690,1,0,0}, {6691,1,0,0}, {0,0,5,2585},
+    {6692,1,0,0}, {6693,1,0,0}, {0,0,3,621}, {6694,1,0,0},
+    {0,0,3,2590}, {0,0,3,2593}, {6695,1,0,0}, {6696,1,0,0},
+    {6697,1,0,0}, {0,0,3,2596}, {6698,1,0,0}, {6699,1,0,0},
+    {6700,2,0,0}, {0,0,3,2599}, {6702,1,0,0}, {0,0,3,1501},
+    {0,0,3,1508}, {6703,1,0,0}, {6704,1,0,0}, {0,0,5,2602},
+    {0,0,3,2607}, {6705,1,0,0}, {0,0,3,624}, {6706,1,0,0},
+    {0,0,5,2610}, {0,0,3,2615}, {6707,1,0,0}, {6708,1,2,2618},
+    {6709,1,0,0}, {6710,1,0,0}, {0,0,3,2620}, {6711,1,0,0},
+    {6712,1,0,0}, {6713,1,0,0}, {6714,1,0,0}, {6715,1,0,0},
+    {6716,1,0,0}, {6717,1,0,0}, {6718,1,0,0}, {0,0,6,2623},
+    {0,0,3,2629}, {6719,1,0,0}, {0,0,3,2632}, {6720,1,0,0},
+    {6721,1,0,0}, {6722,1,2,2635}, {0,0,2,1572}, {0,0,3,2637},
+    {6723,1,0,0}, {6724,1,0,0}, {0,0,2,2640}, {0,0,3,2642},
+    {6725,1,2,2645}, {0,0,3,2647}, {0,0,3,2650}, {0,0,3,2653},
+    {6726,1,0,0}, {0,0,3,2656}, {0,0,2,2659}, {0,0,2,2661},
+    {6727,1,0,0}, {6728,1,0,0}, {0,0,3,2663}, {0,0,3,2666},
+    {0,0,3,2669}, {0,0,3,1598}, {6729,1,0,0}, {6730,1,0,0},
+    {6731,1,0,0}, {6732,1,2,2672}, {6733,1,2,2674}, {6734,2,0,0},
+    {0,0,3,2676}, {6736,1,0,0}, {6737,1,0,0}, {0,0,3,2679},
+    {6738,1,0,0}, {6739,1,0,0}, {6740,1,0,0}, {6741,1,0,0},
+    {6742,1,0,0}, {0,0,3,2682}, {6743,1,0,0}, {6744,2,0,0},
+    {6746,1,0,0}, {6747,1,0,0}, {0,0,3,2685}, {6748,1,0,0},
+    {6749,1,0,0}, {6750,1,0,0}, {0,0,3,2688}, {6751,1,2,123},
+    {6752,1,0,0}, {6753,1,0,0}, {6754,1,0,0}, {0,0,2,1614},
+    {0,0,3,2691}, {6755,1,0,0}, {6756,1,0,0}, {6757,1,0,0},
+    {6758,1,0,0}, {6759,1,0,0}, {6760,1,0,0}, {6761,1,0,0},
+    {0,0,3,2694}, {6762,1,0,0}, {0,0,3,2697}, {6763,1,0,0},
+    {6764,1,0,0}, {6765,1,0,0}, {6766,1,0,0}, {6767,1,0,0},
+    {0,0,3,2700}, {6768,1,0,0}, {6769,1,0,0}, {6770,1,0,0},
+    {6771,1,0,0}, {6772,1,0,0}, {0,0,1,2703}, {6773,1,0,0},
+    {0,0,3,2704}, {6774,1,0,0}, {0,0,3,2707}, {6775,1,0,0},
+    {0,0,3,981}, {6776,1,0,0}, {0,0,3,2710}, {0,0,3,2713},
+    {6777,1,0,0}, {0,0,2,1657}, {6778,1,0,0}, {0,0,3,2716},
+    {6779,1,0,0}, {0,0,3,2719}, {6780,1,0,0}, {6781,1,0,0},
+    {6782,1,0,0}, {6783,1,0,0}, {6784,1,0,0}, {6785,1,0,0},
+    {0,0,3,2722}, {6786,1,0,0}, {0,0,3,2725}, {6787,1,0,0},
+    {0,0,3,2728}, {0,0,3,2731}, {6788,1,0,0}, {6789,1,0,0},
+    {0,0,3,2734}, {6790,2,0,0}, {6792,1,0,0}, {6793,1,0,0},
+    {0,0,3,2737}, {6794,1,0,0}, {0,0,3,2740}, {6795,1,0,0},
+    {6796,1,0,0}, {6797,1,0,0}, {0,0,3,969}, {6798,1,0,0},
+    {6799,1,0,0}, {0,0,3,2743}, {0,0,3,2746}, {6800,1,0,0},
+    {6801,1,0,0}, {6802,1,0,0}, {6803,1,0,0}, {6804,1,0,0},
+    {6805,1,0,0}, {6806,1,0,0}, {6807,1,0,0}, {0,0,3,2749},
+    {0,0,3,2752}, {6808,2,0,0}, {0,0,3,2755}, {0,0,3,2758},
+    {0,0,3,2761}, {0,0,3,2764}, {0,0,3,2767}, {6810,1,0,0},
+    {6811,1,0,0}, {6812,1,0,0}, {6813,1,0,0}, {0,0,3,2770},
+    {6814,1,0,0}, {0,0,3,2773}, {6815,1,0,0}, {6816,1,0,0},
+    {6817,1,0,0}, {0,0,3,2776}, {0,0,3,2779}, {6818,1,0,0},
+    {6819,1,0,0}, {6820,1,0,0}, {0,0,3,2782}, {6821,1,0,0},
+    {0,0,3,2785}, {6822,1,0,0}, {0,0,2,2788}, {0,0,3,2790},
+    {6823,1,0,0}, {6824,1,0,0}, {0,0,3,2793}, {0,0,3,2796},
+    {0,0,3,2799}, {0,0,3,2802}, {6825,1,0,0}, {0,0,3,2805},
+    {6826,1,0,0}, {6827,1,0,0}, {6828,1,0,0}, {0,0,3,2808},
+    {6829,1,0,0}, {0,0,3,2811}, {6830,1,0,0}, {6831,1,0,0},
+    {6832,1,0,0}, {0,0,2,2814}, {6833,1,0,0}, {6834,1,0,0},
+    {6835,1,0,0}, {0,0,3,1704}, {0,0,3,2816}, {0,0,3,2819},
+    {0,0,3,2822}, {6836,1,0,0}, {6837,1,0,0}, {0,0,3,1382},
+    {6838,1,0,0}, {6839,1,0,0}, {6840,1,0,0}, {0,0,3,2825},
+    {0,0,6,2828}, {6841,1,0,0}, {6842,1,0,0}, {6843,2,0,0},
+    {0,0,3,2834}, {6845,1,0,0}, {0,0,3,2837}, {6846,1,0,0},
+    {0,0,3,2840}, {6847,1,0,0}, {6848,1,0,0}, {0,0,3,2843},
+    {6849,1,0,0}, {6850,1,0,0}, {6851,1,0,0}, {6852,1,0,0},
+    {0,0,3,1659}, {6853,1,0,0}, {6854,1,0,0}, {6855,1,0,0},
+    {0,0,3,2846}, {6856,1,0,0}, {0,0,2,546}, {6857,1,0,0},
+    {6858,1,0,0}, {6859,1,0,0}, {0,0,3,2849}, {0,0,3,2852},
+    {6860,1,0,0}, {6861,1,0,0}, {6862,3,0,0}, {6865,1,0,0},
+    {6866,1,0,0}, {6867,1,0,0}, {6868,1,0,0}, {6869,1,0,0},
+    {6870,1,0,0}, {6871,1,0,0}, {6872,1,0,0}, {6873,1,0,0},
+    {6874,1,0,0}, {6875,1,0,0}, {6876,1,0,0}, {6877,1,0,0},
+    {6878,1,0,0}, {6879,1,0,0}, {6880,1,0,0}, {6881,1,0,0},
+    {0,0,3,2855}, {0,0,3,2858}, {6882,1,0,0}, {6883,3,0,0},
+    {6886,1,0,0}, {6887,1,0,0}, {6888,1,0,0}, {0,0,3,2861},
+    {6889,1,0,0}, {0,0,3,2864}, {6890,1,0,0}, {6891,1,0,0},
+    {0,0,2,1748}, {6892,1,0,0}, {6893,1,0,0}, {6894,1,0,0},
+    {6895,1,0,0}, {6896,1,0,0}, {6897,1,0,0}, {0,0,2,2867},
+    {6898,1,0,0}, {6899,1,0,0}, {6900,1,0,0}, {6901,1,0,0},
+    {6902,1,0,0}, {0,0,3,51}, {6903,1,0,0}, {0,0,2,1756},
+    {0,0,2,2869}, {0,0,2,1758}, {6904,2,0,0}, {6906,1,0,0},
+    {6907,1,0,0}, {6908,1,0,0}, {6909,1,0,0}, {6910,1,0,0},
+    {0,0,3,1973}, {6911,1,0,0}, {6912,1,0,0}, {6913,1,0,0},
+    {6914,1,0,0}, {0,0,3,2871}, {6915,1,0,0}, {6916,1,0,0},
+    {0,0,2,2874}, {6917,1,0,0}, {0,0,3,2876}, {6918,1,0,0},
+    {6919,1,2,2879}, {0,0,2,2881}, {6920,1,0,0}, {0,0,2,1791},
+    {0,0,3,2883}, {6921,1,0,0}, {0,0,3,2886}, {6922,1,0,0},
+    {6923,1,2,2889}, {0,0,3,2891}, {0,0,3,2894}, {0,0,3,2897},
+    {6924,2,0,0}, {6926,1,0,0}, {0,0,3,2900}, {0,0,2,2903},
+    {0,0,2,2905}, {6927,1,0,0}, {6928,1,0,0}, {6929,1,0,0},
+    {0,0,3,2907}, {0,0,2,1012}, {6930,1,0,0}, {6931,1,0,0},
+    {6932,2,0,0}, {6934,1,0,0}, {0,0,2,2910}, {0,0,3,2912},
+    {0,0,3,2915}, {6935,1,0,0}, {0,0,3,2918}, {0,0,3,2921},
+    {6936,1,0,0}, {0,0,3,2924}, {0,0,3,2927}, {6937,1,0,0},
+    {6938,1,0,0}, {6939,1,0,0}, {6940,1,0,0}, {6941,1,0,0},
+    {0,0,2,667}, {6942,1,0,0}, {6943,1,0,0}, {6944,1,0,0},
+    {6945,1,0,0}, {6946,1,0,0}, {6947,1,0,0}, {6948,1,0,0},
+    {0,0,3,2930}, {6949,1,0,0}, {0,0,3,2933}, {6950,1,0,0},
+    {6951,1,0,0}, {0,0,3,2936}, {0,0,6,2939}, {0,0,6,2945},
+    {0,0,3,1625}, {0,0,3,2951}, {6952,1,0,0}, {6953,1,0,0},
+    {6954,1,0,0}, {6955,1,0,0}, {6956,1,0,0}, {0,0,2,2954},
+    {6957,1,0,0}, {0,0,3,365}, {6958,1,0,0}, {6959,1,0,0},
+    {6960,1,0,0}, {0,0,3,2956}, {0,0,3,2959}, {0,0,3,2962},
+    {0,0,3,2965}, {0,0,3,2968}, {0,0,3,2971}, {0,0,3,2974},
+    {6961,1,0,0}, {6962,1,0,0}, {0,0,3,2977}, {0,0,3,2980},
+    {6963,1,0,0}, {6964,1,0,0}, {0,0,3,2983}, {6965,1,0,0},
+    {6966,1,2,2986}, {0,0,2,2988}, {6967,1,0,0}, {6968,1,0,0},
+    {6969,1,0,0}, {6970,1,0,0}, {0,0,2,1883}, {0,0,2,2990},
+    {0,0,2,1885}, {6971,1,0,0}, {0,0,3,2992}, {0,0,2,1893},
+    {6972,1,0,0}, {0,0,3,2995}, {6973,1,0,0}, {6974,1,0,0},
+    {0,0,3,1147}, {0,0,2,2998}, {6975,1,0,0}, {6976,1,0,0},
+    {0,0,2,3000}, {0,0,2,1897}, {6977,1,0,0}, {6978,1,0,0},
+    {6979,1,0,0}, {6980,1,0,0}, {6981,1,0,0}, {6982,1,0,0},
+    {6983,1,0,0}, {6984,1,0,0}, {6985,1,0,0}, {0,0,3,3002},
+    {6986,1,0,0}, {0,0,3,3005}, {6987,1,0,0}, {6988,1,0,0},
+    {6989,1,0,0}, {0,0,3,3008}, {6990,1,0,0}, {0,0,3,3011},
+    {0,0,2,3014}, {6991,1,0,0}, {6992,1,0,0}, {6993,1,0,0},
+    {0,0,3,3016}, {6994,1,0,0}, {6995,1,0,0}, {6996,1,0,0},
+    {6997,2,0,0}, {6999,1,0,0}, {7000,1,0,0}, {7001,1,0,0},
+    {7002,1,0,0}, {7003,1,0,0}, {7004,1,0,0}, {7005,1,0,0},
+    {7006,2,0,0}, {7008,1,0,0}, {0,0,2,3019}, {0,0,2,1912},
+    {0,0,2,3021}, {0,0,2,1914}, {7009,1,0,0}, {7010,1,0,0},
+    {7011,1,0,0}, {7012,1,0,0}, {7013,1,0,0}, {7014,1,0,0},
+    {0,0,3,2303}, {7015,1,0,0}, {7016,1,0,0}, {7017,1,0,0},
+    {0,0,3,3023}, {7018,1,0,0}, {0,0,2,3026}, {0,0,2,3028},
+    {0,0,2,3030}, {7019,6,0,0}, {0,0,2,3032}, {7025,1,0,0},
+    {7026,1,0,0}, {0,0,2,3034}, {7027,1,0,0}, {7028,1,0,0},
+    {0,0,2,1933}, {0,0,2,1935}, {7029,1,0,0}, {7030,1,0,0},
+    {7031,1,0,0}, {7032,1,0,0}, {7033,1,0,0}, {0,0,2,3036},
+    {0,0,2,3038}, {0,0,2,3040}, {0,0,2,3042}, {0,0,2,3044},
+    {7034,1,0,0}, {0,0,2,3046}, {0,0,2,3048}, {7035,1,0,0},
+    {7036,1,0,0}, {7037,1,0,0}, {7038,1,0,0}, {7039,1,0,0},
+    {7040,1,0,0}, {7041,1,0,0}, {7042,3,0,0}, {7045,1,0,0},
+    {7046,1,0,0}, {7047,1,0,0}, {7048,1,0,0}, {7049,1,0,0},
+    {7050,1,0,0}, {7051,1,0,0}, {7052,1,0,0}, {7053,1,0,0},
+    {7054,1,0,0}, {7055,1,0,0}, {7056,1,0,0}, {7057,1,0,0},
+    {7058,1,0,0}, {0,0,2,3050}, {7059,1,0,0}, {7060,1,0,0},
+    {7061,1,0,0}, {7062,1,0,0}, {7063,1,0,0}, {7064,1,0,0},
+    {0,0,2,3052}, {7065,1,0,0}, {7066,1,0,0}, {7067,1,0,0},
+    {0,0,2,3054}, {0,0,2,3056}, {0,0,2,3058}, {7068,1,0,0},
+    {7069,1,0,0}, {7070,1,0,0}, {7071,1,0,0}, {7072,1,0,0},
+    {7073,1,0,0}, {7074,1,0,0}, {7075,1,0,0}, {7076,1,0,0},
+    {7077,1,0,0}, {7078,1,0,0}, {7079,1,0,0}, {7080,1,0,0},
+    {7081,2,0,0}, {7083,1,0,0}, {7084,6,0,0}, {7090,1,0,0},
+    {7091,1,0,0}, {7092,1,0,0}, {7093,1,0,0}, {7094,1,0,0},
+    {7095,1,0,0}, {7096,1,0,0}, {7097,1,0,0}, {7098,1,0,0},
+    {7099,1,0,0}, {0,0,2,1949}, {0,0,2,1953}, {0,0,2,3060},
+    {0,0,2,1955}, {7100,1,0,0}, {7101,1,0,0}, {0,0,2,1959},
+    {0,0,2,1961}, {0,0,3,3062}, {7102,1,0,0}, {7103,1,0,0},
+    {7104,1,0,0}, {7105,1,0,0}, {7106,1,0,0}, {7107,1,0,0},
+    {7108,1,0,0}, {7109,1,0,0}, {7110,1,0,0}, {0,0,2,3065},
+    {0,0,3,3067}, {0,0,2,3070}, {0,0,2,3072}, {7111,2,0,0},
+    {7113,1,0,0}, {7114,1,0,0}, {7115,1,0,0}, {7116,2,0,0},
+    {7118,1,0,0}, {7119,1,0,0}, {7120,1,0,0}, {7121,3,0,0},
+    {7124,1,0,0}, {7125,1,0,0}, {7126,1,0,0}, {7127,1,0,0},
+    {7128,1,0,0}, {0,0,2,3074}, {0,0,2,3076}, {0,0,2,3078},
+    {0,0,2,3080}, {0,0,2,3082}, {7129,1,0,0}, {7130,1,0,0},
+    {7131,1,0,0}, {7132,1,0,0}, {7133,1,0,0}, {0,0,3,713},
+    {7134,1,0,0}, {7135,1,0,0}, {7136,1,0,0}, {0,0,3,297},
+    {7137,1,0,0}, {7138,1,0,0}, {7139,1,0,0}, {7140,1,0,0},
+    {0,0,3,303}, {0,0,2,3084}, {0,0,2,3086}, {7141,1,0,0},
+    {7142,1,0,0}, {7143,1,0,0}, {7144,1,0,0}, {7145,1,0,0},
+    {7146,1,0,0}, {7147,1,0,0}, {0,0,2,3088}, {0,0,2,1980},
+    {7148,1,0,0}, {0,0,2,3090}, {0,0,2,3092}, {0,0,2,1984},
+    {7149,1,0,0}, {7150,1,0,0}, {7151,1,0,0}, {7152,1,0,0},
+    {7153,3,0,0}, {7156,1,0,0}, {7157,1,0,0}, {7158,1,0,0},
+    {7159,1,0,0}, {7160,1,0,0}, {7161,1,0,0}, {7162,1,0,0},
+    {7163,1,0,0}, {0,0,2,3094}, {0,0,3,3096}, {0,0,3,1021},
+    {7164,1,0,0}, {7165,1,0,0}, {0,0,3,3099}, {0,0,2,2003},
+    {0,0,2,3102}, {0,0,2,3104}, {7166,1,0,0}, {0,0,2,2007},
+    {0,0,2,3106}, {0,0,2,2009}, {7167,1,0,0}, {0,0,3,3108},
+    {7168,1,0,0}, {0,0,3,3111}, {7169,8,0,0}, {7177,2,0,0},
+    {0,0,3,3114}, {7179,1,0,0}, {0,0,3,3117}, {0,0,3,51},
+    {7180,1,0,0}, {7181,1,0,0}, {0,0,2,2026}, {7182,1,0,0},
+    {7183,1,0,0}, {7184,1,0,0}, {7185,1,0,0}, {7186,2,0,0},
+    {0,0,3,3120}, {0,0,3,3123}, {7188,1,0,0}, {7189,1,0,0},
+    {0,0,3,3126}, {7190,1,0,0}, {7191,1,0,0}, {0,0,3,801},
+    {7192,1,0,0}, {0,0,3,1832}, {7193,1,0,0}, {0,0,3,1835},
+    {7194,1,0,0}, {7195,1,0,0}, {7196,1,0,0}, {7197,1,0,0},
+    {7198,1,0,0}, {7199,1,0,0}, {7200,1,0,0}, {0,0,3,325},
+    {7201,1,0,0}, {0,0,3,2728}, {7202,1,0,0}, {7203,1,0,0},
+    {7204,1,0,0}, {7205,1,0,0}, {0,0,3,390}, {0,0,3,3129},
+    {0,0,3,3132}, {7206,1,0,0}, {7207,1,0,0}, {7208,1,0,0},
+    {0,0,3,3135}, {0,0,2,2162}, {7209,1,0,0}, {0,0,3,1144},
+    {0,0,3,2176}, {0,0,2,3138}, {0,0,3,3140}, {7210,1,0,0},
+    {0,0,3,3143}, {0,0,3,3146}, {0,0,3,3149}, {0,0,2,3152},
+    {0,0,2,2185}, {7211,1,0,0}, {7212,1,0,0}, {7213,1,0,0},
+    {7214,1,0,0}, {0,0,3,1167}, {7215,1,0,0}, {7216,5,0,0},
+    {7221,1,0,0}, {0,0,3,3154}, {7222,1,0,0}, {7223,1,0,0},
+    {0,0,3,2992}, {7224,1,0,0}, {0,0,1,3157}, {0,0,3,3158},
+    {7225,1,0,0}, {7226,1,0,0}, {7227,1,0,0}, {0,0,3,1582},
+    {0,0,3,3161}, {0,0,3,3164}, {7228,1,0,0}, {7229,1,0,0},
+    {0,0,3,3167}, {7230,1,0,0}, {7231,1,0,0}, {0,0,3,3170},
+    {0,0,3,3173}, {0,0,3,3176}, {0,0,3,3179}, {7232,1,0,0},
+    {7233,2,0,0}, {7235,1,0,0}, {7236,1,0,0}, {0,0,2,2224},
+    {7237,1,0,0}, {7238,1,0,0}, {0,0,3,3182}, {0,0,3,3185},
+    {0,0,3,3188}, {7239,1,0,0}, {0,0,2,3191}, {7240,1,0,0},
+    {7241,1,0,0}, {7242,1,0,0}, {0,0,3,3193}, {7243,2,0,0},
+    {7245,1,0,0}, {0,0,2,416}, {7246,1,0,0}, {0,0,3,3196},
+    {0,0,3,3199}, {0,0,3,3202}, {0,0,1,3205}, {7247,1,0,0},
+    {7248,1,0,0}, {7249,1,0,0}, {7250,1,0,0}, {7251,1,0,0},
+    {7252,1,0,0}, {7253,1,0,0}, {7254,1,0,0}, {7255,1,0,0},
+    {0,0,3,3206}, {0,0,3,3209}, {0,0,2,3212}, {7256,1,0,0},
+    {7257,1,0,0}, {0,0,2,2275}, {0,0,3,3214}, {0,0,2,3217},
+    {0,0,3,3219}, {0,0,2,2280}, {0,0,3,3222}, {7258,1,0,0},
+    {0,0,3,3225}, {7259,1,0,0}, {0,0,3,2284}, {0,0,3,3228},
+    {0,0,3,3231}, {0,0,3,3234}, {7260,1,0,0}, {0,0,3,1234},
+    {7261,1,0,0}, {7262,2,0,0}, {0,0,1,3237}, {0,0,3,3238},
+    {7264,1,0,0}, {7265,1,0,0}, {7266,1,0,0}, {7267,1,0,0},
+    {7268,1,0,0}, {0,0,3,3241}, {0,0,3,3244}, {0,0,3,3247},
+    {0,0,3,3023}, {7269,1,0,0}, {0,0,2,1314}, {0,0,3,3250},
+    {0,0,2,2323}, {0,0,3,3253}, {0,0,3,3256}, {0,0,3,3259},
+    {0,0,3,3262}, {0,0,3,3265}, {0,0,2,2325}, {0,0,3,3268},
+    {0,0,3,3271}, {0,0,3,3274}, {0,0,3,3277}, {0,0,3,3280},
+    {0,0,3,3283}, {0,0,2,3286}, {0,0,2,3288}, {0,0,2,3290},
+    {7270,1,0,0}, {0,0,3,3292}, {7271,2,0,0}, {0,0,3,3295},
+    {7273,1,0,0}, {0,0,3,3298}, {7274,1,0,0}, {7275,1,0,0},
+    {0,0,3,3301}, {0,0,3,2356}, {7276,1,0,0}, {7277,1,0,0},
+    {7278,1,0,0}, {0,0,3,1302}, {7279,1,0,0}, {0,0,3,3304},
+    {0,0,3,868}, {0,0,2,3307}, {7280,1,0,0}, {0,0,3,3309},
+    {7281,1,0,0}, {0,0,3,1445}, {0,0,3,3312}, {7282,1,0,0},
+    {7283,1,0,0}, {0,0,3,3315}, {7284,1,0,0}, {7285,1,0,0},
+    {0,0,3,3318}, {0,0,3,1319}, {0,0,2,3321}, {0,0,3,3323},
+    {0,0,3,1205}, {0,0,2,2367}, {0,0,2,2369}, {0,0,3,1632},
+    {0,0,3,3326}, {7286,1,0,0}, {7287,1,0,0}, {0,0,3,3329},
+    {7288,1,0,0}, {0,0,2,2378}, {0,0,3,3332}, {7289,1,0,0},
+    {7290,1,0,0}, {7291,1,0,0}, {7292,1,0,0}, {0,0,2,2390},
+    {7293,1,0,0}, {0,0,3,3335}, {0,0,2,3338}, {0,0,2,3340},
+    {0,0,2,3342}, {0,0,2,3344}, {0,0,2,3346}, {0,0,3,3348},
+    {0,0,2,3351}, {7294,1,0,0}, {0,0,3,920}, {0,0,2,3353},
+    {0,0,3,1377}, {7295,1,0,0}, {0,0,3,3355}, {0,0,3,3358},
+    {0,0,3,3361}, {0,0,3,3364}, {7296,1,0,0}, {0,0,3,3367},
+    {0,0,3,3370}, {0,0,1,1388}, {0,0,1,1421}, {7297,1,0,0},
+    {7298,1,0,0}, {0,0,2,3373}, {0,0,2,3375}, {0,0,3,2034},
+    {7299,1,0,0}, {7300,1,0,0}, {7301,1,0,0}, {7302,1,0,0},
+    {7303,1,0,0}, {7304,1,0,0}, {7305,1,0,0}, {7306,1,0,0},
+    {0,0,3,3377}, {7307,2,0,0}, {0,0,3,3380}, {7309,1,0,0},
+    {7310,1,0,0}, {7311,1,0,0}, {7312,1,0,0}, {7313,1,0,0},
+    {7314,1,0,0}, {0,0,3,3383}, {0,0,3,3386}, {0,0,3,3389},
+    {7315,1,0,0}, {0,0,3,3392}, {0,0,2,3395}, {0,0,3,3397},
+    {7316,1,0,0}, {7317,1,0,0}, {7318,1,0,0}, {7319,1,0,0},
+    {7320,1,0,0}, {7321,1,0,0}, {0,0,3,3400}, {7322,1,0,0},
+    {0,0,3,3403}, {0,0,1,3406}, {7323,1,0,0}, {0,0,3,3407},
+    {7324,1,0,0}, {0,0,3,3410}, {0,0,3,3413}, {0,0,3,2782},
+    {0,0,2,3416}, {0,0,3,3418}, {0,0,3,3421}, {0,0,3,3424},
+    {7325,1,0,0}, {0,0,3,3427}, {7326,1,0,0}, {7327,1,0,0},
+    {7328,1,0,0}, {7329,1,0,0}, {0,0,3,548}, {7330,1,0,0},
+    {7331,1,0,0}, {7332,1,0,0}, {0,0,3,3430}, {0,0,3,3433},
+    {7333,1,0,0}, {0,0,1,377}, {0,0,3,3436}, {0,0,2,2510},
+    {0,0,3,3439}, {0,0,3,3442}, {7334,1,0,0}, {0,0,3,100},
+    {0,0,3,3445}, {0,0,3,45}, {7335,1,0,0}, {7336,1,0,0},
+    {7337,1,0,0}, {7338,1,0,0}, {0,0,3,3448}, {0,0,3,3451},
+    {0,0,2,3454}, {7339,1,0,0}, {7340,2,0,0}, {0,0,5,3456},
+    {0,0,2,3461}, {0,0,2,3463}, {7342,1,0,0}, {0,0,3,3465},
+    {7343,1,0,0}, {0,0,3,3468}, {0,0,3,1763}, {0,0,3,3471},
+    {7344,1,0,0}, {7345,1,0,0}, {7346,1,0,0}, {7347,1,0,0},
+    {7348,1,0,0}, {0,0,3,3474}, {0,0,5,3477}, {7349,1,0,0},
+    {7350,1,0,0}, {7351,1,0,0}, {7352,1,0,0}, {7353,1,0,0},
+    {7354,1,0,0}, {7355,1,0,0}, {7356,1,0,0}, {0,0,6,3482},
+    {7357,1,0,0}, {0,0,3,3488}, {7358,1,0,0}, {0,0,5,3491},
+    {0,0,5,3496}, {7359,1,0,0}, {0,0,3,3501}, {0,0,3,3504},
+    {7360,1,0,0}, {7361,1,0,0}, {0,0,3,2599}, {7362,1,0,0},
+    {7363,1,0,0}, {7364,2,0,0}, {7366,1,0,0}, {7367,2,0,0},
+    {0,0,2,2618}, {7369,1,0,0}, {0,0,3,3507}, {0,0,3,3510},
+    {0,0,3,3513}, {0,0,3,3516}, {7370,1,0,0}, {0,0,3,3519},
+    {7371,1,0,0}, {0,0,3,3522}, {7372,1,0,0}, {0,0,3,3525},
+    {7373,1,0,0}, {0,0,3,3528}, {0,0,2,2635}, {0,0,2,3531},
+    {0,0,3,3533}, {0,0,2,2645}, {7374,1,0,0}, {7375,1,0,0},
+    {0,0,3,3536}, {7376,1,0,0}, {0,0,3,3539}, {7377,1,0,0},
+    {0,0,2,2672}, {0,0,2,2674}, {0,0,3,3542}, {7378,1,0,0},
+    {7379,1,0,0}, {0,0,3,3545}, {0,0,1,3548}, {0,0,1,3549},
+    {0,0,3,3550}, {7380,1,0,0}, {0,0,3,927}, {7381,1,0,0},
+    {0,0,3,1319}, {7382,1,0,0}, {0,0,3,1319}, {7383,1,0,0},
+    {7384,1,0,0}, {0,0,3,3553}, {0,0,3,3556}, {0,0,2,123},
+    {7385,1,0,0}, {7386,1,0,0}, {7387,1,0,0}, {7388,1,0,0},
+    {7389,1,0,0}, {0,0,3,672}, {7390,1,0,0}, {7391,1,0,0},
+    {7392,1,0,0}, {7393,1,0,0}, {0,0,3,949}, {0,0,3,3559},
+    {7394,1,0,0}, {7395,1,0,0}, {7396,1,0,0}, {0,0,3,1625},
+    {0,0,3,3562}, {0,0,3,3565}, {0,0,3,3568}, {7397,1,0,0},
+    {7398,1,0,0}, {7399,1,0,0}, {0,0,3,3571}, {0,0,2,3574},
+    {7400,1,0,0}, {0,0,3,1654}, {0,0,3,3576}, {7401,1,0,0},
+    {0,0,3,3579}, {0,0,3,3582}, {0,0,3,3585}, {0,0,3,3588},
+    {7402,1,0,0}, {0,0,3,3591}, {0,0,3,3594}, {7403,1,0,0},
+    {0,0,1,1662}, {0,0,1,1685}, {7404,1,0,0}, {7405,1,0,0},
+    {0,0,2,3597}, {0,0,2,3599}, {7406,1,0,0}, {0,0,3,2740},
+    {7407,1,0,0}, {7408,1,0,0}, {0,0,3,3601}, {0,0,3,3604},
+    {0,0,3,3607}, {7409,1,0,0}, {7410,1,0,0}, {7411,1,0,0},
+    {7412,1,0,0}, {7413,1,0,0}, {7414,1,0,0}, {7415,1,0,0},
+    {0,0,3,3610}, {7416,1,0,0}, {0,0,3,3613}, {7417,1,0,0},
+    {0,0,3,3616}, {7418,1,0,0}, {0,0,3,3619}, {0,0,3,2773},
+    {0,0,3,3622}, {0,0,3,3625}, {7419,1,0,0}, {7420,1,0,0},
+    {0,0,2,3628}, {0,0,2,3630}, {0,0,2,3632}, {0,0,3,3634},
+    {7421,1,0,0}, {0,0,3,3637}, {7422,1,0,0}, {0,0,3,1770},
+    {7423,1,0,0}, {0,0,3,2330}, {0,0,2,3640}, {7424,1,0,0},
+    {7425,1,0,0}, {0,0,2,3642}, {0,0,2,3642}, {0,0,3,3644},
+    {7426,1,0,0}, {7427,1,0,0}, {7428,1,0,0}, {0,0,3,3647},
+    {7429,1,0,0}, {0,0,2,3650}, {0,0,3,3652}, {0,0,3,3655},
+    {7430,1,0,0}, {0,0,6,3658}, {0,0,6,3664}, {0,0,3,3670},
+    {7431,1,0,0}, {0,0,3,3673}, {7432,1,0,0}, {0,0,3,713},
+    {0,0,3,1723}, {0,0,3,2808}, {0,0,3,2825}, {0,0,3,988},
+    {7433,1,0,0}, {0,0,3,3676}, {7434,1,0,0}, {7435,1,0,0},
+    {7436,1,0,0}, {7437,1,0,0}, {0,0,3,716}, {7438,1,0,0},
+    {7439,1,0,0}, {0,0,3,3679}, {0,0,3,3682}, {0,0,3,3685},
+    {7440,1,0,0}, {7441,1,0,0}, {0,0,3,695}, {7442,1,0,0},
+    {7443,1,0,0}, {7444,1,0,0}, {7445,1,0,0}, {0,0,3,3688},
+    {7446,1,0,0}, {7447,1,0,0}, {7448,1,0,0}, {7449,1,0,0},
+    {7450,1,0,0}, {7451,1,0,0}, {7452,1,0,0}, {0,0,3,725},
+    {7453,1,0,0}, {7454,1,0,0}, {0,0,3,3691}, {0,0,3,3694},
+    {0,0,3,3697}, {0,0,3,3700}, {7455,1,0,0}, {0,0,3,3703},
+    {0,0,3,3706}, {0,0,2,3709}, {0,0,2,3711}, {0,0,3,3713},
+    {0,0,3,3716}, {7456,1,0,0}, {7457,1,0,0}, {0,0,2,3719},
+    {7458,1,0,0}, {7459,1,0,0}, {0,0,3,3721}, {0,0,3,706},
+    {0,0,3,3724}, {7460,1,0,0}, {0,0,3,3727}, {0,0,3,3730},
+    {0,0,3,3733}, {7461,1,0,0}, {0,0,3,3736}, {7462,1,0,0},
+    {0,0,3,3739}, {7463,1,0,0}, {7464,1,0,0}, {7465,1,0,0},
+    {7466,1,0,0}, {0,0,2,3742}, {7467,2,0,0}, {0,0,2,2879},
+    {0,0,2,3744}, {0,0,2,3746}, {0,0,3,3748}, {0,0,2,2889},
+    {0,0,3,3751}, {7469,1,0,0}, {0,0,3,3754}, {7470,1,0,0},
+    {7471,1,0,0}, {7472,1,0,0}, {7473,1,0,0}, {7474,1,0,0},
+    {0,0,3,3757}, {7475,1,0,0}, {0,0,3,3760}, {0,0,2,3763},
+    {7476,1,0,0}, {0,0,3,3765}, {7477,1,0,0}, {7478,1,0,0},
+    {7479,1,0,0}, {0,0,2,1607}, {7480,1,0,0}, {0,0,2,1672},
+    {7481,1,0,0}, {7482,1,0,0}, {7483,1,0,0}, {7484,1,0,0},
+    {7485,1,0,0}, {0,0,3,3768}, {0,0,3,3771}, {0,0,1,1815},
+    {0,0,6,3774}, {0,0,6,3780}, {0,0,6,3786}, {0,0,6,3792},
+    {7486,1,0,0}, {0,0,3,3798}, {0,0,3,3801}, {0,0,3,138},
+    {0,0,3,141}, {0,0,3,3804}, {0,0,3,3807}, {0,0,3,3810},
+    {0,0,3,3813}, {0,0,3,2000}, {0,0,2,2986}, {0,0,2,3816},
+    {0,0,2,3818}, {0,0,3,348}, {7487,1,0,0}, {7488,1,0,0},
+    {7489,1,0,0}, {0,0,3,3126}, {7490,1,0,0}, {7491,1,0,0},
+    {0,0,3,170}, {0,0,3,3820}, {0,0,2,1158}, {7492,1,0,0},
+    {7493,1,0,0}, {7494,1,0,0}, {7495,1,0,0}, {7496,1,0,0},
+    {7497,1,0,0}, {7498,1,0,0}, {7499,1,0,0}, {7500,1,0,0},
+    {7501,1,0,0}, {7502,1,0,0}, {7503,1,0,0}, {7504,1,0,0},
+    {0,0,3,1208}, {7505,1,0,0}, {7506,1,0,0}, {7507,1,0,0},
+    {7508,2,0,0}, {7510,1,0,0}, {7511,1,0,0}, {7512,1,0,0},
+    {7513,2,0,0}, {7515,1,0,0}, {7516,1,0,0}, {7517,1,0,0},
+    {7518,3,0,0}, {7521,1,0,0}, {0,0,3,736}, {7522,1,0,0},
+    {7523,1,0,0}, {0,0,3,85}, {7524,1,0,0}, {7525,1,0,0},
+    {0,0,2,3823}, {7526,1,0,0}, {7527,1,0,0}, {7528,1,0,0},
+    {7529,1,0,0}, {7530,1,0,0}, {7531,1,0,0}, {7532,1,0,0},
+    {7533,1,0,0}, {7534,1,0,0}, {7535,1,0,0}, {7536,1,0,0},
+    {7537,1,0,0}, {7538,1,0,0}, {7539,1,0,0}, {7540,1,0,0},
+    {7541,1,0,0}, {7542,1,0,0}, {0,0,3,1643}, {7543,1,0,0},
+    {7544,1,0,0}, {7545,1,0,0}, {7546,1,0,0}, {7547,1,0,0},
+    {7548,1,0,0}, {7549,1,0,0}, {7550,1,0,0}, {7551,2,0,0},
+    {7553,1,0,0}, {7554,1,0,0}, {0,0,3,2235}, {7555,1,0,0},
+    {7556,1,0,0}, {7557,1,0,0}, {7558,1,0,0}, {7559,1,0,0},
+    {7560,1,0,0}, {7561,1,0,0}, {7562,1,0,0}, {7563,1,0,0},
+    {7564,1,0,0}, {7565,1,0,0}, {7566,1,0,0}, {7567,1,0,0},
+    {7568,1,0,0}, {7569,1,0,0}, {7570,1,0,0}, {7571,2,0,0},
+    {7573,1,0,0}, {7574,2,0,0}, {7576,1,0,0}, {7577,1,0,0},
+    {7578,1,0,0}, {7579,1,0,0}, {7580,1,0,0}, {7581,1,0,0},
+    {7582,3,0,0}, {7585,1,0,0}, {7586,1,0,0}, {0,0,1,3825},
+    {0,0,3,3826}, {7587,1,0,0}, {7588,1,0,0}, {7589,1,0,0},
+    {7590,1,0,0}, {7591,1,0,0}, {7592,2,0,0}, {7594,1,0,0},
+    {7595,1,0,0}, {7596,1,0,0}, {7597,1,0,0}, {7598,1,0,0},
+    {0,0,3,618}, {7599,1,0,0}, {7600,1,0,0}, {7601,1,0,0},
+    {7602,1,0,0}, {7603,1,0,0}, {7604,1,0,0}, {7605,1,0,0},
+    {7606,1,0,0}, {7607,1,0,0}, {7608,1,0,0}, {7609,1,0,0},
+    {7610,1,0,0}, {7611,1,0,0}, {7612,4,0,0}, {7616,1,0,0},
+    {0,0,2,3829}, {7617,1,0,0}, {0,0,3,2656}, {7618,2,0,0},
+    {7620,1,0,0}, {7621,1,0,0}, {7622,1,0,0}, {7623,1,0,0},
+    {7624,4,0,0}, {0,0,3,1622}, {7628,1,0,0}, {7629,2,0,0},
+    {7631,1,0,0}, {7632,1,0,0}, {7633,1,0,0}, {7634,1,0,0},
+    {7635,1,0,0}, {7636,1,0,0}, {7637,1,0,0}, {7638,3,0,0},
+    {7641,1,0,0}, {7642,1,0,0}, {7643,1,0,0}, {7644,1,0,0},
+    {7645,1,0,0}, {7646,1,0,0}, {7647,1,0,0}, {7648,1,0,0},
+    {7649,1,0,0}, {7650,1,0,0}, {7651,1,0,0}, {7652,1,0,0},
+    {7653,1,0,0}, {7654,1,0,0}, {7655,1,0,0}, {7656,2,0,0},
+    {7658,1,0,0}, {7659,1,0,0}, {7660,4,0,0}, {7664,1,0,0},
+    {7665,2,0,0}, {7667,1,0,0}, {7668,1,0,0}, {7669,1,0,0},
+    {7670,1,0,0}, {7671,1,0,0}, {7672,1,0,0}, {7673,1,0,0},
+    {7674,1,0,0}, {7675,1,0,0}, {7676,1,0,0}, {7677,1,0,0},
+    {7678,1,0,0}, {0,0,3,1788}, {7679,1,0,0}, {7680,1,0,0},
+    {7681,1,0,0}, {7682,1,0,0}, {7683,1,0,0}, {0,0,3,1782},
+    {7684,1,0,0}, {7685,1,0,0}, {7686,1,0,0}, {0,0,2,3831},
+    {7687,4,0,0}, {7691,1,0,0}, {7692,1,0,0}, {0,0,3,2011},
+    {7693,1,0,0}, {7694,1,0,0}, {7695,1,0,0}, {7696,1,0,0},
+    {7697,1,0,0}, {7698,1,0,0}, {7699,1,0,0}, {7700,1,0,0},
+    {7701,1,0,0}, {0,0,3,3833}, {7702,1,0,0}, {0,0,3,3836},
+    {7703,1,0,0}, {0,0,3,3008}, {7704,1,0,0}, {7705,1,0,0},
+    {7706,1,0,0}, {7707,1,0,0}, {0,0,3,1140}, {7708,1,0,0},
+    {7709,1,0,0}, {7710,1,0,0}, {0,0,3,3126}, {0,0,3,3839},
+    {0,0,3,2876}, {0,0,3,2956}, {0,0,3,2974}, {7711,1,0,0},
+    {7712,1,0,0}, {7713,1,0,0}, {0,0,3,2846}, {7714,1,0,0},
+    {7715,1,0,0}, {7716,1,0,0}, {7717,1,0,0}, {7718,1,0,0},
+    {7719,1,0,0}, {0,0,6,3842}, {7720,1,0,0}, {0,0,3,2685},
+    {7721,1,0,0}, {7722,1,0,0}, {7723,1,0,0}, {0,0,3,3848},
+    {0,0,3,3851}, {7724,1,0,0}, {7725,1,0,0}, {7726,1,0,0},
+    {7727,1,0,0}, {7728,1,0,0}, {7729,1,0,0}, {7730,1,0,0},
+    {7731,1,0,0}, {7732,1,0,0}, {0,0,3,3854}, {7733,1,0,0},
+    {0,0,3,2992}, {7734,1,0,0}, {7735,1,0,0}, {0,0,3,3857},
+    {0,0,3,3860}, {0,0,3,3863}, {0,0,3,3866}, {7736,1,0,0},
+    {0,0,3,3869}, {7737,1,0,0}, {7738,1,0,0}, {7739,1,0,0},
+    {7740,1,0,0}, {7741,1,0,0}, {7742,1,0,0}, {0,0,3,2707},
+    {0,0,3,3011}, {0,0,3,2272}, {0,0,3,3872}, {0,0,3,1208},
+    {7743,1,0,0}, {0,0,2,3288}, {7744,1,0,0}, {7745,1,0,0},
+    {7746,1,0,0}, {0,0,3,3553}, {7747,1,0,0}, {7748,1,0,0},
+    {7749,1,0,0}, {7750,1,0,0}, {7751,1,0,0}, {7752,1,0,0},
+    {0,0,3,3875}, {7753,1,0,0}, {7754,1,0,0}, {7755,1,0,0},
+    {0,0,2,1254}, {0,0,3,3219}, {7756,1,0,0}, {7757,1,0,0},
+    {0,0,3,3878}, {7758,1,0,0}, {7759,1,0,0}, {7760,1,0,0},
+    {7761,1,0,0}, {7762,1,0,0}, {7763,1,0,0}, {0,0,3,3881},
+    {7764,1,0,0}, {7765,1,0,0}, {0,0,3,3884}, {7766,1,0,0},
+    {7767,1,0,0}, {7768,1,0,0}, {0,0,3,76}, {7769,1,0,0},
+    {0,0,3,3887}, {7770,1,0,0}, {7771,1,0,0}, {7772,1,0,0},
+    {7773,1,0,0}, {7774,1,0,0}, {7775,1,0,0}, {7776,1,0,0},
+    {7777,1,0,0}, {7778,1,0,0}, {7779,1,0,0}, {7780,1,0,0},
+    {0,0,3,2387}, {0,0,3,3890}, {7781,1,0,0}, {0,0,3,3893},
+    {0,0,3,3896}, {0,0,3,3899}, {0,0,3,3902}, {0,0,3,3905},
+    {7782,1,0,0}, {7783,1,0,0}, {7784,1,0,0}, {7785,1,0,0},
+    {7786,1,0,0}, {7787,1,0,0}, {7788,1,0,0}, {0,0,3,3908},
+    {7789,1,0,0}, {7790,1,0,0}, {0,0,3,2495}, {7791,1,0,0},
+    {7792,1,0,0}, {0,0,3,97}, {0,0,3,1418}, {7793,1,0,0},
+    {7794,1,0,0}, {7795,1,0,0}, {7796,2,0,0}, {7798,1,0,0},
+    {7799,1,0,0}, {7800,1,0,0}, {0,0,3,3911}, {0,0,3,540},
+    {7801,1,0,0}, {0,0,3,3914}, {7802,1,0,0}, {0,0,3,3917},
+    {7803,1,0,0}, {0,0,3,1437}, {7804,1,0,0}, {7805,1,0,0},
+    {7806,1,0,0}, {7807,1,0,0}, {0,0,3,3920}, {7808,1,0,0},
+    {7809,1,0,0}, {7810,1,0,0}, {7811,1,0,0}, {0,0,3,585},
+    {0,0,3,2525}, {7812,1,0,0}, {7813,1,0,0}, {0,0,3,2542},
+    {0,0,3,3471}, {7814,1,0,0}, {7815,1,0,0}, {7816,1,0,0},
+    {7817,1,0,0}, {7818,1,0,0}, {0,0,3,2579}, {0,0,3,3923},
+    {0,0,3,3926}, {0,0,3,2582}, {0,0,3,3929}, {0,0,3,3932},
+    {7819,1,0,0}, {0,0,3,3935}, {0,0,5,1511}, {7820,1,0,0},
+    {7821,1,0,0}, {7822,1,0,0}, {0,0,3,3938}, {0,0,3,3941},
+    {0,0,6,2939}, {7823,1,0,0}, {0,0,5,1516}, {0,0,6,2945},
+    {7824,1,0,0}, {7825,1,0,0}, {0,0,3,3944}, {0,0,6,3947},
+    {0,0,6,3953}, {0,0,3,2632}, {0,0,3,3959}, {0,0,2,3962},
+    {0,0,3,1598}, {0,0,3,3964}, {7826,1,0,0}, {7827,1,0,0},
+    {0,0,3,3967}, {7828,1,0,0}, {0,0,3,3970}, {7829,1,0,0},
+    {0,0,3,3973}, {0,0,3,3976}, {0,0,3,3979}, {7830,1,0,0},
+    {7831,1,0,0}, {7832,1,0,0}, {7833,1,0,0}, {7834,1,0,0},
+    {7835,1,0,0}, {0,0,3,2700}, {7836,1,0,0}, {7837,1,0,0},
+    {7838,1,0,0}, {7839,1,0,0}, {0,0,3,3982}, {0,0,3,3238},
+    {7840,1,0,0}, {0,0,3,3985}, {0,0,3,3988}, {7841,1,0,0},
+    {0,0,3,3991}, {0,0,3,3994}, {0,0,3,3997}, {0,0,3,972},
+    {7842,1,0,0}, {7843,1,0,0}, {7844,1,0,0}, {7845,1,0,0},
+    {7846,1,0,0}, {7847,1,0,0}, {7848,1,0,0}, {7849,1,0,0},
+    {7850,1,0,0}, {0,0,3,4000}, {7851,1,0,0}, {7852,1,0,0},
+    {0,0,3,4003}, {7853,1,0,0}, {0,0,3,2805}, {7854,1,0,0},
+    {7855,1,0,0}, {7856,1,0,0}, {0,0,3,4006}, {0,0,3,4009},
+    {7857,1,0,0}, {7858,1,0,0}, {7859,1,0,0}, {7860,2,0,0},
+    {7862,2,0,0}, {7864,2,0,0}, {0,0,3,4012}, {0,0,3,4015},
+    {0,0,3,4018}, {0,0,3,4021}, {7866,2,0,0}, {7868,1,0,0},
+    {7869,1,0,0}, {7870,1,0,0}, {7871,1,0,0}, {7872,1,0,0},
+    {7873,1,0,0}, {0,0,3,2793}, {0,0,3,4024}, {0,0,3,4027},
+    {0,0,3,4030}, {0,0,3,4033}, {0,0,3,4036}, {0,0,3,4039},
+    {0,0,3,4042}, {7874,2,0,0}, {7876,1,0,0}, {0,0,3,2864},
+    {7877,1,0,0}, {7878,1,0,0}, {7879,1,0,0}, {7880,1,0,0},
+    {7881,1,0,0}, {0,0,3,4045}, {7882,5,0,0}, {7887,1,0,0},
+    {0,0,3,4048}, {0,0,3,4051}, {7888,1,0,0}, {7889,1,0,0},
+    {7890,1,0,0}, {7891,1,0,0}, {0,0,3,1788}, {7892,1,0,0},
+    {7893,1,0,0}, {0,0,2,1797}, {7894,1,0,0}, {7895,1,0,0},
+    {0,0,3,4054}, {7896,1,0,0}, {7897,1,0,0}, {7898,1,0,0},
+    {7899,1,0,0}, {7900,1,0,0}, {7901,1,0,0}, {7902,1,0,0},
+    {7903,1,0,0}, {7904,1,0,0}, {0,0,3,4057}, {0,0,3,4060},
+    {7905,1,0,0}, {7906,1,0,0}, {7907,1,0,0}, {7908,1,0,0},
+    {7909,1,0,0}, {7910,1,0,0}, {7911,1,0,0}, {7912,1,0,0},
+    {7913,1,0,0}, {7914,1,0,0}, {7915,1,0,0}, {7916,1,0,0},
+    {7917,1,0,0}, {7918,1,0,0}, {7919,1,0,0}, {0,0,3,4063},
+    {7920,1,0,0}, {7921,1,0,0}, {0,0,3,2257}, {7922,1,0,0},
+    {7923,1,0,0}, {7924,1,0,0}, {7925,1,0,0}, {7926,1,0,0},
+    {7927,1,0,0}, {7928,1,0,0}, {7929,1,0,0}, {7930,1,0,0},
+    {7931,3,0,0}, {7934,1,0,0}, {7935,1,0,0}, {7936,1,0,0},
+    {7937,1,0,0}, {7938,2,0,0}, {7940,1,0,0}, {7941,1,0,0},
+    {7942,1,0,0}, {7943,1,0,0}, {7944,1,0,0}, {7945,1,0,0},
+    {7946,1,0,0}, {7947,1,0,0}, {7948,1,0,0}, {7949,1,0,0},
+    {7950,1,0,0}, {7951,1,0,0}, {7952,1,0,0}, {7953,1,0,0},
+    {7954,1,0,0}, {7955,1,0,0}, {7956,1,0,0}, {7957,1,0,0},
+    {7958,1,0,0}, {7959,1,0,0}, {7960,1,0,0}, {0,0,3,493},
+    {7961,1,0,0}, {7962,2,0,0}, {7964,1,0,0}, {7965,1,0,0},
+    {7966,3,0,0}, {7969,1,0,0}, {7970,1,0,0}, {7971,1,0,0},
+    {7972,1,0,0}, {7973,1,0,0}, {7974,2,0,0}, {7976,1,0,0},
+    {7977,1,0,0}, {7978,1,0,0}, {7979,1,0,0}, {7980,1,0,0},
+    {7981,1,0,0}, {7982,1,0,0}, {7983,1,0,0}, {7984,1,0,0},
+    {7985,1,0,0}, {7986,1,0,0}, {7987,1,0,0}, {0,0,3,4066},
+    {7988,1,0,0}, {7989,1,0,0}, {7990,1,0,0}, {7991,1,0,0},
+    {7992,1,0,0}, {7993,1,0,0}, {7994,1,0,0}, {7995,1,0,0},
+    {7996,1,0,0}, {7997,1,0,0}, {7998,1,0,0}, {7999,1,0,0},
+    {8000,1,0,0}, {8001,1,0,0}, {8002,1,0,0}, {8003,1,0,0},
+    {8004,1,0,0}, {8005,1,0,0}, {8006,1,0,0}, {8007,1,0,0},
+    {8008,1,0,0}, {8009,1,0,0}, {8010,1,0,0}, {8011,1,0,0},
+    {0,0,3,105}, {8012,1,0,0}, {8013,1,0,0}, {8014,1,0,0},
+    {8015,1,0,0}, {8016,1,0,0}, {8017,1,0,0}, {8018,1,0,0},
+    {8019,1,0,0}, {8020,1,0,0}, {8021,1,0,0}, {8022,1,0,0},
+    {8023,2,0,0}, {8025,1,0,0}, {8026,1,0,0}, {8027,1,0,0},
+    {8028,1,0,0}, {8029,2,0,0}, {8031,1,0,0}, {8032,1,0,0},
+    {0,0,3,1525}, {8033,1,0,0}, {8034,1,0,0}, {8035,1,0,0},
+    {8036,1,0,0}, {8037,2,0,0}, {8039,1,0,0}, {8040,1,0,0},
+    {8041,1,0,0}, {0,0,3,1604}, {8042,1,0,0}, {8043,1,0,0},
+    {0,0,3,125}, {8044,1,0,0}, {8045,1,0,0}, {8046,1,0,0},
+    {8047,1,0,0}, {8048,1,0,0}, {8049,1,0,0}, {8050,1,0,0},
+    {8051,1,0,0}, {8052,1,0,0}, {8053,1,0,0}, {8054,1,0,0},
+    {8055,2,0,0}, {8057,1,0,0}, {0,0,3,2930}, {8058,1,0,0},
+    {8059,1,0,0}, {8060,1,0,0}, {8061,1,0,0}, {8062,1,0,0},
+    {8063,1,0,0}, {8064,1,0,0}, {8065,1,0,0}, {8066,1,0,0},
+    {8067,1,0,0}, {8068,1,0,0}, {8069,1,0,0}, {8070,1,0,0},
+    {8071,1,0,0}, {8072,1,0,0}, {8073,1,0,0}, {8074,1,0,0},
+    {8075,1,0,0}, {8076,1,0,0}, {8077,1,0,0}, {8078,1,0,0},
+    {0,0,3,131}, {8079,1,0,0}, {8080,1,0,0}, {8081,1,0,0},
+    {0,0,3,108}, {0,0,3,725}, {8082,1,0,0}, {8083,1,0,0},
+    {8084,1,0,0}, {8085,1,0,0}, {8086,1,0,0}, {8087,1,0,0},
+    {8088,1,0,0}, {8089,1,0,0}, {0,0,3,4069}, {0,0,1,3406},
+    {8090,2,0,0}, {8092,1,0,0}, {8093,1,0,0}, {8094,1,0,0},
+    {8095,1,0,0}, {8096,1,0,0}, {8097,1,0,0}, {8098,1,0,0},
+    {8099,1,0,0}, {8100,1,0,0}, {8101,1,0,0}, {8102,1,0,0},
+    {8103,1,0,0}, {8104,1,0,0}, {8105,1,0,0}, {8106,1,0,0},
+    {8107,1,0,0}, {0,0,3,4072}, {0,0,3,4075}, {0,0,3,4078},
+    {0,0,3,4081}, {0,0,3,4084}, {0,0,3,4087}, {0,0,3,4090},
+    {0,0,3,4093}, {0,0,3,4096}, {0,0,3,4099}, {0,0,3,374},
+    {0,0,3,4102}, {0,0,3,2031}, {8108,1,0,0}, {8109,1,0,0},
+    {8110,1,0,0}, {0,0,3,3123}, {0,0,3,4105}, {0,0,3,3804},
+    {8111,1,0,0}, {0,0,3,3810}, {8112,1,0,0}, {0,0,3,3813},
+    {0,0,3,2000}, {8113,1,0,0}, {8114,1,0,0}, {8115,1,0,0},
+    {0,0,3,3439}, {0,0,3,3724}, {0,0,3,4108}, {0,0,3,4111},
+    {8116,1,0,0}, {8117,1,0,0}, {8118,1,0,0}, {0,0,2,35},
+    {0,0,3,115}, {8119,1,0,0}, {8120,1,0,0}, {8121,1,0,0},
+    {0,0,3,4114}, {0,0,3,2195}, {8122,1,0,0}, {8123,1,0,0},
+    {0,0,3,4117}, {8124,1,0,0}, {8125,1,0,0}, {0,0,3,2226},
+    {8126,1,0,0}, {8127,1,0,0}, {0,0,3,4120}, {8128,1,0,0},
+    {8129,1,0,0}, {0,0,3,1231}, {0,0,3,3442}, {8130,1,0,0},
+    {8131,1,0,0}, {8132,1,0,0}, {8133,1,0,0}, {8134,1,0,0},
+    {0,0,3,1966}, {0,0,3,4123}, {0,0,3,4126}, {0,0,3,2284},
+    {8135,1,0,0}, {8136,1,0,0}, {0,0,3,4129}, {8137,1,0,0},
+    {8138,1,0,0}, {8139,1,0,0}, {0,0,3,4132}, {0,0,3,458},
+    {0,0,3,4135}, {0,0,3,1292}, {8140,1,0,0}, {8141,1,0,0},
+    {8142,1,0,0}, {8143,1,0,0}, {8144,1,0,0}, {0,0,3,3637},
+    {0,0,3,3700}, {8145,1,0,0}, {8146,1,0,0}, {0,0,3,885},
+    {0,0,3,14}, {0,0,3,4138}, {0,0,3,1070}, {0,0,3,3332},
+    {0,0,3,4141}, {0,0,3,4144}, {0,0,3,4147}, {8147,2,0,0},
+    {8149,1,0,0}, {8150,1,0,0}, {8151,3,0,0}, {8154,1,0,0},
+    {0,0,3,524}, {0,0,3,4150}, {8155,1,0,0}, {8156,1,0,0},
+    {8157,1,0,0}, {0,0,3,3199}, {8158,1,0,0}, {0,0,3,1403},
+    {8159,1,0,0}, {8160,1,0,0}, {8161,1,0,0}, {8162,1,0,0},
+    {8163,2,0,0}, {0,0,3,3206}, {0,0,3,4153}, {8165,1,0,0},
+    {8166,1,0,0}, {8167,1,0,0}, {0,0,3,4156}, {8168,1,0,0},
+    {0,0,3,2515}, {8169,1,0,0}, {8170,1,0,0}, {8171,1,0,0},
+    {0,0,3,932}, {0,0,5,4159}, {8172,1,0,0}, {8173,1,0,0},
+    {8174,1,0,0}, {8175,1,0,0}, {0,0,5,4164}, {8176,1,0,0},
+    {8177,1,0,0}, {8178,1,0,0}, {8179,1,0,0}, {8180,2,0,0},
+    {8182,2,0,0}, {8184,2,0,0}, {0,0,3,4169}, {0,0,3,654},
+    {8186,1,0,0}, {0,0,3,4172}, {0,0,3,4175}, {8187,1,0,0},
+    {8188,1,0,0}, {8189,1,0,0}, {0,0,3,1619}, {0,0,3,3559},
+    {0,0,3,4178}, {0,0,3,4181}, {0,0,3,4184}, {8190,1,0,0},
+    {0,0,3,4187}, {8191,1,0,0}, {0,0,3,37}, {8192,1,0,0},
+    {8193,1,0,0}, {8194,2,0,0}, {8196,1,0,0}, {8197,1,0,0},
+    {8198,1,0,0}, {8199,1,0,0}, {8200,1,0,0}, {0,0,3,4190},
+    {0,0,3,4193}, {0,0,3,4196}, {0,0,3,2808}, {0,0,3,560},
+    {8201,1,0,0}, {8202,1,0,0}, {0,0,3,4199}, {8203,1,0,0},
+    {0,0,3,2840}, {8204,1,0,0}, {0,0,3,2843}, {8205,1,0,0},
+    {8206,1,0,0}, {8207,1,0,0}, {0,0,3,1736}, {8208,1,0,0},
+    {8209,2,0,0}, {8211,1,0,0}, {8212,1,0,0}, {8213,1,0,0},
+    {0,0,3,1692}, {0,0,3,3634}, {0,0,3,1745}, {8214,1,0,0},
+    {8215,2,0,0}, {8217,1,0,0}, {0,0,2,3719}, {8218,1,0,0},
+    {0,0,3,706}, {0,0,3,4202}, {0,0,3,1803}, {8219,1,0,0},
+    {8220,1,0,0}, {8221,1,0,0}, {8222,1,0,0}, {0,0,3,4205},
+    {0,0,3,4208}, {8223,1,0,0}, {8224,1,0,0}, {0,0,3,3751},
+    {8225,1,0,0}, {8226,2,0,0}, {8228,1,0,0}, {0,0,3,3757},
+    {8229,1,0,0}, {0,0,2,3342}, {8230,1,0,0}, {8231,1,0,0},
+    {0,0,2,3642}, {8232,1,0,0}, {8233,1,0,0}, {0,0,2,3719},
+    {8234,1,0,0}, {8235,1,0,0}, {0,0,3,2808}, {8236,1,0,0},
+    {8237,1,0,0}, {0,0,2,2510}, {0,0,3,1577}, {8238,1,0,0},
+    {8239,1,0,0}, {8240,1,0,0}, {8241,1,0,0}, {8242,2,0,0},
+    {0,0,3,2294}, {8244,1,0,0}, {0,0,3,3161}, {8245,1,0,0},
+    {8246,1,0,0}, {8247,1,0,0}, {8248,1,0,0}, {0,0,2,136},
+    {8249,1,0,0}, {8250,3,0,0}, {8253,2,0,0}, {8255,1,0,0},
+    {8256,1,0,0}, {8257,1,0,0}, {8258,1,0,0}, {0,0,3,1202},
+    {8259,1,0,0}, {8260,1,0,0}, {0,0,2,4211}, {8261,1,0,0},
+    {8262,1,0,0}, {8263,1,0,0}, {8264,1,0,0}, {8265,1,0,0},
+    {8266,1,0,0}, {0,0,3,1196}, {8267,1,0,0}, {8268,1,0,0},
+    {8269,1,0,0}, {8270,1,0,0}, {8271,1,0,0}, {8272,1,0,0},
+    {8273,1,0,0}, {8274,1,0,0}, {8275,1,0,0}, {8276,1,0,0},
+    {8277,1,0,0}, {8278,1,0,0}, {8279,1,0,0}, {8280,1,0,0},
+    {8281,1,0,0}, {8282,1,0,0}, {8283,1,0,0}, {0,0,3,2176},
+    {8284,1,0,0}, {8285,1,0,0}, {8286,1,0,0}, {8287,1,0,0},
+    {8288,1,0,0}, {8289,1,0,0}, {0,0,3,1382}, {8290,1,0,0},
+    {8291,1,0,0}, {8292,1,0,0}, {8293,1,0,0}, {8294,1,0,0},
+    {8295,1,0,0}, {0,0,3,3386}, {8296,1,0,0}, {8297,1,0,0},
+    {8298,1,0,0}, {8299,1,0,0}, {8300,1,0,0}, {8301,1,0,0},
+    {8302,1,0,0}, {8303,1,0,0}, {8304,2,0,0}, {0,0,3,1371},
+    {8306,1,0,0}, {8307,1,0,0}, {8308,1,0,0}, {8309,1,0,0},
+    {8310,1,0,0}, {0,0,3,1418}, {8311,1,0,0}, {8312,1,0,0},
+    {8313,1,0,0}, {8314,1,0,0}, {8315,1,0,0}, {8316,1,0,0},
+    {8317,1,0,0}, {8318,1,0,0}, {8319,1,0,0}, {8320,1,0,0},
+    {0,0,3,927}, {0,0,3,100}, {8321,1,0,0}, {8322,1,0,0},
+    {8323,1,0,0}, {8324,1,0,0}, {8325,1,0,0}, {8326,1,0,0},
+    {8327,1,0,0}, {0,0,3,4213}, {8328,1,0,0}, {8329,1,0,0},
+    {8330,1,0,0}, {0,0,3,3471}, {8331,7,0,0}, {8338,1,0,0},
+    {8339,1,0,0}, {8340,1,0,0}, {8341,1,0,0}, {8342,1,0,0},
+    {8343,1,0,0}, {8344,1,0,0}, {8345,1,0,0}, {8346,1,0,0},
+    {8347,1,0,0}, {8348,1,0,0}, {8349,1,0,0}, {8350,1,0,0},
+    {8351,1,0,0}, {0,0,6,2939}, {8352,1,0,0}, {8353,1,0,0},
+    {8354,1,0,0}, {8355,1,0,0}, {8356,1,0,0}, {8357,1,0,0},
+    {8358,1,0,0}, {8359,1,0,0}, {8360,1,0,0}, {0,0,3,4216},
+    {8361,1,0,0}, {8362,1,0,0}, {0,0,2,123}, {8363,1,0,0},
+    {8364,1,0,0}, {8365,1,0,0}, {8366,1,0,0}, {8367,2,0,0},
+    {8369,1,0,0}, {8370,1,0,0}, {8371,1,0,0}, {8372,1,0,0},
+    {8373,3,0,0}, {8376,1,0,0}, {8377,1,0,0}, {8378,1,0,0},
+    {8379,1,0,0}, {8380,1,0,0}, {8381,1,0,0}, {8382,1,0,0},
+    {8383,1,0,0}, {8384,1,0,0}, {8385,1,0,0}, {8386,1,0,0},
+    {8387,1,0,0}, {8388,1,0,0}, {8389,1,0,0}, {8390,1,0,0},
+    {8391,1,0,0}, {8392,1,0,0}, {8393,1,0,0}, {8394,1,0,0},
+    {8395,1,0,0}, {8396,1,0,0}, {8397,1,0,0}, {8398,1,0,0},
+    {8399,1,0,0}, {8400,1,0,0}, {8401,1,0,0}, {8402,1,0,0},
+    {8403,1,0,0}, {8404,1,0,0}, {8405,1,0,0}, {0,0,3,3716},
+    {8406,1,0,0}, {0,0,3,3721}, {8407,1,0,0}, {8408,1,0,0},
+    {8409,1,0,0}, {0,0,3,1753}, {8410,1,0,0}, {8411,1,0,0},
+    {8412,1,0,0}, {0,0,3,2907}, {8413,1,0,0}, {8414,1,0,0},
+    {8415,1,0,0}, {8416,1,0,0}, {8417,1,0,0}, {8418,1,0,0},
+    {8419,1,0,0}, {8420,1,0,0}, {8421,1,0,0}, {8422,1,0,0},
+    {8423,1,0,0}, {8424,1,0,0}, {8425,1,0,0}, {8426,1,0,0},
+    {8427,1,0,0}, {0,0,3,3135}, {0,0,3,2167}, {0,0,3,3807},
+    {8428,1,0,0}, {8429,1,0,0}, {8430,1,0,0}, {8431,1,0,0},
+    {0,0,2,2510}, {0,0,3,2192}, {8432,1,0,0}, {8433,1,0,0},
+    {8434,1,0,0}, {8435,1,0,0}, {8436,1,0,0}, {0,0,3,808},
+    {8437,1,0,0}, {8438,1,0,0}, {8439,1,0,0}, {8440,2,0,0},
+    {8442,1,0,0}, {8443,1,0,0}, {0,0,3,2796}, {8444,1,0,0},
+    {0,0,3,1202}, {8445,1,0,0}, {8446,1,0,0}, {8447,1,0,0},
+    {8448,1,0,0}, {8449,1,0,0}, {8450,1,0,0}, {8451,1,0,0},
+    {0,0,3,450}, {0,0,3,455}, {8452,1,0,0}, {0,0,6,1308},
+    {0,0,3,3309}, {8453,1,0,0}, {8454,1,0,0}, {0,0,3,1382},
+    {8455,1,0,0}, {8456,1,0,0}, {8457,1,0,0}, {8458,1,0,0},
+    {8459,1,0,0}, {8460,1,0,0}, {8461,1,0,0}, {8462,1,0,0},
+    {0,0,3,521}, {8463,1,0,0}, {8464,1,0,0}, {8465,1,0,0},
+    {8466,1,0,0}, {8467,1,0,0}, {8468,1,0,0}, {8469,1,0,0},
+    {8470,1,0,0}, {0,0,6,1428}, {8471,1,0,0}, {8472,1,0,0},
+    {8473,1,0,0}, {8474,1,0,0}, {8475,1,0,0}, {8476,1,0,0},
+    {0,0,5,1483}, {8477,1,0,0}, {8478,1,0,0}, {0,0,5,1496},
+    {0,0,3,1508}, {8479,1,0,0}, {0,0,3,1501}, {8480,1,0,0},
+    {0,0,3,2607}, {8481,1,0,0}, {0,0,3,2615}, {8482,1,0,0},
+    {8483,1,0,0}, {8484,1,0,0}, {0,0,3,1275}, {8485,1,0,0},
+    {8486,1,0,0}, {8487,1,0,0}, {8488,1,0,0}, {0,0,3,956},
+    {8489,2,0,0}, {8491,1,0,0}, {8492,1,0,0}, {8493,1,0,0},
+    {8494,1,0,0}, {8495,1,0,0}, {8496,1,0,0}, {8497,1,0,0},
+    {8498,1,0,0}, {8499,1,0,0}, {8500,1,0,0}, {0,0,3,3655},
+    {8501,1,0,0}, {8502,1,0,0}, {8503,1,0,0}, {8504,1,0,0},
+    {0,0,3,1733}, {0,0,3,2852}, {8505,1,0,0}, {8506,1,0,0},
+    {8507,1,0,0}, {8508,1,0,0}, {0,0,3,1742}, {0,0,3,2858},
+    {8509,1,0,0}, {0,0,3,3716}, {8510,1,0,0}, {8511,1,0,0},
+    {8512,1,0,0}, {0,0,3,1773}, {8513,1,0,0}, {8514,1,0,0},
+    {8515,1,0,0}, {8516,1,0,0}, {8517,1,0,0}, {8518,1,0,0},
+    {8519,1,0,0}, {8520,1,0,0}, {8521,1,0,0}, {0,0,3,1625},
+    {8522,1,0,0}, {8523,1,0,0}, {8524,1,0,0}, {8525,1,0,0},
+    {0,0,3,801}, {8526,1,0,0}, {8527,1,0,0}, {0,0,3,2666},
+    {8528,1,0,0}, {8529,1,0,0}, {8530,1,0,0}, {8531,1,0,0},
+    {8532,1,0,0}, {8533,1,0,0}, {8534,4,0,0}, {8538,1,0,0},
+    {8539,1,0,0}, {8540,1,0,0}, {8541,1,0,0}, {8542,1,0,0},
+    {8543,1,0,0}, {8544,1,0,0}, {8545,1,0,0}, {8546,2,0,0},
+    {8548,1,0,0}, {8549,1,0,0}, {8550,1,0,0}, {8551,1,0,0},
+    {8552,1,0,0}, {8553,1,0,0}, {8554,1,0,0}, {8555,1,0,0},
+    {8556,1,0,0}, {8557,1,0,0}, {8558,1,0,0}, {8559,1,0,0},
+    {8560,1,0,0}, {0,0,3,1259}, {8561,1,0,0}, {8562,1,0,0},
+    {8563,1,0,0}, {8564,1,0,0}, {0,0,3,850}, {8565,1,0,0},
+    {8566,1,0,0}, {8567,1,0,0}, {8568,1,0,0}, {8569,1,0,0},
+    {8570,1,0,0}, {8571,1,0,0}, {8572,1,0,0}, {8573,1,0,0},
+    {0,0,3,82}, {8574,1,0,0}, {8575,1,0,0}, {8576,1,0,0},
+    {0,0,3,920}, {8577,1,0,0}, {8578,1,0,0}, {8579,1,0,0},
+    {8580,1,0,0}, {8581,1,0,0}, {8582,1,0,0}, {8583,1,0,0},
+    {8584,1,0,0}, {8585,1,0,0}, {8586,1,0,0}, {8587,1,0,0},
+    {8588,1,0,0}, {8589,1,0,0}, {8590,1,0,0}, {8591,1,0,0},
+    {0,0,3,2447}, {8592,1,0,0}, {8593,1,0,0}, {8594,1,0,0},
+    {8595,1,0,0}, {8596,1,0,0}, {8597,1,0,0}, {0,0,3,2408},
+    {8598,1,0,0}, {8599,1,0,0}, {8600,1,0,0}, {8601,1,0,0},
+    {8602,1,0,0}, {8603,1,0,0}, {8604,1,0,0}, {8605,1,0,0},
+    {8606,1,0,0}, {8607,1,0,0}, {8608,2,0,0}, {8610,1,0,0},
+    {8611,1,0,0}, {8612,1,0,0}, {8613,1,0,0}, {8614,1,0,0},
+    {8615,1,0,0}, {0,0,3,2579}, {8616,1,0,0}, {0,0,3,604},
+    {8617,1,0,0}, {8618,1,0,0}, {8619,1,0,0}, {8620,1,0,0},
+    {8621,1,0,0}, {8622,1,0,0}, {8623,1,0,0}, {8624,1,0,0},
+    {8625,1,0,0}, {8626,1,0,0}, {8627,1,0,0}, {8628,1,0,0},
+    {8629,1,0,0}, {8630,1,0,0}, {8631,1,0,0}, {8632,1,0,0},
+    {8633,3,0,0}, {8636,1,0,0}, {8637,1,0,0}, {8638,2,0,0},
+    {8640,1,0,0}, {8641,4,0,0}, {8645,2,0,0}, {8647,1,0,0},
+    {8648,1,0,0}, {8649,1,0,0}, {8650,1,0,0}, {8651,1,0,0},
+    {8652,1,0,0}, {8653,1,0,0}, {8654,1,0,0}, {8655,1,0,0},
+    {8656,1,0,0}, {8657,1,0,0}, {8658,1,0,0}, {0,0,3,1901},
+    {8659,1,0,0}, {8660,1,0,0}, {8661,1,0,0}, {8662,1,0,0},
+    {8663,1,0,0}, {0,0,3,1659}, {8664,1,0,0}, {8665,1,0,0},
+    {8666,1,0,0}, {8667,1,0,0}, {8668,1,0,0}, {8669,1,0,0},
+    {0,0,3,3604}, {8670,1,0,0}, {8671,1,0,0}, {8672,1,0,0},
+    {8673,1,0,0}, {8674,1,0,0}, {8675,1,0,0}, {8676,2,0,0},
+    {0,0,3,1643}, {8678,1,0,0}, {8679,1,0,0}, {8680,1,0,0},
+    {8681,1,0,0}, {8682,1,0,0}, {8683,1,0,0}, {8684,1,0,0},
+    {8685,1,0,0}, {8686,1,0,0}, {8687,1,0,0}, {8688,1,0,0},
+    {8689,1,0,0}, {8690,1,0,0}, {8691,1,0,0}, {8692,1,0,0},
+    {8693,1,0,0}, {8694,1,0,0}, {0,0,6,4219}, {0,0,3,1704},
+    {8695,1,0,0}, {0,0,3,51}, {0,0,3,4225}, {8696,1,0,0},
+    {8697,1,0,0}, {0,0,3,4228}, {8698,1,0,0}, {8699,1,0,0},
+    {8700,1,0,0}, {0,0,3,4156}, {8701,1,0,0}, {8702,1,0,0},
+    {8703,1,0,0}, {8704,1,0,0}, {8705,1,0,0}, {8706,1,0,0},
+    {8707,1,0,0}, {8708,1,0,0}, {8709,1,0,0}, {8710,1,0,0},
+    {8711,2,0,0}, {8713,1,0,0}, {8714,1,0,0}, {8715,1,0,0},
+    {8716,2,0,0}, {0,0,3,1566}, {8718,1,0,0}, {8719,1,0,0},
+    {0,0,3,1170}, {8720,1,0,0}, {8721,1,0,0}, {0,0,3,2229},
+    {8722,1,0,0}, {8723,1,0,0}, {8724,1,0,0}, {8725,1,0,0},
+    {8726,1,0,0}, {8727,1,0,0}, {8728,2,0,0}, {0,0,3,426},
+    {8730,1,0,0}, {8731,1,0,0}, {8732,1,0,0}, {8733,1,0,0},
+    {0,0,3,447}, {8734,1,0,0}, {8735,1,0,0}, {8736,1,0,0},
+    {8737,2,0,0}, {8739,1,0,0}, {8740,1,0,0}, {8741,1,0,0},
+    {8742,1,0,0}, {8743,1,0,0}, {0,0,3,513}, {0,0,3,510},
+    {0,0,3,3397}, {8744,1,0,0}, {8745,1,0,0}, {0,0,3,1838},
+    {8746,1,0,0}, {8747,1,0,0}, {8748,1,0,0}, {0,0,3,4231},
+    {0,0,3,4234}, {8749,1,0,0}, {0,0,3,2567}, {8750,1,0,0},
+    {8751,1,0,0}, {0,0,3,2570}, {8752,1,0,0}, {8753,1,0,0},
+    {8754,1,0,0}, {0,0,5,2602}, {0,0,5,2610}, {8755,1,0,0},
+    {8756,1,0,0}, {0,0,3,1616}, {8757,1,0,0}, {8758,1,0,0},
+    {8759,1,0,0}, {0,0,3,1659}, {8760,1,0,0}, {8761,1,0,0},
+    {8762,1,0,0}, {8763,1,0,0}, {8764,1,0,0}, {8765,1,0,0},
+    {8766,1,0,0}, {8767,1,0,0}, {0,0,3,3610}, {8768,1,0,0},
+    {8769,1,0,0}, {0,0,3,3670}, {0,0,3,3673}, {8770,1,0,0},
+    {8771,1,0,0}, {0,0,3,2849}, {0,0,3,1689}, {8772,1,0,0},
+    {8773,1,0,0}, {0,0,3,2855}, {8774,1,0,0}, {8775,1,0,0},
+    {8776,1,0,0}, {8777,1,0,0}, {8778,1,0,0}, {8779,1,0,0},
+    {8780,1,0,0}, {8781,1,0,0}, {8782,1,0,0}, {0,0,3,2921},
+    {0,0,2,2292}, {0,0,3,2284}, {8783,1,0,0}, {8784,1,0,0},
+    {8785,2,0,0}, {8787,1,0,0}, {8788,1,0,0}, {0,0,3,3536},
+    {0,0,3,3542}, {8789,1,0,0}, {8790,1,0,0}, {8791,1,0,0},
+    {8792,1,0,0}, {8793,1,0,0}, {8794,1,0,0}, {8795,1,0,0},
+    {8796,1,0,0}, {8797,1,0,0}, {8798,1,0,0}, {8799,1,0,0},
+    {8800,1,0,0}, {8801,1,0,0}, {8802,1,0,0}, {8803,1,0,0},
+    {8804,1,0,0}, {8805,1,0,0}, {8806,1,0,0}, {8807,1,0,0},
+    {8808,1,0,0}, {8809,1,0,0}, {8810,1,0,0}, {8811,1,0,0},
+    {8812,1,0,0}, {8813,1,0,0}, {8814,1,0,0}, {8815,1,0,0},
+    {8816,1,0,0}, {8817,1,0,0}, {8818,1,0,0}, {8819,1,0,0},
+    {8820,1,0,0}, {0,0,3,2752}, {8821,1,0,0}, {8822,1,0,0},
+    {8823,1,0,0}, {8824,2,0,0}, {8826,1,0,0}, {8827,1,0,0},
+    {0,0,3,76}, {8828,1,0,0}, {8829,1,0,0}, {8830,1,0,0},
+    {8831,1,0,0}, {8832,1,0,0}, {8833,1,0,0}, {8834,1,0,0},
+    {8835,1,0,0}, {8836,1,0,0}, {8837,1,0,0}, {8838,1,0,0},
+    {0,0,3,2435}, {8839,1,0,0}, {8840,1,0,0}, {8841,1,0,0},
+    {8842,1,0,0}, {8843,1,0,0}, {8844,1,0,0}, {8845,1,0,0},
+    {8846,3,0,0}, {8849,1,0,0}, {8850,1,0,0}, {8851,2,0,0},
+    {8853,1,0,0}, {8854,1,0,0}, {8855,1,0,0}, {8856,1,0,0},
+    {0,0,3,97}, {8857,1,0,0}, {8858,1,0,0}, {8859,1,0,0},
+    {8860,1,0,0}, {8861,1,0,0}, {8862,1,0,0}, {8863,1,0,0},
+    {8864,1,0,0}, {8865,1,0,0}, {0,0,3,4237}, {8866,1,0,0},
+    {8867,1,0,0}, {8868,1,0,0}, {8869,1,0,0}, {8870,1,0,0},
+    {8871,1,0,0}, {8872,1,0,0}, {8873,1,0,0}, {8874,1,0,0},
+    {8875,1,0,0}, {8876,1,0,0}, {8877,1,0,0}, {8878,1,0,0},
+    {8879,1,0,0}, {8880,1,0,0}, {8881,1,0,0}, {8882,1,0,0},
+    {8883,1,0,0}, {8884,1,0,0}, {8885,1,0,0}, {8886,1,0,0},
+    {0,0,5,1461}, {8887,1,0,0}, {8888,1,0,0}, {8889,1,0,0},
+    {8890,1,0,0}, {0,0,3,621}, {8891,1,0,0}, {8892,1,0,0},
+    {8893,1,0,0}, {8894,1,0,0}, {8895,1,0,0}, {8896,1,0,0},
+    {8897,1,0,0}, {0,0,3,624}, {8898,1,0,0}, {8899,1,0,0},
+    {8900,1,0,0}, {0,0,6,2945}, {8901,1,0,0}, {8902,1,0,0},
+    {8903,1,0,0}, {8904,1,0,0}, {8905,1,0,0}, {8906,1,0,0},
+    {8907,1,0,0}, {0,0,3,1750}, {8908,1,0,0}, {8909,1,0,0},
+    {8910,1,0,0}, {8911,1,0,0}, {8912,1,0,0}, {8913,1,0,0},
+    {8914,1,0,0}, {8915,1,0,0}, {8916,1,0,0}, {8917,1,0,0},
+    {8918,1,0,0}, {8919,1,0,0}, {8920,1,0,0}, {8921,1,0,0},
+    {8922,1,0,0}, {8923,1,0,0}, {8924,1,0,0}, {8925,1,0,0},
+    {8926,1,0,0}, {8927,1,0,0}, {8928,1,0,0}, {8929,1,0,0},
+    {0,0,3,2746}, {8930,1,0,0}, {8931,1,0,0}, {0,0,3,2704},
+    {0,0,3,4240}, {8932,1,0,0}, {8933,1,0,0}, {8934,1,0,0},
+    {8935,1,0,0}, {0,0,3,3158}, {8936,1,0,0}, {8937,2,0,0},
+    {8939,1,0,0}, {0,0,3,2837}, {0,0,3,1736}, {8940,1,0,0},
+    {8941,1,0,0}, {8942,1,0,0}, {8943,1,0,0}, {8944,1,0,0},
+    {8945,1,0,0}, {8946,1,0,0}, {8947,1,0,0}, {0,0,3,1812},
+    {8948,1,0,0}, {0,0,3,1806}, {8949,1,0,0}, {8950,1,0,0},
+    {0,0,3,560}, {8951,1,0,0}, {8952,1,0,0}, {8953,1,0,0},
+    {8954,1,0,0}, {8955,1,0,0}, {0,0,2,2037}, {8956,1,0,0},
+    {8957,1,0,0}, {8958,1,0,0}, {0,0,3,1723}, {8959,1,0,0},
+    {8960,1,0,0}, {8961,1,0,0}, {0,0,3,1569}, {0,0,3,2637},
+    {0,0,3,2215}, {0,0,3,2218}, {8962,1,0,0}, {8963,1,0,0},
+    {0,0,3,2251}, {8964,1,0,0}, {8965,1,0,0}, {8966,1,0,0},
+    {8967,1,0,0}, {8968,1,0,0}, {0,0,3,432}, {0,0,3,840},
+    {8969,1,0,0}, {8970,1,0,0}, {8971,1,0,0}, {8972,1,0,0},
+    {8973,1,0,0}, {8974,1,0,0}, {8975,1,0,0}, {8976,1,0,0},
+    {8977,1,0,0}, {8978,1,0,0}, {8979,1,0,0}, {8980,1,0,0},
+    {8981,1,0,0}, {8982,1,0,0}, {8983,1,0,0}, {8984,1,0,0},
+    {8985,1,0,0}, {8986,1,0,0}, {8987,1,0,0}, {0,0,3,2590},
+    {8988,1,0,0}, {0,0,3,2593}, {8989,1,0,0}, {8990,1,0,0},
+    {8991,1,0,0}, {0,0,3,2691}, {0,0,3,2697}, {0,0,3,865},
+    {8992,1,0,0}, {8993,2,0,0}, {8995,1,0,0}, {8996,1,0,0},
+    {8997,1,0,0}, {8998,1,0,0}, {8999,1,0,0}, {9000,1,0,0},
+    {9001,1,0,0}, {9002,1,0,0}, {9003,1,0,0}, {0,0,2,1607},
+    {0,0,3,2785}, {0,0,3,2790}, {0,0,3,51}, {9004,1,0,0},
+    {9005,2,0,0}, {9007,1,0,0}, {9008,1,0,0}, {9009,1,0,0},
+    {0,0,3,1812}, {9010,1,0,0}, {9011,1,0,0}, {9012,2,0,0},
+    {9014,2,0,0}, {9016,1,0,0}, {9017,1,0,0}, {9018,1,0,0},
+    {9019,1,0,0}, {9020,1,0,0}, {9021,1,0,0}, {9022,1,0,0},
+    {9023,1,0,0}, {9024,1,0,0}, {9025,1,0,0}, {9026,2,0,0},
+    {9028,1,0,0}, {9029,1,0,0}, {9030,1,0,0}, {9031,1,0,0},
+    {9032,1,0,0}, {9033,1,0,0}, {9034,1,0,0}, {9035,1,0,0},
+    {9036,1,0,0}, {9037,1,0,0}, {9038,1,0,0}, {9039,1,0,0},
+    {9040,1,0,0}, {9041,1,0,0}, {9042,1,0,0}, {0,0,3,4243},
+    {9043,1,0,0}, {9044,1,0,0}, {9045,1,0,0}, {9046,1,0,0},
+    {9047,1,0,0}, {9048,1,0,0}, {0,0,3,4231}, {9049,1,0,0},
+    {9050,1,0,0}, {0,0,3,59}, {9051,1,0,0}, {9052,1,0,0},
+    {0,0,3,73}, {9053,1,0,0}, {9054,1,0,0}, {9055,1,0,0},
+    {9056,1,0,0}, {0,0,3,1302}, {0,0,3,868}, {9057,1,0,0},
+    {0,0,3,1147}, {0,0,3,1832}, {9058,1,0,0}, {9059,1,0,0},
+    {9060,1,0,0}, {0,0,3,2417}, {9061,1,0,0}, {9062,1,0,0},
+    {9063,1,0,0}, {9064,1,0,0}, {9065,1,0,0}, {9066,1,0,0},
+    {0,0,3,4234}, {9067,1,0,0}, {0,0,3,2936}, {9068,1,0,0},
+    {9069,1,0,0}, {9070,1,0,0}, {9071,1,0,0}, {0,0,3,2891},
+    {9072,1,0,0}, {9073,1,0,0}, {9074,1,0,0}, {9075,1,0,0},
+    {9076,1,0,0}, {9077,1,0,0}, {9078,1,0,0}, {9079,1,0,0},
+    {9080,1,0,0}, {9081,1,0,0}, {9082,1,0,0}, {9083,1,0,0},
+    {9084,1,0,0}, {9085,1,0,0}, {9086,1,0,0}, {9087,1,0,0},
+    {9088,1,0,0}, {9089,1,0,0}, {9090,1,0,0}, {9091,1,0,0},
+    {9092,1,0,0}, {0,0,3,3468}, {9093,1,0,0}, {9094,1,0,0},
+    {9095,1,0,0}, {9096,1,0,0}, {9097,1,0,0}, {9098,1,0,0},
+    {9099,1,0,0}, {9100,1,0,0}, {9101,1,0,0}, {0,0,5,3456},
+    {9102,1,0,0}, {0,0,3,615}, {9103,1,0,0}, {9104,1,0,0},
+    {0,0,3,2573}, {9105,1,0,0}, {9106,1,0,0}, {9107,1,0,0},
+    {9108,1,0,0}, {9109,1,0,0}, {9110,1,0,0}, {9111,1,0,0},
+    {9112,1,0,0}, {9113,1,0,0}, {9114,1,0,0}, {9115,1,0,0},
+    {9116,1,0,0}, {9117,1,0,0}, {9118,1,0,0}, {9119,1,0,0},
+    {9120,1,0,0}, {9121,1,0,0}, {9122,1,0,0}, {9123,1,0,0},
+    {9124,1,0,0}, {9125,1,0,0}, {9126,1,0,0}, {9127,1,0,0},
+    {9128,1,0,0}, {0,0,3,1625}, {9129,1,0,0}, {9130,1,0,0},
+    {9131,1,0,0}, {9132,1,0,0}, {9133,1,0,0}, {9134,1,0,0},
+    {0,0,3,2737}, {9135,1,0,0}, {9136,1,0,0}, {9137,1,0,0},
+    {9138,1,0,0}, {9139,1,0,0}, {9140,3,0,0}, {9143,1,0,0},
+    {9144,1,0,0}, {9145,2,0,0}, {9147,1,0,0}, {0,0,3,4246},
+    {9148,1,0,0}, {9149,1,0,0}, {9150,1,0,0}, {0,0,3,1788},
+    {9151,1,0,0}, {0,0,3,2840}, {9152,1,0,0}, {9153,1,0,0},
+    {9154,1,0,0}, {9155,1,0,0}, {9156,1,0,0}, {9157,1,0,0},
+    {9158,1,0,0}, {0,0,3,1109}, {9159,1,0,0}, {9160,1,0,0},
+    {9161,1,0,0}, {9162,1,0,0}, {9163,1,0,0}, {0,0,1,1815},
+    {9164,1,0,0}, {9165,1,0,0}, {9166,1,0,0}, {9167,1,0,0},
+    {9168,1,0,0}, {9169,1,0,0}, {0,0,3,1410}, {9170,4,0,0},
+    {9174,1,0,0}, {9175,1,0,0}, {9176,1,0,0}, {9177,1,0,0},
+    {9178,1,0,0}, {9179,1,0,0}, {9180,1,0,0}, {9181,1,0,0},
+    {9182,1,0,0}, {0,0,3,59}, {9183,1,0,0}, {9184,1,0,0},
+    {9185,1,0,0}, {9186,1,0,0}, {9187,1,0,0}, {9188,1,0,0},
+    {9189,1,0,0}, {9190,1,0,0}, {9191,1,0,0}, {9192,1,0,0},
+    {9193,1,0,0}, {9194,1,0,0}, {9195,1,0,0}, {9196,1,0,0},
+    {9197,1,0,0}, {9198,1,0,0}, {9199,1,0,0}, {9200,1,0,0},
+    {9201,1,0,0}, {9202,1,0,0}, {9203,2,0,0}, {9205,1,0,0},
+    {9206,1,0,0}, {9207,1,0,0}, {9208,1,0,0}, {9209,1,0,0},
+    {9210,1,0,0}, {9211,1,0,0}, {9212,1,0,0}, {9213,1,0,0},
+    {0,0,3,2297}, {9214,1,0,0}, {9215,1,0,0}, {9216,1,0,0},
+    {0,0,3,1226}, {0,0,3,1425}, {9217,1,0,0}, {9218,2,0,0},
+    {9220,1,0,0}, {9221,1,0,0}, {9222,1,0,0}, {9223,1,0,0},
+    {0,0,6,3780}, {9224,1,0,0}, {0,0,6,3792}, {9225,1,0,0},
+    {9226,1,0,0}, {9227,1,0,0}, {0,0,3,48}, {9228,1,0,0},
+    {9229,1,0,0}, {9230,1,0,0}, {9231,1,0,0}, {9232,1,0,0},
+    {9233,1,0,0}, {9234,1,0,0}, {9235,1,0,0}, {9236,1,0,0},
+    {9237,1,0,0}, {9238,1,0,0}, {0,0,3,54}, {9239,1,0,0},
+    {9240,1,0,0}, {9241,1,0,0}, {9242,1,0,0}, {0,0,3,1907},
+    {9243,2,0,0}, {9245,1,0,0}, {9246,1,0,0}, {9247,1,0,0},
+    {0,0,3,1782}, {9248,1,0,0}, {9249,1,0,0}, {9250,1,0,0},
+    {9251,1,0,0}, {9252,1,0,0}, {9253,2,0,0}, {9255,1,0,0},
+    {9256,1,0,0}, {9257,1,0,0}, {9258,1,0,0}, {9259,1,0,0},
+    {9260,1,0,0}, {9261,1,0,0}, {9262,1,0,0}, {9263,1,0,0},
+    {9264,1,0,0}, {9265,1,0,0}, {9266,1,0,0}, {9267,1,0,0},
+    {9268,1,0,0}, {9269,1,0,0}, {9270,1,0,0}, {9271,1,0,0},
+    {9272,2,0,0}, {9274,1,0,0}, {9275,1,0,0}, {0,0,3,4249},
+    {9276,1,0,0}, {9277,1,0,0}, {9278,1,0,0}, {9279,1,0,0},
+    {9280,1,0,0}, {0,0,3,4252}, {9281,1,0,0}, {9282,1,0,0},
+    {0,0,3,91}, {9283,1,0,0}, {0,0,3,2971}, {9284,1,0,0},
+    {9285,1,0,0}, {0,0,3,2968}, {9286,1,0,0}, {9287,1,0,0},
+    {9288,1,0,0}, {9289,1,0,0}, {9290,1,0,0}, {9291,1,0,0},
+    {9292,1,0,0}, {9293,1,0,0}, {9294,1,0,0}, {9295,1,0,0},
+    {9296,1,0,0}, {9297,1,0,0}, {0,0,5,2550}, {9298,1,0,0},
+    {9299,1,0,0}, {9300,1,0,0}, {9301,1,0,0}, {9302,1,0,0},
+    {9303,1,0,0}, {9304,1,0,0}, {9305,1,0,0}, {9306,1,0,0},
+    {9307,1,0,0}, {9308,1,0,0}, {9309,1,0,0}, {9310,1,0,0},
+    {9311,1,0,0}, {9312,1,0,0}, {9313,1,0,0}, {9314,1,0,0},
+    {9315,1,0,0}, {9316,1,0,0}, {9317,1,0,0}, {9318,1,0,0},
+    {9319,1,0,0}, {9320,1,0,0}, {0,0,3,2599}, {9321,1,0,0},
+    {0,0,3,585}, {9322,1,0,0}, {9323,1,0,0}, {9324,1,0,0},
+    {9325,1,0,0}, {0,0,3,212}, {0,0,3,672}, {9326,1,0,0},
+    {0,0,3,2700}, {9327,1,0,0}, {9328,1,0,0}, {9329,1,0,0},
+    {9330,1,0,0}, {0,0,3,2716}, {9331,1,0,0}, {9332,1,0,0},
+    {9333,1,0,0}, {9334,1,0,0}, {0,0,3,548}, {9335,1,0,0},
+    {0,0,3,2951}, {9336,1,0,0}, {9337,1,0,0}, {9338,1,0,0},
+    {9339,1,0,0}, {0,0,3,2894}, {9340,1,0,0}, {9341,1,0,0},
+    {9342,1,0,0}, {9343,1,0,0}, {9344,1,0,0}, {9345,1,0,0},
+    {9346,1,0,0}, {9347,2,0,0}, {0,0,3,695}, {9349,1,0,0},
+    {0,0,3,2793}, {0,0,3,1745}, {9350,1,0,0}, {9351,1,0,0},
+    {9352,1,0,0}, {0,0,3,2886}, {9353,1,0,0}, {9354,1,0,0},
+    {9355,1,0,0}, {0,0,3,141}, {0,0,3,3304}, {9356,1,0,0},
+    {9357,1,0,0}, {0,0,3,2983}, {0,0,3,2918}, {9358,1,0,0},
+    {9359,1,0,0}, {9360,1,0,0}, {9361,1,0,0}, {9362,1,0,0},
+    {9363,1,0,0}, {9364,1,0,0}, {0,0,3,3196}, {9365,1,0,0},
+    {9366,1,0,0}, {9367,1,0,0}, {9368,1,0,0}, {0,0,3,2277},
+    {0,0,3,3358}, {9369,1,0,0}, {0,0,3,3367}, {9370,1,0,0},
+    {0,0,3,2447}, {9371,1,0,0}, {9372,2,0,0}, {9374,1,0,0},
+    {9375,1,0,0}, {9376,1,0,0}, {0,0,3,2971}, {9377,1,0,0},
+    {9378,1,0,0}, {0,0,3,3361}, {9379,1,0,0}, {0,0,3,3111},
+    {9380,1,0,0}, {9381,1,0,0}, {9382,1,0,0}, {0,0,3,2576},
+    {9383,1,0,0}, {9384,2,0,0}, {9386,1,0,0}, {9387,1,0,0},
+    {9388,1,0,0}, {9389,1,0,0}, {9390,1,0,0}, {9391,1,0,0},
+    {9392,1,0,0}, {9393,1,0,0}, {0,0,3,654}, {0,0,3,2808},
+    {9394,1,0,0}, {9395,1,0,0}, {0,0,3,1686}, {9396,1,0,0},
+    {9397,1,0,0}, {9398,1,0,0}, {0,0,3,2891}, {9399,1,0,0},
+    {0,0,6,3774}, {0,0,6,3786}, {9400,1,0,0}, {9401,1,0,0},
+    {9402,1,0,0}, {9403,1,0,0}, {9404,1,0,0}, {9405,1,0,0},
+    {9406,1,0,0}, {9407,1,0,0}, {9408,1,0,0}, {0,0,2,418},
+    {9409,1,0,0}, {9410,1,0,0}, {9411,1,0,0}, {9412,1,0,0},
+    {9413,1,0,0}, {9414,1,0,0}, {9415,1,0,0}, {9416,1,0,0},
+    {9417,1,0,0}, {9418,1,0,0}, {9419,1,0,0}, {0,0,3,2927},
+    {9420,1,0,0}, {9421,1,0,0}, {9422,1,0,0}, {9423,1,0,0},
+    {9424,1,0,0}, {0,0,3,2444}, {9425,1,0,0}, {9426,1,0,0},
+    {9427,2,0,0}, {9429,1,0,0}, {9430,1,0,0}, {9431,1,0,0},
+    {9432,1,0,0}, {9433,1,0,0}, {9434,1,0,0}, {0,0,3,4255},
+    {9435,1,0,0}, {0,0,3,1130}, {0,0,3,79}, {0,0,3,88},
+    {9436,1,0,0}, {9437,1,0,0}, {9438,1,0,0}, {9439,1,0,0},
+    {0,0,3,2245}, {9440,1,0,0}, {0,0,3,1316}, {9441,1,0,0},
+    {9442,1,0,0}, {9443,1,0,0}, {9444,1,0,0}, {9445,1,0,0},
+    {9446,1,0,0}, {0,0,3,486}, {9447,1,0,0}, {0,0,3,524},
+    {9448,1,0,0}, {0,0,3,2980}, {9449,1,0,0}, {0,0,3,2977},
+    {0,0,3,2864}, {9450,1,0,0}, {9451,1,0,0}, {9452,1,0,0},
+    {9453,1,0,0}, {9454,1,0,0}, {9455,1,0,0}, {0,0,3,20},
+    {9456,1,0,0}, {9457,1,0,0}, {9458,1,0,0}, {9459,1,0,0},
+    {9460,1,0,0}, {0,0,3,1534}, {9461,1,0,0}, {9462,1,0,0},
+    {9463,1,0,0}, {9464,3,0,0}, {0,0,3,1537}, {9467,1,0,0},
+    {9468,1,0,0}, {9469,1,0,0}, {9470,1,0,0}, {9471,1,0,0},
+    {9472,1,0,0}, {9473,1,0,0}, {9474,2,0,0}, {9476,1,0,0},
+    {0,0,3,2607}, {9477,1,0,0}, {9478,1,0,0}, {9479,1,0,0},
+    {9480,1,0,0}, {9481,1,0,0}, {0,0,3,1501}, {9482,1,0,0},
+    {0,0,3,2489}, {9483,1,0,0}, {9484,1,0,0}, {0,0,3,108},
+    {9485,1,0,0}, {9486,1,0,0}, {9487,1,0,0}, {9488,1,0,0},
+    {9489,1,0,0}, {9490,1,0,0}, {9491,2,0,0}, {0,0,3,4258},
+    {9493,1,0,0}, {9494,1,0,0}, {9495,1,0,0}, {9496,1,0,0},
+    {9497,1,0,0}, {0,0,3,4261}, {0,0,3,1202}, {0,0,3,1382},
+    {9498,1,0,0}, {9499,1,0,0}, {9500,1,0,0}, {0,0,3,2843},
+    {9501,1,0,0}, {9502,1,0,0}, {0,0,3,1173}, {9503,1,0,0},
+    {9504,1,0,0}, {0,0,3,2632}, {9505,1,0,0}, {9506,1,0,0},
+    {0,0,3,4264}, {9507,1,0,0}, {9508,1,0,0}, {9509,1,0,0},
+    {9510,1,0,0}, {9511,1,0,0}, {9512,1,0,0}, {0,0,3,3167},
+    {9513,1,0,0}, {0,0,3,2995}, {0,0,3,2240}, {9514,1,0,0},
+    {9515,1,0,0}, {0,0,3,3582}, {9516,1,0,0}, {0,0,3,2453},
+    {0,0,3,1316}, {9517,1,0,0}, {9518,1,0,0}, {9519,1,0,0},
+    {0,0,3,3418}, {9520,1,0,0}, {0,0,3,2980}, {0,0,3,3585},
+    {9521,1,0,0}, {9522,1,0,0}, {0,0,3,1508}, {9523,1,0,0},
+    {0,0,3,2596}, {9524,1,0,0}, {0,0,3,3591}, {9525,1,0,0},
+    {0,0,3,2746}, {9526,1,0,0}, {9527,1,0,0}, {9528,1,0,0},
+    {9529,1,0,0}, {9530,1,0,0}, {9531,1,0,0}, {0,0,3,2498},
+    {9532,1,0,0}, {9533,1,0,0}, {9534,1,0,0}, {0,0,3,2894},
+    {9535,1,0,0}, {9536,1,0,0}, {9537,1,0,0}, {9538,1,0,0},
+    {9539,1,0,0}, {0,0,3,2773}, {0,0,3,1582}, {9540,1,0,0},
+    {9541,1,0,0}, {9542,1,0,0}, {9543,1,0,0}, {9544,1,0,0},
+    {9545,1,0,0}, {0,0,3,1196}, {0,0,3,1371}, {9546,1,0,0},
+    {9547,1,0,0}, {9548,1,0,0}, {9549,1,0,0}, {9550,1,0,0},
+    {9551,1,0,0}, {9552,1,0,0}, {9553,1,0,0}, {9554,1,0,0},
+    {9555,1,0,0}, {9556,1,0,0}, {9557,1,0,0}, {0,0,3,2743},
+    {9558,1,0,0}, {9559,1,0,0}, {9560,1,0,0}, {9561,1,0,0},
+    {9562,1,0,0}, {9563,1,0,0}, {9564,1,0,0}, {9565,1,0,0},
+    {9566,1,0,0}, {9567,1,0,0}, {9568,1,0,0}, {9569,1,0,0},
+    {9570,1,0,0}, {0,0,3,4267}, {0,0,3,4270}, {9571,1,0,0},
+    {9572,1,0,0}, {0,0,3,4273}, {0,0,3,4276}, {9573,1,0,0},
+    {9574,1,0,0}, {9575,1,0,0}, {0,0,3,2805}, {9576,1,0,0},
+    {9577,1,0,0}, {9578,1,0,0}, {9579,1,0,0}, {9580,1,0,0},
+    {9581,1,0,0}, {9582,1,0,0}, {0,0,3,601}, {9583,1,0,0},
+    {9584,1,0,0}, {9585,1,0,0}, {0,0,3,2555}, {0,0,5,2528},
+    {0,0,3,2576}, {9586,1,0,0}, {9587,1,0,0}, {9588,1,0,0},
+    {9589,1,0,0}, {9590,1,0,0}, {9591,1,0,0}, {9592,1,0,0},
+    {9593,1,0,0}, {9594,3,0,0}, {0,0,5,4279}, {9597,1,0,0},
+    {9598,1,0,0}, {9599,1,0,0}, {9600,1,0,0}, {9601,1,0,0},
+    {9602,1,0,0}, {9603,1,0,0}, {9604,1,0,0}, {0,0,3,4284},
+    {9605,1,0,0}, {9606,1,0,0}, {9607,1,0,0}, {9608,1,0,0},
+    {9609,1,0,0}, {9610,1,0,0}, {9611,1,0,0}, {0,0,3,2248},
+    {9612,1,0,0}, {9613,1,0,0}, {9614,1,0,0}, {9615,1,0,0},
+    {9616,1,0,0}, {9617,1,0,0}, {0,0,3,1659}, {9618,1,0,0},
+    {9619,1,0,0}, {9620,1,0,0}, {9621,1,0,0}, {9622,1,0,0},
+    {9623,1,0,0}, {0,0,3,2542}, {9624,1,0,0}, {0,0,3,2959},
+    {9625,1,0,0}, {9626,1,0,0}, {9627,1,0,0}, {0,0,3,2650},
+    {9628,1,0,0}, {0,0,3,3179}, {0,0,3,2245}, {9629,1,0,0},
+    {0,0,3,2444}, {0,0,3,2474}, {9630,1,0,0}, {9631,1,0,0},
+    {9632,1,0,0}, {0,0,3,2558}, {0,0,3,2561}, {0,0,3,3474},
+    {9633,1,0,0}, {9634,1,0,0}, {0,0,3,2749}, {9635,1,0,0},
+    {9636,1,0,0}, {0,0,3,2722}, {0,0,3,3622}, {0,0,2,2292},
+    {0,0,3,2776}, {9637,1,0,0}, {9638,1,0,0}, {0,0,3,2936},
+    {9639,1,0,0}, {9640,1,0,0}, {9641,1,0,0}, {9642,1,0,0},
+    {9643,1,0,0}, {0,0,2,1079}, {9644,1,0,0}, {0,0,1,2346},
+    {0,0,2,2869}, {9645,1,0,0}, {9646,1,0,0}, {9647,1,0,0},
+    {9648,1,0,0}, {9649,1,0,0}, {0,0,3,1643}, {9650,1,0,0},
+    {9651,1,0,0}, {0,0,3,2266}, {9652,1,0,0}, {9653,1,0,0},
+    {9654,1,0,0}, {9655,1,0,0}, {9656,1,0,0}, {0,0,3,4287},
+    {9657,1,0,0}, {9658,1,0,0}, {9659,1,0,0}, {0,0,3,455},
+    {0,0,3,70}, {9660,1,0,0}, {0,0,3,1377}, {9661,1,0,0},
+    {9662,1,0,0}, {9663,1,0,0}, {9664,1,0,0}, {9665,1,0,0},
+    {0,0,3,4290}, {0,0,3,521}, {9666,1,0,0}, {9667,1,0,0},
+    {9668,1,0,0}, {9669,1,0,0}, {9670,1,0,0}, {9671,1,0,0},
+    {9672,1,0,0}, {0,0,2,588}, {9673,1,0,0}, {9674,1,0,0},
+    {9675,1,0,0}, {9676,1,0,0}, {9677,1,0,0}, {9678,1,0,0},
+    {9679,1,0,0}, {9680,1,0,0}, {9681,1,0,0}, {0,0,5,1511},
+    {9682,1,0,0}, {9683,1,0,0}, {0,0,3,2596}, {9684,1,0,0},
+    {9685,1,0,0}, {9686,1,0,0}, {9687,2,0,0}, {0,0,5,1516},
+    {9689,1,0,0}, {0,0,5,4293}, {0,0,3,2615}, {9690,1,0,0},
+    {9691,1,0,0}, {9692,1,0,0}, {9693,1,0,0}, {9694,1,0,0},
+    {9695,1,0,0}, {9696,1,0,0}, {9697,1,0,0}, {9698,1,0,0},
+    {9699,1,0,0}, {0,0,3,4298}, {9700,1,0,0}, {9701,1,0,0},
+    {0,0,3,4301}, {0,0,3,4304}, {9702,1,0,0}, {9703,1,0,0},
+    {9704,1,0,0}, {9705,1,0,0}, {0,0,3,4307}, {0,0,3,2883},
+    {9706,1,0,0}, {9707,1,0,0}, {9708,1,0,0}, {9709,1,0,0},
+    {0,0,3,2669}, {0,0,3,2248}, {9710,1,0,0}, {9711,1,0,0},
+    {9712,1,0,0}, {0,0,3,3501}, {0,0,3,2743}, {9713,1,0,0},
+    {0,0,3,2770}, {0,0,3,913}, {9714,1,0,0}, {0,0,3,2951},
+    {9715,1,0,0}, {9716,1,0,0}, {9717,1,0,0}, {9718,1,0,0},
+    {9719,1,0,0}, {9720,1,0,0}, {9721,1,0,0}, {9722,1,0,0},
+    {9723,1,0,0}, {9724,1,0,0}, {0,0,3,1806}, {0,0,3,654},
+    {9725,1,0,0}, {0,0,3,4310}, {0,0,3,4313}, {9726,1,0,0},
+    {9727,1,0,0}, {9728,1,0,0}, {0,0,3,4316}, {9729,1,0,0},
+    {0,0,3,458}, {9730,1,0,0}, {0,0,3,2468}, {0,0,3,4319},
+    {0,0,3,4322}, {0,0,3,2498}, {9731,1,0,0}, {9732,1,0,0},
+    {9733,1,0,0}, {9734,1,0,0}, {0,0,3,4264}, {9735,1,0,0},
+    {9736,1,0,0}, {9737,1,0,0}, {9738,1,0,0}, {0,0,5,1456},
+    {9739,1,0,0}, {9740,1,0,0}, {9741,1,0,0}, {0,0,5,1496},
+    {9742,1,0,0}, {0,0,5,4325}, {9743,1,0,0}, {0,0,3,2582},
+    {9744,1,0,0}, {9745,1,0,0}, {9746,1,0,0}, {0,0,5,4330},
+    {9747,1,0,0}, {9748,1,0,0}, {0,0,3,2533}, {9749,1,0,0},
+    {9750,1,0,0}, {9751,1,0,0}, {9752,1,0,0}, {0,0,3,1654},
+    {9753,1,0,0}, {9754,1,0,0}, {9755,1,0,0}, {9756,1,0,0},
+    {9757,1,0,0}, {0,0,3,4335}, {9758,1,0,0}, {0,0,3,3670},
+    {9759,1,0,0}, {9760,1,0,0}, {0,0,3,4338}, {0,0,3,2263},
+    {0,0,3,2501}, {9761,1,0,0}, {0,0,3,2477}, {9762,1,0,0},
+    {9763,1,0,0}, {0,0,3,2752}, {0,0,3,966}, {9764,1,0,0},
+    {9765,1,0,0}, {9766,1,0,0}, {9767,1,0,0}, {9768,1,0,0},
+    {9769,1,0,0}, {9770,1,0,0}, {9771,1,0,0}, {9772,1,0,0},
+    {9773,1,0,0}, {9774,1,0,0}, {0,0,3,4341}, {0,0,3,4344},
+    {9775,1,0,0}, {9776,1,0,0}, {9777,1,0,0}, {0,0,3,2965},
+    {0,0,3,2962}, {9778,1,0,0}, {0,0,3,4264}, {9779,1,0,0},
+    {9780,1,0,0}, {9781,1,0,0}, {9782,1,0,0}, {9783,1,0,0},
+    {0,0,5,4347}, {9784,1,0,0}, {9785,1,0,0}, {9786,1,0,0},
+    {9787,1,0,0}, {9788,1,0,0}, {9789,1,0,0}, {9790,1,0,0},
+    {9791,1,0,0}, {9792,1,0,0}, {0,0,3,2691}, {0,0,3,2477},
+    {9793,1,0,0}, {9794,1,0,0}, {0,0,3,2764}, {0,0,3,4352},
+    {0,0,3,4355}, {0,0,3,2776}, {0,0,3,2834}, {9795,1,0,0},
+    {0,0,3,2785}, {0,0,3,2779}, {9796,1,0,0}, {0,0,3,2965},
+    {9797,1,0,0}, {9798,1,0,0}, {9799,1,0,0}, {9800,1,0,0},
+    {9801,1,0,0}, {9802,1,0,0}, {9803,1,0,0}, {0,0,3,2968},
+    {9804,1,0,0}, {9805,1,0,0}, {0,0,3,4358}, {9806,1,0,0},
+    {9807,1,0,0}, {0,0,3,2474}, {0,0,3,4264}, {9808,1,0,0},
+    {9809,1,0,0}, {9810,1,0,0}, {0,0,5,596}, {9811,1,0,0},
+    {9812,1,0,0}, {9813,1,0,0}, {9814,1,0,0}, {0,0,5,4361},
+    {9815,1,0,0}, {9816,1,0,0}, {9817,1,0,0}, {9818,1,0,0},
+    {9819,1,0,0}, {9820,1,0,0}, {0,0,3,2749}, {0,0,3,3673},
+    {0,0,3,2359}, {0,0,3,3}, {9821,1,0,0}, {9822,1,0,0},
+    {9823,1,0,0}, {9824,1,0,0}, {9825,1,0,0}, {0,0,3,486},
+    {9826,1,0,0}, {0,0,3,2977}, {0,0,3,4366}, {9827,1,0,0},
+    {9828,1,0,0}, {0,0,3,11}, {0,0,3,1508}, {0,0,5,1483},
+    {0,0,3,3474}, {9829,1,0,0}, {9830,1,0,0}, {9831,1,0,0},
+    {0,0,3,3938}, {9832,1,0,0}, {9833,1,0,0}, {0,0,3,2438},
+    {0,0,3,2269}, {9834,1,0,0}, {0,0,3,2740}, {9835,1,0,0},
+    {9836,1,0,0}, {0,0,3,3005}, {9837,1,0,0}, {0,0,3,1723},
+    {0,0,3,4264}, {9838,1,0,0}, {0,0,3,3488}, {0,0,3,3501},
+    {9839,1,0,0}, {0,0,3,3504}, {9840,1,0,0}, {9841,1,0,0},
+    {0,0,2,2238}, {9842,1,0,0}, {9843,1,0,0}, {0,0,3,3941},
+    {9844,1,0,0}, {9845,1,0,0}, {9846,1,0,0}, {0,0,5,4369},
+    {0,0,3,4120}, {9847,1,0,0}, {0,0,3,2962}, {9848,1,0,0},
+    {9849,1,0,0}, {9850,1,0,0}, {9851,1,0,0}, {9852,1,0,0},
+    {9853,1,0,0}, {0,0,3,4102},
+};
+
+static const char entity_labels[9855] =
+    "#ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyzEMabcfglmnoprstuaceforsuHOacdefhilorsuDJSZa"
+    "cefiosNTacdfglmopqstuxcfiosJTabcdfgorstAacfiosuEJOacdfgmnostucfosuHJacfosJTaceflmostacefiosuJace"
+    "fostuEacdfgmoprstuvacfhilorsUfosBEacefhiorsuHOacfhimoqstuHRSacfhiorsabcdfgmnoprstuDbcdefosvcefos"
+    "fiosAIUacfosuHacdefosabcefglmnoprstuwNabcdefiklnoprsuacdefhilorstuwyAHabcdefhijlorstuwzDacdefglm"
+    "nopqrstuxacefijlnoprsEabcdefgijlnorstvAabcefkosyacefgijmnopqstucfmosuacfghjosABEHabcdefghjlmnopr"
+    "stuvDacdefhilnopsuGLRVabcdefghijlmoprstuvwSacdefghilmoprstuvacefhilmorsufiopsuABHabcdefhilmnoprs"
+    "tuxabcdefhilmopqrstuwzabcdefhioprswAHabcdfghlmoprstuwABDacdeflnoprszcefoprscdfhilmnorsuvwacefios"
+    "uacdefhioswlPcriyrrpadgppicsimcrycrtrpecmcPcpyaeioodnrirolnpuocp;occcgrsaylrafptuwctGHcaiyorreap"
+    "gpsuciamipyrlprucc;mreiyor;pec;Rctirlprctmclcciyorr;aptvgptcikmiyrpcekccpeyrpcc;cmnpraeyfsr;einp"
+    "wcht;pydlrnpc;ccaeygswrBnptci;lciybrraeipe;climeryri;uip;eiociOrpcaGcnraey;vrogpuichlCcFc;aeiyro"
+    "gaprucabcmpOAHcbuaeyreilpictcrriybrradigpADETadpsicimaayaerrpcdidrpcr;pccccciyrpcmccayortrpccr;E"
+    "diuyl;rrepapdggp;Eaeiopictyimciocrroyqcmprtrgaakoeoptwxrevceiolmcpraeiuodmnrceirulmnpaocuddelprv"
+    "wcilraglrsklay;aoglmiraaegsvcclptuwbccotdrahaciDocsaioyo;Dr;rs;ilsapsgsgpalscsuvDacdiahmrciplymi"
+    "lrllaltopraaoc;lcmpriyo;lqsr;gmc;EajEaespaci;cdlqrenrilmraialrrsamoprcltbpc;iycxfrr;inolaop;cfot"
+    "cgptruci;ikmiyrapcekpeyrrccpcarta;gacegmnpqrtabraeuycqrs;fgqsilr;Eabc;achtioEaesabnoptwzaachmtac"
+    "hiqt;cdhilqrrenDclproyaarocdncdpdp;ct;lmgteltiDdbcnptsuaeouya;AadqsxrEestAap;svcAEadestiptaorAai"
+    "tchimpqugilr;mDHadgilrsAan;csiyabioslcrortbmnacitaeipael;adiosvcloimbryrrimo;tvau;ipu;Eaceinosuc"
+    "inrnprcaeoartaacdenqrtabraeuyclqsacgilraognsahmomabptapaachqhirl;cq;EaceinpsyoAacmstxracoygmaaei"
+    "tflpacsuacemtarbcmnpAanlruraeyolreikolmnepsraipchtioracrriyabhirrabctalgpadhlsucitcdiramaraanrya"
+    "elrrtsprtcuiidirp;;ecaiutrAa;AaaidptAacqpteeciynrcpccmcayoetrcgpcjni;uer;;ahc;oflnrillkvw;ana;fv"
+    "rpyYu;ilrdrntit;;ccsogitfrnsr;Ctyyygrhr;;t;cmff;DEbnrr;;urr;t;amctofiairm;lso;;lfArrymedr;t;farD"
+    "e;r;bfirrpyiyur;t;acgl;eiofarlclr;;frrcyypd;;fryubglrrd;ts;fdgfer;r;;il;ufryurd;atL;rBf;CDEGHLNP"
+    "RSTVrliur;l;acgcfnralmlrt;;;snfcmdpr;T;frr;ugrrd;e;;hfngr;eHyTurdr;;rmlftarr;sch;;esRDcy;;rd;;rt"
+    "cndfprrurcer;l;aceoofroqeroeinrllsr;s;bty;frarg;fr;fryyyur;;frlyur;toa;frue;;rt;i;afphcl;;adsv;e"
+    "lmrszof;c;dsrnr;mllontkvwkn;uapsnahw;costuvwrcn13c;qtf;ttDHUVbdhmptuvivbrmmllpu;abcdseoprdrptipt"
+    ";yc;;Ecefmsbompgifryrsrbpoapsa;bcdosalrveeoncrrgerhaar;grt;tps;rm;ai;ioyorlf;empsbnkorrylroirany"
+    "gotutrrl;to;a;dn;;dctp;pofruiioilaeiporrom;;lolseol;alil;iitinffakrcswr;um;er;t;;qs;cdl;;ey;;;;p"
+    ";qifvrmcioPuadelsrErrfidrrrrlc;ewrtkfbraruhur;yc;;ainfticgtfeaid;celpyofaoernlclr;;tfrrcpd;;eyyf"
+    "rrrar;rumrbg;ur;aerrakrdib;auduht;;qs;cdgsso;;rlyroardu;p;qinrrgpafliab;efrroa;rqr;mburciormauPi"
+    "durEoret;skm;ss;;r;acduprlefrpta;;vf;;vgaalug;Eiopupmprdnp;srroueii;;;qsi;rrra;d;yr;rr;fqsi;rdf;"
+    "inrl;cerrgr;ceromiasbcpllgi;esaapaetnAetAtirreutr;slvtoii;na;a;trirn;cgcdnfrrur;efmgrl;rallmla;a"
+    "st;cimpt;;vmnc;nsnfn;pu;cmEasdfpirr;c;tfirtstrrarreuimgurairrakrdib;aduhlt;so;r;vhgira;uinrrafli"
+    "rorqr;burmiuuu;pru;drEasoi;trrtiwmt;orhyr;m;deglnprrlspdl;et;bfdrauu;afrrtiaran;Edemnprsc;g123;E"
+    "dehlmnpsrrwig;krd;tr;rtcnasrdeta;bcfaidadempsterycrxhrrurcer;rlas;arlorrc;ofroauipornrrolirlnrrs"
+    "geknprst;s;belbt;ruforrbpgrbge;farprpr;rrrrpsoflirrrclreduyr;;;yfrylur;tta;yrfr;jgtvcvarn;yg;gd;"
+    "s;euo;;e;e;;tteoici;lelkenrno;ots;ar;;;e;voaroe;oqlABLRTa;otoc;veryn;lll;;;tne;li;;avic;;t;ckce;"
+    "z;oDE;g;tc;vriigrsn;;;dy;c;;cy;;ai;;;td;a;oiACDFRTUVarEFGLSTtoLRlr;r;ouis;;;toiteier;ouolqxrueer"
+    "eiquie;dgtcavrar;C;sde;BPiMc;eeuo;;;;rt;;toirt;dh;Dc;ctoictal;;r;;eeTreNEy;oieakSe;l;ot;oyvcavrr"
+    "nn;rwuerwr;lg;d;h;ha;iT;;sce;;;;;;;tc;;;;to;W;;;tvcegvshargn;l;;estptan;i;;og;pd;nt;cepsee;tgout"
+    "io;;eaiudptqtrpeeokk244ku;;oiLRlr;DUduLRlr;HLRhlroLRlr;DUduiliLRlr;HLRhlrmea;i;e;bh;e;Eetnrauo;t"
+    "nsoics;lt;e;k;;el;nicsna;fl;dn;o;srs;;e;etrrcrrauor;ryeeedntt;;et;;vrcogrsathlr;osmndn;roa;qilql"
+    "adharo;;;ot;frrg;rt;teo;co;tvotory1;;n;;ss;lvrlmalsvatr;t;;;;tcniligigg;gs;;l;vt123457ln;tavc;;l"
+    "co;el;;p;qm;e;;el;rtaeproqeit;;s;lc;cw;ctioaarhlr;a;soletc;lvntiagrelph;drnoagrar;n;;ds;;Edsvdy;"
+    "ch;;cyaie;;;;r;ir;tpad;dlo;bfhlpsti;srkcesoil;;ohs;ahlrt;lco;eadegshoduk;rrrios;p;qmgrklmrar;ums"
+    "an;;lrrriu;;eg;oo;rteerea;efsht;t;;;etemhuosios;;ul;;oip;t;hssat;;dsrr;p;oig;hrhrtiams;qs;m;rrr;"
+    ";rr;t;qs;smi;;ni;astiu;crrhiu;;r;edru;Eesc;Ees;d;arpsr;s;;fr;;rrrmrhrat;;cha;;lgr;vr;rroerar;u;;"
+    "psrr;;o;o;s;de;r;lil;noi;e;aehck;abcdemstt;d;e;acense;pi;als;tme;s;;m;eit;r;ir;;tcp;delo;abcfhlp"
+    "stwiorkcesoil;;ho;;ips;hodu;t;nrrsdgrkr;um;glru;;oee;eflhto;oeic;pilm;berhr;;ain;wpc;tao;q;E;Eel"
+    "arlha;e;sc;a;e;ppbpr;r;mlr;fis;o;duEelaeiu;acens;;;;;os;dsauEeleiurhrage;oi;eeakspines;;oi;o;men"
+    "o;ilbiz;;yote;;t;yvcrarhvlrkroirn;rwrs;hlarogi;td;fr;g;;vhrpaohir;hiuhrhaqia;ibp;pi;nnzcaer;t;;c"
+    ";irrrr;;t;umrr;uui;gt;c;;;;;to;r;;a;;;;ee;e;;;F;neldsu;qeaynl;nlrewC;eutude;par;n;inrtuerreierke"
+    "n;en;SV;o;Tisedle;del;ey;;rokoq;e;e;nersi;e;;y;;leacnlnreolierperiqureliateieiLRkmnPenlidnaenpue"
+    "uiemfssevgubcplre;e;ce;;ouhesaraaiad;cr;elnlsACDFTUVaIteyyenl;DLRU;Cetehst;;;nlf;Sp;EFTekec;e;ce"
+    ";BP;P;oni;AonLRo;e;;lrchh;;e;eniee;;;ey;;;;do;d;vh;r;rx;;eei;opriedb;;sy;ueprpolicailedwlst;;;;;"
+    "ime;;;;;;;;;;;;;;;;;;x;;;;;;;;num;;;;;;;;;;e;r;;;st;;qedcppt;;;nl;;s;yr;mqeidi;u;e;tneotdr;;;;;r"
+    ";;rcppt;revwna;;i;yrh;o;ne;e;yt;;n;m;exnpr;dnuueroarnpk;;;;la;ern;n;etet;;sv34;l;o;co;nst;Dr;;;;"
+    "teneg;g;;;;l;i234568354585688;;e;de;a;ts;r;;;;;;;rsprtlqsmnptyi;;spnrr;teirhklne;;et;n;;;;ia;;e;"
+    "ttlecro;;t;o;v;e;;;y;;vln;l;etna;e;;fskplill;;;ek;lnl;;rahraeiha;tspoqtitr;;l;;nd;ttr;;;;;eair;s"
+    "etrgt;n;d;o;;;rk;;esrsr;;han;sora;r;trt;bdsssm;arthh;e;;o;a;enl;d;;k;o;vr;t;l;;;;;;ar;l;;;e;Edv;"
+    "vll;ne;e;;cwt;eet;q;;bp;;e;e;;eeno;hrhiriri;;k;ore;;cd;;e;;;s;;;os;;;;ofphes;lm;tdlnt;fkvc;iou;n"
+    "iwi;;puqaesi;s;mliuo;lpern;e;l;e;t;;e;p;f;skplil;l;n;;ek;lnl;a;rna;tr;;lahlrstg;;t;;;;;seti;o;re"
+    "s;;tae;n;l;;mi;;;;k;orn;n;ymp;fvt;;;;ur;spr;;yrs;s;s;es;esef;nef;g;tol;;urtmbppuqaesituoourl;;ut"
+    "mbp;k;or;tnlc4f;svasp;m;;;bdtrre;gtnu;mi;k;ae;e;;c;te;;;np;;;onp;;ornp;;;e;;l;;tspti;oogbpei;r;p"
+    "r;;;;;EeEea;r;qph;;;;;;;se;;ps;ee;enfr;;;u;;a;el;;ls;;taDDMPTiu;e;rur;h;;tde;aCDLRUVrefger;;;;tm"
+    "enib;nSV;r;;;r;tn;wu;;asaeb;;;;;e;;griuwogeiDTVcrgulesalr;fgfgei;Stl;;;vGLekagCbmasaptstcehasced"
+    "t;;;;nr;;;rarlnrett;;;;enreolerpermal;;;;;oeipi;ISU;Edae;;;opaquiD;;i;;;aralwAlrwaein;;;ai;;;;d;"
+    ";;m;p;ab;r;;eq;nnsim;;gr;ev;n;c;tumurau;g;oqrv;;;use;;u;;;;u;;;;;mvda;adn;ri;q;;mxt;;;lr;pa;;;;m"
+    "qee;rn;;;w;rqv;da;o;;;;ousabrwro;;;er;;;;;;r;e;;;;n;nt;;Dsang;;;;n;;;;;;;;;;;;;;;;;;n;o;o;tr;;el"
+    "s;e;;;r;u;;oo;fg;;;;;;;;;nr;i;;rahd;t;;;;;;;;y;;;s;;;;m;;;;du;;;rarrfgrn;o;ptgqrm;;;e;;;aofpgr;s"
+    ";;e;e;;;;;;;t;aree;dlu;;e;;;;;u;;;aria;;;xl;;;o;w;;;saria;;oabcabcl;t;q;;a;;mp;eetqt;g;;;;n;e;e;"
+    "w;;;;;sn;f;e;;;ae;;;;k;o;h;ir;;;monpr;pqim;;anr;;;;ntq;;y;;s;;;;m;;a;;du;;r;er;;;raeiqhd;a;s;n;;"
+    ";;rr;;;;n;w;u;;ia;;;sre;s;;;u;;;e;e;;;;;h;ttsr;en;;;pr;pqim;btlbrts;en;;;;w;;;;;;oy;pi;;;a;;;k;l"
+    ";useu;d;;;;;;e;waonr;e;;e;iph;p;mssta;;;;;;;g;;;;;;;;;;;;;rns;lD;;;ooilisrnIcCdi;nlooeoipeovth;A"
+    "o;ar;lrtmetEFGLSTStnar;lcltlolbnoh;AVaoeetohalasndrththfgpruere;;kralelttDET;EGLSTeertreerei;l;c"
+    "eDues;iEUgriuwoeiDTVcrprawfgArnunqsttracullorraru;BDrir;rfg;lnt;eabcdefgh;d;q;tgim;eek;;;;;sep;n"
+    "sezui;s;sbp;;orrRSacdt;t;ee;;;;p;psedrt;;;;;s;nts;raonpw;rst;;gl;lttdtt;lx;ose;q;iwwtheteslk;;v;"
+    ";;;;ropthet;rr;tg;;rcxtsho;;r;r;q;oepd;prgr;;st;;nrgnt;;;;;;e;;ria;;;e;;el;;;;;;;;sl;r;r;;;trlpq"
+    "m;refi;;v;;l;;;;trrfguroc;ti;t;sdr;;tlittt;;;;qerlpqm;;;;;;;;qe;rmpmr;es;;mlrr;ro;or;laitaeean;;"
+    "chiittnumeltntl;ct;ntwfngADrweRTVtrwlydiiarrqurelipaHly;terewilTVrtrenwecowtlEt;teoARtartthafsMT"
+    "Vesiupen;TseoqrqreliddsTetes;EFTcyekn;sp;ESTolqplolbno;AVaoeetolrynthrctbpiu;EST;;Eecealdt;;cesa"
+    "orborthBLSTSh;;;;;;;;;;;;;leq;;;s;g;;eaa;;;;tkr;;sia;;ns;ru;go;ut;;erwao;;;;te;iio;;;;xssqt;;at;"
+    ";;;;;;;woate;;ort;h;arttw;;qwf;a;ohr;;toht;lrdrqqe;;k;;oyr;;;;;o;s;opthieth;;;;;am;t;e;eep;qqoyr"
+    ";;;qqe;r;;;dlqr;;ei;rnw;o;no;tt;gt;sf;;useCy;t;oait;ntghrot;BU;ieeTVr;lSeualyfulesalalu;IiCTfB;B"
+    "Rneee;AVrcgnVtr;aGqeE;wriAriaAtc;;eheasne;Vti;rwuiuesalGLeerS;EdequiaDQ;et;lqlineuEewilTVrrenwec"
+    "owioeAAtrleseoaqliq;e;lEe;ekn;rworwoAtaieipSo;;;lnrn;;otrst;ecewii;w;rorsoat;;s;;ra;torahstx;rer"
+    "ioalr;ntnwto;wt;;o;a;q;qlr;xeon;woahtgeseli;qqph;;qxeo;;q;ooe;ifgolrsng;nnli;fs;soDQeclaoAARTLRt"
+    "rwiapgeceeoSm;mllS;alasndcLm;ooi;raigBecreotlVeo;Brrurq;rgrrgrrAedirtLgne;l;EFGLSTnaaaasndresEiu"
+    "qstulllouthaual;amiqB;BLneee;rcgnVtr;ewdrrAoerernlualu;;q;;et;nwi;wrArnplapnegegw;ch;cc;lrtmern;"
+    "snls;rranrraqi;;;rg;rei;;g;aw;awl;;ei;qxs;toraaate;ln;;si;;qx;xwfgthwei;;;eeeoe;;nougkADGTlurrie"
+    "eiAToncrAhVtecwqa;ESmlEt;teeipnmmarg;rVtrcwoeecrarea;uohrohrrr;icnyeeStrdqureliHlnlt;tees;ESlabp"
+    "u;EST;EaldBuo;enandleluraegBecotlVeo;Bs;;rrrw;sts;;andauthA;u;rr;eadca;due;llr;;;;ei;edolr;;eeor"
+    "iduorrumohrfglr;r;lfg;;;anrrrriqeui;;;;nthat;fgqqlrnrtuorwcoriDrrrgefgrewAa;rteoVt;ul;qa;LqeE;;n"
+    ";;mec;haeoot;r;BEct;BroalawtowtoorukSTrsp;teulesalu;g;eE;asqlenseaqliqlEeabtselte;niiarf;rVtwoee"
+    "cra;oor;e;Eeltela;ermor;reecop;eeifgsgwei;qwolopwopiewtotherrethiduoprrm;lsl;;etrath;q;qei;eobta"
+    "iutual;Iooh;thre;rlrVcreoaluleurqeasktccrwo;aqtoa;wt;l;Aw;awwomSphGsai;alasndmlrqtLuamgerlualu;q"
+    ";rlei;;E;tblc;taeo;r;BEct;Brwwocqt;E;;lsr;woa;;ew;;dlrfgth;esfg;;w;w;swogs;aw;t;ool;etlopwoooe;;"
+    "oq;err;t;;fgnulelst;bvdnwwtARto;rBoet;BcrrSalsa;u;;;eAkt;B;rruorr;e;r;r;;wSpair;cclEt;tepe;ueean"
+    "elts;andau;e;sq;rikAccr;aqtoa;;;wtu;Eq;io;wt;noeith;t;;th;n;;soa;r;;ww;q;e;w;sowwsn;qor;thtre;;e"
+    "eleet;;AriAwoawcoat;BeqrSslatreoa;;ar;;rrr;pacneea;qeE;;;BEarsltne;EeltelaQ;uiberkt;Bruorr;iaqus"
+    "w;o;wfg;t;;t;;nrr;;;qn;ns;;;;wo;tiIQC;e;;errgr;wr;trroa;ueq;;l;rtrrl;;ooaceSa;lurqaqlGs;Et;BEqt;"
+    "E;;luaurtreoa;ar;;olua;;rnth;;sro;;s;;w;anuoAgrohr;;o;;rra;u;o;;;;wwce;ptBa;uru;r;q;aqu;Eq;olmi;"
+    "otrrl;n;al;;;t;ow;;ltoncrowtor;;raw;;e;aeala;aeuruaqut;;uw;;;;;l;;w;Dettuaw;Aw;er;;crr;llaa;alua"
+    "em;;;;geotl;r;;ee;;;;tll;al;;r;ue;r;;e;;l;ar;or;lIw;;n;tegral;"
+    ;
+
+static const char entity_values[4375] =
+    "\x3e\x3c\x26\xe2\x85\x85\xc3\x90\xe2\x8b\x99\xe2\x89\xab\xe2\x84\x91\xe2\x8b\x98\xe2\x89\xaa\xce"
+    "\x9c\xce\x9d\xe2\xa9\x94\xce\xa0\xe2\xaa\xbb\xc2\xae\xe2\x84\x9c\xe2\xaa\xbc\xce\x9e\xe2\x88\xbe"
+    "\xe2\x81\xa1\xe2\x89\x88\xe2\x85\x86\xc2\xb0\xe2\x85\x87\xe2\xaa\x9a\xe2\xaa\x99\xc3\xb0\xe2\x89"
+    "\xa7\xe2\x89\xa5\xe2\x89\xb7\xe2\x81\xa3\xe2\x85\x88\xe2\x88\x88\xe2\x81\xa2\xe2\x89\xa6\xe2\x89"
+    "\xa4\xe2\x89\xb6\xe2\x88\x93\xce\xbc\xe2\x89\xa0\xe2\x88\x8b\xc2\xac\xce\xbd\xe2\x93\x88\xe2\x88"
+    "\xa8\xcf\x80\xc2\xb1\xe2\x89\xba\xe2\x84\x9e\xe2\x89\xbb\xc2\xad\xc2\xa8\xe2\x84\x98\xe2\x89\x80"
+    "\xce\xbe\xc2\xa5\xd0\x90\xf0\x9d\x94\x84\xe2\xa9\x93\xc3\x84\xd0\x91\xf0\x9d\x94\x85\xc2\xa9\xe2"
+    "\x8b\x92\xe2\x84\xad\xce\xa7\xe2\x8b\x93\xd0\x94\xe2\x88\x87\xf0\x9d\x94\x87\xc5\x8a\xd0\xad\xf0"
+    "\x9d\x94\x88\xce\x97\xc3\x8b\xd0\xa4\xf0\x9d\x94\x89\xd0\x93\xf0\x9d\x94\x8a\x5e\xe2\x84\x8c\xd0"
+    "\x98\xe2\x88\xac\xc3\x8f\xd0\x99\xf0\x9d\x94\x8d\xd0\x9a\xf0\x9d\x94\x8e\xd0\x9b\xf0\x9d\x94\x8f"
+    "\xe2\x86\xb0\xe2\xa4\x85\xd0\x9c\xf0\x9d\x94\x90\xd0\x9d\xf0\x9d\x94\x91\xe2\xab\xac\xd0\x9e\xf0"
+    "\x9d\x94\x92\xc3\x96\xd0\x9f\xf0\x9d\x94\x93\xce\xa6\xce\xa8\x22\xf0\x9d\x94\x94\xd0\xa0\xce\xa1"
+    "\xe2\x86\xb1\xd0\xa1\xf0\x9d\x94\x96\xe2\x8b\x90\xe2\x88\x91\xe2\x8b\x91\x09\xce\xa4\xd0\xa2\xf0"
+    "\x9d\x94\x97\xd0\xa3\xf0\x9d\x94\x98\xc3\x9c\xd0\x92\xe2\x8b\x81\xf0\x9d\x94\x99\xf0\x9d\x94\x9a"
+    "\xf0\x9d\x94\x9b\xd0\xab\xf0\x9d\x94\x9c\xd0\x97\xe2\x84\xa8\xe2\x88\xbe\xcc\xb3\xe2\x88\xbf\xd0"
+    "\xb0\xf0\x9d\x94\x9e\xe2\x88\xa7\xe2\x88\xa0\xe2\xa9\xb0\xe2\x89\x8a\x2a\xc3\xa4\xd0\xb1\xf0\x9d"
+    "\x94\x9f\x3d\xe2\x83\xa5\xe2\x8a\xa5\xe2\x88\xa9\xc2\xa2\xf0\x9d\x94\xa0\xcf\x87\xe2\x97\x8b\xe2"
+    "\x88\xaa\xd0\xb4\xf0\x9d\x94\xa1\xc3\xb7\xcb\x99\xd1\x8d\xf0\x9d\x94\xa2\xe2\xaa\x96\xe2\x84\x93"
+    "\xe2\xaa\x95\xc5\x8b\xce\xb7\xc3\xab\xd1\x84\xf0\x9d\x94\xa3\xe2\xaa\x8c\xe2\xaa\x86\xd0\xb3\xe2"
+    "\x8b\x9b\xe2\xa9\xbe\xf0\x9d\x94\xa4\xe2\xaa\x92\xe2\xaa\xa5\xe2\xaa\xa4\xe2\x89\xa9\xe2\xaa\x88"
+    "\xf0\x9d\x94\xa5\xd0\xb8\xe2\x87\x94\xf0\x9d\x94\xa6\xe2\x88\xab\xc3\xaf\xd0\xb9\xf0\x9d\x94\xa7"
+    "\xd0\xba\xf0\x9d\x94\xa8\xe2\xaa\x8b\xe2\xaa\x85\xe2\xaa\xab\xd0\xbb\xe2\x8b\x9a\xe2\xa9\xbd\xf0"
+    "\x9d\x94\xa9\xe2\xaa\x91\xe2\x89\xa8\xe2\xaa\x87\xe2\x97\x8a\xe2\x80\x8e\xc2\xaf\xe2\x86\xa6\xd0"
+    "\xbc\xf0\x9d\x94\xaa\xe2\x84\xa7\xe2\x88\xa3\xe2\x8b\x99\xcc\xb8\xe2\x89\xab\xe2\x83\x92\xe2\x8b"
+    "\x98\xcc\xb8\xe2\x89\xaa\xe2\x83\x92\xe2\x89\x89\xc2\xa0\xd0\xbd\xf0\x9d\x94\xab\xe2\x89\xa7\xcc"
+    "\xb8\xe2\x89\xb1\xe2\x89\xaf\xe2\x8b\xbc\xe2\x89\xa6\xcc\xb8\xe2\x89\xb0\xe2\x89\xae\xe2\x8a\x80"
+    "\xe2\x8a\x81\x23\xd0\xbe\xf0\x9d\x94\xac\xe2\xa7\x81\xce\xa9\xe2\xa7\x80\xe2\xa9\x9d\xc2\xaa\xc2"
+    "\xba\xe2\xa9\x9b\xc3\xb6\xe2\x88\xa5\xc2\xb6\xd0\xbf\xf0\x9d\x94\xad\xcf\x86\xcf\x96\xe2\xaa\xb3"
+    "\xe2\xaa\xaf\xcf\x88\xf0\x9d\x94\xae\xd1\x80\xf0\x9d\x94\xaf\xcf\x81\xe2\x80\x8f\xe2\xaa\xb4\xe2"
+    "\xaa\xb0\xd1\x81\xc2\xa7\xf0\x9d\x94\xb0\xe2\x88\xbc\xe2\xaa\xaa\x2f\xe2\x96\xa1\xe2\x8a\x82\xc2"
+    "\xb9\xc2\xb2\xc2\xb3\xe2\x8a\x83\xcf\x84\xd1\x82\xf0\x9d\x94\xb1\xe2\x8a\xa4\xd1\x83\xf0\x9d\x94"
+    "\xb2\xc3\xbc\xd0\xb2\xf0\x9d\x94\xb3\xf0\x9d\x94\xb4\xf0\x9d\x94\xb5\xd1\x8b\xf0\x9d\x94\xb6\xc3"
+    "\xbf\xd0\xb7\xf0\x9d\x94\xb7\xe2\x80\x8d\xc3\x86\xc3\x82\xf0\x9d\x94\xb8\xc3\x85\xf0\x9d\x92\x9c"
+    "\xe2\xab\xa7\xce\x92\xf0\x9d\x94\xb9\xe2\x84\xac\xd0\xa7\xc4\x8a\xe2\x84\x82\xf0\x9d\x92\x9e\xd0"
+    "\x82\xd0\x85\xd0\x8f\xe2\x86\xa1\xf0\x9d\x94\xbb\xf0\x9d\x92\x9f\xc3\x8a\xc4\x96\xf0\x9d\x94\xbc"
+    "\xe2\x84\xb0\xe2\xa9\xb3\xf0\x9d\x94\xbd\xe2\x84\xb1\xd0\x83\xc4\xa0\xf0\x9d\x94\xbe\xf0\x9d\x92"
+    "\xa2\xe2\x84\x8d\xe2\x84\x8b\xd0\x95\xd0\x81\xc3\x8e\xc4\xb0\xf0\x9d\x95\x80\xce\x99\xe2\x84\x90"
+    "\xf0\x9d\x95\x81\xf0\x9d\x92\xa5\xd0\xa5\xd0\x8c\xf0\x9d\x95\x82\xf0\x9d\x92\xa6\xd0\x89\xe2\x9f"
+    "\xaa\xe2\x86\x9e\xf0\x9d\x95\x83\xe2\x84\x92\xf0\x9d\x95\x84\xe2\x84\xb3\xd0\x8a\xe2\x84\x95\xf0"
+    "\x9d\x92\xa9\xc3\x94\xf0\x9d\x95\x86\xf0\x9d\x92\xaa\xe2\x84\x99\xf0\x9d\x92\xab\xe2\x84\x9a\xf0"
+    "\x9d\x92\xac\xe2\x9f\xab\xe2\x86\xa0\xe2\x84\x9d\xe2\x84\x9b\xd0\xa8\xf0\x9d\x95\x8a\xe2\x88\x9a"
+    "\xf0\x9d\x92\xae\xe2\x8b\x86\xc3\x9e\xd0\xa6\xf0\x9d\x95\x8b\xf0\x9d\x92\xaf\xe2\x86\x9f\xc3\x9b"
+    "\xf0\x9d\x95\x8c\xcf\x92\xf0\x9d\x92\xb0\xe2\xab\xab\xe2\x80\x96\xf0\x9d\x95\x8d\xf0\x9d\x92\xb1"
+    "\xf0\x9d\x95\x8e\xf0\x9d\x92\xb2\xf0\x9d\x95\x8f\xf0\x9d\x92\xb3\xd0\xaf\xd0\x87\xd0\xae\xf0\x9d"
+    "\x95\x90\xf0\x9d\x92\xb4\xc5\xb8\xd0\x96\xc5\xbb\xce\x96\xe2\x84\xa4\xf0\x9d\x92\xb5\xc3\xa2\xc2"
+    "\xb4\xc3\xa6\xe2\xa9\x9c\xe2\xa9\x9a\xe2\xa6\xa4\xf0\x9d\x95\x92\xe2\x89\x8b\x27\xc3\xa5\xf0\x9d"
+    "\x92\xb6\xe2\xab\xad\xe2\x8e\xb5\xce\xb2\xe2\x84\xb6\xe2\x8c\x90\xf0\x9d\x95\x93\xe2\x95\x90\xe2"
+    "\x95\x91\xe2\x94\x80\xe2\x94\x82\xf0\x9d\x92\xb7\xe2\x88\xbd\x5c\xe2\x80\xa2\xe2\x89\x8e\xe2\x88"
+    "\xa9\xef\xb8\x80\xc4\x8b\xc2\xb8\xd1\x87\xe2\xa7\x83\xcb\x86\xe2\x89\x97\xe2\x88\x81\xe2\x89\x85"
+    "\xf0\x9d\x95\x94\xf0\x9d\x92\xb8\xe2\xab\x8f\xe2\xab\x90\xe2\x88\xaa\xef\xb8\x80\xe2\x87\x93\xe2"
+    "\xa5\xa5\xe2\x86\x93\xe2\x80\x90\xe2\x8b\x84\xd1\x92\xf0\x9d\x95\x95\xf0\x9d\x92\xb9\xd1\x95\xe2"
+    "\xa7\xb6\xe2\x96\xbf\xd1\x9f\xe2\x89\x91\xe2\x89\x96\xc3\xaa\xc4\x97\xe2\x80\x83\xe2\x80\x82\xf0"
+    "\x9d\x95\x96\xe2\x8b\x95\xce\xb5\xe2\x84\xaf\xe2\x89\x82\xe2\x82\xac\x21\xe2\x99\xad\xc6\x92\xf0"
+    "\x9d\x95\x97\xe2\x8b\x94\xf0\x9d\x92\xbb\xc4\xa1\xe2\x8b\x9b\xef\xb8\x80\xd1\x93\xe2\xaa\x8a\xf0"
+    "\x9d\x95\x98\xe2\x84\x8a\xe2\x89\xb3\xe2\xaa\xa7\xe2\x89\xa9\xef\xb8\x80\xc2\xbd\xe2\x86\x94\xe2"
+    "\x84\x8f\xf0\x9d\x95\x99\xf0\x9d\x92\xbd\xc3\xae\xd0\xb5\xc2\xa1\xe2\x8a\xb7\xd1\x91\xf0\x9d\x95"
+    "\x9a\xce\xb9\xf0\x9d\x92\xbe\xf0\x9d\x95\x9b\xf0\x9d\x92\xbf\xd1\x85\xd1\x9c\xf0\x9d\x95\x9c\xf0"
+    "\x9d\x93\x80\xe2\x87\x90\xe2\xa5\xa2\xe2\x9f\xa8\xc2\xab\xe2\x86\x90\xe2\xaa\xad\x7b\xe2\xa4\xb6"
+    "\xe2\x86\xb2\xe2\x8b\x9a\xef\xb8\x80\xd1\x99\xe2\xaa\x89\xf0\x9d\x95\x9d\xe2\xa7\xab\x28\xf0\x9d"
+    "\x93\x81\xe2\x89\xb2\x5b\xe2\xaa\xa6\xe2\x97\x83\xe2\x89\xa8\xef\xb8\x80\xe2\x99\x82\xe2\x9c\xa0"
+    "\xc2\xb5\xe2\xab\x9b\xe2\x80\xa6\xf0\x9d\x95\x9e\xf0\x9d\x93\x82\xe2\x89\xab\xcc\xb8\xe2\x89\xaa"
+    "\xcc\xb8\xe2\x88\xa0\xe2\x83\x92\xe2\xa9\xb0\xcc\xb8\xe2\xa9\x83\xe2\xa9\x82\xe2\xa9\xbe\xcc\xb8"
+    "\xe2\x8b\xba\xd1\x9a\xe2\x80\xa5\xe2\xa9\xbd\xcc\xb8\xe2\x88\xa4\xf0\x9d\x95\x9f\xe2\x88\xa6\xe2"
+    "\xaa\xaf\xcc\xb8\xe2\xaa\xb0\xcc\xb8\xf0\x9d\x93\x83\xe2\x89\x81\xe2\x8a\x84\xe2\x8a\x85\xe2\x89"
+    "\xb9\xe2\x89\xb8\xe2\x89\x8d\xe2\x83\x92\xe2\x89\xa5\xe2\x83\x92\x3e\xe2\x83\x92\xe2\x89\xa4\xe2"
+    "\x83\x92\x3c\xe2\x83\x92\xe2\x8a\x9b\xe2\x8a\x9a\xc3\xb4\xe2\xa8\xb8\xe2\x8a\x99\xcb\x9b\xe2\x88"
+    "\xae\xe2\xa6\xb6\xf0\x9d\x95\xa0\xe2\xa6\xb7\xe2\xa9\x96\xe2\x84\xb4\xe2\x8a\x98\xe2\x88\x82\xcf"
+    "\x95\x2b\xf0\x9d\x95\xa1\xc2\xa3\xe2\xaa\xb7\xe2\xaa\xb5\xe2\x88\x8f\xe2\x88\x9d\xf0\x9d\x93\x85"
+    "\xe2\xa8\x8c\xf0\x9d\x95\xa2\xf0\x9d\x93\x86\xe2\x87\x92\xe2\xa5\xa4\xe2\x88\xbd\xcc\xb1\xe2\x9f"
+    "\xa9\xc2\xbb\xe2\x86\x92\x7d\xe2\xa4\xb7\xe2\x86\xb3\xe2\x96\xad\xcf\xb1\xcb\x9a\xf0\x9d\x95\xa3"
+    "\x29\xf0\x9d\x93\x87\x5d\xe2\x96\xb9\xe2\xaa\xb8\xe2\xaa\xb6\xe2\x8b\x85\x3b\xe2\x9c\xb6\xd1\x88"
+    "\xe2\x89\x83\xe2\xaa\x9e\xe2\xaa\x9d\xe2\xaa\xac\xe2\xa7\x84\xf0\x9d\x95\xa4\xe2\x96\xaa\xf0\x9d"
+    "\x93\x88\xe2\x98\x86\xe2\xab\x85\xe2\x8a\x86\xe2\x99\xaa\xe2\xab\x86\xe2\x8a\x87\xc3\x9f\xe2\x8e"
+    "\xb4\xe2\x83\x9b\xc3\xbe\xc3\x97\xe2\x88\xad\xe2\xa4\xa8\xf0\x9d\x95\xa5\xe2\xa4\xa9\xe2\x89\x9c"
+    "\xf0\x9d\x93\x89\xd1\x86\xe2\x87\x91\xe2\xa5\xa3\xe2\x86\x91\xc3\xbb\xf0\x9d\x95\xa6\xcf\x85\xf0"
+    "\x9d\x93\x8a\xe2\x96\xb5\xe2\x87\x95\xe2\xab\xa8\xe2\x86\x95\x7c\xf0\x9d\x95\xa7\xf0\x9d\x93\x8b"
+    "\xf0\x9d\x95\xa8\xf0\x9d\x93\x8c\xe2\x8b\x82\xe2\x8b\x83\xe2\x9f\xbc\xe2\x8b\xbb\xf0\x9d\x95\xa9"
+    "\xf0\x9d\x93\x8d\xd1\x8f\xd1\x97\xf0\x9d\x95\xaa\xf0\x9d\x93\x8e\xd1\x8e\xc5\xbc\xce\xb6\xd0\xb6"
+    "\xf0\x9d\x95\xab\xf0\x9d\x93\x8f\xe2\x80\x8c\xc3\x81\xc3\x80\xce\x91\xc4\x80\xc4\x84\xc3\x83\xcb"
+    "\x98\xc3\x87\xc4\x88\xe2\x88\xb7\xe2\xa8\xaf\xe2\xab\xa4\xce\x94\xc3\x89\xc3\x88\xc4\x92\xc4\x98"
+    "\xe2\xa9\xb5\xce\x93\xc4\x9c\xcb\x87\xc4\xa4\xc4\xb2\xc3\x8d\xc3\x8c\xc4\xaa\xc4\xae\xd0\x86\xc4"
+    "\xb4\xd0\x84\xce\x9a\xc3\x91\xc5\x92\xc3\x93\xc3\x92\xc5\x8c\xc3\x98\xc3\x95\xe2\x80\xb3\xe2\xa4"
+    "\x90\xc5\x9c\xce\xa3\xe2\x84\xa2\xd0\x8b\xce\x98\xc3\x9a\xd0\x8e\xc3\x99\xc5\xaa\xc5\xb2\xc5\xae"
+    "\xe2\x8a\xab\xe2\x8a\xa9\xc5\xb4\xe2\x8b\x80\xc3\x9d\xc5\xb6\xc3\xa1\xc3\xa0\xe2\x84\xb5\xce\xb1"
+    "\xc4\x81\xe2\xa8\xbf\xe2\x88\x9f\xc4\x85\xc3\xa3\xe2\xa8\x91\xe2\x89\x8c\xe2\x80\x9e\xcf\xb6\xe2"
+    "\x90\xa3\xe2\x96\x92\xe2\x96\x91\xe2\x96\x93\xe2\x96\x88\xe2\x95\x97\xe2\x95\x94\xe2\x95\x96\xe2"
+    "\x95\x93\xe2\x95\xa6\xe2\x95\xa9\xe2\x95\xa4\xe2\x95\xa7\xe2\x95\x9d\xe2\x95\x9a\xe2\x95\x9c\xe2"
+    "\x95\x99\xe2\x95\xac\xe2\x95\xa3\xe2\x95\xa0\xe2\x95\xab\xe2\x95\xa2\xe2\x95\x9f\xe2\x95\x95\xe2"
+    "\x95\x92\xe2\x94\x90\xe2\x94\x8c\xe2\x95\xa5\xe2\x95\xa8\xe2\x94\xac\xe2\x94\xb4\xe2\x95\x9b\xe2"
+    "\x95\x98\xe2\x94\x98\xe2\x94\x94\xe2\x95\xaa\xe2\x95\xa1\xe2\x95\x9e\xe2\x94\xbc\xe2\x94\xa4\xe2"
+    "\x94\x9c\xc2\xa6\xe2\x81\x8f\xe2\x8b\x8d\xe2\xa7\x85\xe2\xaa\xae\xe2\x89\x8f\xe2\x81\x81\xe2\xa9"
+    "\x8d\xc3\xa7\xc4\x89\xe2\xa9\x8c\xe2\x9c\x93\xe2\x99\xa3\x3a\x2c\xe2\x86\xb5\xe2\x9c\x97\xe2\xab"
+    "\x91\xe2\xab\x92\xe2\x8b\xaf\xe2\x8b\x9e\xe2\x8b\x9f\xe2\xa9\x85\xc2\xa4\xe2\x8b\x8e\xe2\x8b\x8f"
+    "\xe2\x88\xb1\xe2\x8a\xa3\xcb\x9d\xe2\x87\x8a\xce\xb4\xe2\x87\x83\xe2\x87\x82\xe2\x99\xa6\xe2\x8b"
+    "\xb2\xe2\x89\x90\xe2\x8b\xb1\xe2\x96\xbe\xe2\x87\xb5\xe2\xa5\xaf\xe2\xa9\xb7\xc3\xa9\xe2\x89\x92"
+    "\xc3\xa8\xc4\x93\xe2\x88\x85\xc4\x99\xe2\xa9\xb1\xcf\xb5\xe2\x89\xa1\xe2\x89\x93\xe2\xa5\xb1\xe2"
+    "\x88\x83\xef\xac\x80\xef\xac\x81\x66\x6a\xef\xac\x82\xe2\x96\xb1\xe2\xab\x99\xc2\xbc\xc2\xbe\xe2"
+    "\x81\x84\xe2\x8c\xa2\xce\xb3\xc4\x9d\xe2\xaa\xa9\xe2\x84\xb7\xe2\x8b\xa7\x60\xe2\xaa\x8e\xe2\xaa"
+    "\x90\xe2\xa9\xba\xe2\x8b\x97\xe2\x86\xad\xc4\xa5\xe2\x87\xbf\xc3\xad\xc3\xac\xe2\x84\xa9\xc4\xb3"
+    "\xc4\xab\xc4\xb1\xc6\xb5\xe2\x88\x9e\xc4\xaf\xe2\xa8\xbc\xc2\xbf\xe2\x8b\xb9\xe2\x8b\xb4\xd1\x96"
+    "\xc4\xb5\xc8\xb7\xd1\x94\xce\xba\xe2\x87\x9a\xe2\xa4\x8e\xe2\xa6\x91\xe2\x87\xa4\xe2\xaa\xad\xef"
+    "\xb8\x80\xe2\xa4\x8c\xe2\x9d\xb2\xe2\xa6\x8b\xe2\x8c\x88\xe2\x80\x9c\xe2\xaa\xa8\xe2\x86\xbd\xe2"
+    "\x86\xbc\xe2\x96\x84\xe2\x87\x87\xe2\x97\xba\xe2\x8b\xa6\xe2\x9f\xac\xe2\x87\xbd\xe2\x9f\xa6\xe2"
+    "\xa6\x85\xe2\x87\x86\xe2\x87\x8b\xe2\x8a\xbf\xe2\xaa\x8d\xe2\xaa\x8f\xe2\x80\x98\xe2\xa9\xb9\xe2"
+    "\x8b\x96\xe2\x8a\xb4\xe2\x97\x82\xe2\x88\xba\xe2\x80\x94\xc2\xb7\xe2\x88\x92\xe2\x8a\xb8\xe2\x89"
+    "\x8b\xcc\xb8\xc5\x89\xe2\x99\xae\xe2\x89\x8e\xcc\xb8\xe2\x89\x87\xe2\x80\x93\xe2\x87\x97\xe2\x86"
+    "\x97\xe2\x89\x90\xcc\xb8\xe2\x89\x82\xcc\xb8\xe2\x89\xb5\xe2\x87\x8e\xe2\x86\xae\xe2\xab\xb2\xe2"
+    "\x87\x8d\xe2\x86\x9a\xe2\x89\xb4\xe2\x8b\xaa\xe2\x88\x89\xe2\x88\x8c\xe2\x88\x82\xcc\xb8\xe2\x87"
+    "\x8f\xe2\x86\x9b\xe2\x8b\xab\xe2\x89\x84\xe2\xab\x85\xcc\xb8\xe2\x8a\x88\xe2\xab\x86\xcc\xb8\xe2"
+    "\x8a\x89\xc3\xb1\xe2\x80\x87\xe2\x88\xbc\xe2\x83\x92\xe2\x87\x96\xe2\x86\x96\xc3\xb3\xe2\x8a\x9d"
+    "\xc5\x93\xe2\xa6\xbf\xc3\xb2\xe2\xa6\xb5\xe2\x86\xba\xe2\xa6\xbe\xe2\x80\xbe\xc5\x8d\xcf\x89\xe2"
+    "\xa6\xb9\xe2\x8a\x95\xe2\x86\xbb\xc3\xb8\xc3\xb5\xe2\x8c\xbd\xe2\xab\xbd\xe2\x98\x8e\xe2\x8a\x9e"
+    "\xe2\xa9\xb2\xe2\x89\xbc\xe2\x80\xb2\xe2\xaa\xb9\xe2\x89\xbe\x3f\xe2\x87\x9b\xe2\xa4\x8f\xe2\xa6"
+    "\x92\xe2\xa6\xa5\xe2\x87\xa5\xe2\xa4\xb3\xe2\x86\x9d\xe2\x88\xb6\xe2\xa4\x8d\xe2\x9d\xb3\xe2\xa6"
+    "\x8c\xe2\x8c\x89\xe2\x80\x9d\xe2\x87\x81\xe2\x87\x80\xe2\x87\x84\xe2\x87\x8c\xe2\xab\xae\xe2\x9f"
+    "\xad\xe2\x87\xbe\xe2\x9f\xa7\xe2\xa6\x86\xe2\x87\x89\xe2\x80\x99\xe2\x8a\xb5\xe2\x96\xb8\xe2\x80"
+    "\x9a\xe2\x89\xbd\xc5\x9d\xe2\xaa\xba\xe2\x89\xbf\xe2\x8a\xa1\xe2\xa9\xa6\xe2\x87\x98\xe2\x86\x98"
+    "\xe2\x88\x96\xe2\x99\xaf\xcf\x83\xe2\xaa\xa0\xe2\xaa\x9f\xe2\x89\x86\xe2\x8c\xa3\xe2\xaa\xac\xef"
+    "\xb8\x80\xe2\x8a\x93\xe2\x8a\x94\xe2\x8a\x8f\xe2\x8a\x90\xe2\x98\x85\xe2\xab\x8b\xe2\x8a\x8a\xe2"
+    "\xab\x8c\xe2\x8a\x8b\xe2\x87\x99\xe2\x86\x99\xce\xb8\xcb\x9c\xe2\xa7\x8d\xd1\x9b\xe2\x89\xac\xc3"
+    "\xba\xd1\x9e\xe2\x87\x85\xe2\xa5\xae\xc3\xb9\xe2\x86\xbf\xe2\x86\xbe\xe2\x96\x80\xe2\x97\xb8\xc5"
+    "\xab\xc5\xb3\xe2\x8a\x8e\xc5\xaf\xe2\x97\xb9\xe2\x8b\xb0\xe2\x96\xb4\xe2\x87\x88\xe2\xab\xa9\xe2"
+    "\x8a\xa8\xe2\x8a\xa2\xe2\x89\x9a\xe2\x8a\xb2\xe2\x8a\x82\xe2\x83\x92\xe2\x8a\x83\xe2\x83\x92\xe2"
+    "\x8a\xb3\xc5\xb5\xe2\x97\xaf\xe2\x96\xbd\xe2\x9f\xba\xe2\x9f\xb7\xe2\x9f\xb8\xe2\x9f\xb5\xe2\xa8"
+    "\x80\xe2\x9f\xb9\xe2\x9f\xb6\xe2\x96\xb3\xc3\xbd\xc5\xb7\xc4\x82\xe2\x89\x94\xe2\x8c\x86\xc4\x86"
+    "\xc4\x8c\xe2\xa9\xb4\xe2\x88\xaf\xe2\x89\x8d\xe2\x80\xa1\xc4\x8e\xe2\x83\x9c\xc4\x90\xc4\x9a\xe2"
+    "\x88\x80\xcf\x9c\xc4\x9e\xc4\xa2\xd0\xaa\xc4\xa6\xc4\xa8\xd0\x88\xc4\xb6\xc4\xb9\xce\x9b\xc4\xbd"
+    "\xc4\xbb\xc4\xbf\xc5\x81\xc5\x83\xc5\x87\xc5\x85\xc5\x90\xe2\xa8\xb7\xc5\x94\xe2\xa4\x96\xc5\x98"
+    "\xc5\x96\xd0\xa9\xd0\xac\xc5\x9a\xc5\xa0\xc5\x9e\xc5\xa4\xc5\xa2\xc5\xa6\xc5\xac\xc5\xb0\xc5\xa8"
+    "\xe2\xab\xa6\xe2\x8a\xaa\xc5\xb9\xc5\xbd\xc4\x83\xe2\xa9\x95\xe2\x88\xa1\xe2\x88\xa2\xe2\xa9\xaf"
+    "\xe2\x8a\xbd\xe2\x8c\x85\xe2\x88\xb5\xe2\x8b\x88\xe2\xa7\x89\xe2\x80\xb5\xc4\x87\xe2\xa9\x84\xe2"
+    "\xa9\x8b\xe2\xa9\x87\xe2\xa9\x80\xc4\x8d\xe2\xab\xaf\x40\xe2\x88\x98\xe2\x88\x90\xe2\x84\x97\xe2"
+    "\x86\xb6\xe2\xa9\x86\xe2\xa9\x8a\xe2\x8a\x8d\xe2\x86\xb7\xe2\x8c\xad\xe2\x80\xa0\xe2\x84\xb8\xc4"
+    "\x8f\xe2\xa5\xbf\xe2\x8b\x87\xe2\x8c\x9e\xe2\x8c\x8d\x24\xe2\x8c\x9f\xe2\x8c\x8c\xc4\x91\xe2\xa9"
+    "\xae\xc4\x9b\xe2\x89\x95\xe2\xaa\x98\xe2\xaa\x97\xe2\x80\x84\xe2\x80\x85\xe2\xa7\xa3\x3d\xe2\x89"
+    "\x9f\xe2\x99\x80\xef\xac\x83\xef\xac\x84\xe2\x85\x93\xe2\x85\x95\xe2\x85\x99\xe2\x85\x9b\xe2\x85"
+    "\x94\xe2\x85\x96\xe2\x85\x97\xe2\x85\x9c\xe2\x85\x98\xe2\x85\x9a\xe2\x85\x9d\xe2\x85\x9e\xc7\xb5"
+    "\xcf\x9d\xc4\x9f\xe2\xaa\x80\xe2\xaa\x94\xe2\xa6\x95\xe2\xa5\xb8\xe2\x80\x8a\xd1\x8a\xe2\x99\xa5"
+    "\xe2\x8a\xb9\xe2\x88\xbb\xe2\x80\x95\xc4\xa7\xe2\x81\x83\xe2\xa7\x9c\xe2\x84\x85\xe2\x8a\xba\xe2"
+    "\x8b\xb3\xc4\xa9\xd1\x98\xcf\xb0\xc4\xb7\xc4\xb8\xe2\xa4\x9b\xc4\xba\xce\xbb\xe2\xa4\x9d\xe2\x86"
+    "\xa9\xe2\x86\xab\xe2\xa4\xb9\xe2\x86\xa2\xe2\xa4\x99\xc4\xbe\xc4\xbc\xe2\xa9\xbf\xe2\xaa\x93\xe2"
+    "\xa5\xbc\xe2\x8c\x8a\xe2\xa5\xaa\xe2\xa5\xab\xc5\x80\xe2\x8e\xb0\xe2\xa8\xad\xe2\x88\x97\x5f\xe2"
+    "\xa6\x93\xe2\xa5\xad\xe2\x80\xb9\xc5\x82\xe2\x8b\x8b\xe2\x8b\x89\xe2\xa5\xb6\xe2\xa6\x96\xe2\x96"
+    "\xae\xe2\xa8\xa9\xe2\xab\xb0\xe2\x8a\x9f\xe2\x88\xb8\xe2\x8a\xa7\xe2\x8a\xaf\xe2\x8a\xae\xc5\x84"
+    "\xe2\x89\x8f\xcc\xb8\xc5\x88\xc5\x86\xe2\xa4\xa4\xe2\x89\xa2\xe2\x88\x84\xe2\x8b\xac\xe2\x8b\xb9"
+    "\xcc\xb8\xe2\xab\xbd\xe2\x83\xa5\xe2\x8b\xa0\xe2\xa4\xb3\xcc\xb8\xe2\x86\x9d\xcc\xb8\xe2\x8b\xad"
+    "\xe2\x8b\xa1\xe2\x84\x96\xe2\x8a\xad\xe2\xa4\x84\xe2\x8a\xac\xe2\xa4\x82\xe2\xa4\x83\xe2\xa4\xa3"
+    "\xe2\xa4\xa7\xc5\x91\xe2\xa6\xbc\xe2\x8a\x96\xe2\x8a\xb6\xe2\x8a\x97\xe2\xab\xb3\x25\x2e\xe2\x80"
+    "\xb0\xe2\x88\x94\xe2\xa8\xa5\xe2\x8b\xa8\xe2\x8a\xb0\xe2\x80\x88\xe2\x81\x97\xe2\xa4\x9c\xc5\x95"
+    "\xe2\xa5\xb5\xe2\xa4\x9e\xe2\x86\xaa\xe2\x86\xac\xe2\xa5\x85\xe2\x86\xa3\xe2\xa4\x9a\xc5\x99\xc5"
+    "\x97\xe2\xa5\xbd\xe2\x8c\x8b\xe2\xa5\xac\xe2\x8e\xb1\xe2\xa8\xae\xe2\xa6\x94\xe2\x80\xba\xe2\x8b"
+    "\x8c\xe2\x8b\x8a\xc5\x9b\xc5\xa1\xc5\x9f\xe2\x8b\xa9\xe2\xa4\xa5\xd1\x89\xcf\x82\xe2\xa9\xaa\xe2"
+    "\xa8\xb3\xd1\x8c\xe2\x8c\xbf\xe2\x99\xa0\xe2\x8a\x93\xef\xb8\x80\xe2\x8a\x94\xef\xb8\x80\xe2\x8a"
+    "\x91\xe2\x8a\x92\xe2\xaa\xbd\xe2\xab\x87\xe2\xab\x95\xe2\xab\x93\xe2\xaa\xbe\xe2\xab\x88\xe2\xab"
+    "\x94\xe2\xab\x96\xe2\xa4\xa6\xe2\xa4\xaa\xe2\x8c\x96\xc5\xa5\xc5\xa3\xe2\x8c\x95\xe2\x88\xb4\xcf"
+    "\x91\xe2\x80\x89\xe2\x8a\xa0\xe2\xa8\xb0\xe2\x8c\xb6\xe2\xab\xb1\xe2\x80\xb4\xe2\x97\xac\xc5\xa7"
+    "\xc5\xad\xc5\xb1\xe2\xa5\xbe\xe2\x8c\x9c\xe2\x8c\x8f\xe2\x8c\x9d\xe2\x8c\x8e\xc5\xa9\xe2\xa6\x9c"
+    "\xe2\x8a\xbb\xe2\x8b\xae\xe2\xab\x8b\xef\xb8\x80\xe2\x8a\x8a\xef\xb8\x80\xe2\xab\x8c\xef\xb8\x80"
+    "\xe2\x8a\x8b\xef\xb8\x80\xe2\xa9\x9f\xe2\x89\x99\xe2\xa8\x81\xe2\xa8\x82\xe2\xa8\x86\xe2\xa8\x84"
+    "\xc5\xba\xc5\xbe\xe2\x88\xb0\xce\x95\x0a\xe2\x81\xa0\xce\x9f\xce\xa5\xe2\x8a\xbe\xe2\x8d\xbc\xe2"
+    "\xa6\xb0\xe2\x89\xa1\xe2\x83\xa5\xe2\xa9\x90\xe2\xa6\xb2\xe2\xa7\x82\xe2\xa9\xad\xe2\xa4\xb8\xe2"
+    "\xa4\xb5\xe2\xa4\xbd\xe2\xa4\xbc\xe2\xa6\xb1\xe2\xa6\xa6\xe2\xa9\xb8\xe2\xaa\x82\xe2\xa9\xbc\xe2"
+    "\xa5\x88\xe2\x8b\xb5\xe2\xa4\x9f\xe2\xa5\xb3\xe2\xa6\x8f\xe2\xa6\x8d\xe2\xa5\xa7\xe2\xaa\x81\xe2"
+    "\xa8\xb4\xe2\xa9\xbb\xe2\xa5\xa6\xe2\xa8\xaa\xe2\x8b\xb7\xe2\x8b\xb6\xe2\x8b\xbe\xe2\x8b\xbd\xe2"
+    "\xa8\x94\xe2\x8b\xa2\xe2\x8b\xa3\xe2\xa7\x9e\xe2\x8a\xb4\xe2\x83\x92\xe2\x8a\xb5\xe2\x83\x92\xe2"
+    "\xa6\xbb\xce\xbf\xe2\xa9\x97\xe2\x80\xb1\xe2\x84\x8e\xe2\xa8\xa2\xe2\xa8\xa6\xe2\xa8\xa7\xe2\xa8"
+    "\x96\xe2\xa4\xa0\xe2\xa5\xb4\xe2\xa6\x8e\xe2\xa6\x90\xe2\xa5\xa9\xe2\xa8\xb5\xe2\xa5\xa8\xe2\xa8"
+    "\xa4\xe2\xa5\xb2\xe2\xab\x83\xe2\xab\x81\xe2\xaa\xbf\xe2\xa5\xb9\xe2\xab\x98\xe2\xab\x84\xe2\x9f"
+    "\x89\xe2\xab\x97\xe2\xa5\xbb\xe2\xab\x82\xe2\xab\x80\xe2\xab\x9a\xe2\xa8\xb9\xe2\xa8\xbb\xe2\xa6"
+    "\xa7\xe2\xa6\x9a\xe2\x87\x9d\xe2\xa4\x91\xe2\xaa\xa1\xe2\xa5\x89\xe2\xa9\x98\xe2\xa6\xa8\xe2\xa6"
+    "\xa9\xe2\xa6\xaa\xe2\xa6\xab\xe2\xa6\xac\xe2\xa6\xad\xe2\xa6\xae\xe2\xa6\xaf\xe2\xa6\x9d\xe2\x88"
+    "\xb3\xe2\x8e\xb6\xe2\x9f\x88\xe2\xa9\x89\xe2\xa8\x90\xe2\xa9\x88\xe2\x88\xb2\xe2\x9f\xbf\xe2\x8f"
+    "\xa7\xe2\xa7\xa5\xe2\xa8\x8d\xe2\xaa\x84\xe2\xa7\x9d\xe2\xa8\x97\xe2\xa6\xb4\xe2\xa5\x8b\xe2\xaa"
+    "\x83\xe2\xa5\x8a\xe2\x86\xa5\xe2\xa9\xad\xcc\xb8\xe2\x8b\xb5\xcc\xb8\xe2\xa8\xb6\xe2\xa8\xa3\xe2"
+    "\xa8\x95\xe2\x8c\xae\xe2\x8c\x92\xe2\x8c\x93\xe2\xa6\xb3\xe2\xa8\x92\xe2\xa7\x8e\xe2\xa8\x93\xe2"
+    "\xa7\xa4\xe2\xa8\xb1\xe2\xa8\xba\xe2\x8f\xa2\xcc\x91\xe2\x89\xad\xe2\x8f\x9e\xe2\x81\x9f\xe2\x80"
+    "\x8a\xe2\x8f\x9f\xe2\xa4\x92\xe2\x86\xa7\xe2\x86\xa4\xe2\x81\x9f\xe2\xa7\xb4\xe2\xa4\x93\xe2\xa5"
+    "\xb0\xe2\xa5\x9a\xe2\xa5\x92\xe2\xaa\xa2\xe2\xa5\x9b\xe2\xa5\x93\xe2\x80\x8b\xe2\xa5\x8e\xe2\xa7"
+    "\x8f\xe2\xa5\xa0\xe2\xa5\x98\xe2\x8a\x8f\xcc\xb8\xe2\x8f\x9c\xe2\x97\xbb\xe2\xa5\x91\xe2\x89\xbf"
+    "\xcc\xb8\xe2\xa7\x90\xe2\xa5\x9c\xe2\xa5\x94\xe2\x8f\x9d\xe2\xa5\x9e\xe2\xa5\x96\xe2\x97\xbc\xe2"
+    "\xa5\xa1\xe2\xa5\x99\xe2\xaa\xa1\xcc\xb8\xe2\x8a\x90\xcc\xb8\xe2\xa5\x8f\xe2\x9d\x98\xe2\xa5\x9f"
+    "\xe2\xa5\x97\xe2\xa7\x8f\xcc\xb8\xe2\xa5\x9d\xe2\xa5\x95\xe2\xa5\x90\xe2\xa7\x90\xcc\xb8\xe2\x96"
+    "\xab\xe2\xaa\xa2\xcc\xb8"
+    ;
+
+#endif
@@ -2,33 +2,61 @@
 #define MODELS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "re2_wrapper.h"
 
+#define MAX_PATTERNS 128
+// Every rule can hit once per location (url, headers, body)
+#define MAX_DETECTIONS (MAX_PATTERNS * 3)
 
 // ---------------- STRUCTS ----------------
 
+// Where a finding was made, the values are the location codes of the binary protocol
+typedef enum {
+    LOCATION_URL = 0,
+    LOCATION_HEADERS = 1,
+    LOCATION_BODY = 2,
+} location_t;
+
+#define LOCATION_COUNT 3
+
+// One value the rules run on - the url, a header, a body parameter, or a whole body
+typedef struct {
+    location_t location;
+    const char *name;   // Header or parameter name, NULL if the value has none
+    char *value;        // Normalized, NUL terminated
+    size_t value_len;
+} field_t;
+
 typedef struct{
     char *id;
-    char *url;
-    char *headers;
-    char *body;
+    uint32_t seq;       // Request id in the binary protocol
+    uint64_t deadline;  // stats_now_ns() time the verdict is due by, 0 - none
+    field_t *fields;    // See request-parser.h
+    size_t field_count;
 }request_t;
 
-typedef struct {
-    const char *name;
-    uint32_t codepoint;
-} Entity;
-
 typedef struct {
     const char *attack;
-    const char *location;
     const char *description;
+    int rule_id;
+    int pattern;        // Index in the ruleset
+    location_t location;
 }detection_t;
 
 typedef struct {
-    detection_t *items;
+    detection_t items[MAX_DETECTIONS];
     size_t count;
+    int score;          // Sum of the severities of the findings
+    int attack;         // Verdict, see report_is_attack()
+    // Rules already reported per location - a rule hitting several fields is one finding
+    uint64_t reported[LOCATION_COUNT][MAX_PATTERNS / 64];
+    // Deadline of the request (see request_t), the scan stops once it passed. The rules that
+    // did not run on some input are kept, a verdict with any of them is incomplete.
+    uint64_t deadline;
+    int incomplete;
+    uint64_t skipped[MAX_PATTERNS / 64];    // Bit per rule id
 }detection_report_t;
 
 typedef struct {
@@ -36,6 +64,14 @@ typedef struct {
     const char *attack;
     const char *description;
     int severity;
+    int rule_id;        // Index of the rule in the rules file
+    unsigned locations; // Bit per location_t the rule runs on
+    char **fields;      // Header / parameter names the rule is limited to, NULL - all of them
+    int field_count;
+    char **keywords;    // Optional prefilter literals, overrides the extracted ones
+    int keyword_count;
+    int detector;       // detector_t of a "detector" rule (compiled_regex NULL), 0 - a regex rule
+    int chain;          // Transform stage the rule runs on ("transforms"), 0 - the normalized input
 } CompiledRegexPattern;
 
 
@@ -1,27 +1,120 @@
 #include "re2_wrapper.h"
 #include <re2/re2.h>
+#include <re2/set.h>
+#include <re2/filtered_re2.h>
 #include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
 #include <cstring>
 #include <cstdlib>
 
 struct re2_pattern {
     RE2* regex;
     bool is_valid;
+    std::string source;
+    int64_t max_mem;
+    std::atomic<uint64_t> dfa_failures;
 };
 
+// RE2::Match falls back to the NFA on its own when the DFA runs out of memory, the only
+// sign of it is the DFASearchFailure hook. Not every RE2 build exports the hooks (shared
+// libraries of older versions do not), so the setter is a weak reference - without it the
+// failures are not counted. Mach-O has weak imports instead of ELF's weak undefined symbols;
+// the library linked against must export the setter (Homebrew's does), at run time a library
+// without it leaves the reference null.
+#if defined(__ELF__) || defined(__APPLE__)
+#if defined(__APPLE__)
+#define RE2_WEAK_REFERENCE __attribute__((weak_import))
+#else
+#define RE2_WEAK_REFERENCE __attribute__((weak))
+#endif
+namespace re2 {
+namespace hooks {
+void SetDFASearchFailureHook(DFASearchFailureCallback* cb) RE2_WEAK_REFERENCE;
+}
+}
+#define RE2_DFA_HOOK_AVAILABLE() (&re2::hooks::SetDFASearchFailureHook != nullptr)
+#else
+#define RE2_DFA_HOOK_AVAILABLE() false
+#endif
+
+// Pattern of the re2_matches() call in progress on this thread
+static thread_local re2_pattern_t* matching = nullptr;
+static std::once_flag hook_once;
+static bool hook_installed = false;
+
+static void on_dfa_failure(const re2::hooks::DFASearchFailure&) {
+    if (matching) matching->dfa_failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void install_dfa_hook() {
+    std::call_once(hook_once, [] {
+#if defined(__ELF__) || defined(__APPLE__)
+        if (RE2_DFA_HOOK_AVAILABLE()) {
+            re2::hooks::SetDFASearchFailureHook(on_dfa_failure);
+            hook_installed = true;
+        }
+#endif
+    });
+}
+
+struct re2_set {
+    RE2::Set* set;
+    bool is_compiled;
+};
+
+struct re2_filter {
+    re2::FilteredRE2* filter;
+    std::vector<std::string> atoms;
+    bool is_compiled;
+};
+
+static RE2::Options to_re2_options(const re2_options_t* options) {
+    RE2::Options re2_options;
+    if (options->max_mem > 0) re2_options.set_max_mem(options->max_mem);
+    re2_options.set_never_capture(options->never_capture);
+    re2_options.set_longest_match(options->longest_match);
+    re2_options.set_literal(options->literal);
+    if (options->latin1) re2_options.set_encoding(RE2::Options::EncodingLatin1);
+    return re2_options;
+}
+
 extern "C" {
 
+void re2_options_init(re2_options_t* options) {
+    if (!options) return;
+
+    RE2::Options defaults;
+    options->max_mem = defaults.max_mem();
+    options->never_capture = defaults.never_capture();
+    options->longest_match = defaults.longest_match();
+    options->literal = defaults.literal();
+    options->latin1 = defaults.encoding() == RE2::Options::EncodingLatin1;
+}
+
 re2_pattern_t* re2_compile(const char* pattern) {
+    return re2_compile_options(pattern, nullptr);
+}
+
+re2_pattern_t* re2_compile_options(const char* pattern, const re2_options_t* options) {
     if (!pattern) return nullptr;
-    
+
+    re2_options_t defaults;
+    if (!options) {
+        re2_options_init(&defaults);
+        options = &defaults;
+    }
+    RE2::Options re2_options = to_re2_options(options);
+
     re2_pattern_t* p = new re2_pattern_t;
-    p->regex = new RE2(pattern);
+    p->regex = new RE2(pattern, re2_options);
     p->is_valid = p->regex->ok();
-    
-    if (!p->is_valid) {
-        return p;
-    }
-    
+    p->source = options->literal ? RE2::QuoteMeta(pattern) : std::string(pattern);
+    p->max_mem = re2_options.max_mem();
+    p->dfa_failures = 0;
+
+    install_dfa_hook();
     return p;
 }
 
@@ -36,23 +129,39 @@ int re2_is_valid(re2_pattern_t* pattern) {
     return (pattern && pattern->is_valid) ? 1 : 0;
 }
 
+const char* re2_pattern_string(re2_pattern_t* pattern) {
+    if (!pattern) return nullptr;
+
+    return pattern->source.c_str();
+}
+
+void re2_pattern_info(re2_pattern_t* pattern, re2_pattern_info_t* info) {
+    if (!info) return;
+
+    memset(info, 0, sizeof(*info));
+    if (!pattern || !pattern->is_valid) return;
+
+    // The reverse program is compiled on demand, asking for its size would build it
+    info->program_size = pattern->regex->ProgramSize();
+    info->max_mem = pattern->max_mem;
+    info->dfa_failures = hook_installed ? (int64_t)pattern->dfa_failures.load(std::memory_order_relaxed) : -1;
+}
+
 int re2_match(re2_pattern_t* pattern, const char* text) {
     if (!pattern || !pattern->is_valid || !text) return 0;
     
     return RE2::FullMatch(text, *pattern->regex) ? 1 : 0;
 }
 
-int re2_find(re2_pattern_t* pattern, const char* text, int* start, int* end) {
+int re2_find(re2_pattern_t* pattern, const char* text, size_t len, int* start, int* end) {
     if (!pattern || !pattern->is_valid || !text || !start || !end) return 0;
     
-    re2::StringPiece input(text);
+    // Whole-match span (submatch 0) - works for patterns without capture groups too
+    re2::StringPiece input(text, len);
     re2::StringPiece match;
     
-    if (RE2::FindAndConsume(&input, *pattern->regex, &match)) {
-        size_t original_len = strlen(text);
-        size_t remaining_len = input.size();
-        
-        *start = original_len - remaining_len - match.size();
+    if (pattern->regex->Match(input, 0, input.size(), RE2::UNANCHORED, &match, 1)) {
+        *start = match.data() - input.data();
         *end = *start + match.size();
         return 1;
     }
@@ -60,6 +169,17 @@ int re2_find(re2_pattern_t* pattern, const char* text, int* start, int* end) {
     return 0;
 }
 
+int re2_matches(re2_pattern_t* pattern, const char* text, size_t len) {
+    if (!pattern || !pattern->is_valid || !text) return 0;
+
+    // No submatches - the forward DFA alone answers, no reverse pass for the match bounds
+    re2::StringPiece input(text, len);
+    matching = pattern;
+    bool found = pattern->regex->Match(input, 0, input.size(), RE2::UNANCHORED, nullptr, 0);
+    matching = nullptr;
+    return found ? 1 : 0;
+}
+
 char* re2_replace(re2_pattern_t* pattern, const char* text, const char* replacement) {
     if (!pattern || !pattern->is_valid || !text || !replacement) return nullptr;
     
@@ -77,4 +197,114 @@ char* re2_replace(re2_pattern_t* pattern, const char* text, const char* replacem
     return c_result;
 }
 
-}
\ No newline at end of file
+re2_set_t* re2_set_new(void) {
+    return re2_set_new_options(nullptr);
+}
+
+re2_set_t* re2_set_new_options(const re2_options_t* options) {
+    re2_options_t defaults;
+    if (!options) {
+        re2_options_init(&defaults);
+        defaults.max_mem = RE2_SET_MAX_MEM;
+        options = &defaults;
+    }
+
+    re2_set_t* s = new re2_set_t;
+    s->set = new RE2::Set(to_re2_options(options), RE2::UNANCHORED);
+    s->is_compiled = false;
+    return s;
+}
+
+void re2_set_free(re2_set_t* set) {
+    if (set) {
+        delete set->set;
+        delete set;
+    }
+}
+
+int re2_set_add(re2_set_t* set, const char* pattern) {
+    if (!set || set->is_compiled || !pattern) return -1;
+
+    return set->set->Add(pattern, nullptr);
+}
+
+int re2_set_compile(re2_set_t* set) {
+    if (!set || set->is_compiled) return 0;
+
+    set->is_compiled = set->set->Compile();
+    return set->is_compiled ? 1 : 0;
+}
+
+int re2_set_match(re2_set_t* set, const char* text, size_t len, int* ids, int max_ids) {
+    if (!set || !set->is_compiled || !text || !ids) return -1;
+
+    std::vector<int> matches;
+    RE2::Set::ErrorInfo error;
+
+    if (!set->set->Match(re2::StringPiece(text, len), &matches, &error)) {
+        return error.kind == RE2::Set::kNoError ? 0 : -1;
+    }
+
+    int count = 0;
+    for (int id : matches) {
+        if (count == max_ids) break;
+        ids[count++] = id;
+    }
+    return count;
+}
+
+re2_filter_t* re2_filter_new(int min_atom_len) {
+    re2_filter_t* f = new re2_filter_t;
+    f->filter = new re2::FilteredRE2(min_atom_len);
+    f->is_compiled = false;
+    return f;
+}
+
+void re2_filter_free(re2_filter_t* filter) {
+    if (filter) {
+        delete filter->filter;
+        delete filter;
+    }
+}
+
+int re2_filter_add(re2_filter_t* filter, const char* pattern) {
+    if (!filter || filter->is_compiled || !pattern) return -1;
+
+    RE2::Options options;
+    options.set_log_errors(false);
+
+    int id = -1;
+    if (filter->filter->Add(pattern, options, &id) != RE2::NoError) return -1;
+    return id;
+}
+
+int re2_filter_compile(re2_filter_t* filter) {
+    if (!filter || filter->is_compiled) return -1;
+
+    filter->filter->Compile(&filter->atoms);
+    filter->is_compiled = true;
+    return (int)filter->atoms.size();
+}
+
+const char* re2_filter_atom(re2_filter_t* filter, int index) {
+    if (!filter || index < 0 || index >= (int)filter->atoms.size()) return nullptr;
+
+    return filter->atoms[index].c_str();
+}
+
+int re2_filter_candidates(re2_filter_t* filter, const int* atoms, int atom_count, int* ids, int max_ids) {
+    if (!filter || !filter->is_compiled || !ids) return 0;
+
+    std::vector<int> matched_atoms(atoms, atoms + atom_count);
+    std::vector<int> potentials;
+    filter->filter->AllPotentials(matched_atoms, &potentials);
+
+    int count = 0;
+    for (int id : potentials) {
+        if (count == max_ids) break;
+        ids[count++] = id;
+    }
+    return count;
+}
+
+}
@@ -2,21 +2,55 @@
 #ifndef RE2_WRAPPER_H
 #define RE2_WRAPPER_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct re2_pattern re2_pattern_t;
+typedef struct re2_set re2_set_t;
+typedef struct re2_filter re2_filter_t;
+
+// Default max_mem of a set - its DFA holds all patterns at once
+#define RE2_SET_MAX_MEM (64 << 20)
+
+// Compile options, see RE2::Options. re2_options_init() fills in the RE2 defaults.
+typedef struct {
+    int64_t max_mem;        // Budget of the compiled programs and their DFA caches, in bytes
+    int never_capture;      // Parentheses do not capture - nothing is extracted anyway
+    int longest_match;      // Leftmost-longest instead of leftmost-first
+    int literal;            // The pattern is a plain string, not a regular expression
+    int latin1;             // Pattern and text are Latin-1 instead of UTF-8
+} re2_options_t;
+
+// What a compiled pattern costs and how its DFA did
+typedef struct {
+    int program_size;           // Instructions of the forward program
+    int64_t max_mem;            // Budget it was compiled with
+    int64_t dfa_failures;       // re2_matches() calls the DFA gave up on (out of memory),
+                                // -1 if the RE2 build does not report them
+} re2_pattern_info_t;
+
+void re2_options_init(re2_options_t* options);
 
 // Kreira novi regex pattern
 re2_pattern_t* re2_compile(const char* pattern);
+// NULL options - the defaults
+re2_pattern_t* re2_compile_options(const char* pattern, const re2_options_t* options);
 
 // Oslobađa memoriju
 void re2_free(re2_pattern_t* pattern);
 
 // Match funkcije
 int re2_match(re2_pattern_t* pattern, const char* text);
-int re2_find(re2_pattern_t* pattern, const char* text, int* start, int* end);
+// Searches text[0, len) - the text does not have to be NUL terminated
+int re2_find(re2_pattern_t* pattern, const char* text, size_t len, int* start, int* end);
+// Whether the pattern matches anywhere in text[0, len). Nothing is extracted, so the search
+// stays on the DFA and stops at the first match. If the DFA runs out of memory RE2 repeats
+// the search on the slower engines, see dfa_failures.
+int re2_matches(re2_pattern_t* pattern, const char* text, size_t len);
 
 // Replace funkcija
 char* re2_replace(re2_pattern_t* pattern, const char* text, const char* replacement);
@@ -24,6 +58,39 @@ char* re2_replace(re2_pattern_t* pattern, const char* text, const char* replacem
 // Provjera da li je pattern validan
 int re2_is_valid(re2_pattern_t* pattern);
 
+// Source text of the compiled pattern, as a regular expression (a literal pattern is quoted)
+const char* re2_pattern_string(re2_pattern_t* pattern);
+void re2_pattern_info(re2_pattern_t* pattern, re2_pattern_info_t* info);
+
+// Multi-pattern set - all patterns are matched in a single pass over the text
+re2_set_t* re2_set_new(void);
+// NULL options - the defaults with a larger max_mem, the set DFA holds all patterns at once
+re2_set_t* re2_set_new_options(const re2_options_t* options);
+void re2_set_free(re2_set_t* set);
+
+// Adds a pattern, returns its index in the set or -1 if it cannot be parsed
+int re2_set_add(re2_set_t* set, const char* pattern);
+int re2_set_compile(re2_set_t* set);
+
+// Fills ids with indices of matching patterns (unsorted), returns their count
+// or -1 if the set could not be evaluated (not compiled, DFA out of memory)
+int re2_set_match(re2_set_t* set, const char* text, size_t len, int* ids, int max_ids);
+
+// Literal prefilter (FilteredRE2) - extracts the literal atoms each pattern depends on
+re2_filter_t* re2_filter_new(int min_atom_len);
+void re2_filter_free(re2_filter_t* filter);
+
+// Adds a pattern, returns its index in the filter or -1 if it cannot be parsed
+int re2_filter_add(re2_filter_t* filter, const char* pattern);
+
+// Returns the number of lowercase atoms to search for, or -1 on error
+int re2_filter_compile(re2_filter_t* filter);
+const char* re2_filter_atom(re2_filter_t* filter, int index);
+
+// Given the indices of atoms found in the (lowercased) text, fills ids with
+// patterns that may match - patterns without atoms are always included
+int re2_filter_candidates(re2_filter_t* filter, const int* atoms, int atom_count, int* ids, int max_ids);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,457 @@
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+
+#include "request-parser.h"
+#include "html-decoder.h"
+
+#define FIELDS_INITIAL 8
+// Longer boundaries are not valid (RFC 2046 allows 70 characters)
+#define MULTIPART_BOUNDARY_MAX 200
+// Deeper JSON documents are inspected as a whole
+#define JSON_MAX_DEPTH 64
+
+typedef struct {
+    request_t *req;
+    size_t capacity;
+    arena_t *arena;
+} field_list_t;
+
+// Single pass over a JSON document, strings are emitted as fields without building a tree
+typedef struct {
+    const char *p;
+    const char *end;
+    field_list_t *list;
+    location_t location;
+    const char **content_type;  // Headers only
+} json_scanner_t;
+
+static int add_field(field_list_t *list, location_t location, const char *name, size_t name_len,
+                     const char *value, size_t value_len);
+static int add_header_fields(field_list_t *list, const char *headers, size_t headers_len, const char **content_type);
+static int add_json_fields(field_list_t *list, const char *body, size_t body_len);
+static int json_value(json_scanner_t *s, const char *name, size_t name_len, int depth);
+static int json_string(json_scanner_t *s, const char **out, size_t *out_len);
+static void json_skip_space(json_scanner_t *s);
+static int add_urlencoded_fields(field_list_t *list, const char *body, size_t body_len);
+static int add_multipart_fields(field_list_t *list, const char *body, size_t body_len, const char *content_type);
+static int is_binary_type(const char *type, size_t len);
+static const char *find_bytes(const char *haystack, size_t len, const char *needle, size_t needle_len);
+static const char *find_ci(const char *haystack, size_t len, const char *needle);
+static const char *header_param(const char *header, size_t len, const char *param, size_t *out_len);
+
+int parse_request_fields(request_t *req, const char *url, size_t url_len, const char *headers,
+                         size_t headers_len, const char *body, size_t body_len, arena_t *arena) {
+    field_list_t list = { req, FIELDS_INITIAL, arena };
+    req->field_count = 0;
+    req->fields = arena_alloc(arena, FIELDS_INITIAL * sizeof(field_t));
+    if (!req->fields) return 0;
+
+    if (url && !add_field(&list, LOCATION_URL, NULL, 0, url, url_len)) return 0;
+
+    const char *content_type = NULL;
+    if (headers) {
+        size_t before = req->field_count;
+        if (!add_header_fields(&list, headers, headers_len, &content_type)) {
+            // Not a JSON object (or too many headers) - inspected as a whole, like before
+            req->field_count = before;
+            content_type = NULL;
+            if (!add_field(&list, LOCATION_HEADERS, NULL, 0, headers, headers_len)) return 0;
+        }
+    }
+
+    if (body && body_len) {
+        size_t before = req->field_count;
+        int parsed = 0;
+
+        if (content_type) {
+            size_t type_len = strlen(content_type);
+            if (find_ci(content_type, type_len, "json")) {
+                parsed = add_json_fields(&list, body, body_len);
+            } else if (find_ci(content_type, type_len, "application/x-www-form-urlencoded")) {
+                parsed = add_urlencoded_fields(&list, body, body_len);
+            } else if (find_ci(content_type, type_len, "multipart/form-data")) {
+                parsed = add_multipart_fields(&list, body, body_len, content_type);
+            }
+        }
+
+        if (!parsed) {
+            req->field_count = before;
+            if (!add_field(&list, LOCATION_BODY, NULL, 0, body, body_len)) return 0;
+        }
+    }
+    return 1;
+}
+
+// Name and value are normalized like every other input, empty values are not inspected
+static int add_field(field_list_t *list, location_t location, const char *name, size_t name_len,
+                     const char *value, size_t value_len) {
+    request_t *req = list->req;
+    if (value_len == 0) return 1;
+
+    if (req->field_count == list->capacity) {
+        if (list->capacity >= FIELDS_MAX) return 0;
+        size_t capacity = list->capacity * 2;
+        req->fields = arena_grow(list->arena, req->fields, list->capacity * sizeof(field_t),
+                                 capacity * sizeof(field_t));
+        if (!req->fields) return 0;
+        list->capacity = capacity;
+    }
+
+    field_t *field = &req->fields[req->field_count];
+    field->location = location;
+    field->name = NULL;
+
+    if (name) {
+        char *normalized = arena_alloc(list->arena, NORMALIZED_SIZE(name_len));
+        if (!normalized) return 0;
+        normalize_into(name, name_len, normalized, NORMALIZED_SIZE(name_len));
+        field->name = normalized;
+    }
+
+    field->value = arena_alloc(list->arena, NORMALIZED_SIZE(value_len));
+    if (!field->value) return 0;
+    field->value_len = normalize_into(value, value_len, field->value, NORMALIZED_SIZE(value_len));
+
+    req->field_count++;
+    return 1;
+}
+
+// {"name": "value", ...} as sent by the proxy. The content type is copied for the body parser.
+static int add_header_fields(field_list_t *list, const char *headers, size_t headers_len, const char **content_type) {
+    json_scanner_t s = { headers, headers + headers_len, list, LOCATION_HEADERS, content_type };
+
+    json_skip_space(&s);
+    if (s.p == s.end || *s.p != '{' || !json_value(&s, NULL, 0, 0)) return 0;
+
+    json_skip_space(&s);
+    return s.p == s.end;
+}
+
+// Every string in the document, named by the key it belongs to (array items by the array's key)
+static int add_json_fields(field_list_t *list, const char *body, size_t body_len) {
+    json_scanner_t s = { body, body + body_len, list, LOCATION_BODY, NULL };
+
+    json_skip_space(&s);
+    if (s.p == s.end || (*s.p != '{' && *s.p != '[') || !json_value(&s, NULL, 0, 0)) return 0;
+
+    json_skip_space(&s);
+    return s.p == s.end;
+}
+
+static int json_value(json_scanner_t *s, const char *name, size_t name_len, int depth) {
+    json_skip_space(s);
+    if (s->p == s->end || depth > JSON_MAX_DEPTH) return 0;
+
+    char c = *s->p;
+    if (c == '{') {
+        s->p++;
+        json_skip_space(s);
+        if (s->p < s->end && *s->p == '}') {
+            s->p++;
+            return 1;
+        }
+
+        for (;;) {
+            const char *key;
+            size_t key_len;
+
+            json_skip_space(s);
+            if (!json_string(s, &key, &key_len)) return 0;
+            json_skip_space(s);
+            if (s->p == s->end || *s->p++ != ':') return 0;
+
+            // Body keys are user input as well, header names are not
+            if (s->location == LOCATION_BODY && !add_field(s->list, LOCATION_BODY, NULL, 0, key, key_len)) return 0;
+            if (!json_value(s, key, key_len, depth + 1)) return 0;
+
+            json_skip_space(s);
+            if (s->p == s->end) return 0;
+            if (*s->p == '}') {
+                s->p++;
+                return 1;
+            }
+            if (*s->p++ != ',') return 0;
+        }
+    }
+
+    if (c == '[') {
+        s->p++;
+        json_skip_space(s);
+        if (s->p < s->end && *s->p == ']') {
+            s->p++;
+            return 1;
+        }
+
+        for (;;) {
+            if (!json_value(s, name, name_len, depth + 1)) return 0;
+
+            json_skip_space(s);
+            if (s->p == s->end) return 0;
+            if (*s->p == ']') {
+                s->p++;
+                return 1;
+            }
+            if (*s->p++ != ',') return 0;
+        }
+    }
+
+    if (c == '"') {
+        const char *value;
+        size_t value_len;
+        if (!json_string(s, &value, &value_len)) return 0;
+
+        if (s->content_type && name && name_len == 12 && strncasecmp(name, "content-type", 12) == 0) {
+            *s->content_type = arena_strndup(s->list->arena, value, value_len);
+        }
+        return add_field(s->list, s->location, name, name_len, value, value_len);
+    }
+
+    // Numbers, true, false and null carry no payload
+    const char *start = s->p;
+    while (s->p < s->end && (*s->p == '-' || *s->p == '+' || *s->p == '.' ||
+                             (*s->p >= '0' && *s->p <= '9') || (*s->p >= 'a' && *s->p <= 'z') ||
+                             *s->p == 'E')) {
+        s->p++;
+    }
+    return s->p > start;
+}
+
+// Points into the document if the string has no escapes, otherwise decodes into the arena
+static int json_string(json_scanner_t *s, const char **out, size_t *out_len) {
+    if (s->p == s->end || *s->p != '"') return 0;
+    const char *start = ++s->p;
+
+    const char *quote = start;
+    int escaped = 0;
+    while (quote < s->end && *quote != '"') {
+        if (*quote == '\\') {
+            escaped = 1;
+            quote++;
+        }
+        quote++;
+    }
+    if (quote >= s->end) return 0;
+    s->p = quote + 1;
+
+    if (!escaped) {
+        *out = start;
+        *out_len = quote - start;
+        return 1;
+    }
+
+    // Decoding never grows the string (\uXXXX takes 6 bytes, its UTF-8 at most 4)
+    char *dst = arena_alloc(s->list->arena, quote - start);
+    if (!dst) return 0;
+
+    size_t j = 0;
+    for (const char *p = start; p < quote; p++) {
+        if (*p != '\\') {
+            dst[j++] = *p;
+            continue;
+        }
+
+        p++;
+        switch (*p) {
+            case 'b': dst[j++] = '\b'; break;
+            case 'f': dst[j++] = '\f'; break;
+            case 'n': dst[j++] = '\n'; break;
+            case 'r': dst[j++] = '\r'; break;
+            case 't': dst[j++] = '\t'; break;
+            case 'u': {
+                uint32_t cp = 0;
+                if (quote - p < 5) return 0;
+                for (int k = 1; k <= 4; k++) {
+                    char h = p[k];
+                    int v = h >= '0' && h <= '9' ? h - '0' :
+                            h >= 'a' && h <= 'f' ? h - 'a' + 10 :
+                            h >= 'A' && h <= 'F' ? h - 'A' + 10 : -1;
+                    if (v < 0) return 0;
+                    cp = cp << 4 | (uint32_t)v;
+                }
+                p += 4;
+
+                // Surrogate halves are not combined, they still show up as bytes
+                if (cp < 0x80) {
+                    dst[j++] = (char)cp;
+                } else if (cp < 0x800) {
+                    dst[j++] = (char)(0xC0 | (cp >> 6));
+                    dst[j++] = (char)(0x80 | (cp & 0x3F));
+                } else {
+                    dst[j++] = (char)(0xE0 | (cp >> 12));
+                    dst[j++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                    dst[j++] = (char)(0x80 | (cp & 0x3F));
+                }
+                break;
+            }
+            default: dst[j++] = *p; break; // \" \\ \/
+        }
+    }
+
+    *out = dst;
+    *out_len = j;
+    return 1;
+}
+
+static void json_skip_space(json_scanner_t *s) {
+    while (s->p < s->end && (*s->p == ' ' || *s->p == '\t' || *s->p == '\n' || *s->p == '\r')) {
+        s->p++;
+    }
+}
+
+// name=value&name=value - escapes are decoded by the normalization of every part
+static int add_urlencoded_fields(field_list_t *list, const char *body, size_t body_len) {
+    const char *p = body;
+    const char *end = body + body_len;
+
+    while (p < end) {
+        const char *amp = memchr(p, '&', end - p);
+        const char *pair_end = amp ? amp : end;
+        const char *eq = memchr(p, '=', pair_end - p);
+
+        if (eq) {
+            if (!add_field(list, LOCATION_BODY, p, eq - p, eq + 1, pair_end - eq - 1)) return 0;
+        } else if (!add_field(list, LOCATION_BODY, NULL, 0, p, pair_end - p)) {
+            return 0;
+        }
+        p = pair_end + 1;
+    }
+    return 1;
+}
+
+// Parts between "--boundary" lines, named by Content-Disposition. File names are inspected,
+// the content of binary file uploads is not.
+static int add_multipart_fields(field_list_t *list, const char *body, size_t body_len, const char *content_type) {
+    size_t boundary_len;
+    const char *boundary = header_param(content_type, strlen(content_type), "boundary", &boundary_len);
+    if (!boundary || boundary_len == 0 || boundary_len > MULTIPART_BOUNDARY_MAX) return 0;
+
+    char delimiter[MULTIPART_BOUNDARY_MAX + 2];
+    delimiter[0] = delimiter[1] = '-';
+    memcpy(delimiter + 2, boundary, boundary_len);
+    size_t delimiter_len = boundary_len + 2;
+
+    const char *end = body + body_len;
+    const char *p = find_bytes(body, body_len, delimiter, delimiter_len);
+    if (!p) return 0;
+
+    for (;;) {
+        p += delimiter_len;
+        if (end - p >= 2 && p[0] == '-' && p[1] == '-') return 1; // Closing delimiter
+
+        // Rest of the delimiter line
+        const char *line_end = memchr(p, '\n', end - p);
+        if (!line_end) return 0;
+        const char *part = line_end + 1;
+
+        // Part headers end with an empty line
+        const char *headers_end = find_bytes(part, end - part, "\r\n\r\n", 4);
+        size_t separator_len = 4;
+        if (!headers_end) {
+            headers_end = find_bytes(part, end - part, "\n\n", 2);
+            separator_len = 2;
+        }
+        if (!headers_end) return 0;
+
+        const char *content = headers_end + separator_len;
+        const char *next = find_bytes(content, end - content, delimiter, delimiter_len);
+        if (!next) return 0;
+
+        const char *content_end = next;
+        if (content_end > content && content_end[-1] == '\n') content_end--;
+        if (content_end > content && content_end[-1] == '\r') content_end--;
+
+        const char *name = NULL, *filename = NULL;
+        size_t name_len = 0, filename_len = 0;
+        int binary = 0;
+
+        for (const char *line = part; line < headers_end; ) {
+            const char *eol = memchr(line, '\n', headers_end - line);
+            size_t len = (eol ? eol : headers_end) - line;
+
+            if (len > 20 && strncasecmp(line, "content-disposition:", 20) == 0) {
+                name = header_param(line, len, "name", &name_len);
+                filename = header_param(line, len, "filename", &filename_len);
+            } else if (len > 13 && strncasecmp(line, "content-type:", 13) == 0) {
+                const char *type = line + 13;
+                while (type < line + len && *type == ' ') type++;
+                binary = is_binary_type(type, line + len - type);
+            }
+            line += len + 1;
+        }
+
+        // Without a file name the part is a form field whatever its type says, only uploaded
+        // files are left unscanned
+        if (filename && !add_field(list, LOCATION_BODY, name, name_len, filename, filename_len)) return 0;
+        if (!(filename && binary) && !add_field(list, LOCATION_BODY, name, name_len, content, content_end - content)) {
+            return 0;
+        }
+
+        p = next;
+    }
+}
+
+// Same types the proxy does not send for analysis at all
+static int is_binary_type(const char *type, size_t len) {
+    static const char *binary_types[] = { "image/", "video/", "audio/", "application/octet-stream" };
+
+    for (size_t i = 0; i < sizeof(binary_types) / sizeof(binary_types[0]); i++) {
+        size_t prefix = strlen(binary_types[i]);
+        if (len >= prefix && strncasecmp(type, binary_types[i], prefix) == 0) return 1;
+    }
+    return 0;
+}
+
+static const char *find_bytes(const char *haystack, size_t len, const char *needle, size_t needle_len) {
+    if (needle_len == 0 || len < needle_len) return NULL;
+
+    const char *last = haystack + len - needle_len;
+    for (const char *p = haystack; p <= last; p++) {
+        p = memchr(p, needle[0], last - p + 1);
+        if (!p) return NULL;
+        if (memcmp(p, needle, needle_len) == 0) return p;
+    }
+    return NULL;
+}
+
+static const char *find_ci(const char *haystack, size_t len, const char *needle) {
+    size_t needle_len = strlen(needle);
+
+    for (size_t i = 0; i + needle_len <= len; i++) {
+        if (strncasecmp(haystack + i, needle, needle_len) == 0) return haystack + i;
+    }
+    return NULL;
+}
+
+// Value of a `param=value` or `param="value"` attribute of a header, NULL if it is missing
+static const char *header_param(const char *header, size_t len, const char *param, size_t *out_len) {
+    size_t param_len = strlen(param);
+    const char *end = header + len;
+
+    for (const char *p = header; p + param_len < end; p++) {
+        p = find_ci(p, end - p, param);
+        if (!p || p + param_len >= end) return NULL;
+
+        // Whole attribute name only - "name" must not match inside "filename"
+        int starts = p == header || p[-1] == ';' || p[-1] == ' ' || p[-1] == '\t';
+        if (!starts || p[param_len] != '=') continue;
+
+        const char *value = p + param_len + 1;
+        const char *value_end;
+        if (value < end && *value == '"') {
+            value++;
+            value_end = memchr(value, '"', end - value);
+            if (!value_end) return NULL;
+        } else {
+            value_end = value;
+            while (value_end < end && *value_end != ';' && *value_end != ' ' &&
+                   *value_end != '\r' && *value_end != '\n') {
+                value_end++;
+            }
+        }
+
+        *out_len = value_end - value;
+        return value;
+    }
+    return NULL;
+}
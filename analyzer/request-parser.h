@@ -0,0 +1,22 @@
+#ifndef REQUEST_PARSER
+#define REQUEST_PARSER
+
+#include <stddef.h>
+
+#include "models.h"
+#include "arena.h"
+
+// Upper bound for the fields of one request. A body or header block that would go
+// above it is inspected as a whole instead.
+#define FIELDS_MAX 512
+
+// Splits a request into the fields the rules run on, every value normalized into the arena:
+//  - the url as a whole
+//  - headers one by one (the proxy sends them as a JSON object), named by the header
+//  - the body by its content type: JSON values, urlencoded and multipart parameters,
+//    named by their key. Other types, and bodies that do not parse, stay one field.
+// Returns 0 if the arena ran out of memory.
+int parse_request_fields(request_t *req, const char *url, size_t url_len, const char *headers,
+                         size_t headers_len, const char *body, size_t body_len, arena_t *arena);
+
+#endif
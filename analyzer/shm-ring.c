@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "shm-ring.h"
+
+// Files of the rings proxy/shm-ring.js creates: waf-ring-<pid>-<connection>
+#define SHM_RING_PREFIX "waf-ring-"
+
+static int ring_name_valid(const char *path);
+
+int shm_ring_attach(shm_ring_t *ring, const char *path, size_t size) {
+    shm_ring_detach(ring);
+    if (size == 0) return 0;
+
+    // The path comes from the peer - only a ring file the proxy (running as this user) made
+    // is mapped, never a link, a device or a file someone else owns
+    if (!ring_name_valid(path)) {
+        fprintf(stderr, "shm ring %s is not a ring file\n", path);
+        return 0;
+    }
+    int fd = open(path, O_RDONLY | O_NOFOLLOW | O_NONBLOCK);
+    if (fd < 0) {
+        perror("shm ring open failed");
+        return 0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_uid != geteuid()) {
+        fprintf(stderr, "shm ring %s is not a regular file of this user\n", path);
+        close(fd);
+        return 0;
+    }
+    if ((size_t)st.st_size < size) {
+        fprintf(stderr, "shm ring %s is smaller than %zu bytes\n", path, size);
+        close(fd);
+        return 0;
+    }
+
+    void *base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file alive, the proxy may unlink it now
+    if (base == MAP_FAILED) {
+        perror("shm ring mmap failed");
+        return 0;
+    }
+
+    ring->base = base;
+    ring->size = size;
+    return 1;
+}
+
+void shm_ring_detach(shm_ring_t *ring) {
+    if (ring->base) {
+        munmap((void *)ring->base, ring->size);
+    }
+    ring->base = NULL;
+    ring->size = 0;
+}
+
+const char *shm_ring_slice(const shm_ring_t *ring, uint32_t offset, uint32_t len) {
+    if (!ring || !ring->base) return NULL;
+    if (offset > ring->size || len > ring->size - offset) return NULL;
+    return ring->base + offset;
+}
+
+// SHM_RING_PREFIX, the pid and a dash at the start of the file name
+static int ring_name_valid(const char *path) {
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    if (strncmp(name, SHM_RING_PREFIX, strlen(SHM_RING_PREFIX)) != 0) return 0;
+
+    const char *p = name + strlen(SHM_RING_PREFIX);
+    if (!isdigit((unsigned char)*p)) return 0;
+    while (isdigit((unsigned char)*p)) p++;
+    return *p == '-';
+}
@@ -0,0 +1,23 @@
+#ifndef SHM_RING
+#define SHM_RING
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Read-only view of the shared-memory ring a proxy worker writes request bodies into.
+// The proxy owns the ring (space management, file lifetime), the analyzer only maps it
+// and reads the slices named in FRAME_BATCH_SHM frames.
+
+typedef struct {
+    const char *base;
+    size_t size;
+} shm_ring_t;
+
+// Maps size bytes of the ring file at path (a waf-ring-<pid>-* file of this user), returns 0 on failure
+int shm_ring_attach(shm_ring_t *ring, const char *path, size_t size);
+void shm_ring_detach(shm_ring_t *ring);
+
+// Pointer to [offset, offset + len) of the ring, NULL if it is not mapped or out of bounds
+const char *shm_ring_slice(const shm_ring_t *ring, uint32_t offset, uint32_t len);
+
+#endif
@@ -0,0 +1,208 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// ---------------- SCALAR ----------------
+
+static size_t find_any_scalar(const char *src, size_t len, const char *set, int set_len) {
+    for (size_t i = 0; i < len; i++) {
+        for (int k = 0; k < set_len; k++) {
+            if (src[i] == set[k]) return i;
+        }
+    }
+    return len;
+}
+
+static size_t normalize_run_scalar(const char *src, size_t len, char *dst, int in_space, int stop_escapes) {
+    size_t i = 0;
+    for (; i < len; i++) {
+        unsigned char c = (unsigned char)src[i];
+        if (c < 0x20 || c == 0x7F) break;
+        if (stop_escapes && (c == '%' || c == '&')) break;
+        if (c == ' ') {
+            if (in_space) break;
+            in_space = 1;
+        } else {
+            in_space = 0;
+        }
+        dst[i] = (char)((c >= 'A' && c <= 'Z') ? c + 32 : c);
+    }
+    return i;
+}
+
+#ifdef SIMD_X86
+
+// ---------------- SSE2 ----------------
+
+static size_t find_any_sse2(const char *src, size_t len, const char *set, int set_len) {
+    __m128i needles[4];
+    for (int k = 0; k < 4; k++) {
+        needles[k] = _mm_set1_epi8(set[k < set_len ? k : 0]);
+    }
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, needles[0]), _mm_cmpeq_epi8(v, needles[1])),
+            _mm_or_si128(_mm_cmpeq_epi8(v, needles[2]), _mm_cmpeq_epi8(v, needles[3])));
+        unsigned mask = (unsigned)_mm_movemask_epi8(hit);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_any_scalar(src + i, len - i, set, set_len);
+}
+
+static size_t normalize_run_sse2(const char *src, size_t len, char *dst, int in_space, int stop_escapes) {
+    const __m128i ctrl_max = _mm_set1_epi8(0x1F);
+    const __m128i del = _mm_set1_epi8(0x7F);
+    const __m128i pct = _mm_set1_epi8('%');
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z = _mm_set1_epi8('Z' + 1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i escape_on = stop_escapes ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+
+    unsigned prev_space = in_space ? 1 : 0;
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+
+        __m128i ctrl = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(v, ctrl_max), ctrl_max),
+                                    _mm_cmpeq_epi8(v, del));
+        __m128i esc = _mm_and_si128(escape_on,
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, pct), _mm_cmpeq_epi8(v, amp)));
+        unsigned spaces = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, space));
+        unsigned stop = (unsigned)_mm_movemask_epi8(_mm_or_si128(ctrl, esc)) |
+                        (spaces & ((spaces << 1) | prev_space));
+
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, before_a), _mm_cmplt_epi8(v, after_z));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(v, _mm_and_si128(upper, case_bit)));
+
+        if (stop) return i + __builtin_ctz(stop);
+        prev_space = (spaces >> 15) & 1;
+    }
+    return i + normalize_run_scalar(src + i, len - i, dst + i, prev_space, stop_escapes);
+}
+
+// ---------------- AVX2 ----------------
+
+__attribute__((target("avx2")))
+static size_t find_any_avx2(const char *src, size_t len, const char *set, int set_len) {
+    __m256i needles[4];
+    for (int k = 0; k < 4; k++) {
+        needles[k] = _mm256_set1_epi8(set[k < set_len ? k : 0]);
+    }
+
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, needles[0]), _mm256_cmpeq_epi8(v, needles[1])),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, needles[2]), _mm256_cmpeq_epi8(v, needles[3])));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(hit);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    // The tail runs on legacy SSE encodings - with dirty upper halves every call pays the transition
+    _mm256_zeroupper();
+    return i + find_any_sse2(src + i, len - i, set, set_len);
+}
+
+__attribute__((target("avx2")))
+static size_t normalize_run_avx2(const char *src, size_t len, char *dst, int in_space, int stop_escapes) {
+    const __m256i ctrl_max = _mm256_set1_epi8(0x1F);
+    const __m256i del = _mm256_set1_epi8(0x7F);
+    const __m256i pct = _mm256_set1_epi8('%');
+    const __m256i amp = _mm256_set1_epi8('&');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i before_a = _mm256_set1_epi8('A' - 1);
+    const __m256i after_z = _mm256_set1_epi8('Z' + 1);
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i escape_on = stop_escapes ? _mm256_set1_epi8(-1) : _mm256_setzero_si256();
+
+    uint32_t prev_space = in_space ? 1 : 0;
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        __m256i ctrl = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(v, ctrl_max), ctrl_max),
+                                       _mm256_cmpeq_epi8(v, del));
+        __m256i esc = _mm256_and_si256(escape_on,
+                                       _mm256_or_si256(_mm256_cmpeq_epi8(v, pct), _mm256_cmpeq_epi8(v, amp)));
+        uint32_t spaces = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, space));
+        uint32_t stop = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(ctrl, esc)) |
+                        (spaces & ((spaces << 1) | prev_space));
+
+        __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, before_a), _mm256_cmpgt_epi8(after_z, v));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_or_si256(v, _mm256_and_si256(upper, case_bit)));
+
+        if (stop) return i + __builtin_ctz(stop);
+        prev_space = spaces >> 31;
+    }
+    _mm256_zeroupper();
+    return i + normalize_run_sse2(src + i, len - i, dst + i, prev_space, stop_escapes);
+}
+
+#endif
+
+// ---------------- DISPATCH ----------------
+
+static size_t find_any_resolve(const char *src, size_t len, const char *set, int set_len);
+static size_t normalize_run_resolve(const char *src, size_t len, char *dst, int in_space, int stop_escapes);
+
+static size_t (*find_any_impl)(const char *, size_t, const char *, int) = find_any_resolve;
+static size_t (*normalize_run_impl)(const char *, size_t, char *, int, int) = normalize_run_resolve;
+static const char *implementation = NULL;
+
+// Picks the implementations once, on the first call
+static void resolve(void) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        find_any_impl = find_any_avx2;
+        normalize_run_impl = normalize_run_avx2;
+        implementation = "avx2";
+        return;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        find_any_impl = find_any_sse2;
+        normalize_run_impl = normalize_run_sse2;
+        implementation = "sse2";
+        return;
+    }
+#endif
+    find_any_impl = find_any_scalar;
+    normalize_run_impl = normalize_run_scalar;
+    implementation = "scalar";
+}
+
+static size_t find_any_resolve(const char *src, size_t len, const char *set, int set_len) {
+    resolve();
+    return find_any_impl(src, len, set, set_len);
+}
+
+static size_t normalize_run_resolve(const char *src, size_t len, char *dst, int in_space, int stop_escapes) {
+    resolve();
+    return normalize_run_impl(src, len, dst, in_space, stop_escapes);
+}
+
+size_t simd_find_any(const char *src, size_t len, const char *set, int set_len) {
+    if (set_len <= 0) return len;
+    if (set_len > 4) set_len = 4;
+    return find_any_impl(src, len, set, set_len);
+}
+
+size_t simd_normalize_run(const char *src, size_t len, char *dst, int in_space, int stop_escapes) {
+    return normalize_run_impl(src, len, dst, in_space, stop_escapes);
+}
+
+const char *simd_implementation(void) {
+    if (!implementation) resolve();
+    return implementation;
+}
@@ -0,0 +1,23 @@
+#ifndef SIMD
+#define SIMD
+
+#include <stddef.h>
+
+// Byte-class kernels used by the normalizer. On x86 the widest available
+// instruction set (AVX2, SSE2) is picked at runtime, elsewhere a scalar
+// implementation is used.
+
+// Index of the first byte of src that is one of set[0..set_len) (set_len <= 4),
+// len if there is none
+size_t simd_find_any(const char *src, size_t len, const char *set, int set_len);
+
+// Copies src to dst lowercasing ASCII, stops before the first byte that the
+// normalizer has to look at: a control char, a space following a space
+// (in_space tells if the byte before src was one) and, with stop_escapes,
+// '%' or '&'. Returns the number of bytes copied. dst must have room for len bytes.
+size_t simd_normalize_run(const char *src, size_t len, char *dst, int in_space, int stop_escapes);
+
+// Name of the selected implementation
+const char *simd_implementation(void);
+
+#endif
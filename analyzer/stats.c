@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "stats.h"
+#include "detection.h"
+#include "verdict-cache.h"
+
+// Time of the batch phases, the queueing before a batch is measured by the proxy
+typedef struct {
+    uint64_t batches;
+    uint64_t requests;
+    uint64_t incomplete;    // Requests whose deadline passed before every rule ran
+    latency_t parse;
+    latency_t scan;
+    latency_t serialize;
+} batch_stats_t;
+
+static batch_stats_t batch_stats;
+
+void latency_record(latency_t *latency, uint64_t ns) {
+    int bucket = ns ? 64 - __builtin_clzll(ns) : 0;
+    if (bucket >= LATENCY_BUCKETS) bucket = LATENCY_BUCKETS - 1;
+
+    __atomic_add_fetch(&latency->count, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&latency->total_ns, ns, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&latency->buckets[bucket], 1, __ATOMIC_RELAXED);
+}
+
+void stats_append_latency(arena_buf_t *out, const latency_t *latency) {
+    uint64_t buckets[LATENCY_BUCKETS];
+    int used = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        buckets[b] = __atomic_load_n(&latency->buckets[b], __ATOMIC_RELAXED);
+        if (buckets[b]) used = b + 1;
+    }
+
+    arena_buf_putc(out, '{');
+    stats_append_counter(out, "count", &latency->count);
+    arena_buf_putc(out, ',');
+    stats_append_counter(out, "total_ns", &latency->total_ns);
+    arena_buf_append(out, ",\"buckets\":[", 12);
+
+    for (int b = 0; b < used; b++) {
+        char value[24];
+        int len = snprintf(value, sizeof(value), "%s%llu", b > 0 ? "," : "", (unsigned long long)buckets[b]);
+        arena_buf_append(out, value, len);
+    }
+    arena_buf_append(out, "]}", 2);
+}
+
+void stats_append_buckets(arena_buf_t *out) {
+    arena_buf_putc(out, '[');
+    for (int b = 0; b < LATENCY_BUCKETS - 1; b++) {
+        char value[24];
+        int len = snprintf(value, sizeof(value), "%s%llu", b > 0 ? "," : "", 1ULL << b);
+        arena_buf_append(out, value, len);
+    }
+    arena_buf_putc(out, ']');
+}
+
+void stats_append_counter(arena_buf_t *out, const char *name, const uint64_t *counter) {
+    char field[96];
+    int len = snprintf(field, sizeof(field), "\"%s\":%llu", name,
+                       (unsigned long long)__atomic_load_n(counter, __ATOMIC_RELAXED));
+    arena_buf_append(out, field, len);
+}
+
+void stats_record_parse(uint64_t ns) {
+    latency_record(&batch_stats.parse, ns);
+}
+
+void stats_record_batch(size_t requests, uint64_t begin, uint64_t scanned) {
+    __atomic_add_fetch(&batch_stats.batches, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&batch_stats.requests, requests, __ATOMIC_RELAXED);
+    latency_record(&batch_stats.scan, scanned - begin);
+    latency_record(&batch_stats.serialize, stats_now_ns() - scanned);
+}
+
+void stats_record_incomplete(void) {
+    __atomic_add_fetch(&batch_stats.incomplete, 1, __ATOMIC_RELAXED);
+}
+
+void stats_format_cache(char *buf, size_t size) {
+    verdict_cache_stats_t stats;
+    verdict_cache_stats(&stats);
+    snprintf(buf, size,
+             "{\"status\":\"cache_stats\",\"hits\":%llu,\"misses\":%llu,\"inserts\":%llu,"
+             "\"evictions\":%llu,\"entries\":%zu,\"capacity\":%zu}",
+             (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+             (unsigned long long)stats.inserts, (unsigned long long)stats.evictions,
+             stats.entries, stats.capacity);
+}
+
+char *stats_format(arena_t *arena) {
+    arena_buf_t out;
+    if (!arena_buf_init(&out, arena, 16 * 1024)) return NULL;
+
+    ruleset_t *rules = ruleset_acquire();
+    char head[64];
+    int head_len = snprintf(head, sizeof(head), "{\"status\":\"stats\",\"generation\":%u,\"buckets_ns\":",
+                            ruleset_generation(rules));
+    arena_buf_append(&out, head, head_len);
+    stats_append_buckets(&out);
+
+    arena_buf_append(&out, ",\"batch\":{", 10);
+    stats_append_counter(&out, "batches", &batch_stats.batches);
+    arena_buf_putc(&out, ',');
+    stats_append_counter(&out, "requests", &batch_stats.requests);
+    arena_buf_putc(&out, ',');
+    stats_append_counter(&out, "incomplete", &batch_stats.incomplete);
+    arena_buf_append(&out, ",\"parse\":", 9);
+    stats_append_latency(&out, &batch_stats.parse);
+    arena_buf_append(&out, ",\"scan\":", 8);
+    stats_append_latency(&out, &batch_stats.scan);
+    arena_buf_append(&out, ",\"serialize\":", 13);
+    stats_append_latency(&out, &batch_stats.serialize);
+
+    arena_buf_append(&out, "},\"locations\":{", 15);
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        const location_stats_t *stats = ruleset_location_stats(rules, (location_t)l);
+        const char *name = location_name((location_t)l);
+
+        if (l > 0) arena_buf_putc(&out, ',');
+        arena_buf_append_json(&out, name, strlen(name));
+        arena_buf_append(&out, ":{", 2);
+        stats_append_counter(&out, "prefiltered", &stats->prefiltered);
+        arena_buf_putc(&out, ',');
+        stats_append_counter(&out, "set_scans", &stats->set_scans);
+        arena_buf_putc(&out, ',');
+        stats_append_counter(&out, "cache_hits", &stats->cache_hits);
+        arena_buf_putc(&out, ',');
+        stats_append_counter(&out, "transforms", &stats->transforms);
+        arena_buf_append(&out, ",\"latency\":", 11);
+        stats_append_latency(&out, &stats->latency);
+        arena_buf_putc(&out, '}');
+    }
+
+    // Locations a rule never ran or matched on are left out
+    arena_buf_append(&out, "},\"rules\":[", 11);
+    for (int i = 0; i < ruleset_pattern_count(rules); i++) {
+        const CompiledRegexPattern *pattern = ruleset_pattern(rules, i);
+        char id[32];
+        int id_len = snprintf(id, sizeof(id), "%s{\"id\":%d,\"attack\":", i > 0 ? "," : "", pattern->rule_id);
+        arena_buf_append(&out, id, id_len);
+        arena_buf_append_json(&out, pattern->attack, strlen(pattern->attack));
+        arena_buf_append(&out, ",\"description\":", 15);
+        arena_buf_append_json(&out, pattern->description, strlen(pattern->description));
+
+        // Compiled size and DFA memory budget of the rule, searches its DFA gave up on
+        re2_pattern_info_t info;
+        re2_pattern_info(pattern->compiled_regex, &info);
+        char regex[128];
+        int regex_len = snprintf(regex, sizeof(regex), ",\"program_size\":%d,\"max_mem\":%lld,\"dfa_failures\":%lld",
+                                 info.program_size, (long long)info.max_mem, (long long)info.dfa_failures);
+        arena_buf_append(&out, regex, regex_len);
+
+        for (int l = 0; l < LOCATION_COUNT; l++) {
+            const rule_stats_t *stats = ruleset_rule_stats(rules, i, (location_t)l);
+            if (!__atomic_load_n(&stats->evaluations, __ATOMIC_RELAXED) &&
+                !__atomic_load_n(&stats->matches, __ATOMIC_RELAXED)) {
+                continue;
+            }
+
+            const char *name = location_name((location_t)l);
+            arena_buf_putc(&out, ',');
+            arena_buf_append_json(&out, name, strlen(name));
+            arena_buf_append(&out, ":{", 2);
+            stats_append_counter(&out, "evaluations", &stats->evaluations);
+            arena_buf_putc(&out, ',');
+            stats_append_counter(&out, "matches", &stats->matches);
+            arena_buf_append(&out, ",\"latency\":", 11);
+            stats_append_latency(&out, &stats->latency);
+            arena_buf_putc(&out, '}');
+        }
+        arena_buf_putc(&out, '}');
+    }
+    arena_buf_append(&out, "]}", 2);
+    arena_buf_putc(&out, '\0');
+
+    ruleset_release(rules);
+    return out.data;
+}
+
+uint64_t stats_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,63 @@
+#ifndef STATS
+#define STATS
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+// Runtime counters of the analyzer, read on demand by the stats command.
+// Writers update them with relaxed atomics, concurrently from the pool threads.
+
+// Log2 latency histogram: bucket b counts durations in [2^(b-1), 2^b) ns, bucket 0 - under 1 ns,
+// the last bucket everything from 2^(LATENCY_BUCKETS - 2) ns (67 ms) up
+#define LATENCY_BUCKETS 28
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t buckets[LATENCY_BUCKETS];
+} latency_t;
+
+// One rule on one location. Evaluations are the direct RE2 runs of the rule, a rule that runs
+// inside the RE2::Set of the location is covered by the set scans of the location.
+typedef struct {
+    uint64_t evaluations;
+    uint64_t matches;       // Direct runs, set scans and verdict cache hits
+    latency_t latency;      // Of the direct runs
+} rule_stats_t;
+
+// analyze() on one location
+typedef struct {
+    uint64_t prefiltered;   // Scans the literal prefilter ended before RE2
+    uint64_t set_scans;     // Scans that ran the RE2::Set of the location
+    uint64_t cache_hits;    // Whole-location results taken from the verdict cache
+    uint64_t transforms;    // Transform stages computed for the rules that ask for them
+    latency_t latency;      // Of every scan
+} location_stats_t;
+
+void latency_record(latency_t *latency, uint64_t ns);
+
+// {"count":N,"total_ns":N,"buckets":[...]} - trailing empty buckets are left out
+void stats_append_latency(arena_buf_t *out, const latency_t *latency);
+// [1,2,4,...] - upper bounds of the buckets in ns, the last one open
+void stats_append_buckets(arena_buf_t *out);
+// "name":N with a relaxed load of the counter
+void stats_append_counter(arena_buf_t *out, const char *name, const uint64_t *counter);
+
+// Phases of the batches of the whole process: parsing, then the scan from begin to scanned
+// and the serialization from there to now
+void stats_record_parse(uint64_t ns);
+void stats_record_batch(size_t requests, uint64_t begin, uint64_t scanned);
+// A verdict that came out incomplete, its deadline passed
+void stats_record_incomplete(void);
+
+// {"status":"stats","generation":N,"buckets_ns":[...],"batch":{...},"locations":{...},"rules":[...]},
+// NUL terminated in the arena. Every latency is {"count","total_ns","buckets"}.
+char *stats_format(arena_t *arena);
+// {"status":"cache_stats","hits":N,...} of the verdict cache
+void stats_format_cache(char *buf, size_t size);
+
+uint64_t stats_now_ns(void);
+
+#endif
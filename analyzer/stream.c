@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stream.h"
+#include "detection.h"
+
+static void scan(stream_t *stream, const char *raw, size_t len, arena_t *arena);
+static size_t escape_tail(const char *raw, size_t len);
+
+void stream_table_init(stream_table_t *table) {
+    table->count = 0;
+}
+
+void stream_table_free(stream_table_t *table) {
+    while (table->count > 0) {
+        stream_close(table, table->streams[table->count - 1]);
+    }
+}
+
+stream_t *stream_begin(stream_table_t *table, uint32_t id, uint32_t max_bytes, const request_t *head) {
+    // An id is not reused while its stream is open, a repeated one replaces the old stream
+    stream_t *old = stream_find(table, id);
+    if (old) stream_close(table, old);
+
+    if (table->count == STREAMS_MAX) return NULL;
+
+    stream_t *stream = calloc(1, sizeof(stream_t));
+    if (!stream) return NULL;
+
+    stream->id = id;
+    stream->max_bytes = max_bytes ? max_bytes : STREAM_DEFAULT_MAX;
+    stream->last_active_ns = stream_now_ns();
+    stream->rules = ruleset_acquire();
+
+    analyze_fields(stream->rules, head->fields, head->field_count, &stream->report);
+    stream->report.attack = report_is_attack(stream->rules, &stream->report);
+
+    table->streams[table->count++] = stream;
+    return stream;
+}
+
+stream_t *stream_find(stream_table_t *table, uint32_t id) {
+    for (int i = 0; i < table->count; i++) {
+        if (table->streams[i]->id == id) {
+            table->streams[i]->last_active_ns = stream_now_ns();
+            return table->streams[i];
+        }
+    }
+    return NULL;
+}
+
+uint64_t stream_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+stream_t *stream_find_idle(stream_table_t *table, uint64_t now_ns) {
+    for (int i = 0; i < table->count; i++) {
+        if (now_ns - table->streams[i]->last_active_ns > STREAM_IDLE_TIMEOUT_NS) return table->streams[i];
+    }
+    return NULL;
+}
+
+void stream_close(stream_table_t *table, stream_t *stream) {
+    for (int i = 0; i < table->count; i++) {
+        if (table->streams[i] == stream) {
+            table->streams[i] = table->streams[--table->count];
+            break;
+        }
+    }
+
+    ruleset_release(stream->rules);
+    free(stream);
+}
+
+int stream_chunk(stream_t *stream, const char *data, size_t len, arena_t *arena) {
+    if (stream->report.attack) return 1;
+
+    // Past the limit the body is passed through unscanned
+    if (stream->inspected >= stream->max_bytes) return 0;
+    if (len > stream->max_bytes - stream->inspected) len = stream->max_bytes - stream->inspected;
+    stream->inspected += len;
+
+    char *raw = arena_alloc(arena, stream->carry_len + len + 1);
+    if (!raw) return 0;
+    memcpy(raw, stream->carry, stream->carry_len);
+    memcpy(raw + stream->carry_len, data, len);
+    size_t raw_len = stream->carry_len + len;
+
+    // An escape the chunk cut in half is decoded together with the next chunk
+    size_t hold = escape_tail(raw, raw_len);
+    scan(stream, raw, raw_len - hold, arena);
+
+    memcpy(stream->carry, raw + raw_len - hold, hold);
+    stream->carry_len = hold;
+    return stream->report.attack;
+}
+
+void stream_end(stream_t *stream, arena_t *arena) {
+    if (!stream->report.attack && stream->carry_len) {
+        scan(stream, stream->carry, stream->carry_len, arena);
+    }
+    stream->carry_len = 0;
+}
+
+// Normalizes raw, scans it behind the tail of the previous chunks and keeps the new tail
+static void scan(stream_t *stream, const char *raw, size_t len, arena_t *arena) {
+    if (len == 0) return;
+
+    size_t prefix = stream->window_len;
+    char *text = arena_alloc(arena, prefix + NORMALIZED_SIZE(len));
+    if (!text) return;
+
+    memcpy(text, stream->window, prefix);
+    size_t text_len = normalize_into(raw, len, text + prefix, NORMALIZED_SIZE(len));
+
+    // Whitespace runs are collapsed across the boundary as well
+    if (prefix && text_len && text[prefix - 1] == ' ' && text[prefix] == ' ') {
+        memmove(text + prefix, text + prefix + 1, text_len);
+        text_len--;
+    }
+
+    size_t total = prefix + text_len;
+    analyze(stream->rules, text, total, LOCATION_BODY, NULL, &stream->report);
+    stream->report.attack = report_is_attack(stream->rules, &stream->report);
+
+    size_t keep = total < STREAM_OVERLAP ? total : STREAM_OVERLAP;
+    memcpy(stream->window, text + total - keep, keep);
+    stream->window_len = keep;
+}
+
+// Bytes at the end of raw that may start a %XX or &...; escape
+static size_t escape_tail(const char *raw, size_t len) {
+    size_t hold = 0;
+
+    if (len >= 1 && raw[len - 1] == '%') hold = 1;
+    if (len >= 2 && raw[len - 2] == '%') hold = 2;
+
+    for (size_t back = 1; back < ENTITY_MAX_LEN && back <= len; back++) {
+        char c = raw[len - back];
+        if (c == ';') break;
+        if (c == '&') {
+            if (back > hold) hold = back;
+            break;
+        }
+    }
+    return hold;
+}
@@ -0,0 +1,62 @@
+#ifndef STREAM
+#define STREAM
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "models.h"
+#include "arena.h"
+#include "html-decoder.h"
+
+// Streamed body inspection: the body arrives in chunks and is scanned as it comes, an open
+// stream keeps only its report and a short tail of the normalized text. A finding that spans
+// a chunk boundary is found as long as it is not longer than the tail.
+#define STREAM_OVERLAP 1024
+// Open streams per connection
+#define STREAMS_MAX 64
+// Body bytes inspected when the proxy does not set a limit
+#define STREAM_DEFAULT_MAX (1024 * 1024)
+// A stream without a frame for this long is closed - its upload was dropped without a
+// FRAME_STREAM_ABORT (the proxy crashed or lost the frame), it would hold its slot forever
+#define STREAM_IDLE_TIMEOUT_NS (60ull * 1000000000)
+
+typedef struct {
+    uint32_t id;
+    uint32_t max_bytes;         // Body bytes inspected at most, the rest is not scanned
+    uint64_t inspected;         // Body bytes scanned so far
+    uint64_t last_active_ns;    // Monotonic time of the last frame of the stream
+    struct ruleset *rules;      // Held until the stream ends - findings point into it
+    detection_report_t report;
+    char window[STREAM_OVERLAP];    // Normalized tail of the body so far
+    size_t window_len;
+    char carry[ENTITY_MAX_LEN];     // Raw bytes of an escape cut by the chunk boundary
+    size_t carry_len;
+} stream_t;
+
+typedef struct {
+    stream_t *streams[STREAMS_MAX];
+    int count;
+} stream_table_t;
+
+void stream_table_init(stream_table_t *table);
+// Closes every stream that is still open (the connection went away)
+void stream_table_free(stream_table_t *table);
+
+// Opens a stream on the current rules and analyzes the head of the request (url and
+// headers, already split into fields). NULL if the table is full or out of memory.
+stream_t *stream_begin(stream_table_t *table, uint32_t id, uint32_t max_bytes, const request_t *head);
+// The stream with this id, its idle time restarts
+stream_t *stream_find(stream_table_t *table, uint32_t id);
+// Monotonic clock the idle times are measured with
+uint64_t stream_now_ns(void);
+// A stream that has been idle longer than STREAM_IDLE_TIMEOUT_NS at now_ns, NULL if none is
+stream_t *stream_find_idle(stream_table_t *table, uint64_t now_ns);
+void stream_close(stream_table_t *table, stream_t *stream);
+
+// Scans the next chunk of the body, temporaries go to the arena.
+// Returns 1 once the verdict is final (an attack) - later chunks would not change it.
+int stream_chunk(stream_t *stream, const char *data, size_t len, arena_t *arena);
+// End of the body - scans what the last chunk held back and sets the verdict
+void stream_end(stream_t *stream, arena_t *arena);
+
+#endif
@@ -0,0 +1,173 @@
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "thread-pool.h"
+
+// One range per participating thread, on its own cache line
+typedef struct {
+    _Alignas(64) atomic_size_t next;
+    size_t end;
+} range_t;
+
+typedef struct job {
+    thread_pool_fn fn;
+    void *ctx;
+    range_t *ranges;
+    int range_count;
+    atomic_int next_range;  // Hands out the starting range to joining threads
+    atomic_int exhausted;   // Every item is claimed, no point in joining
+    int users;              // Pool threads working on the job, guarded by the pool lock
+    struct job *next;
+} job_t;
+
+struct thread_pool {
+    pthread_t *threads;
+    int thread_count;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;    // New job queued or shutdown
+    pthread_cond_t done;    // A pool thread left a job
+    job_t *jobs;            // Batches in progress, oldest first
+    int stop;
+};
+
+// Claims items starting with range `first`, then steals from the others
+static void work_on(job_t *job, int first) {
+    for (int r = 0; r < job->range_count; r++) {
+        range_t *range = &job->ranges[(first + r) % job->range_count];
+
+        for (;;) {
+            if (atomic_load_explicit(&range->next, memory_order_relaxed) >= range->end) break;
+            size_t item = atomic_fetch_add(&range->next, 1);
+            if (item >= range->end) break;
+            job->fn(job->ctx, item);
+        }
+    }
+    atomic_store(&job->exhausted, 1);
+}
+
+static void *worker_main(void *arg) {
+    thread_pool_t *pool = arg;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        job_t *job = pool->jobs;
+        while (job && atomic_load(&job->exhausted)) job = job->next;
+
+        if (!job) {
+            if (pool->stop) break;
+            pthread_cond_wait(&pool->work, &pool->lock);
+            continue;
+        }
+
+        job->users++;
+        pthread_mutex_unlock(&pool->lock);
+
+        work_on(job, atomic_fetch_add(&job->next_range, 1) % job->range_count);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--job->users == 0) pthread_cond_broadcast(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+thread_pool_t *thread_pool_new(int threads) {
+    if (threads < 0) threads = 0;
+    if (threads > THREAD_POOL_MAX_THREADS) threads = THREAD_POOL_MAX_THREADS;
+
+    thread_pool_t *pool = calloc(1, sizeof(thread_pool_t));
+    if (!pool) return NULL;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    pool->threads = calloc(threads ? threads : 1, sizeof(pthread_t));
+    if (!pool->threads) {
+        thread_pool_free(pool);
+        return NULL;
+    }
+
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_main, pool) != 0) break;
+        pool->thread_count++;
+    }
+    return pool;
+}
+
+void thread_pool_free(thread_pool_t *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->thread_count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+void thread_pool_run(thread_pool_t *pool, size_t count, thread_pool_fn fn, void *ctx) {
+    if (!pool || pool->thread_count == 0 || count < 2) {
+        for (size_t i = 0; i < count; i++) fn(ctx, i);
+        return;
+    }
+
+    int range_count = pool->thread_count + 1;
+    if ((size_t)range_count > count) range_count = (int)count;
+
+    range_t *ranges = aligned_alloc(_Alignof(range_t), range_count * sizeof(range_t));
+    if (!ranges) {
+        for (size_t i = 0; i < count; i++) fn(ctx, i);
+        return;
+    }
+
+    for (int r = 0; r < range_count; r++) {
+        atomic_init(&ranges[r].next, count * r / range_count);
+        ranges[r].end = count * (r + 1) / range_count;
+    }
+
+    job_t job = {
+        .fn = fn,
+        .ctx = ctx,
+        .ranges = ranges,
+        .range_count = range_count,
+    };
+    atomic_init(&job.next_range, 1);  // Range 0 belongs to the caller
+    atomic_init(&job.exhausted, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    job_t **tail = &pool->jobs;
+    while (*tail) tail = &(*tail)->next;
+    *tail = &job;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    work_on(&job, 0);
+
+    // Every item is claimed, wait for the pool threads still running one
+    pthread_mutex_lock(&pool->lock);
+    for (job_t **j = &pool->jobs; *j; j = &(*j)->next) {
+        if (*j == &job) {
+            *j = job.next;
+            break;
+        }
+    }
+    while (job.users > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    free(ranges);
+}
+
+int thread_pool_size(const thread_pool_t *pool) {
+    return pool ? pool->thread_count : 0;
+}
@@ -0,0 +1,26 @@
+#ifndef THREAD_POOL
+#define THREAD_POOL
+
+#include <stddef.h>
+
+// Fixed set of threads that run the items of a batch in parallel.
+// Items [0, count) are split into one range per thread; a thread that is done
+// with its own range steals items from the others. Several callers (connections)
+// can run batches at the same time, every caller works on its own batch too.
+
+#define THREAD_POOL_MAX_THREADS 256
+
+typedef struct thread_pool thread_pool_t;
+
+typedef void (*thread_pool_fn)(void *ctx, size_t item);
+
+// threads == 0 is valid - every batch then runs on the calling thread
+thread_pool_t *thread_pool_new(int threads);
+void thread_pool_free(thread_pool_t *pool);
+
+// Calls fn(ctx, i) for every i in [0, count), returns once all calls are done
+void thread_pool_run(thread_pool_t *pool, size_t count, thread_pool_fn fn, void *ctx);
+
+int thread_pool_size(const thread_pool_t *pool);
+
+#endif
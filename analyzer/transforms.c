@@ -0,0 +1,260 @@
+#include <string.h>
+#include <stdint.h>
+
+#include "transforms.h"
+#include "simd.h"
+
+static const char *const transform_names[TRANSFORM_COUNT] = {
+    [TRANSFORM_URL_DECODE] = "url_decode",
+    [TRANSFORM_URL_DECODE_UNI] = "url_decode_uni",
+    [TRANSFORM_ESCAPE_DECODE] = "escape_decode",
+    [TRANSFORM_REMOVE_COMMENTS] = "remove_comments",
+    [TRANSFORM_REPLACE_COMMENTS] = "replace_comments",
+    [TRANSFORM_REMOVE_WHITESPACE] = "remove_whitespace",
+};
+
+// Bytes a transform starts its work on - text without any of them stays as it is
+static const char *const transform_triggers[TRANSFORM_COUNT] = {
+    [TRANSFORM_URL_DECODE] = "%",
+    [TRANSFORM_URL_DECODE_UNI] = "%",
+    [TRANSFORM_ESCAPE_DECODE] = "\\",
+    [TRANSFORM_REMOVE_COMMENTS] = "*!",     // Of /*, */ and <!--, rarer than '/' and '<'
+    [TRANSFORM_REPLACE_COMMENTS] = "*!",
+    [TRANSFORM_REMOVE_WHITESPACE] = " ",
+};
+
+// Output of one value, normalized as it is written
+typedef struct {
+    char *dst;
+    size_t len;
+    int in_space;
+} output_t;
+
+static inline void emit(output_t *out, unsigned char c) {
+    if (c < 0x20 || c == 0x7F) return;
+    if (c == ' ') {
+        if (!out->in_space) out->dst[out->len++] = ' ';
+        out->in_space = 1;
+        return;
+    }
+    out->dst[out->len++] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+    out->in_space = 0;
+}
+
+// Hex value of a byte, -1 if it is not a hex digit
+static inline int hex_value(unsigned char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Value of count hex digits at src, -1 if they are not all there
+static int hex_run(const char *src, size_t len, size_t count) {
+    if (len < count) return -1;
+
+    int value = 0;
+    for (size_t k = 0; k < count; k++) {
+        int digit = hex_value((unsigned char)src[k]);
+        if (digit < 0) return -1;
+        value = value << 4 | digit;
+    }
+    return value;
+}
+
+// A BMP code point as UTF-8, full width ASCII (U+FF01 - U+FF5E) as the ASCII it stands for
+static void emit_code_point(output_t *out, unsigned cp) {
+    if (cp >= 0xFF01 && cp <= 0xFF5E) cp -= 0xFEE0;
+
+    if (cp < 0x80) {
+        emit(out, (unsigned char)cp);
+    } else if (cp < 0x800) {
+        emit(out, (unsigned char)(0xC0 | cp >> 6));
+        emit(out, (unsigned char)(0x80 | (cp & 0x3F)));
+    } else {
+        emit(out, (unsigned char)(0xE0 | cp >> 12));
+        emit(out, (unsigned char)(0x80 | ((cp >> 6) & 0x3F)));
+        emit(out, (unsigned char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+static void url_decode(const char *src, size_t len, output_t *out, int unicode) {
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] == '%') {
+            int value;
+            if (unicode && i + 1 < len && src[i + 1] == 'u' && (value = hex_run(src + i + 2, len - i - 2, 4)) >= 0) {
+                emit_code_point(out, (unsigned)value);
+                i += 5;
+                continue;
+            }
+            if ((value = hex_run(src + i + 1, len - i - 1, 2)) >= 0) {
+                emit(out, (unsigned char)value);
+                i += 2;
+                continue;
+            }
+        }
+        emit(out, (unsigned char)src[i]);
+    }
+}
+
+// C / JavaScript string escapes. Escaped whitespace is a space, other escaped chars stand for themselves.
+static void escape_decode(const char *src, size_t len, output_t *out) {
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] != '\\' || i + 1 == len) {
+            emit(out, (unsigned char)src[i]);
+            continue;
+        }
+
+        char c = src[++i];
+        int value;
+        if (c == 'x' && (value = hex_run(src + i + 1, len - i - 1, 2)) >= 0) {
+            emit(out, (unsigned char)value);
+            i += 2;
+        } else if (c == 'u' && (value = hex_run(src + i + 1, len - i - 1, 4)) >= 0) {
+            emit_code_point(out, (unsigned)value);
+            i += 4;
+        } else if (c >= '0' && c <= '7') {
+            value = c - '0';
+            for (int k = 0; k < 2 && i + 1 < len && src[i + 1] >= '0' && src[i + 1] <= '7'; k++) {
+                value = value << 3 | (src[++i] - '0');
+            }
+            emit(out, (unsigned char)value);
+        } else if (c == 'n' || c == 't' || c == 'r' || c == 'v' || c == 'f') {
+            emit(out, ' ');
+        } else if (c != 'a' && c != 'b') {
+            emit(out, (unsigned char)c);
+        }
+    }
+}
+
+// Position of needle in src[from, len), len if it is not there
+static size_t find_from(const char *src, size_t len, size_t from, const char *needle, size_t needle_len) {
+    for (size_t i = from; i + needle_len <= len; i++) {
+        if (memcmp(src + i, needle, needle_len) == 0) return i;
+    }
+    return len;
+}
+
+// An unterminated comment runs to the end of the value. MySQL runs the content of /*!
+// comments (/*!50000union*/) - only their markers go.
+static void remove_comments(const char *src, size_t len, output_t *out, int replace) {
+    int executable = 0;     // Open /*! comments
+
+    for (size_t i = 0; i < len;) {
+        if (src[i] == '/' && i + 1 < len && src[i + 1] == '*') {
+            i += 2;
+            if (i < len && src[i] == '!') {
+                i++;
+                while (i < len && src[i] >= '0' && src[i] <= '9') i++;
+                executable++;
+            } else {
+                size_t end = find_from(src, len, i, "*/", 2);
+                i = end < len ? end + 2 : len;
+            }
+            if (replace) emit(out, ' ');
+            continue;
+        }
+        if (executable && src[i] == '*' && i + 1 < len && src[i + 1] == '/') {
+            i += 2;
+            executable--;
+            if (replace) emit(out, ' ');
+            continue;
+        }
+        if (src[i] == '<' && i + 3 < len && memcmp(src + i, "<!--", 4) == 0) {
+            size_t end = find_from(src, len, i + 4, "-->", 3);
+            i = end < len ? end + 3 : len;
+            if (replace) emit(out, ' ');
+            continue;
+        }
+        emit(out, (unsigned char)src[i++]);
+    }
+}
+
+static void remove_whitespace(const char *src, size_t len, output_t *out) {
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] != ' ') emit(out, (unsigned char)src[i]);
+    }
+}
+
+int transform_from_name(const char *name) {
+    if (!name) return -1;
+
+    for (int t = 0; t < TRANSFORM_COUNT; t++) {
+        if (strcmp(transform_names[t], name) == 0) return t;
+    }
+    return -1;
+}
+
+const char *transform_name(transform_t transform) {
+    return transform < TRANSFORM_COUNT ? transform_names[transform] : "unknown";
+}
+
+const char *transform_trigger(transform_t transform) {
+    return transform < TRANSFORM_COUNT ? transform_triggers[transform] : "";
+}
+
+// Whether the trigger byte at src[i] starts something the transform changes
+static int starts_work(transform_t transform, const char *src, size_t len, size_t i) {
+    switch (transform) {
+        case TRANSFORM_URL_DECODE:
+            return hex_run(src + i + 1, len - i - 1, 2) >= 0;
+        case TRANSFORM_URL_DECODE_UNI:
+            return hex_run(src + i + 1, len - i - 1, 2) >= 0 ||
+                   (i + 1 < len && src[i + 1] == 'u' && hex_run(src + i + 2, len - i - 2, 4) >= 0);
+        case TRANSFORM_ESCAPE_DECODE:
+            return i + 1 < len && src[i + 1] != '\n';
+        case TRANSFORM_REMOVE_COMMENTS:
+        case TRANSFORM_REPLACE_COMMENTS:
+            // The '*' of /* or the '!' of <!--
+            if (src[i] == '*') return i > 0 && src[i - 1] == '/';
+            return i > 0 && src[i - 1] == '<' && i + 2 < len && src[i + 1] == '-' && src[i + 2] == '-';
+        default:
+            return 1;
+    }
+}
+
+// Whether the transform changes anything - most trigger bytes start nothing ("12%", "great!"),
+// text without work is left as it is without a pass over it
+static int has_work(transform_t transform, const char *src, size_t len) {
+    const char *trigger = transform_triggers[transform];
+    int trigger_len = (int)strlen(trigger);
+
+    for (size_t i = simd_find_any(src, len, trigger, trigger_len); i < len;
+         i += 1 + simd_find_any(src + i + 1, len - i - 1, trigger, trigger_len)) {
+        if (starts_work(transform, src, len, i)) return 1;
+    }
+    return 0;
+}
+
+size_t transform_apply(transform_t transform, const char *src, size_t len, char *dst) {
+    if (!has_work(transform, src, len)) return TRANSFORM_UNCHANGED;
+
+    output_t out = { dst, 0, 0 };
+    size_t start = 0;
+    for (;;) {
+        const char *newline = memchr(src + start, '\n', len - start);
+        size_t end = newline ? (size_t)(newline - src) : len;
+        const char *value = src + start;
+        size_t value_len = end - start;
+
+        switch (transform) {
+            case TRANSFORM_URL_DECODE: url_decode(value, value_len, &out, 0); break;
+            case TRANSFORM_URL_DECODE_UNI: url_decode(value, value_len, &out, 1); break;
+            case TRANSFORM_ESCAPE_DECODE: escape_decode(value, value_len, &out); break;
+            case TRANSFORM_REMOVE_COMMENTS: remove_comments(value, value_len, &out, 0); break;
+            case TRANSFORM_REPLACE_COMMENTS: remove_comments(value, value_len, &out, 1); break;
+            case TRANSFORM_REMOVE_WHITESPACE: remove_whitespace(value, value_len, &out); break;
+            default: return TRANSFORM_UNCHANGED;
+        }
+
+        if (!newline) break;
+        // Values stay separated, nothing decodes to a newline (emit drops control chars)
+        out.dst[out.len++] = '\n';
+        out.in_space = 0;
+        start = end + 1;
+    }
+
+    dst[out.len] = '\0';
+    // Every transform only drops bytes or puts fewer in their place
+    return out.len == len ? TRANSFORM_UNCHANGED : out.len;
+}
@@ -0,0 +1,35 @@
+#ifndef TRANSFORMS
+#define TRANSFORMS
+
+#include <stddef.h>
+
+// Transformations a rule can ask for on top of the normalization every input gets
+// (normalize_into: URI decode, entity decode, lowercase), in the manner of ModSecurity's
+// t: actions - "transforms" of a rule, applied in order. They work on normalized text:
+// values separated by '\n', each transformed on its own, and the result is normalized
+// the same way (lowercase, no control chars, single spaces). None of them makes the text longer.
+
+typedef enum {
+    TRANSFORM_URL_DECODE = 0,       // %XX once more - double encoding
+    TRANSFORM_URL_DECODE_UNI,       // %uXXXX (full width ASCII folded to ASCII) and %XX
+    TRANSFORM_ESCAPE_DECODE,        // Backslash escapes: \xHH, \uHHHH, \NNN (octal), \n, \', ...
+    TRANSFORM_REMOVE_COMMENTS,      // /* */ and <!-- --> dropped, /*! */ (MySQL) keeps its content
+    TRANSFORM_REPLACE_COMMENTS,     // The same, every comment becomes a space
+    TRANSFORM_REMOVE_WHITESPACE,
+    TRANSFORM_COUNT,
+} transform_t;
+
+// transform_apply() found nothing to change, dst is not meaningful
+#define TRANSFORM_UNCHANGED ((size_t)-1)
+
+// transform_t of a "transforms" entry, -1 for an unknown name
+int transform_from_name(const char *name);
+const char *transform_name(transform_t transform);
+// Bytes a transform starts its work on - text without any of them stays as it is
+const char *transform_trigger(transform_t transform);
+
+// Transforms len bytes of normalized text into dst, which must hold len + 1 bytes.
+// Returns the length of the NUL terminated result, TRANSFORM_UNCHANGED if it is the input itself.
+size_t transform_apply(transform_t transform, const char *src, size_t len, char *dst);
+
+#endif
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "verdict-cache.h"
+#include "hash.h"
+
+typedef struct {
+    uint64_t hash;
+    char *key;              // NULL - free slot
+    uint32_t key_len;
+    unsigned generation;
+    uint8_t location;
+    uint8_t referenced;     // Hit since the CLOCK hand passed it
+    uint8_t count;
+    uint8_t patterns[CACHE_HITS_MAX];
+} cache_entry_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    cache_entry_t *entries; // sets * CACHE_WAYS
+    uint8_t *hands;         // CLOCK hand of every set
+    size_t used;
+} cache_shard_t;
+
+static cache_shard_t shards[CACHE_SHARDS];
+static size_t sets_per_shard = 0;   // 0 - disabled
+// Random per process, so nobody can aim many texts at one set
+static uint64_t seed;
+
+// Relaxed atomics - only ever read for the stats
+static uint64_t hits, misses, inserts, evictions;
+
+static uint64_t random_seed(void);
+static cache_entry_t *find_set(uint64_t hash, cache_shard_t **shard);
+
+int verdict_cache_init(size_t entries) {
+    verdict_cache_free();
+    if (entries == 0) return 1;
+
+    size_t sets = (entries + CACHE_SHARDS * CACHE_WAYS - 1) / (CACHE_SHARDS * CACHE_WAYS);
+    int ok = 1;
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        shards[s].entries = calloc(sets * CACHE_WAYS, sizeof(cache_entry_t));
+        shards[s].hands = calloc(sets, 1);
+        shards[s].used = 0;
+        pthread_mutex_init(&shards[s].lock, NULL);
+        if (!shards[s].entries || !shards[s].hands) ok = 0;
+    }
+
+    seed = random_seed();
+    sets_per_shard = sets;
+
+    if (!ok) {
+        fprintf(stderr, "Could not allocate the verdict cache, it is disabled\n");
+        verdict_cache_free();
+    }
+    return ok;
+}
+
+void verdict_cache_free(void) {
+    if (!sets_per_shard) return;
+
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        if (shards[s].entries) {
+            for (size_t i = 0; i < sets_per_shard * CACHE_WAYS; i++) {
+                free(shards[s].entries[i].key);
+            }
+        }
+        free(shards[s].entries);
+        free(shards[s].hands);
+        shards[s].entries = NULL;
+        shards[s].hands = NULL;
+        pthread_mutex_destroy(&shards[s].lock);
+    }
+    sets_per_shard = 0;
+}
+
+int verdict_cache_enabled(void) {
+    return sets_per_shard > 0;
+}
+
+int verdict_cache_lookup(unsigned generation, location_t location, const char *text, size_t len,
+                         uint8_t *patterns, int *count) {
+    if (!sets_per_shard || len > CACHE_KEY_MAX) return 0;
+
+    uint64_t hash = xxh64(text, len, seed + location);
+    cache_shard_t *shard;
+    cache_entry_t *set = find_set(hash, &shard);
+
+    pthread_mutex_lock(&shard->lock);
+    for (int w = 0; w < CACHE_WAYS; w++) {
+        cache_entry_t *entry = &set[w];
+        if (!entry->key || entry->hash != hash || entry->generation != generation ||
+            entry->location != location || entry->key_len != len || memcmp(entry->key, text, len) != 0) {
+            continue;
+        }
+
+        memcpy(patterns, entry->patterns, entry->count);
+        *count = entry->count;
+        entry->referenced = 1;
+        pthread_mutex_unlock(&shard->lock);
+
+        __atomic_add_fetch(&hits, 1, __ATOMIC_RELAXED);
+        return 1;
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    __atomic_add_fetch(&misses, 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+void verdict_cache_insert(unsigned generation, location_t location, const char *text, size_t len,
+                          const uint8_t *patterns, int count) {
+    if (!sets_per_shard || len > CACHE_KEY_MAX || count > CACHE_HITS_MAX) return;
+
+    // Copied before the lock, the shard is held only for the slot update
+    char *key = malloc(len ? len : 1);
+    if (!key) return;
+    memcpy(key, text, len);
+
+    uint64_t hash = xxh64(text, len, seed + location);
+    cache_shard_t *shard;
+    cache_entry_t *set = find_set(hash, &shard);
+    size_t set_index = set - shard->entries;
+    uint8_t *hand = &shard->hands[set_index / CACHE_WAYS];
+
+    pthread_mutex_lock(&shard->lock);
+
+    // The same text (another thread missed on it too), a free slot, or one left from older
+    // rules - before anything that may still be hit
+    cache_entry_t *victim = NULL;
+    for (int w = 0; w < CACHE_WAYS && !victim; w++) {
+        if (set[w].key && set[w].hash == hash && set[w].location == location &&
+            set[w].key_len == len && memcmp(set[w].key, text, len) == 0) {
+            victim = &set[w];
+        }
+    }
+    for (int w = 0; w < CACHE_WAYS && !victim; w++) {
+        if (!set[w].key || set[w].generation != generation) victim = &set[w];
+    }
+
+    // CLOCK - clears the referenced bits it passes, takes the first entry without one
+    while (!victim) {
+        cache_entry_t *entry = &set[*hand];
+        *hand = (*hand + 1) % CACHE_WAYS;
+        if (entry->referenced) {
+            entry->referenced = 0;
+        } else {
+            victim = entry;
+        }
+    }
+
+    char *old = victim->key;
+    if (!old) shard->used++;
+
+    victim->hash = hash;
+    victim->key = key;
+    victim->key_len = (uint32_t)len;
+    victim->generation = generation;
+    victim->location = (uint8_t)location;
+    victim->referenced = 0;
+    victim->count = (uint8_t)count;
+    memcpy(victim->patterns, patterns, count);
+
+    pthread_mutex_unlock(&shard->lock);
+
+    free(old);
+    __atomic_add_fetch(&inserts, 1, __ATOMIC_RELAXED);
+    if (old) __atomic_add_fetch(&evictions, 1, __ATOMIC_RELAXED);
+}
+
+void verdict_cache_stats(verdict_cache_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->hits = __atomic_load_n(&hits, __ATOMIC_RELAXED);
+    stats->misses = __atomic_load_n(&misses, __ATOMIC_RELAXED);
+    stats->inserts = __atomic_load_n(&inserts, __ATOMIC_RELAXED);
+    stats->evictions = __atomic_load_n(&evictions, __ATOMIC_RELAXED);
+    stats->capacity = sets_per_shard * CACHE_SHARDS * CACHE_WAYS;
+
+    for (int s = 0; s < CACHE_SHARDS && sets_per_shard; s++) {
+        pthread_mutex_lock(&shards[s].lock);
+        stats->entries += shards[s].used;
+        pthread_mutex_unlock(&shards[s].lock);
+    }
+}
+
+// Low bits pick the shard, the rest the set inside it
+static cache_entry_t *find_set(uint64_t hash, cache_shard_t **shard) {
+    *shard = &shards[hash % CACHE_SHARDS];
+    size_t set = (size_t)((hash / CACHE_SHARDS) % sets_per_shard);
+    return &(*shard)->entries[set * CACHE_WAYS];
+}
+
+static uint64_t random_seed(void) {
+    uint64_t value = 0;
+
+    FILE *urandom = fopen("/dev/urandom", "rb");
+    if (urandom) {
+        if (fread(&value, sizeof(value), 1, urandom) != 1) value = 0;
+        fclose(urandom);
+    }
+    if (!value) {
+        value = ((uint64_t)time(NULL) << 32) ^ (uint64_t)getpid() ^ (uint64_t)clock();
+    }
+    return value;
+}
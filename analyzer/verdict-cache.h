@@ -0,0 +1,50 @@
+#ifndef VERDICT_CACHE
+#define VERDICT_CACHE
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "models.h"
+
+// Results of the rules on the text of one location, keyed by the normalized text itself.
+// Repeated urls and header sets skip the prefilter and RE2 entirely, also when the other
+// locations of the request differ.
+//
+// The entries are split over shards, a lookup locks only its shard. Every shard is
+// set-associative: the hash picks a set of CACHE_WAYS entries, the set evicts with CLOCK
+// (an entry that was hit since the hand last passed it gets a second chance).
+// The full text is stored and compared, a hash collision can not return a wrong result.
+// Entries carry the rules generation - after a reload the old ones never match.
+
+#define CACHE_SHARDS 16
+#define CACHE_WAYS 8
+// Longer texts are not cached, they are rarely repeated and would take too much memory
+#define CACHE_KEY_MAX 2048
+// Results with more findings are not cached
+#define CACHE_HITS_MAX 16
+#define CACHE_DEFAULT_ENTRIES 4096
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t inserts;
+    uint64_t evictions;
+    size_t entries;     // In use
+    size_t capacity;
+} verdict_cache_stats_t;
+
+// Process-wide cache, entries == 0 disables it (lookups miss, inserts are dropped)
+int verdict_cache_init(size_t entries);
+void verdict_cache_free(void);
+int verdict_cache_enabled(void);
+
+// Fills patterns with the indexes (in the ruleset) of the rules that hit this text,
+// returns 1 on a hit
+int verdict_cache_lookup(unsigned generation, location_t location, const char *text, size_t len,
+                         uint8_t *patterns, int *count);
+void verdict_cache_insert(unsigned generation, location_t location, const char *text, size_t len,
+                          const uint8_t *patterns, int count);
+
+void verdict_cache_stats(verdict_cache_stats_t *stats);
+
+#endif
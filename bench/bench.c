@@ -0,0 +1,374 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "detection.h"
+#include "html-decoder.h"
+#include "simd.h"
+
+// Microbenchmarks of the analyzer hot paths, without the proxy and the pipe in between:
+// the normalizer, the entity decoder, analyze() per location and every rule on its own.
+// Inputs are the lines of the corpora (bench/corpus), build and run with bench/bench.sh.
+
+#define DEFAULT_CORPUS_DIR "bench/corpus"
+// Every measurement repeats whole passes over its corpus until it ran this long
+#define DEFAULT_MIN_TIME_MS 200
+// Rules are many, each of them runs for a fraction of the time
+#define RULE_TIME_DIVISOR 10
+#define DEFAULT_TOP_RULES 15
+
+typedef struct {
+    char **lines;
+    size_t *lens;
+    size_t count;
+    size_t bytes;   // Of one pass
+} corpus_t;
+
+typedef struct {
+    uint64_t ops;
+    uint64_t bytes;
+    uint64_t ns;
+    uint64_t hits;
+    uint64_t passes;
+} result_t;
+
+typedef struct {
+    int index;
+    result_t result;
+} rule_result_t;
+
+typedef void (*bench_fn)(void *ctx, const char *input, size_t len, result_t *result);
+
+typedef struct {
+    const ruleset_t *rules;
+    location_t location;
+    detection_report_t report;
+} analyze_ctx_t;
+
+static int load_corpus(const char *path, corpus_t *corpus);
+static void free_corpus(corpus_t *corpus);
+static int normalize_corpus(const corpus_t *src, corpus_t *dst);
+static int merge_corpora(const corpus_t *a, const corpus_t *b, corpus_t *dst);
+static result_t measure(const corpus_t *corpus, bench_fn fn, void *ctx, uint64_t min_ns);
+static void print_header(const char *title);
+static void print_result(const char *name, const result_t *result);
+static void bench_normalize_str(void *ctx, const char *input, size_t len, result_t *result);
+static void bench_normalize_into(void *ctx, const char *input, size_t len, result_t *result);
+static void bench_html_entity_decode(void *ctx, const char *input, size_t len, result_t *result);
+static void bench_analyze(void *ctx, const char *input, size_t len, result_t *result);
+static void bench_rule(void *ctx, const char *input, size_t len, result_t *result);
+static int compare_cost(const void *a, const void *b);
+static uint64_t now_ns(void);
+
+// Output buffer of the normalizer benchmarks, sized for the longest line
+static char *scratch = NULL;
+static size_t scratch_size = 0;
+// Keeps the compiler from dropping work whose result is never used
+static volatile size_t sink;
+
+int main(int argc, char **argv) {
+    const char *corpus_dir = DEFAULT_CORPUS_DIR;
+    long min_time_ms = DEFAULT_MIN_TIME_MS;
+    int top = DEFAULT_TOP_RULES;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--rules") == 0 && i + 1 < argc) {
+            set_rules_path(argv[++i]);
+        } else if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+            corpus_dir = argv[++i];
+        } else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time_ms = atol(argv[++i]);
+        } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            top = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            fprintf(stderr, "Usage: %s [--rules RULES_FILE] [--corpus DIR] [--min-time MS] [--top N (0 - all rules)]\n", argv[0]);
+            return 1;
+        }
+    }
+    uint64_t min_ns = (uint64_t)(min_time_ms > 0 ? min_time_ms : 1) * 1000000ULL;
+
+    char path[4096];
+    corpus_t clean = {0}, attack = {0};
+    snprintf(path, sizeof(path), "%s/clean.txt", corpus_dir);
+    int ok = load_corpus(path, &clean);
+    snprintf(path, sizeof(path), "%s/attack.txt", corpus_dir);
+    ok = ok && load_corpus(path, &attack);
+    if (!ok) return 1;
+
+    if (!init_regex_patterns()) {
+        fprintf(stderr, "Could not load the rules\n");
+        return 1;
+    }
+    ruleset_t *rules = ruleset_acquire();
+
+    corpus_t clean_normalized = {0}, attack_normalized = {0}, all_normalized = {0};
+    if (!normalize_corpus(&clean, &clean_normalized) || !normalize_corpus(&attack, &attack_normalized) ||
+        !merge_corpora(&clean_normalized, &attack_normalized, &all_normalized)) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("SIMD: %s, rules: %d, corpora: clean %zu lines / %zu bytes, attack %zu lines / %zu bytes\n",
+           simd_implementation(), ruleset_pattern_count(rules),
+           clean.count, clean.bytes, attack.count, attack.bytes);
+
+    const corpus_t *corpora[] = { &clean, &attack };
+    const corpus_t *normalized[] = { &clean_normalized, &attack_normalized };
+    const char *corpus_names[] = { "clean", "attack" };
+    char name[128];
+
+    print_header("Normalization");
+    for (int c = 0; c < 2; c++) {
+        result_t result;
+
+        result = measure(corpora[c], bench_normalize_str, NULL, min_ns);
+        snprintf(name, sizeof(name), "normalize_str / %s", corpus_names[c]);
+        print_result(name, &result);
+
+        result = measure(corpora[c], bench_normalize_into, NULL, min_ns);
+        snprintf(name, sizeof(name), "normalize_into / %s", corpus_names[c]);
+        print_result(name, &result);
+
+        result = measure(corpora[c], bench_html_entity_decode, NULL, min_ns);
+        snprintf(name, sizeof(name), "html_entity_decode / %s", corpus_names[c]);
+        print_result(name, &result);
+    }
+
+    // On normalized inputs, as the analyzer runs it - the normalizer is measured above
+    print_header("analyze() per location (hits - inputs with a finding)");
+    for (int l = 0; l < LOCATION_COUNT; l++) {
+        for (int c = 0; c < 2; c++) {
+            analyze_ctx_t ctx = { .rules = rules, .location = (location_t)l };
+            result_t result = measure(normalized[c], bench_analyze, &ctx, min_ns);
+            snprintf(name, sizeof(name), "%s / %s", location_name((location_t)l), corpus_names[c]);
+            print_result(name, &result);
+        }
+    }
+
+    // Every rule alone on both normalized corpora, the most expensive first
+    int count = ruleset_pattern_count(rules);
+    rule_result_t *costs = calloc(count ? count : 1, sizeof(rule_result_t));
+    if (!costs) return 1;
+
+    for (int i = 0; i < count; i++) {
+        costs[i].index = i;
+        costs[i].result = measure(&all_normalized, bench_rule, (void *)ruleset_pattern(rules, i),
+                                  min_ns / RULE_TIME_DIVISOR);
+    }
+    qsort(costs, count, sizeof(rule_result_t), compare_cost);
+
+    int shown = top > 0 && top < count ? top : count;
+    // Share of the summed per-input cost of all rules
+    double total_cost = 0;
+    for (int i = 0; i < count; i++) {
+        total_cost += (double)costs[i].result.ns / costs[i].result.ops;
+    }
+
+    printf("\nMost expensive rules (%d of %d, on both corpora, hits - inputs matched)\n", shown, count);
+    printf("%4s %5s %12s %10s %7s %6s  %-20s %s\n", "rank", "rule", "ns/op", "MB/s", "share", "hits", "category", "description");
+    for (int i = 0; i < shown; i++) {
+        const CompiledRegexPattern *pattern = ruleset_pattern(rules, costs[i].index);
+        const result_t *result = &costs[i].result;
+        double ns_per_op = (double)result->ns / result->ops;
+        double mb_per_s = result->ns ? (double)result->bytes * 1000.0 / result->ns : 0;
+
+        printf("%4d %5d %12.1f %10.1f %6.1f%% %6llu  %-20s %s\n", i + 1, pattern->rule_id, ns_per_op, mb_per_s,
+               total_cost > 0 ? 100.0 * ns_per_op / total_cost : 0, (unsigned long long)(result->hits / result->passes),
+               pattern->attack ? pattern->attack : "", pattern->description ? pattern->description : "");
+    }
+
+    free(costs);
+    free(scratch);
+    free_corpus(&clean);
+    free_corpus(&attack);
+    free_corpus(&clean_normalized);
+    free_corpus(&attack_normalized);
+    free(all_normalized.lines);
+    free(all_normalized.lens);
+    ruleset_release(rules);
+    cleanup_regex_patterns();
+    return 0;
+}
+
+// One input per line, empty lines are skipped
+static int load_corpus(const char *path, corpus_t *corpus) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Could not open corpus %s\n", path);
+        return 0;
+    }
+
+    size_t capacity = 0;
+    char *line = NULL;
+    size_t line_size = 0;
+    ssize_t read;
+
+    while ((read = getline(&line, &line_size, file)) != -1) {
+        while (read > 0 && (line[read - 1] == '\n' || line[read - 1] == '\r')) line[--read] = '\0';
+        if (read == 0) continue;
+
+        if (corpus->count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **lines = realloc(corpus->lines, capacity * sizeof(char *));
+            size_t *lens = realloc(corpus->lens, capacity * sizeof(size_t));
+            if (lines) corpus->lines = lines;
+            if (lens) corpus->lens = lens;
+            if (!lines || !lens) break;
+        }
+
+        corpus->lines[corpus->count] = strdup(line);
+        if (!corpus->lines[corpus->count]) break;
+        corpus->lens[corpus->count] = (size_t)read;
+        corpus->bytes += (size_t)read;
+        corpus->count++;
+
+        if ((size_t)read + 1 > scratch_size) {
+            free(scratch);
+            scratch_size = NORMALIZED_SIZE((size_t)read);
+            scratch = malloc(scratch_size);
+        }
+    }
+
+    free(line);
+    fclose(file);
+
+    if (corpus->count == 0 || !scratch) {
+        fprintf(stderr, "Corpus %s is empty\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+static void free_corpus(corpus_t *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) {
+        free(corpus->lines[i]);
+    }
+    free(corpus->lines);
+    free(corpus->lens);
+    memset(corpus, 0, sizeof(*corpus));
+}
+
+static int normalize_corpus(const corpus_t *src, corpus_t *dst) {
+    dst->lines = calloc(src->count, sizeof(char *));
+    dst->lens = calloc(src->count, sizeof(size_t));
+    if (!dst->lines || !dst->lens) return 0;
+
+    for (size_t i = 0; i < src->count; i++) {
+        dst->lines[i] = malloc(NORMALIZED_SIZE(src->lens[i]));
+        if (!dst->lines[i]) return 0;
+
+        dst->lens[i] = normalize_into(src->lines[i], src->lens[i], dst->lines[i], NORMALIZED_SIZE(src->lens[i]));
+        dst->bytes += dst->lens[i];
+        dst->count++;
+    }
+    return 1;
+}
+
+// dst borrows the lines of a and b
+static int merge_corpora(const corpus_t *a, const corpus_t *b, corpus_t *dst) {
+    dst->count = a->count + b->count;
+    dst->bytes = a->bytes + b->bytes;
+    dst->lines = malloc(dst->count * sizeof(char *));
+    dst->lens = malloc(dst->count * sizeof(size_t));
+    if (!dst->lines || !dst->lens) return 0;
+
+    memcpy(dst->lines, a->lines, a->count * sizeof(char *));
+    memcpy(dst->lines + a->count, b->lines, b->count * sizeof(char *));
+    memcpy(dst->lens, a->lens, a->count * sizeof(size_t));
+    memcpy(dst->lens + a->count, b->lens, b->count * sizeof(size_t));
+    return 1;
+}
+
+// Whole passes over the corpus until min_ns elapsed, the clock is read once per pass
+static result_t measure(const corpus_t *corpus, bench_fn fn, void *ctx, uint64_t min_ns) {
+    result_t result = {0};
+
+    // Warm-up pass - caches, lazily built DFA states
+    for (size_t i = 0; i < corpus->count; i++) {
+        fn(ctx, corpus->lines[i], corpus->lens[i], &result);
+    }
+    result.hits = 0;
+
+    uint64_t start = now_ns();
+    do {
+        for (size_t i = 0; i < corpus->count; i++) {
+            fn(ctx, corpus->lines[i], corpus->lens[i], &result);
+        }
+        result.ops += corpus->count;
+        result.passes++;
+        result.bytes += corpus->bytes;
+        result.ns = now_ns() - start;
+    } while (result.ns < min_ns);
+
+    return result;
+}
+
+static void print_header(const char *title) {
+    printf("\n%s\n", title);
+    printf("%-34s %12s %10s %12s %8s\n", "benchmark", "ns/op", "MB/s", "ops", "hits");
+}
+
+static void print_result(const char *name, const result_t *result) {
+    double ns_per_op = result->ops ? (double)result->ns / result->ops : 0;
+    double mb_per_s = result->ns ? (double)result->bytes * 1000.0 / result->ns : 0;
+    printf("%-34s %12.1f %10.1f %12llu", name, ns_per_op, mb_per_s, (unsigned long long)result->ops);
+    if (result->hits) {
+        // Per pass, comparable with the number of lines in the corpus
+        printf(" %8llu", (unsigned long long)(result->hits / result->passes));
+    }
+    printf("\n");
+}
+
+static void bench_normalize_str(void *ctx, const char *input, size_t len, result_t *result) {
+    (void)ctx; (void)len; (void)result;
+    char *normalized = normalize_str(input);
+    sink += normalized ? (size_t)normalized[0] : 0;
+    free(normalized);
+}
+
+static void bench_normalize_into(void *ctx, const char *input, size_t len, result_t *result) {
+    (void)ctx; (void)result;
+    sink += normalize_into(input, len, scratch, scratch_size);
+}
+
+static void bench_html_entity_decode(void *ctx, const char *input, size_t len, result_t *result) {
+    (void)ctx; (void)result;
+    sink += html_entity_decode(input, len, scratch, scratch_size);
+}
+
+static void bench_analyze(void *ctx, const char *input, size_t len, result_t *result) {
+    analyze_ctx_t *analyze_ctx = ctx;
+    detection_report_t *report = &analyze_ctx->report;
+
+    // Only what analyze() reads, clearing the whole report would dominate short inputs
+    report->count = 0;
+    report->score = 0;
+    memset(report->reported, 0, sizeof(report->reported));
+
+    analyze(analyze_ctx->rules, input, len, analyze_ctx->location, NULL, report);
+    if (report->count) result->hits++;
+}
+
+static void bench_rule(void *ctx, const char *input, size_t len, result_t *result) {
+    const CompiledRegexPattern *pattern = ctx;
+    int start, end;
+    if (re2_find(pattern->compiled_regex, input, len, &start, &end)) result->hits++;
+}
+
+// Most nanoseconds per input first
+static int compare_cost(const void *a, const void *b) {
+    const result_t *ra = &((const rule_result_t *)a)->result;
+    const result_t *rb = &((const rule_result_t *)b)->result;
+    double ca = (double)ra->ns / (ra->ops ? ra->ops : 1);
+    double cb = (double)rb->ns / (rb->ops ? rb->ops : 1);
+    return (ca < cb) - (ca > cb);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,43 @@
+#!/bin/bash
+# Builds the analyzer microbenchmarks and runs them, from the repository root:
+#   ./bench/bench.sh [--rules RULES_FILE] [--corpus DIR] [--min-time MS] [--top N]
+# The modules are linked directly, no proxy or pipe is involved.
+
+BENCH_NAME=bench/analyzer-bench
+
+echo "🔨 Compiling benchmarks..."
+
+g++ -std=c++17 -O2 \
+    -I/opt/homebrew/include \
+    -Ianalyzer \
+    -c analyzer/re2_wrapper.cpp \
+    -o bench/re2_wrapper.o || exit 1
+
+for SOURCE in analyzer/detectors/detection.c analyzer/detectors/fingerprint.c analyzer/html-decoder.c analyzer/transforms.c \
+              analyzer/aho-corasick.c analyzer/simd.c analyzer/arena.c analyzer/hash.c analyzer/verdict-cache.c \
+              analyzer/stats.c \
+              bench/bench.c; do
+    gcc -O2 \
+        -I/opt/homebrew/include \
+        -Ianalyzer/detectors \
+        -Ianalyzer \
+        -c ${SOURCE} \
+        -o bench/$(basename ${SOURCE} .c).o || exit 1
+done
+
+g++ -O2 \
+    bench/*.o \
+    -L/opt/homebrew/lib \
+    -lre2 \
+    -ljson-c \
+    -pthread \
+    -o ${BENCH_NAME}
+
+STATUS=$?
+rm -f bench/*.o
+if [ ${STATUS} -ne 0 ]; then
+    echo "❌ Linking error!"
+    exit 1
+fi
+
+./${BENCH_NAME} "$@"
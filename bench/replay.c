@@ -0,0 +1,767 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <json-c/json.h>
+
+// Offline replay of recorded requests through analyzer processes, the way the proxy drives
+// them (JSON line protocol, up to --depth batches in flight per process, as PIPELINE_DEPTH
+// in proxy/worker-pool.js), without the proxy, a backend or Redis. Every combination of
+// batch size and concurrency (analyzer processes) replays the corpus and reports throughput,
+// per-request latency percentiles and the peak RSS of the analyzers. Results are appended
+// to a CSV. Build and run with bench/replay.sh.
+//
+// Corpus lines: a JSON array of requests (a batch as the proxy sends it), a single request
+// object ({"url", "headers", "body"}), or a plain url.
+
+#define DEFAULT_ANALYZER "./analyze"
+#define DEFAULT_CSV "replay_results.csv"
+#define DEFAULT_BATCHES "1,8,32"
+#define DEFAULT_CONCURRENCY "1,2,4"
+// Batches in flight per analyzer, the proxy's default pipelineDepth
+#define DEFAULT_DEPTH 2
+#define MAX_DEPTH 16
+#define DEFAULT_REQUESTS 20000
+// Requests of every run before the measurement starts (analyzer start, caches, page faults)
+#define DEFAULT_WARMUP 1000
+// A run without a single verdict for this long is given up
+#define STALL_TIMEOUT_MS 10000
+#define MAX_SWEEP 16
+#define MAX_CORPORA 8
+#define READ_CHUNK 65536
+
+// Latency histogram in the manner of HdrHistogram: 2^HISTOGRAM_SUB_BITS linear buckets per
+// power of two, values below 2^HISTOGRAM_SUB_BITS exact - ~3% resolution over the whole range
+#define HISTOGRAM_SUB_BITS 5
+#define HISTOGRAM_SUB_COUNT (1 << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_SIZE ((64 - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT)
+
+typedef struct {
+    uint64_t counts[HISTOGRAM_SIZE];
+    uint64_t count;
+    uint64_t max;
+} histogram_t;
+
+// One request object as JSON text, without its "id" - every send gets a fresh one
+typedef struct {
+    char *text;
+    size_t len;
+} payload_t;
+
+typedef struct {
+    payload_t *items;
+    size_t count;
+    size_t capacity;
+    size_t bytes;
+} corpus_t;
+
+// One batch in flight - its requests have the sequences [first, first + size)
+typedef struct {
+    uint64_t first;
+    int size;
+    int pending;        // Verdicts not read yet
+    int measured;       // Whether the batch counts
+    uint64_t sent_at;
+} batch_t;
+
+typedef struct {
+    pid_t pid;
+    int in;             // Analyzer stdin
+    int out;            // Analyzer stdout
+    int ready;
+    int threads;        // "threads" of its ready message, -1 if it gave none
+    int closed;         // Stdout reached EOF
+    char *line;         // Partial output line
+    size_t line_len;
+    size_t line_cap;
+    batch_t batches[MAX_DEPTH];     // In flight, in the order they were sent
+    int batch_count;
+    int pending;        // Verdicts of all batches in flight
+    long peak_rss_kb;
+} analyzer_t;
+
+typedef struct {
+    const char *analyzer;
+    const char *rules;
+    const char *cache;
+    int threads;        // --threads of the analyzers, -1 - not passed
+    int depth;          // Batches in flight per analyzer
+} launch_t;
+
+typedef struct {
+    int batch;
+    int concurrency;
+    uint64_t requests;      // Measured verdicts
+    uint64_t bytes;         // Of the measured requests
+    uint64_t ns;            // Measured wall time
+    uint64_t errors;
+    long peak_rss_kb;       // The largest analyzer
+    int threads;            // Threads the analyzers reported, -1 if they did not
+    histogram_t latency;
+} run_t;
+
+static int load_corpus(const char *path, corpus_t *corpus);
+static int add_request(corpus_t *corpus, json_object *request);
+static void free_corpus(corpus_t *corpus);
+static int parse_list(const char *text, int *values, int max);
+static int run_config(const launch_t *launch, const corpus_t *corpus, int batch, int concurrency,
+                      uint64_t requests, uint64_t warmup, run_t *run);
+static int spawn_analyzer(const launch_t *launch, analyzer_t *analyzer);
+static void stop_analyzer(analyzer_t *analyzer);
+static int send_batch(analyzer_t *analyzer, const corpus_t *corpus, size_t *cursor, int batch,
+                      uint64_t *sequence, char **buf, size_t *buf_cap);
+static int read_output(analyzer_t *analyzer, run_t *run, uint64_t *received, int *finished);
+static int write_all(int fd, const char *data, size_t len);
+static void histogram_record(histogram_t *histogram, uint64_t value);
+static uint64_t histogram_percentile(const histogram_t *histogram, double percentile);
+static void print_run(const run_t *run);
+static int append_csv(const char *path, const launch_t *launch, const char *corpus_name, const run_t *run);
+static uint64_t now_ns(void);
+
+int main(int argc, char **argv) {
+    launch_t launch = { DEFAULT_ANALYZER, NULL, NULL, -1, DEFAULT_DEPTH };
+    const char *corpus_paths[MAX_CORPORA];
+    int corpus_count = 0;
+    const char *batches = DEFAULT_BATCHES;
+    const char *concurrency = DEFAULT_CONCURRENCY;
+    const char *csv = DEFAULT_CSV;
+    long long requests = DEFAULT_REQUESTS;
+    long long warmup = DEFAULT_WARMUP;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--analyzer") == 0 && i + 1 < argc) {
+            launch.analyzer = argv[++i];
+        } else if (strcmp(argv[i], "--rules") == 0 && i + 1 < argc) {
+            launch.rules = argv[++i];
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            launch.cache = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            launch.threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            launch.depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc && corpus_count < MAX_CORPORA) {
+            corpus_paths[corpus_count++] = argv[++i];
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batches = argv[++i];
+        } else if (strcmp(argv[i], "--concurrency") == 0 && i + 1 < argc) {
+            concurrency = argv[++i];
+        } else if (strcmp(argv[i], "--requests") == 0 && i + 1 < argc) {
+            requests = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmup = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            fprintf(stderr, "Usage: %s [--analyzer PATH] [--corpus FILE]... [--batch 1,8,32] [--concurrency 1,2,4]\n"
+                            "       [--depth N] [--requests N] [--warmup N] [--threads N] [--rules RULES_FILE]\n"
+                            "       [--cache ENTRIES] [--csv FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (corpus_count == 0) {
+        corpus_paths[corpus_count++] = "bench/corpus/clean.txt";
+        corpus_paths[corpus_count++] = "bench/corpus/attack.txt";
+    }
+
+    int batch_sizes[MAX_SWEEP], concurrencies[MAX_SWEEP];
+    int batch_count = parse_list(batches, batch_sizes, MAX_SWEEP);
+    int concurrency_count = parse_list(concurrency, concurrencies, MAX_SWEEP);
+    if (batch_count == 0 || concurrency_count == 0 || requests <= 0 || warmup < 0) {
+        fprintf(stderr, "Batch sizes, concurrency and requests must be positive\n");
+        return 1;
+    }
+    if (launch.depth < 1 || launch.depth > MAX_DEPTH) {
+        fprintf(stderr, "Depth must be between 1 and %d\n", MAX_DEPTH);
+        return 1;
+    }
+
+    corpus_t corpus = {0};
+    char corpus_name[1024] = "";
+    for (int c = 0; c < corpus_count; c++) {
+        if (!load_corpus(corpus_paths[c], &corpus)) return 1;
+
+        const char *base = strrchr(corpus_paths[c], '/');
+        size_t used = strlen(corpus_name);
+        snprintf(corpus_name + used, sizeof(corpus_name) - used, "%s%s", c > 0 ? "+" : "", base ? base + 1 : corpus_paths[c]);
+    }
+    if (corpus.count == 0) {
+        fprintf(stderr, "The corpus has no requests\n");
+        return 1;
+    }
+
+    // An analyzer that dies must not take the replay down with it
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("Analyzer: %s, corpus: %s (%zu requests, %zu bytes), %lld requests per run after %lld of warmup, "
+           "%d batches in flight per analyzer\n",
+           launch.analyzer, corpus_name, corpus.count, corpus.bytes, requests, warmup, launch.depth);
+    printf("%6s %5s %12s %10s %10s %10s %10s %10s %12s %7s\n",
+           "batch", "procs", "requests/s", "MB/s", "p50 ms", "p99 ms", "p99.9 ms", "max ms", "peak RSS KB", "errors");
+
+    int status = 0;
+    for (int b = 0; b < batch_count; b++) {
+        for (int c = 0; c < concurrency_count; c++) {
+            run_t *run = calloc(1, sizeof(run_t));
+            if (!run) {
+                fprintf(stderr, "Out of memory\n");
+                return 1;
+            }
+
+            if (!run_config(&launch, &corpus, batch_sizes[b], concurrencies[c], (uint64_t)requests, (uint64_t)warmup, run)) {
+                status = 1;
+            }
+            print_run(run);
+            if (!append_csv(csv, &launch, corpus_name, run)) status = 1;
+            free(run);
+        }
+    }
+
+    free_corpus(&corpus);
+    return status;
+}
+
+static int load_corpus(const char *path, corpus_t *corpus) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Could not read %s\n", path);
+        return 0;
+    }
+
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t read;
+    int ok = 1;
+    while (ok && (read = getline(&line, &cap, file)) != -1) {
+        while (read > 0 && (line[read - 1] == '\n' || line[read - 1] == '\r')) line[--read] = '\0';
+        if (read == 0) continue;
+
+        if (line[0] == '[' || line[0] == '{') {
+            json_object *root = json_tokener_parse(line);
+            if (!root) {
+                fprintf(stderr, "Skipping a line of %s that is not JSON\n", path);
+                continue;
+            }
+            if (json_object_is_type(root, json_type_array)) {
+                size_t n = json_object_array_length(root);
+                for (size_t k = 0; k < n && ok; k++) {
+                    ok = add_request(corpus, json_object_array_get_idx(root, k));
+                }
+            } else {
+                ok = add_request(corpus, root);
+            }
+            json_object_put(root);
+        } else {
+            // A plain url, as in the benchmark corpora
+            json_object *request = json_object_new_object();
+            json_object_object_add(request, "url", json_object_new_string(line));
+            json_object_object_add(request, "headers", json_object_new_string("{}"));
+            json_object_object_add(request, "body", json_object_new_string(""));
+            ok = add_request(corpus, request);
+            json_object_put(request);
+        }
+    }
+
+    free(line);
+    fclose(file);
+    if (!ok) fprintf(stderr, "Out of memory\n");
+    return ok;
+}
+
+// Only what the analyzer reads is kept - url, headers and body, as strings
+static int add_request(corpus_t *corpus, json_object *request) {
+    if (!json_object_is_type(request, json_type_object)) return 1;
+
+    if (corpus->count == corpus->capacity) {
+        size_t capacity = corpus->capacity ? corpus->capacity * 2 : 256;
+        payload_t *grown = realloc(corpus->items, capacity * sizeof(payload_t));
+        if (!grown) return 0;
+        corpus->items = grown;
+        corpus->capacity = capacity;
+    }
+
+    static const char *const fields[] = { "url", "headers", "body" };
+    json_object *copy = json_object_new_object();
+    for (size_t k = 0; k < sizeof(fields) / sizeof(fields[0]); k++) {
+        json_object *value;
+        if (json_object_object_get_ex(request, fields[k], &value)) {
+            json_object_object_add(copy, fields[k], json_object_new_string(json_object_get_string(value)));
+        }
+    }
+
+    const char *text = json_object_to_json_string_ext(copy, JSON_C_TO_STRING_PLAIN);
+    payload_t *payload = &corpus->items[corpus->count];
+    payload->len = strlen(text);
+    payload->text = strdup(text);
+    json_object_put(copy);
+    if (!payload->text) return 0;
+
+    corpus->count++;
+    corpus->bytes += payload->len;
+    return 1;
+}
+
+static void free_corpus(corpus_t *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) {
+        free(corpus->items[i].text);
+    }
+    free(corpus->items);
+    memset(corpus, 0, sizeof(*corpus));
+}
+
+// "1,8,32" -> values, returns how many (0 on a value that is not positive)
+static int parse_list(const char *text, int *values, int max) {
+    int count = 0;
+    const char *p = text;
+    while (*p && count < max) {
+        char *end;
+        long value = strtol(p, &end, 10);
+        if (end == p || value <= 0) return 0;
+        values[count++] = (int)value;
+        p = *end == ',' ? end + 1 : end;
+        if (*end && *end != ',') return 0;
+    }
+    return count;
+}
+
+// One batch size x concurrency: the analyzers are started for the run and stopped after it,
+// so every run starts cold and their peak RSS belongs to it
+static int run_config(const launch_t *launch, const corpus_t *corpus, int batch, int concurrency,
+                      uint64_t requests, uint64_t warmup, run_t *run) {
+    run->batch = batch;
+    run->concurrency = concurrency;
+
+    analyzer_t *analyzers = calloc(concurrency, sizeof(analyzer_t));
+    struct pollfd *fds = calloc(concurrency, sizeof(struct pollfd));
+    char *buf = NULL;
+    size_t buf_cap = 0;
+    if (!analyzers || !fds) {
+        free(analyzers);
+        free(fds);
+        return 0;
+    }
+
+    int ok = 1;
+    int started = 0;
+    for (; started < concurrency && ok; started++) {
+        ok = spawn_analyzer(launch, &analyzers[started]);
+    }
+    if (!ok) started--;
+
+    size_t cursor = 0;
+    uint64_t sequence = 0;                  // Requests sent
+    uint64_t received = 0;                  // Measured verdicts
+    uint64_t total = warmup + requests;
+    uint64_t measure_start = 0;
+    uint64_t last_progress = now_ns();
+    int in_flight = 0;
+
+    while (ok) {
+        // Analyzers below the depth get the next batch while there is something left to send,
+        // one per round - the least loaded first, as the proxy picks its workers
+        for (int level = 0; level < launch->depth && sequence < total; level++) {
+            for (int a = 0; a < started && sequence < total; a++) {
+                analyzer_t *analyzer = &analyzers[a];
+                if (!analyzer->ready || analyzer->closed || analyzer->batch_count > level) continue;
+
+                int size = (uint64_t)batch < total - sequence ? batch : (int)(total - sequence);
+                int measured = sequence >= warmup;
+                if (measured && measure_start == 0) measure_start = now_ns();
+                if (measured) {
+                    for (int k = 0; k < size; k++) {
+                        run->bytes += corpus->items[(cursor + k) % corpus->count].len;
+                    }
+                }
+                if (!send_batch(analyzer, corpus, &cursor, size, &sequence, &buf, &buf_cap)) {
+                    run->errors += size;
+                    analyzer->closed = 1;
+                    continue;
+                }
+                analyzer->batches[analyzer->batch_count - 1].measured = measured;
+                in_flight++;
+            }
+        }
+        if (in_flight == 0 && sequence >= total) break;
+
+        int open = 0;
+        for (int a = 0; a < started; a++) {
+            fds[a].fd = analyzers[a].closed ? -1 : analyzers[a].out;
+            fds[a].events = POLLIN;
+            fds[a].revents = 0;
+            if (!analyzers[a].closed) open++;
+        }
+        if (open == 0) {
+            ok = 0;
+            break;
+        }
+
+        int n = poll(fds, started, 1000);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ok = 0;
+            break;
+        }
+        if (n == 0) {
+            if ((now_ns() - last_progress) / 1000000 > STALL_TIMEOUT_MS) {
+                fprintf(stderr, "No verdicts for %d ms, giving up on batch %d x %d\n", STALL_TIMEOUT_MS, batch, concurrency);
+                ok = 0;
+            }
+            continue;
+        }
+
+        for (int a = 0; a < started; a++) {
+            if (!(fds[a].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+            analyzer_t *analyzer = &analyzers[a];
+            int finished = 0;
+            if (!read_output(analyzer, run, &received, &finished)) {
+                // Gone before its batches were answered
+                run->errors += analyzer->pending;
+                finished += analyzer->batch_count;
+                analyzer->pending = 0;
+                analyzer->batch_count = 0;
+                analyzer->closed = 1;
+            }
+            in_flight -= finished;
+            last_progress = now_ns();
+        }
+    }
+
+    run->ns = measure_start ? now_ns() - measure_start : 0;
+    run->requests = received;
+    // Whatever was never answered, a run that broke off included
+    if (!ok && received + run->errors < requests) run->errors = requests - received;
+    run->threads = -1;
+    for (int a = 0; a < started; a++) {
+        stop_analyzer(&analyzers[a]);
+        if (analyzers[a].peak_rss_kb > run->peak_rss_kb) run->peak_rss_kb = analyzers[a].peak_rss_kb;
+        if (analyzers[a].threads > run->threads) run->threads = analyzers[a].threads;
+    }
+
+    free(buf);
+    free(analyzers);
+    free(fds);
+    return ok;
+}
+
+static int spawn_analyzer(const launch_t *launch, analyzer_t *analyzer) {
+    int to_child[2], from_child[2];
+    if (pipe(to_child) < 0) return 0;
+    if (pipe(from_child) < 0) {
+        close(to_child[0]);
+        close(to_child[1]);
+        return 0;
+    }
+
+    char threads[16];
+    const char *args[10];
+    int n = 0;
+    args[n++] = launch->analyzer;
+    if (launch->threads >= 0) {
+        snprintf(threads, sizeof(threads), "%d", launch->threads);
+        args[n++] = "--threads";
+        args[n++] = threads;
+    }
+    if (launch->rules) {
+        args[n++] = "--rules";
+        args[n++] = launch->rules;
+    }
+    if (launch->cache) {
+        args[n++] = "--cache";
+        args[n++] = launch->cache;
+    }
+    args[n] = NULL;
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(to_child[0]); close(to_child[1]);
+        close(from_child[0]); close(from_child[1]);
+        return 0;
+    }
+    if (pid == 0) {
+        dup2(to_child[0], STDIN_FILENO);
+        dup2(from_child[1], STDOUT_FILENO);
+        close(to_child[0]); close(to_child[1]);
+        close(from_child[0]); close(from_child[1]);
+        execv(launch->analyzer, (char *const *)args);
+        fprintf(stderr, "Could not start %s: %s\n", launch->analyzer, strerror(errno));
+        _exit(127);
+    }
+
+    close(to_child[0]);
+    close(from_child[1]);
+    // Analyzers started later must not hold this one's stdin open - it would never see EOF
+    fcntl(to_child[1], F_SETFD, FD_CLOEXEC);
+    fcntl(from_child[0], F_SETFD, FD_CLOEXEC);
+    memset(analyzer, 0, sizeof(*analyzer));
+    analyzer->pid = pid;
+    analyzer->threads = -1;
+    analyzer->in = to_child[1];
+    analyzer->out = from_child[0];
+    return 1;
+}
+
+// Closes stdin - the analyzer finishes and exits - and takes its resource usage
+static void stop_analyzer(analyzer_t *analyzer) {
+    if (analyzer->pid <= 0) return;
+
+    close(analyzer->in);
+    close(analyzer->out);
+
+    struct rusage usage;
+    int status;
+    if (wait4(analyzer->pid, &status, 0, &usage) == analyzer->pid) {
+#ifdef __APPLE__
+        analyzer->peak_rss_kb = usage.ru_maxrss / 1024;    // Bytes on macOS
+#else
+        analyzer->peak_rss_kb = usage.ru_maxrss;
+#endif
+    }
+    free(analyzer->line);
+    analyzer->pid = 0;
+}
+
+// [{"id":"<sequence>", ...request}, ...] in one line, all of it before the verdicts are read -
+// the analyzer reads the whole line before it answers
+static int send_batch(analyzer_t *analyzer, const corpus_t *corpus, size_t *cursor, int batch,
+                      uint64_t *sequence, char **buf, size_t *buf_cap) {
+    size_t need = 4;
+    for (int k = 0; k < batch; k++) {
+        need += corpus->items[(*cursor + k) % corpus->count].len + 32;
+    }
+    if (need > *buf_cap) {
+        char *grown = realloc(*buf, need);
+        if (!grown) return 0;
+        *buf = grown;
+        *buf_cap = need;
+    }
+
+    char *p = *buf;
+    *p++ = '[';
+    for (int k = 0; k < batch; k++) {
+        const payload_t *payload = &corpus->items[*cursor];
+        *cursor = (*cursor + 1) % corpus->count;
+
+        if (k > 0) *p++ = ',';
+        p += sprintf(p, "{\"id\":\"%llu\"", (unsigned long long)(*sequence)++);
+        // The payload is {...} - its members follow the id
+        if (payload->len > 2) *p++ = ',';
+        memcpy(p, payload->text + 1, payload->len - 1);
+        p += payload->len - 1;
+    }
+    *p++ = ']';
+    *p++ = '\n';
+
+    uint64_t sent_at = now_ns();
+    if (!write_all(analyzer->in, *buf, p - *buf)) return 0;
+
+    analyzer->batches[analyzer->batch_count++] = (batch_t){
+        .first = *sequence - batch,
+        .size = batch,
+        .pending = batch,
+        .sent_at = sent_at,
+    };
+    analyzer->pending += batch;
+    return 1;
+}
+
+// Reads what the analyzer wrote. Lines: the ready message, then JSON arrays with one or more
+// verdicts ({"id":"<sequence>", "result":"..."} - the result is an escaped string, so an
+// unescaped {"id": only starts a verdict). The id tells the batch, verdicts of a batch can
+// come in any order. finished receives the number of batches answered in full. Returns 0
+// once the analyzer is gone.
+static int read_output(analyzer_t *analyzer, run_t *run, uint64_t *received, int *finished) {
+    char chunk[READ_CHUNK];
+    ssize_t n = read(analyzer->out, chunk, sizeof(chunk));
+    if (n < 0 && errno == EINTR) return 1;
+    if (n <= 0) return 0;
+
+    uint64_t now = now_ns();
+    for (ssize_t i = 0; i < n; i++) {
+        if (chunk[i] != '\n') {
+            if (analyzer->line_len + 1 > analyzer->line_cap) {
+                size_t cap = analyzer->line_cap ? analyzer->line_cap * 2 : 4096;
+                char *grown = realloc(analyzer->line, cap);
+                if (!grown) return 0;
+                analyzer->line = grown;
+                analyzer->line_cap = cap;
+            }
+            analyzer->line[analyzer->line_len++] = chunk[i];
+            continue;
+        }
+
+        const char *line = analyzer->line;
+        size_t len = analyzer->line_len;
+        analyzer->line_len = 0;
+        if (len == 0) continue;
+
+        if (line[0] == '{') {
+            if (len >= 17 && memcmp(line, "{\"status\":\"ready\"", 17) == 0) {
+                analyzer->ready = 1;
+                // What it resolved --threads (or its default) to, for the CSV
+                char text[256];
+                json_object *message = NULL, *threads;
+                if (len < sizeof(text)) {
+                    memcpy(text, line, len);
+                    text[len] = '\0';
+                    message = json_tokener_parse(text);
+                }
+                if (message && json_object_object_get_ex(message, "threads", &threads)) {
+                    analyzer->threads = json_object_get_int(threads);
+                }
+                json_object_put(message);
+            }
+            continue;
+        }
+
+        for (size_t k = 0; k + 6 <= len; k++) {
+            if (memcmp(line + k, "{\"id\":", 6) != 0) continue;
+            k += 5;
+
+            const char *id = line + k + 1;
+            if (*id == '"') id++;
+            uint64_t sequence = strtoull(id, NULL, 10);
+
+            int b = 0;
+            while (b < analyzer->batch_count &&
+                   (sequence < analyzer->batches[b].first ||
+                    sequence >= analyzer->batches[b].first + analyzer->batches[b].size)) {
+                b++;
+            }
+            if (b == analyzer->batch_count) continue;   // Not one of ours
+
+            batch_t *batch = &analyzer->batches[b];
+            batch->pending--;
+            analyzer->pending--;
+            if (batch->measured) {
+                histogram_record(&run->latency, now - batch->sent_at);
+                (*received)++;
+            }
+            if (batch->pending == 0) {
+                memmove(batch, batch + 1, (analyzer->batch_count - b - 1) * sizeof(batch_t));
+                analyzer->batch_count--;
+                (*finished)++;
+            }
+        }
+    }
+    return 1;
+}
+
+static int write_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        data += n;
+        len -= n;
+    }
+    return 1;
+}
+
+static size_t histogram_index(uint64_t value) {
+    if (value < HISTOGRAM_SUB_COUNT) return value;
+
+    int exponent = 63 - __builtin_clzll(value);
+    int shift = exponent - HISTOGRAM_SUB_BITS;
+    size_t mantissa = (value >> shift) & (HISTOGRAM_SUB_COUNT - 1);
+    return (size_t)(shift + 1) * HISTOGRAM_SUB_COUNT + mantissa;
+}
+
+// Largest value that lands in the bucket
+static uint64_t histogram_value(size_t index) {
+    size_t row = index / HISTOGRAM_SUB_COUNT;
+    uint64_t mantissa = index % HISTOGRAM_SUB_COUNT;
+    if (row == 0) return mantissa;
+
+    int shift = (int)row - 1;
+    uint64_t lowest = (1ULL << (shift + HISTOGRAM_SUB_BITS)) + (mantissa << shift);
+    return lowest + (1ULL << shift) - 1;
+}
+
+static void histogram_record(histogram_t *histogram, uint64_t value) {
+    histogram->counts[histogram_index(value)]++;
+    histogram->count++;
+    if (value > histogram->max) histogram->max = value;
+}
+
+// percentile in [0, 100]
+static uint64_t histogram_percentile(const histogram_t *histogram, double percentile) {
+    if (histogram->count == 0) return 0;
+
+    uint64_t target = (uint64_t)(percentile / 100.0 * histogram->count + 0.5);
+    if (target == 0) target = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < HISTOGRAM_SIZE; i++) {
+        seen += histogram->counts[i];
+        if (seen >= target) {
+            uint64_t value = histogram_value(i);
+            return value < histogram->max ? value : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+static void print_run(const run_t *run) {
+    double seconds = run->ns / 1e9;
+    printf("%6d %5d %12.0f %10.2f %10.3f %10.3f %10.3f %10.3f %12ld %7llu\n",
+           run->batch, run->concurrency,
+           seconds > 0 ? run->requests / seconds : 0.0,
+           seconds > 0 ? run->bytes / seconds / 1e6 : 0.0,
+           histogram_percentile(&run->latency, 50) / 1e6,
+           histogram_percentile(&run->latency, 99) / 1e6,
+           histogram_percentile(&run->latency, 99.9) / 1e6,
+           run->latency.max / 1e6,
+           run->peak_rss_kb, (unsigned long long)run->errors);
+    fflush(stdout);
+}
+
+// One row per run, the header when the file is new - the layout of test/test.py's wrk_results.csv
+static int append_csv(const char *path, const launch_t *launch, const char *corpus_name, const run_t *run) {
+    int exists = access(path, F_OK) == 0;
+    FILE *file = fopen(path, "a");
+    if (!file) {
+        fprintf(stderr, "Could not write %s\n", path);
+        return 0;
+    }
+
+    if (!exists) {
+        fprintf(file, "timestamp,analyzer,corpus,batch_size,concurrency,depth,threads,requests,duration_s,rps,"
+                      "mb_s,p50_ms,p99_ms,p999_ms,max_ms,peak_rss_kb,errors\n");
+    }
+
+    char timestamp[32];
+    time_t now = time(NULL);
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    double seconds = run->ns / 1e9;
+    fprintf(file, "%s,%s,%s,%d,%d,%d,%d,%llu,%.3f,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f,%ld,%llu\n",
+            timestamp, launch->analyzer, corpus_name, run->batch, run->concurrency, launch->depth, run->threads,
+            (unsigned long long)run->requests, seconds,
+            seconds > 0 ? run->requests / seconds : 0.0,
+            seconds > 0 ? run->bytes / seconds / 1e6 : 0.0,
+            histogram_percentile(&run->latency, 50) / 1e6,
+            histogram_percentile(&run->latency, 99) / 1e6,
+            histogram_percentile(&run->latency, 99.9) / 1e6,
+            run->latency.max / 1e6,
+            run->peak_rss_kb, (unsigned long long)run->errors);
+    fclose(file);
+    return 1;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
@@ -0,0 +1,25 @@
+#!/bin/bash
+# Builds the replay harness and runs it against an analyzer binary, from the repository root:
+#   ./bench/replay.sh [--analyzer PATH] [--corpus FILE]... [--batch 1,8,32] [--concurrency 1,2,4]
+#                     [--depth N] [--requests N] [--warmup N] [--threads N] [--rules RULES_FILE]
+#                     [--cache ENTRIES] [--csv FILE]
+# The analyzer is driven over its JSON line protocol, as the proxy drives it. Build it first
+# with ./compile.sh.
+
+REPLAY_NAME=bench/analyzer-replay
+
+echo "🔨 Compiling replay harness..."
+
+gcc -O2 \
+    -I/opt/homebrew/include \
+    bench/replay.c \
+    -L/opt/homebrew/lib \
+    -ljson-c \
+    -o ${REPLAY_NAME}
+
+if [ $? -ne 0 ]; then
+    echo "❌ Compilation error!"
+    exit 1
+fi
+
+./${REPLAY_NAME} "$@"
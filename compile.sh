@@ -34,6 +34,11 @@ gcc -O2 \
     -c analyzer/html-decoder.c \
     -o analyzer/html-decoder.o
 
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/transforms.c \
+    -o analyzer/transforms.o
+
 gcc -O2 \
     -I/opt/homebrew/include \
     -Ianalyzer/detectors \
@@ -41,18 +46,95 @@ gcc -O2 \
     -c analyzer/detectors/detection.c \
     -o analyzer/detectors/detection.o
 
+gcc -O2 \
+    -Ianalyzer/detectors \
+    -c analyzer/detectors/fingerprint.c \
+    -o analyzer/detectors/fingerprint.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/aho-corasick.c \
+    -o analyzer/aho-corasick.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/simd.c \
+    -o analyzer/simd.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/arena.c \
+    -o analyzer/arena.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/binary-protocol.c \
+    -o analyzer/binary-protocol.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/thread-pool.c \
+    -o analyzer/thread-pool.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/shm-ring.c \
+    -o analyzer/shm-ring.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/request-parser.c \
+    -o analyzer/request-parser.o
+
+gcc -O2 \
+    -I/opt/homebrew/include \
+    -Ianalyzer/detectors \
+    -Ianalyzer \
+    -c analyzer/stream.c \
+    -o analyzer/stream.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/hash.c \
+    -o analyzer/hash.o
+
+gcc -O2 \
+    -Ianalyzer \
+    -c analyzer/verdict-cache.c \
+    -o analyzer/verdict-cache.o
+
+gcc -O2 \
+    -I/opt/homebrew/include \
+    -Ianalyzer/detectors \
+    -Ianalyzer \
+    -c analyzer/stats.c \
+    -o analyzer/stats.o
+
 echo "🔗 Component linking..."
 
 # Link with g++ - because of C++ code in RE2 wrapper
 g++ -O2 \
     analyzer/main.o \
     analyzer/html-decoder.o \
+    analyzer/transforms.o \
     analyzer/detectors/detection.o \
+    analyzer/detectors/fingerprint.o \
+    analyzer/aho-corasick.o \
+    analyzer/simd.o \
+    analyzer/arena.o \
+    analyzer/binary-protocol.o \
+    analyzer/thread-pool.o \
+    analyzer/shm-ring.o \
+    analyzer/request-parser.o \
+    analyzer/stream.o \
+    analyzer/hash.o \
+    analyzer/verdict-cache.o \
+    analyzer/stats.o \
     analyzer/re2_wrapper.o \
     -L/opt/homebrew/lib \
     -lre2 \
-    -luri_encode \
     -ljson-c \
+    -pthread \
     -o ${ANALYZER_NAME}
 
 if [ $? -eq 0 ]; then
@@ -63,4 +145,64 @@ if [ $? -eq 0 ]; then
 else
     echo "❌ Linking error!"
     exit 1
-fi
\ No newline at end of file
+fi
+
+# Optional - Node addons of the proxy: the IP lists (proxy/ip-reputation.js) and the analyzer
+# in process (ANALYZER_MODE=addon). Without them the proxy keeps the lists in JavaScript and
+# spawns analyzer processes.
+echo "🔨 Compiling the Node addons..."
+
+NODE_INCLUDE=${NODE_INCLUDE:-$(node -p "require('path').resolve(process.execPath, '../../include/node')" 2>/dev/null)}
+ADDON_FLAGS="-shared -fPIC"
+if [ "$(uname)" = "Darwin" ]; then
+    ADDON_FLAGS="${ADDON_FLAGS} -undefined dynamic_lookup"
+fi
+
+if [ ! -f "${NODE_INCLUDE}/node_api.h" ]; then
+    echo "⚠️  Node headers not found (set NODE_INCLUDE), the proxy runs without its addons"
+    exit 0
+fi
+
+gcc -O2 ${ADDON_FLAGS} \
+    -I"${NODE_INCLUDE}" \
+    -Ianalyzer \
+    proxy/addon/ip-reputation-addon.c \
+    proxy/addon/ip-reputation.c \
+    analyzer/hash.c \
+    -o proxy/addon/ip_reputation.node \
+    && echo "✅ proxy/addon/ip_reputation.node ready for use" \
+    || echo "⚠️  IP reputation addon not built, the proxy uses the JavaScript lists"
+
+g++ -std=c++17 -O2 -fPIC \
+    -I/opt/homebrew/include \
+    -Ianalyzer \
+    -c analyzer/re2_wrapper.cpp \
+    -o proxy/addon/re2_wrapper.o \
+&& gcc -O2 ${ADDON_FLAGS} \
+    -I"${NODE_INCLUDE}" \
+    -I/opt/homebrew/include \
+    -Ianalyzer/detectors \
+    -Ianalyzer \
+    proxy/addon/analyzer-addon.c \
+    analyzer/detectors/detection.c \
+    analyzer/detectors/fingerprint.c \
+    analyzer/html-decoder.c \
+    analyzer/transforms.c \
+    analyzer/aho-corasick.c \
+    analyzer/simd.c \
+    analyzer/arena.c \
+    analyzer/request-parser.c \
+    analyzer/hash.c \
+    analyzer/verdict-cache.c \
+    analyzer/stats.c \
+    proxy/addon/re2_wrapper.o \
+    -L/opt/homebrew/lib \
+    -lre2 \
+    -ljson-c \
+    -lstdc++ \
+    -pthread \
+    -o proxy/addon/analyzer.node \
+    && echo "✅ proxy/addon/analyzer.node ready for use" \
+    || echo "⚠️  Analyzer addon not built, ANALYZER_MODE=addon falls back to analyzer processes"
+
+rm -f proxy/addon/*.o
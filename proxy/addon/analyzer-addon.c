@@ -0,0 +1,407 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <node_api.h>
+
+#include "detection.h"
+#include "request-parser.h"
+#include "arena.h"
+#include "simd.h"
+#include "verdict-cache.h"
+#include "stats.h"
+
+// The analyzer inside the Node process, used by proxy/worker-pool.js with ANALYZER_MODE=addon.
+// Same rules engine as analyzer.c, without the pipe and the serialization in both directions:
+//   load(rulesPath, cacheEntries) -> boolean (false - the rules did not compile, nothing matches)
+//   analyze(fields, callback[, budgets]) - fields: [url, headers, body, url, headers, body, ...], strings
+//       or Buffers (read in place). callback(err, verdicts), a {status, score, findings} per request.
+//       budgets: microseconds each request has left from the call on (0 - no deadline), a request
+//       that runs out of it gets {..., incomplete: true, evaluated: [categories]}.
+//   reload() - compiles the rules file again off the main thread
+//   stats() -> {"status":"stats",...} text, see stats_format()
+//
+// Batches run on the libuv thread pool (UV_THREADPOOL_SIZE threads), the rules, the verdict
+// cache and the counters are shared by all of them, like the threads of a shared analyzer.
+
+#define FIELDS_PER_REQUEST 3
+// Arena of one batch, the same sizes as a line of the analyzer process
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_MAX_RETAINED (4 * 1024 * 1024)
+// Finished batches kept for reuse, with their arenas
+#define BATCHES_RETAINED 16
+
+typedef struct {
+    const char *data;   // NULL - not given
+    size_t len;
+} input_t;
+
+typedef struct {
+    napi_async_work work;
+    napi_ref fields;        // Keeps the Buffers read in place alive until the batch is done
+    napi_ref callback;
+    arena_t arena;
+    size_t count;
+    input_t *inputs;        // FIELDS_PER_REQUEST per request
+    uint64_t *deadlines;    // Per request, NULL - none of them has one
+    detection_report_t *reports;
+    ruleset_t *rules;       // The findings point into it, held until they are converted
+    uint64_t begin;
+    uint64_t scanned;
+} batch_t;
+
+static int loaded = 0;
+static int rules_compiled = 0;
+// Batches are only created and finished on the main thread, the free list needs no lock
+static batch_t *free_batches[BATCHES_RETAINED];
+static int free_batch_count = 0;
+// One reload at a time, the ones asked for meanwhile are served by a single one after it
+static napi_async_work reload_work = NULL;
+static int reload_pending = 0;
+
+static napi_value load(napi_env env, napi_callback_info info);
+static napi_value analyze_batch(napi_env env, napi_callback_info info);
+static napi_value reload(napi_env env, napi_callback_info info);
+static napi_value stats(napi_env env, napi_callback_info info);
+static void execute_batch(napi_env env, void *data);
+static void complete_batch(napi_env env, napi_status status, void *data);
+static napi_value verdict_value(napi_env env, const ruleset_t *rules, const detection_report_t *report);
+static void set_string(napi_env env, napi_value object, const char *name, const char *value);
+static int read_input(napi_env env, napi_value value, arena_t *arena, input_t *input);
+static batch_t *take_batch(void);
+static void release_batch(napi_env env, batch_t *batch);
+static void queue_reload(napi_env env);
+static void execute_reload(napi_env env, void *data);
+static void complete_reload(napi_env env, napi_status status, void *data);
+
+NAPI_MODULE_INIT() {
+    napi_property_descriptor functions[] = {
+        { "load", NULL, load, NULL, NULL, NULL, napi_default, NULL },
+        { "analyze", NULL, analyze_batch, NULL, NULL, NULL, napi_default, NULL },
+        { "reload", NULL, reload, NULL, NULL, NULL, napi_default, NULL },
+        { "stats", NULL, stats, NULL, NULL, NULL, napi_default, NULL },
+    };
+    napi_define_properties(env, exports, sizeof(functions) / sizeof(functions[0]), functions);
+    return exports;
+}
+
+// Compiles the rules on the calling thread, once per process - later calls return the first result
+static napi_value load(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value argv[2];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+    if (!loaded) {
+        // Read again by every reload, it stays allocated
+        if (argc > 0) {
+            size_t len = 0;
+            if (napi_get_value_string_utf8(env, argv[0], NULL, 0, &len) == napi_ok) {
+                char *path = malloc(len + 1);
+                if (path) {
+                    napi_get_value_string_utf8(env, argv[0], path, len + 1, &len);
+                    set_rules_path(path);
+                }
+            }
+        }
+
+        int64_t cache_entries = CACHE_DEFAULT_ENTRIES;
+        napi_valuetype type;
+        if (argc > 1 && napi_typeof(env, argv[1], &type) == napi_ok && type == napi_number) {
+            napi_get_value_int64(env, argv[1], &cache_entries);
+        }
+
+        rules_compiled = init_regex_patterns();
+        simd_implementation(); // Resolve the kernels before any pool thread uses them
+        verdict_cache_init(cache_entries > 0 ? (size_t)cache_entries : 0);
+        loaded = 1;
+    }
+
+    napi_value result;
+    napi_get_boolean(env, rules_compiled, &result);
+    return result;
+}
+
+static napi_value analyze_batch(napi_env env, napi_callback_info info) {
+    uint64_t called = stats_now_ns();
+    size_t argc = 3;
+    napi_value argv[3];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+    bool is_array = false;
+    napi_valuetype type = napi_undefined;
+    if (argc < 2 || napi_is_array(env, argv[0], &is_array) != napi_ok || !is_array ||
+        napi_typeof(env, argv[1], &type) != napi_ok || type != napi_function) {
+        napi_throw_type_error(env, NULL, "analyze(fields, callback[, budgets])");
+        return NULL;
+    }
+    if (!loaded) {
+        napi_throw_error(env, NULL, "The rules are not loaded, call load() first");
+        return NULL;
+    }
+
+    uint32_t length = 0;
+    napi_get_array_length(env, argv[0], &length);
+
+    batch_t *batch = take_batch();
+    if (!batch) {
+        napi_throw_error(env, NULL, "Memory allocation failed");
+        return NULL;
+    }
+    batch->count = length / FIELDS_PER_REQUEST;
+    batch->inputs = arena_calloc(&batch->arena, batch->count ? batch->count * FIELDS_PER_REQUEST : 1,
+                                 sizeof(input_t));
+    int ok = batch->inputs != NULL;
+
+    for (size_t i = 0; ok && i < batch->count * FIELDS_PER_REQUEST; i++) {
+        napi_value element;
+        ok = napi_get_element(env, argv[0], (uint32_t)i, &element) == napi_ok &&
+             read_input(env, element, &batch->arena, &batch->inputs[i]);
+    }
+
+    bool has_budgets = false;
+    if (ok && argc > 2 && napi_is_array(env, argv[2], &has_budgets) == napi_ok && has_budgets) {
+        batch->deadlines = arena_calloc(&batch->arena, batch->count ? batch->count : 1, sizeof(uint64_t));
+        ok = batch->deadlines != NULL;
+
+        for (uint32_t i = 0; ok && i < batch->count; i++) {
+            napi_value element;
+            int64_t budget = 0;
+            if (napi_get_element(env, argv[2], i, &element) == napi_ok &&
+                napi_get_value_int64(env, element, &budget) == napi_ok && budget > 0) {
+                batch->deadlines[i] = called + (uint64_t)budget * 1000;
+            }
+        }
+    }
+
+    napi_value name;
+    ok = ok && napi_create_reference(env, argv[0], 1, &batch->fields) == napi_ok &&
+         napi_create_reference(env, argv[1], 1, &batch->callback) == napi_ok &&
+         napi_create_string_utf8(env, "waf-analyze", NAPI_AUTO_LENGTH, &name) == napi_ok &&
+         napi_create_async_work(env, NULL, name, execute_batch, complete_batch, batch, &batch->work) == napi_ok &&
+         napi_queue_async_work(env, batch->work) == napi_ok;
+
+    if (!ok) {
+        release_batch(env, batch);
+        napi_throw_error(env, NULL, "Could not queue the batch");
+    }
+    return NULL;
+}
+
+static napi_value reload(napi_env env, napi_callback_info info) {
+    (void)info;
+    if (!loaded) return NULL;
+
+    if (reload_work) {
+        reload_pending = 1;
+    } else {
+        queue_reload(env);
+    }
+    return NULL;
+}
+
+static napi_value stats(napi_env env, napi_callback_info info) {
+    (void)info;
+    arena_t arena;
+    arena_init(&arena, 16 * 1024, 16 * 1024);
+
+    napi_value result;
+    char *text = stats_format(&arena);
+    if (text) {
+        napi_create_string_utf8(env, text, NAPI_AUTO_LENGTH, &result);
+    } else {
+        napi_get_null(env, &result);
+    }
+
+    arena_destroy(&arena);
+    return result;
+}
+
+// Pool thread - parses and scans the whole batch on one ruleset, no N-API calls here
+static void execute_batch(napi_env env, void *data) {
+    (void)env;
+    batch_t *batch = data;
+    size_t count = batch->count;
+
+    uint64_t begin = stats_now_ns();
+    request_t *requests = arena_calloc(&batch->arena, count ? count : 1, sizeof(request_t));
+    batch->reports = arena_alloc(&batch->arena, (count ? count : 1) * sizeof(detection_report_t));
+    if (!requests || !batch->reports) {
+        batch->reports = NULL;
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const input_t *input = &batch->inputs[i * FIELDS_PER_REQUEST];
+        if (!parse_request_fields(&requests[i], input[0].data, input[0].len, input[1].data, input[1].len,
+                                  input[2].data, input[2].len, &batch->arena)) {
+            requests[i].field_count = 0;
+        }
+    }
+    stats_record_parse(stats_now_ns() - begin);
+
+    batch->rules = ruleset_acquire();
+    batch->begin = stats_now_ns();
+    for (size_t i = 0; i < count; i++) {
+        detection_report_t *report = &batch->reports[i];
+        report->count = 0;
+        report->score = 0;
+        memset(report->reported, 0, sizeof(report->reported));
+        report->deadline = batch->deadlines ? batch->deadlines[i] : 0;
+        report->incomplete = 0;
+        memset(report->skipped, 0, sizeof(report->skipped));
+        analyze_fields(batch->rules, requests[i].fields, requests[i].field_count, report);
+        report->attack = report_is_attack(batch->rules, report);
+        if (report->incomplete) stats_record_incomplete();
+    }
+    batch->scanned = stats_now_ns();
+}
+
+// Main thread - the verdicts become JS objects of the same shape as in the process mode
+static void complete_batch(napi_env env, napi_status status, void *data) {
+    batch_t *batch = data;
+
+    napi_value callback, recv, argv[2];
+    napi_get_reference_value(env, batch->callback, &callback);
+    napi_get_undefined(env, &recv);
+    napi_get_undefined(env, &argv[1]);
+
+    if (status != napi_ok || !batch->reports) {
+        napi_value message;
+        napi_create_string_utf8(env, "Could not analyze the batch", NAPI_AUTO_LENGTH, &message);
+        napi_create_error(env, NULL, message, &argv[0]);
+    } else {
+        napi_get_null(env, &argv[0]);
+        napi_create_array_with_length(env, batch->count, &argv[1]);
+        for (size_t i = 0; i < batch->count; i++) {
+            napi_set_element(env, argv[1], (uint32_t)i, verdict_value(env, batch->rules, &batch->reports[i]));
+        }
+        stats_record_batch(batch->count, batch->begin, batch->scanned);
+    }
+
+    release_batch(env, batch);
+    napi_call_function(env, recv, callback, 2, argv, NULL);
+}
+
+// {status, score, findings: [{attack, location, severity}]} - "severity" holds the description,
+// like the verdicts of the analyzer process. An incomplete one adds incomplete and evaluated.
+static napi_value verdict_value(napi_env env, const ruleset_t *rules, const detection_report_t *report) {
+    napi_value verdict, value, findings;
+    napi_create_object(env, &verdict);
+    set_string(env, verdict, "status", report->attack ? "attack" : "clean");
+    napi_create_int32(env, report->score, &value);
+    napi_set_named_property(env, verdict, "score", value);
+
+    napi_create_array_with_length(env, report->count, &findings);
+    for (size_t i = 0; i < report->count; i++) {
+        const detection_t *item = &report->items[i];
+        napi_value finding;
+        napi_create_object(env, &finding);
+        set_string(env, finding, "attack", item->attack);
+        set_string(env, finding, "location", location_name(item->location));
+        set_string(env, finding, "severity", item->description);
+        napi_set_element(env, findings, (uint32_t)i, finding);
+    }
+    napi_set_named_property(env, verdict, "findings", findings);
+
+    if (report->incomplete) {
+        const char *categories[MAX_PATTERNS];
+        int count = report_evaluated_categories(rules, report, categories, MAX_PATTERNS);
+
+        napi_value incomplete, evaluated;
+        napi_get_boolean(env, true, &incomplete);
+        napi_set_named_property(env, verdict, "incomplete", incomplete);
+        napi_create_array_with_length(env, count, &evaluated);
+        for (int i = 0; i < count; i++) {
+            napi_value category;
+            napi_create_string_utf8(env, categories[i], NAPI_AUTO_LENGTH, &category);
+            napi_set_element(env, evaluated, (uint32_t)i, category);
+        }
+        napi_set_named_property(env, verdict, "evaluated", evaluated);
+    }
+    return verdict;
+}
+
+static void set_string(napi_env env, napi_value object, const char *name, const char *value) {
+    napi_value string;
+    napi_create_string_utf8(env, value, NAPI_AUTO_LENGTH, &string);
+    napi_set_named_property(env, object, name, string);
+}
+
+// Buffers are read in place, strings are copied into the arena as UTF-8, anything else is not given
+static int read_input(napi_env env, napi_value value, arena_t *arena, input_t *input) {
+    input->data = NULL;
+    input->len = 0;
+
+    bool is_buffer = false;
+    if (napi_is_buffer(env, value, &is_buffer) == napi_ok && is_buffer) {
+        void *data = NULL;
+        if (napi_get_buffer_info(env, value, &data, &input->len) != napi_ok) return 0;
+        input->data = data ? data : "";
+        return 1;
+    }
+
+    napi_valuetype type;
+    if (napi_typeof(env, value, &type) != napi_ok || type != napi_string) return 1;
+
+    size_t len = 0;
+    napi_get_value_string_utf8(env, value, NULL, 0, &len);
+    char *copy = arena_alloc(arena, len + 1);
+    if (!copy) return 0;
+    napi_get_value_string_utf8(env, value, copy, len + 1, &input->len);
+    input->data = copy;
+    return 1;
+}
+
+static batch_t *take_batch(void) {
+    if (free_batch_count > 0) return free_batches[--free_batch_count];
+
+    batch_t *batch = calloc(1, sizeof(batch_t));
+    if (batch) arena_init(&batch->arena, ARENA_BLOCK_SIZE, ARENA_MAX_RETAINED);
+    return batch;
+}
+
+static void release_batch(napi_env env, batch_t *batch) {
+    if (batch->work) napi_delete_async_work(env, batch->work);
+    if (batch->fields) napi_delete_reference(env, batch->fields);
+    if (batch->callback) napi_delete_reference(env, batch->callback);
+    ruleset_release(batch->rules);
+
+    arena_t arena = batch->arena;
+    memset(batch, 0, sizeof(batch_t));
+    batch->arena = arena;
+    arena_reset(&batch->arena);
+
+    if (free_batch_count < BATCHES_RETAINED) {
+        free_batches[free_batch_count++] = batch;
+    } else {
+        arena_destroy(&batch->arena);
+        free(batch);
+    }
+}
+
+static void queue_reload(napi_env env) {
+    napi_value name;
+    napi_create_string_utf8(env, "waf-reload", NAPI_AUTO_LENGTH, &name);
+    if (napi_create_async_work(env, NULL, name, execute_reload, complete_reload, NULL, &reload_work) != napi_ok) {
+        reload_work = NULL;
+        return;
+    }
+    napi_queue_async_work(env, reload_work);
+}
+
+static void execute_reload(napi_env env, void *data) {
+    (void)env;
+    (void)data;
+    reload_regex_patterns();
+}
+
+static void complete_reload(napi_env env, napi_status status, void *data) {
+    (void)status;
+    (void)data;
+    napi_delete_async_work(env, reload_work);
+    reload_work = NULL;
+
+    if (reload_pending) {
+        reload_pending = 0;
+        queue_reload(env);
+    }
+}
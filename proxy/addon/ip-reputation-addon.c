@@ -0,0 +1,179 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <node_api.h>
+
+#include "ip-reputation.h"
+
+// Node binding of ip-reputation.c, used through proxy/ip-reputation.js:
+//   compile(ips: string[], hosts: string[], path) -> {prefixes, hosts, invalid}
+//   open(path) -> handle | null,  contains(handle, ip, host) -> boolean,  close(handle)
+
+#define ARG_MAX_LEN 1024
+
+static napi_value compile(napi_env env, napi_callback_info info);
+static napi_value open_list(napi_env env, napi_callback_info info);
+static napi_value contains(napi_env env, napi_callback_info info);
+static napi_value close_list(napi_env env, napi_callback_info info);
+static char **string_array(napi_env env, napi_value array, uint32_t *count);
+static void free_strings(char **strings, uint32_t count);
+static char *string_arg(napi_env env, napi_value value);
+static void finalize_list(napi_env env, void *data, void *hint);
+
+NAPI_MODULE_INIT() {
+    napi_property_descriptor functions[] = {
+        { "compile", NULL, compile, NULL, NULL, NULL, napi_default, NULL },
+        { "open", NULL, open_list, NULL, NULL, NULL, napi_default, NULL },
+        { "contains", NULL, contains, NULL, NULL, NULL, napi_default, NULL },
+        { "close", NULL, close_list, NULL, NULL, NULL, napi_default, NULL },
+    };
+    napi_define_properties(env, exports, sizeof(functions) / sizeof(functions[0]), functions);
+    return exports;
+}
+
+static napi_value compile(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value argv[3];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+    if (argc < 3) {
+        napi_throw_type_error(env, NULL, "compile(ips, hosts, path)");
+        return NULL;
+    }
+
+    uint32_t ip_count = 0, host_count = 0;
+    char **ips = string_array(env, argv[0], &ip_count);
+    char **hosts = string_array(env, argv[1], &host_count);
+    char *path = string_arg(env, argv[2]);
+
+    ip_list_counts_t counts;
+    int ok = ips && hosts && path &&
+             ip_list_compile((const char *const *)ips, ip_count, (const char *const *)hosts, host_count, path, &counts);
+
+    free_strings(ips, ip_count);
+    free_strings(hosts, host_count);
+    free(path);
+
+    if (!ok) {
+        napi_throw_error(env, NULL, "Could not compile the IP list");
+        return NULL;
+    }
+
+    napi_value result, value;
+    napi_create_object(env, &result);
+    napi_create_double(env, (double)counts.prefixes, &value);
+    napi_set_named_property(env, result, "prefixes", value);
+    napi_create_double(env, (double)counts.hosts, &value);
+    napi_set_named_property(env, result, "hosts", value);
+    napi_create_double(env, (double)counts.invalid, &value);
+    napi_set_named_property(env, result, "invalid", value);
+    return result;
+}
+
+// The handle owns the mapping, it is unmapped on close() or when the handle is collected
+static napi_value open_list(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value argv[1];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+    char *path = argc ? string_arg(env, argv[0]) : NULL;
+    ip_list_t *list = path ? ip_list_open(path) : NULL;
+    free(path);
+
+    napi_value result;
+    if (!list) {
+        napi_get_null(env, &result);
+        return result;
+    }
+
+    ip_list_t **slot = malloc(sizeof(ip_list_t *));
+    if (!slot) {
+        ip_list_close(list);
+        napi_get_null(env, &result);
+        return result;
+    }
+    *slot = list;
+    napi_create_external(env, slot, finalize_list, NULL, &result);
+    return result;
+}
+
+static napi_value contains(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value argv[3];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+    ip_list_t **slot = NULL;
+    int found = 0;
+    if (argc == 3 && napi_get_value_external(env, argv[0], (void **)&slot) == napi_ok && slot && *slot) {
+        // Copied to the stack, longer values can not be listed anyway
+        char ip[ARG_MAX_LEN], host[ARG_MAX_LEN];
+        size_t ip_len = 0, host_len = 0;
+        int has_ip = napi_get_value_string_utf8(env, argv[1], ip, sizeof(ip), &ip_len) == napi_ok;
+        int has_host = napi_get_value_string_utf8(env, argv[2], host, sizeof(host), &host_len) == napi_ok;
+
+        found = ip_list_contains(*slot, has_ip ? ip : NULL, has_host ? host : NULL, has_host ? host_len : 0);
+    }
+
+    napi_value result;
+    napi_get_boolean(env, found, &result);
+    return result;
+}
+
+static napi_value close_list(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value argv[1];
+    napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+    ip_list_t **slot = NULL;
+    if (argc == 1 && napi_get_value_external(env, argv[0], (void **)&slot) == napi_ok && slot) {
+        ip_list_close(*slot);
+        *slot = NULL;
+    }
+    return NULL;
+}
+
+static void finalize_list(napi_env env, void *data, void *hint) {
+    (void)env;
+    (void)hint;
+    ip_list_t **slot = data;
+    ip_list_close(*slot);
+    free(slot);
+}
+
+// Copies of the string elements, other elements become NULL (counted as invalid)
+static char **string_array(napi_env env, napi_value array, uint32_t *count) {
+    *count = 0;
+    bool is_array = false;
+    if (napi_is_array(env, array, &is_array) != napi_ok || !is_array) return calloc(1, sizeof(char *));
+
+    uint32_t length = 0;
+    napi_get_array_length(env, array, &length);
+    char **strings = calloc(length ? length : 1, sizeof(char *));
+    if (!strings) return NULL;
+
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value element;
+        if (napi_get_element(env, array, i, &element) == napi_ok) {
+            strings[i] = string_arg(env, element);
+        }
+    }
+    *count = length;
+    return strings;
+}
+
+static void free_strings(char **strings, uint32_t count) {
+    if (!strings) return;
+    for (uint32_t i = 0; i < count; i++) {
+        free(strings[i]);
+    }
+    free(strings);
+}
+
+static char *string_arg(napi_env env, napi_value value) {
+    size_t len = 0;
+    if (napi_get_value_string_utf8(env, value, NULL, 0, &len) != napi_ok) return NULL;
+
+    char *str = malloc(len + 1);
+    if (!str) return NULL;
+    napi_get_value_string_utf8(env, value, str, len + 1, &len);
+    return str;
+}
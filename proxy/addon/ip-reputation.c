@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ip-reputation.h"
+#include "hash.h"
+
+#define IMAGE_MAGIC "WAFIPL1"
+#define HOST_MAX_LEN 255
+// Never a child - node 0 is the root
+#define NO_CHILD 0
+
+// 128-bit address, hi holds the first 8 bytes (network order read as a number)
+typedef struct {
+    uint64_t hi;
+    uint64_t lo;
+} addr_t;
+
+typedef struct {
+    char magic[8];
+    uint32_t node_count;
+    uint32_t host_slots;    // Power of two
+    uint32_t pool_size;     // Bytes of host names
+    uint32_t reserved;
+    uint64_t seed;
+} image_header_t;
+
+typedef struct {
+    addr_t prefix;          // Bits past prefix_len are zero
+    uint32_t child[2];
+    uint8_t prefix_len;     // 0..128
+    uint8_t terminal;       // A listed prefix ends here, everything below it is listed
+    uint8_t reserved[6];
+} image_node_t;
+
+typedef struct {
+    uint64_t hash;
+    uint32_t offset;        // In the pool
+    uint32_t len;           // 0 - free slot
+} image_host_t;
+
+struct ip_list {
+    void *map;
+    size_t size;
+    const image_header_t *header;
+    const image_node_t *nodes;
+    const image_host_t *hosts;
+    const char *pool;
+};
+
+typedef struct {
+    image_node_t *nodes;
+    size_t count;
+    size_t capacity;
+} trie_t;
+
+static int parse_prefix(const char *text, addr_t *addr, int *prefix_len);
+static int parse_address(const char *text, size_t len, addr_t *addr);
+static int trie_insert(trie_t *trie, addr_t key, int prefix_len);
+static uint32_t trie_new_node(trie_t *trie, addr_t key, int prefix_len, int terminal);
+static size_t normalize_host(const char *host, size_t len, char *out);
+static int write_image(const char *path, const void *data, size_t size);
+
+static inline addr_t addr_mask(addr_t a, int bits) {
+    addr_t m;
+    m.hi = bits <= 0 ? 0 : bits >= 64 ? ~0ULL : ~0ULL << (64 - bits);
+    m.lo = bits <= 64 ? 0 : bits >= 128 ? ~0ULL : ~0ULL << (128 - bits);
+    return (addr_t){ a.hi & m.hi, a.lo & m.lo };
+}
+
+static inline int addr_bit(addr_t a, int i) {
+    return i < 64 ? (int)((a.hi >> (63 - i)) & 1) : (int)((a.lo >> (127 - i)) & 1);
+}
+
+// Leading bits a and b have in common
+static inline int common_bits(addr_t a, addr_t b) {
+    uint64_t x = a.hi ^ b.hi;
+    if (x) return __builtin_clzll(x);
+    x = a.lo ^ b.lo;
+    return x ? 64 + __builtin_clzll(x) : 128;
+}
+
+int ip_list_compile(const char *const *ips, size_t ip_count, const char *const *hosts, size_t host_count,
+                    const char *path, ip_list_counts_t *counts) {
+    memset(counts, 0, sizeof(*counts));
+
+    trie_t trie = { 0 };
+    if (trie_new_node(&trie, (addr_t){ 0, 0 }, 0, 0) == NO_CHILD && !trie.nodes) return 0;
+
+    for (size_t i = 0; i < ip_count; i++) {
+        addr_t key;
+        int prefix_len;
+        if (!ips[i] || !parse_prefix(ips[i], &key, &prefix_len)) {
+            counts->invalid++;
+            continue;
+        }
+        if (!trie_insert(&trie, key, prefix_len)) {
+            free(trie.nodes);
+            return 0;
+        }
+        counts->prefixes++;
+    }
+
+    // Open addressing, at most half full
+    size_t slots = 16;
+    while (slots < host_count * 2) slots <<= 1;
+
+    size_t pool_size = 0;
+    for (size_t i = 0; i < host_count; i++) {
+        if (hosts[i]) pool_size += strnlen(hosts[i], HOST_MAX_LEN);
+    }
+
+    size_t size = sizeof(image_header_t) + trie.count * sizeof(image_node_t) + slots * sizeof(image_host_t) + pool_size;
+    char *image = calloc(1, size);
+    if (!image) {
+        free(trie.nodes);
+        return 0;
+    }
+
+    image_header_t *header = (image_header_t *)image;
+    image_node_t *nodes = (image_node_t *)(header + 1);
+    image_host_t *table = (image_host_t *)(nodes + trie.count);
+    char *pool = (char *)(table + slots);
+
+    memcpy(header->magic, IMAGE_MAGIC, sizeof(header->magic));
+    header->node_count = (uint32_t)trie.count;
+    header->host_slots = (uint32_t)slots;
+    header->seed = 0x5741462d4950ULL ^ (uint64_t)size;
+    memcpy(nodes, trie.nodes, trie.count * sizeof(image_node_t));
+    free(trie.nodes);
+
+    size_t used = 0;
+    for (size_t i = 0; i < host_count; i++) {
+        char name[HOST_MAX_LEN + 1];
+        size_t len = hosts[i] ? normalize_host(hosts[i], strnlen(hosts[i], HOST_MAX_LEN), name) : 0;
+        if (len == 0) {
+            counts->invalid++;
+            continue;
+        }
+
+        uint64_t hash = xxh64(name, len, header->seed);
+        size_t slot = hash & (slots - 1);
+        int duplicate = 0;
+        while (table[slot].len) {
+            if (table[slot].hash == hash && table[slot].len == len && memcmp(pool + table[slot].offset, name, len) == 0) {
+                duplicate = 1;
+                break;
+            }
+            slot = (slot + 1) & (slots - 1);
+        }
+        if (duplicate) continue;
+
+        memcpy(pool + used, name, len);
+        table[slot] = (image_host_t){ .hash = hash, .offset = (uint32_t)used, .len = (uint32_t)len };
+        used += len;
+        counts->hosts++;
+    }
+    header->pool_size = (uint32_t)used;
+
+    // The pool was sized for the raw names, the normalized ones never take more
+    size -= pool_size - used;
+    int ok = write_image(path, image, size);
+    free(image);
+    return ok;
+}
+
+ip_list_t *ip_list_open(const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(image_header_t)) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    const image_header_t *header = map;
+    size_t expected = sizeof(image_header_t) + (size_t)header->node_count * sizeof(image_node_t) +
+                      (size_t)header->host_slots * sizeof(image_host_t) + header->pool_size;
+    if (memcmp(header->magic, IMAGE_MAGIC, sizeof(header->magic)) != 0 || header->node_count == 0 ||
+        header->host_slots == 0 || (header->host_slots & (header->host_slots - 1)) || expected != size) {
+        munmap(map, size);
+        return NULL;
+    }
+
+    ip_list_t *list = malloc(sizeof(ip_list_t));
+    if (!list) {
+        munmap(map, size);
+        return NULL;
+    }
+    list->map = map;
+    list->size = size;
+    list->header = header;
+    list->nodes = (const image_node_t *)(header + 1);
+    list->hosts = (const image_host_t *)(list->nodes + header->node_count);
+    list->pool = (const char *)(list->hosts + header->host_slots);
+    return list;
+}
+
+void ip_list_close(ip_list_t *list) {
+    if (!list) return;
+    munmap(list->map, list->size);
+    free(list);
+}
+
+int ip_list_contains(const ip_list_t *list, const char *ip, const char *host, size_t host_len) {
+    addr_t key;
+    if (ip && parse_address(ip, strlen(ip), &key)) {
+        const image_node_t *node = &list->nodes[0];
+
+        // Down the trie until a listed prefix covers the address or the path ends
+        for (;;) {
+            addr_t prefix = addr_mask(key, node->prefix_len);
+            if (prefix.hi != node->prefix.hi || prefix.lo != node->prefix.lo) break;
+            if (node->terminal) return 1;
+            if (node->prefix_len == 128) break;
+
+            uint32_t child = node->child[addr_bit(key, node->prefix_len)];
+            // Prefixes grow on every step, a broken image can not loop
+            if (child == NO_CHILD || child >= list->header->node_count ||
+                list->nodes[child].prefix_len <= node->prefix_len) {
+                break;
+            }
+            node = &list->nodes[child];
+        }
+    }
+
+    if (host && host_len) {
+        char name[HOST_MAX_LEN + 1];
+        size_t len = normalize_host(host, host_len > HOST_MAX_LEN ? HOST_MAX_LEN : host_len, name);
+        if (len == 0) return 0;
+
+        uint64_t hash = xxh64(name, len, list->header->seed);
+        uint32_t mask = list->header->host_slots - 1;
+        for (uint32_t slot = hash & mask; list->hosts[slot].len; slot = (slot + 1) & mask) {
+            const image_host_t *entry = &list->hosts[slot];
+            if (entry->hash == hash && entry->len == len && entry->offset + len <= list->header->pool_size &&
+                memcmp(list->pool + entry->offset, name, len) == 0) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// "addr" or "addr/len", IPv4 becomes IPv4-mapped IPv6
+static int parse_prefix(const char *text, addr_t *addr, int *prefix_len) {
+    const char *slash = strchr(text, '/');
+    size_t len = slash ? (size_t)(slash - text) : strlen(text);
+    if (!parse_address(text, len, addr)) return 0;
+
+    int v4 = memchr(text, ':', len) == NULL;
+    int max = v4 ? 32 : 128;
+    int bits = max;
+    if (slash) {
+        char *end;
+        long value = strtol(slash + 1, &end, 10);
+        if (end == slash + 1 || *end != '\0' || value < 0 || value > max) return 0;
+        bits = (int)value;
+    }
+
+    *prefix_len = v4 ? 96 + bits : bits;
+    *addr = addr_mask(*addr, *prefix_len);
+    return 1;
+}
+
+static int parse_address(const char *text, size_t len, addr_t *addr) {
+    char buf[INET6_ADDRSTRLEN + 1];
+    if (len == 0 || len >= sizeof(buf)) return 0;
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+
+    uint8_t bytes[16] = { 0 };
+    if (memchr(buf, ':', len)) {
+        if (inet_pton(AF_INET6, buf, bytes) != 1) return 0;
+    } else {
+        if (inet_pton(AF_INET, buf, bytes + 12) != 1) return 0;
+        bytes[10] = 0xff;
+        bytes[11] = 0xff;
+    }
+
+    addr->hi = addr->lo = 0;
+    for (int i = 0; i < 8; i++) {
+        addr->hi = (addr->hi << 8) | bytes[i];
+        addr->lo = (addr->lo << 8) | bytes[8 + i];
+    }
+    return 1;
+}
+
+static int trie_insert(trie_t *trie, addr_t key, int prefix_len) {
+    uint32_t parent = NO_CHILD;
+    int side = 0;
+    uint32_t current = 0;
+
+    for (;;) {
+        image_node_t node = trie->nodes[current];
+        int common = common_bits(node.prefix, key);
+        if (common > node.prefix_len) common = node.prefix_len;
+        if (common > prefix_len) common = prefix_len;
+
+        if (common < node.prefix_len) {
+            // The key leaves the path inside this node - a new node takes the common part
+            uint32_t split = trie_new_node(trie, addr_mask(key, common), common, common == prefix_len);
+            if (split == NO_CHILD) return 0;
+            trie->nodes[split].child[addr_bit(node.prefix, common)] = current;
+
+            if (common < prefix_len) {
+                uint32_t leaf = trie_new_node(trie, key, prefix_len, 1);
+                if (leaf == NO_CHILD) return 0;
+                trie->nodes[split].child[addr_bit(key, common)] = leaf;
+            }
+            // The root has prefix length 0, it is never split
+            trie->nodes[parent].child[side] = split;
+            return 1;
+        }
+
+        // A shorter prefix is listed already, or this one is
+        if (node.terminal) return 1;
+        if (node.prefix_len == prefix_len) {
+            trie->nodes[current].terminal = 1;
+            return 1;
+        }
+
+        side = addr_bit(key, node.prefix_len);
+        if (node.child[side] == NO_CHILD) {
+            uint32_t leaf = trie_new_node(trie, key, prefix_len, 1);
+            if (leaf == NO_CHILD) return 0;
+            trie->nodes[current].child[side] = leaf;
+            return 1;
+        }
+        parent = current;
+        current = node.child[side];
+    }
+}
+
+// Index of the new node, NO_CHILD when out of memory (except for the root, which is index 0)
+static uint32_t trie_new_node(trie_t *trie, addr_t key, int prefix_len, int terminal) {
+    if (trie->count == trie->capacity) {
+        size_t capacity = trie->capacity ? trie->capacity * 2 : 1024;
+        image_node_t *nodes = realloc(trie->nodes, capacity * sizeof(image_node_t));
+        if (!nodes) return NO_CHILD;
+        trie->nodes = nodes;
+        trie->capacity = capacity;
+    }
+
+    image_node_t *node = &trie->nodes[trie->count];
+    memset(node, 0, sizeof(*node));
+    node->prefix = key;
+    node->prefix_len = (uint8_t)prefix_len;
+    node->terminal = (uint8_t)terminal;
+    return (uint32_t)trie->count++;
+}
+
+// Lowercase, without a port, brackets of an IPv6 literal or the trailing dot
+static size_t normalize_host(const char *host, size_t len, char *out) {
+    if (len > 0 && host[0] == '[') {
+        const char *close = memchr(host, ']', len);
+        if (!close) return 0;
+        host++;
+        len = (size_t)(close - host);
+    } else {
+        const char *colon = memchr(host, ':', len);
+        if (colon) len = (size_t)(colon - host);
+    }
+    if (len > 0 && host[len - 1] == '.') len--;
+
+    for (size_t i = 0; i < len; i++) {
+        out[i] = (char)tolower((unsigned char)host[i]);
+    }
+    return len;
+}
+
+static int write_image(const char *path, const void *data, size_t size) {
+    char tmp[4096];
+    if (snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int)getpid()) >= (int)sizeof(tmp)) return 0;
+
+    // Never through a file or link someone else put there, the path can be in a shared directory
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, 0600);
+    if (fd < 0) return 0;
+
+    const char *p = data;
+    size_t left = size;
+    while (left > 0) {
+        ssize_t written = write(fd, p, left);
+        if (written <= 0) {
+            close(fd);
+            unlink(tmp);
+            return 0;
+        }
+        p += written;
+        left -= (size_t)written;
+    }
+
+    // Readers see the old image or the new one, never a partial file
+    if (close(fd) != 0 || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,36 @@
+#ifndef IP_REPUTATION
+#define IP_REPUTATION
+
+#include <stddef.h>
+#include <stdint.h>
+
+// IP / host lists (whitelist.json, blacklist.json) compiled into one read-only image:
+// a path-compressed binary (Patricia) trie of IPv4 and IPv6 prefixes and a hashed set
+// of host names. IPv4 is stored as IPv4-mapped IPv6 (::ffff:a.b.c.d), one trie serves both.
+//
+// The image is position independent - the cluster primary writes it to a file once, every
+// worker maps the same file and the pages are shared. A reload writes a new file and renames
+// it over the old one, workers map it again and drop the old mapping.
+
+typedef struct ip_list ip_list_t;
+
+typedef struct {
+    size_t prefixes;    // Addresses and CIDR ranges in the trie
+    size_t hosts;
+    size_t invalid;     // Entries that are neither
+} ip_list_counts_t;
+
+// Builds the image and writes it to path (through a temporary file and a rename).
+// Entries are "1.2.3.4", "10.0.0.0/8", "2001:db8::/32", ... and host names.
+int ip_list_compile(const char *const *ips, size_t ip_count, const char *const *hosts, size_t host_count,
+                    const char *path, ip_list_counts_t *counts);
+
+// Maps an image written by ip_list_compile(), NULL if it is missing or broken
+ip_list_t *ip_list_open(const char *path);
+void ip_list_close(ip_list_t *list);
+
+// Whether ip is inside a listed prefix or host (a port is ignored) is a listed name.
+// Either may be NULL.
+int ip_list_contains(const ip_list_t *list, const char *ip, const char *host, size_t host_len);
+
+#endif
@@ -0,0 +1,143 @@
+const fs = require('fs');
+const net = require('net');
+
+// IP / host lists (whitelist.json, blacklist.json). With the native addon (proxy/addon,
+// built by compile.sh) the cluster primary compiles every list into an image file once -
+// a prefix trie and a host hash set - and the workers map that file, so the pages are shared
+// and a lookup never walks the list. Without the addon every worker keeps its own copy
+// in JavaScript: a Set of addresses and hosts plus a scan over the CIDR ranges.
+let native = null;
+try {
+    native = require('./addon/ip_reputation.node');
+} catch {
+    native = null;
+}
+
+// Primary: {ips, hosts} JSON -> image at imagePath, replaced atomically (temp file + rename).
+// Returns the counts, or null without the addon.
+function compileList(jsonPath, imagePath) {
+    if (!native) return null;
+    const list = JSON.parse(fs.readFileSync(jsonPath, 'utf8'));
+    return native.compile(list.ips || [], list.hosts || [], imagePath);
+}
+
+// Worker: lookups on the image of the primary, or on the JSON file without one
+class IpList {
+    constructor(jsonPath, imagePath) {
+        this.jsonPath = jsonPath;
+        this.imagePath = imagePath;
+        this.handle = null;
+        this.fallback = null;
+        this.load();
+    }
+
+    // Maps the current image (the primary writes a new one before it signals a reload).
+    // The old mapping is dropped only once the new one is in place.
+    load() {
+        const handle = native && this.imagePath ? native.open(this.imagePath) : null;
+        if (handle) {
+            const old = this.handle;
+            this.handle = handle;
+            this.fallback = null;
+            if (old) native.close(old);
+            return;
+        }
+
+        const list = JSON.parse(fs.readFileSync(this.jsonPath, 'utf8'));
+        this.fallback = new JsIpList(list.ips || [], list.hosts || []);
+        if (this.handle) native.close(this.handle);
+        this.handle = null;
+    }
+
+    has(ip, host) {
+        if (this.handle) return native.contains(this.handle, ip || '', host || '');
+        return this.fallback.has(ip, host);
+    }
+}
+
+class JsIpList {
+    constructor(ips, hosts) {
+        this.addresses = new Set();
+        this.ranges = [];
+        this.hosts = new Set();
+
+        for (const entry of ips) {
+            const [address, length] = String(entry).split('/');
+            const value = addressValue(address);
+            if (value === null) continue;
+
+            const max = net.isIPv4(address) ? 32 : 128;
+            const bits = length === undefined ? max : Number(length);
+            if (!Number.isInteger(bits) || bits < 0 || bits > max) continue;
+
+            const prefixLength = 128 - max + bits;
+            if (prefixLength === 128) this.addresses.add(value);
+            else this.ranges.push({ prefixLength, prefix: maskValue(value, prefixLength) });
+        }
+        for (const host of hosts) {
+            const name = normalizeHost(String(host));
+            if (name) this.hosts.add(name);
+        }
+    }
+
+    has(ip, host) {
+        const value = ip ? addressValue(ip) : null;
+        if (value !== null) {
+            if (this.addresses.has(value)) return true;
+            for (const range of this.ranges) {
+                if (maskValue(value, range.prefixLength) === range.prefix) return true;
+            }
+        }
+        return host ? this.hosts.has(normalizeHost(host)) : false;
+    }
+}
+
+// Address as a 128-bit BigInt, IPv4 as IPv4-mapped IPv6 - the same keys as the native trie
+function addressValue(address) {
+    if (net.isIPv4(address)) {
+        const v4 = address.split('.').reduce((value, part) => (value << 8n) | BigInt(part), 0n);
+        return (0xffffn << 32n) | v4;
+    }
+    if (!net.isIPv6(address)) return null;
+
+    let text = address;
+    // Embedded IPv4 tail (::ffff:1.2.3.4) as two groups
+    const dotted = text.match(/(\d+\.\d+\.\d+\.\d+)$/);
+    if (dotted) {
+        const v4 = dotted[1].split('.').map(Number);
+        text = text.slice(0, -dotted[1].length) +
+            ((v4[0] << 8) | v4[1]).toString(16) + ':' + ((v4[2] << 8) | v4[3]).toString(16);
+    }
+
+    const [head, tail] = text.split('::');
+    const headGroups = head ? head.split(':') : [];
+    const tailGroups = tail ? tail.split(':') : [];
+    const groups = tail === undefined
+        ? headGroups
+        : [...headGroups, ...new Array(8 - headGroups.length - tailGroups.length).fill('0'), ...tailGroups];
+
+    return groups.reduce((value, group) => (value << 16n) | BigInt(parseInt(group, 16)), 0n);
+}
+
+function maskValue(value, prefixLength) {
+    if (prefixLength === 0) return 0n;
+    const mask = ((1n << BigInt(prefixLength)) - 1n) << BigInt(128 - prefixLength);
+    return value & mask;
+}
+
+// Lowercase, without a port, brackets of an IPv6 literal or the trailing dot
+function normalizeHost(host) {
+    let name = host;
+    if (name.startsWith('[')) {
+        const close = name.indexOf(']');
+        if (close < 0) return '';
+        name = name.slice(1, close);
+    } else {
+        const colon = name.indexOf(':');
+        if (colon >= 0) name = name.slice(0, colon);
+    }
+    if (name.endsWith('.')) name = name.slice(0, -1);
+    return name.toLowerCase();
+}
+
+module.exports = { IpList, compileList, nativeLists: native !== null };
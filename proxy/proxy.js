@@ -5,6 +5,7 @@ const path = require('path');
 const http = require('http');
 const { exec } = require('child_process');
 const WorkerPool = require('./worker-pool');
+const { IpList, compileList } = require('./ip-reputation');
 const Redis = require('ioredis');
 
 
@@ -15,6 +16,18 @@ const backendHost = process.env.BACKEND_HOST || '127.0.0.1';
 const backendPort = Number(process.env.BACKEND_PORT) || 3000;
 const numCWorkers = Number(process.env.C_WORKERS) || 10;
 const numClusterWorkers = Number(process.env.NODE_CLUSTER_WORKERS) || os.cpus().length;
+// ANALYZER_MODE=addon - every cluster worker runs the analyzer in process (see worker-pool.js),
+// C_WORKERS is then the number of batches in flight and the two options below are ignored.
+// > 0 - one shared analyzer with this many analysis threads serves every cluster worker,
+// C_WORKERS is then the number of connections (batches in flight) per cluster worker
+const analyzerThreads = WorkerPool.inProcess ? 0 : Number(process.env.ANALYZER_THREADS) || 0;
+// 'true' - analyzers are forked from one zygote that compiled the rules (ignored with ANALYZER_THREADS)
+const analyzerZygote = !WorkerPool.inProcess && process.env.ANALYZER_ZYGOTE === 'true';
+// > 0 - the primary serves the rule and pool statistics of all workers as JSON on
+// http://127.0.0.1:METRICS_PORT/stats
+const metricsPort = Number(process.env.METRICS_PORT) || 0;
+// Cluster workers that do not answer in time are left out of the statistics
+const METRICS_TIMEOUT_MS = 3000;
 
 const configPath = path.join(__dirname, 'rules/config.json');
 const config = JSON.parse(fs.readFileSync(configPath, 'utf8'));
@@ -22,9 +35,6 @@ const config = JSON.parse(fs.readFileSync(configPath, 'utf8'));
 const whitelistPath = path.join(__dirname, `rules/${config.ip_whitelist}`);
 const blacklistPath = path.join(__dirname, `rules/${config.ip_blacklist}`);
 
-const whitelist = JSON.parse(fs.readFileSync(whitelistPath, 'utf8'));
-const blacklist = JSON.parse(fs.readFileSync(blacklistPath, 'utf8'));
-
 const redis = new Redis({
     host: process.env.REDIS_HOST  || "127.0.0.1",
     port: Number(process.env.REDIS_PORT) || 6379
@@ -35,9 +45,42 @@ const rateLimiterConfig = {
     maxRequests: config.rateLimiter?.maxRequests || 100
 };
 
+// Time the analyzer has for a verdict (0 - no limit) and whether a request it did not fully
+// scan in that time is forwarded (failOpen, the default) or refused with a 503. The time is
+// counted from when the request is queued in the worker pool; what is left of it goes to the
+// analyzer, which counts that from when it reads the batch. Routes override both by the
+// longest prefix of the resolved path (see routePath) - refusing is an opt-in for the routes
+// that need it, a global one turns every load spike into 503s.
+const analysisConfig = {
+    deadlineMs: config.analysis?.deadlineMs || 0,
+    failOpen: config.analysis?.failOpen ?? true,
+    routes: (config.analysis?.routes || []).slice().sort((a, b) => b.prefix.length - a.prefix.length)
+};
+
 
 // ================== HELPERS ==================
 
+// Path of a url as the backend resolves it: percent escapes decoded (until none is left),
+// ;parameters dropped and dot segments resolved - "/static/%2e%2e/api" is not under "/static/"
+function routePath(url) {
+    let p = url.split(/[?#]/, 1)[0];
+    for (let prev = null; p !== prev; ) {
+        prev = p;
+        p = p.replace(/%([0-9a-fA-F]{2})/g, (_, hex) => String.fromCharCode(parseInt(hex, 16)));
+    }
+    p = p.replace(/\\/g, '/').replace(/;[^/]*/g, '');
+    return path.posix.normalize('/' + p);
+}
+
+function analysisPolicy(url) {
+    const resolved = routePath(url);
+    const route = analysisConfig.routes.find(r => resolved.startsWith(r.prefix));
+    return {
+        deadlineMs: route?.deadlineMs ?? analysisConfig.deadlineMs,
+        failOpen: route?.failOpen ?? analysisConfig.failOpen
+    };
+}
+
 async function isRateLimited(ip) {
     const key = `rate:${ip}`;
     const ttl = rateLimiterConfig.windowSec;
@@ -60,10 +103,6 @@ function log(msg) {
     });
 }
 
-function isListed(list, ip, host) {
-   return list.ips.includes(ip) || list.hosts.includes(host);
-}
-
 function groupFindings(findings) {
     const map = new Map();
 
@@ -110,11 +149,79 @@ if (cluster.isPrimary || cluster.isMaster) {
     // ================= MASTER PROCES =================
     
     let shuttingDown = false;
-    console.log(`[cluster-primary ${process.pid}] starting ${numClusterWorkers} workers on port ${PORT} ...`);
+    // Shared analyzer or zygote, started before the cluster workers that connect to it
+    let analyzerServer = null;
+    const workerEnv = {};
+
+    // IP lists: compiled once here, the workers only map the images (proxy/ip-reputation.js).
+    // They go to a directory of this process only - a fixed name in the shared tmpdir could
+    // be put there first by another user.
+    const imageDir = fs.mkdtempSync(path.join(os.tmpdir(), 'waf-lists-'));
+    const whitelistImage = process.env.WAF_WHITELIST_IMAGE || path.join(imageDir, 'whitelist.ipl');
+    const blacklistImage = process.env.WAF_BLACKLIST_IMAGE || path.join(imageDir, 'blacklist.ipl');
+    const compileLists = function() {
+        try {
+            const compiled = [[whitelistPath, whitelistImage], [blacklistPath, blacklistImage]].map(([list, image]) => {
+                const counts = compileList(list, image);
+                if (counts) console.log(`[cluster-primary] ${path.basename(list)}: ${counts.prefixes} prefixes, ${counts.hosts} hosts, ${counts.invalid} invalid`);
+                return counts !== null;
+            });
+            return compiled.every(Boolean);
+        } catch (err) {
+            console.error(`[cluster-primary] could not compile the IP lists: ${err.message}`);
+            return false;
+        }
+    }
+    // Without the addon (or on a failure) the workers read the JSON files themselves
+    if (compileLists()) {
+        workerEnv.WAF_WHITELIST_IMAGE = whitelistImage;
+        workerEnv.WAF_BLACKLIST_IMAGE = blacklistImage;
+    }
+    process.on('exit', () => {
+        [whitelistImage, blacklistImage].forEach(image => fs.rmSync(image, { force: true }));
+        fs.rmSync(imageDir, { recursive: true, force: true });
+    });
 
     // Spawn worker processes
-    for (let i = 0; i < numClusterWorkers; i++) {
-        cluster.fork();
+    const forkWorkers = function() {
+        console.log(`[cluster-primary ${process.pid}] starting ${numClusterWorkers} workers on port ${PORT} ...`);
+        for (let i = 0; i < numClusterWorkers; i++) {
+            cluster.fork(workerEnv);
+        }
+    }
+
+    if (analyzerThreads > 0 || analyzerZygote) {
+        const name = analyzerThreads > 0 ? 'shared analyzer' : 'analyzer zygote';
+        const socketPath = path.join(os.tmpdir(), analyzerThreads > 0
+            ? `waf-analyzer-${process.pid}.sock`
+            : `waf-zygote-${process.pid}.sock`);
+        if (analyzerThreads > 0) workerEnv.ANALYZER_SOCKET = socketPath;
+        else workerEnv.ANALYZER_ZYGOTE_SOCKET = socketPath;
+
+        let started = false;
+        const onReady = function() {
+            console.log(`[cluster-primary] ${name} ready on ${socketPath}`);
+            if (!started) {
+                started = true;
+                forkWorkers();
+            }
+        }
+
+        const startAnalyzer = function() {
+            analyzerServer = analyzerThreads > 0
+                ? WorkerPool.startSharedAnalyzer(socketPath, analyzerThreads, onReady)
+                : WorkerPool.startZygote(socketPath, onReady);
+
+            // Cluster workers reconnect on their own once it is back
+            analyzerServer.on('exit', (code, signal) => {
+                if (shuttingDown) return;
+                console.error(`[cluster-primary] ${name} exited (code=${code}, signal=${signal}). Restarting...`);
+                setTimeout(startAnalyzer, 1000);
+            });
+        }
+        startAnalyzer();
+    } else {
+        forkWorkers();
     }
 
     // Register callback - log when a worker boots up
@@ -122,11 +229,17 @@ if (cluster.isPrimary || cluster.isMaster) {
         console.log(`[cluster-primary] worker ${w.process.pid} online`);
     });
     
+    // A cluster worker gives up on a zygote child stuck on a batch, the zygote kills it
+    cluster.on('message', (w, message) => {
+        if (message?.cmd !== 'zygote_kill' || !analyzerZygote) return;
+        WorkerPool.killZygoteChild(analyzerServer, message.pid);
+    });
+
     // Restart worker if it crashes
     cluster.on('exit', (w, code, signal) => {
         if (shuttingDown) return;
         console.error(`[cluster-primary] worker ${w.process.pid} exited (code=${code}, signal=${signal}). Restarting...`);
-        cluster.fork();
+        cluster.fork(workerEnv);
     });
 
     const shutdownPrimary = function() {
@@ -150,6 +263,8 @@ if (cluster.isPrimary || cluster.isMaster) {
     
         // Execute shell script for unloading PF rules
         function runCleanup() {
+            if (analyzerServer) analyzerServer.kill();
+
             exec('./disable-proxy.sh', (error, stdout) => {
                 if (error) console.error(`Error while unloading PF: ${error.message}`);
                 else console.log(stdout || 'PF rules removed.');
@@ -158,8 +273,57 @@ if (cluster.isPrimary || cluster.isMaster) {
         }
     }
 
+    // Rules reload: the shared analyzer reloads itself, otherwise every worker reloads its pool.
+    // The zygote reloads too, for the analyzers it forks later. The IP lists are recompiled
+    // before the workers are signalled, they map the new images.
+    const reloadRules = function() {
+        console.log('[cluster-primary] reloading rules...');
+        if (analyzerServer) analyzerServer.kill('SIGHUP');
+        if (workerEnv.WAF_WHITELIST_IMAGE) compileLists();
+        Object.values(cluster.workers).forEach(w => w.process.kill('SIGHUP'));
+    }
+
+    // Metrics: every cluster worker answers with the stats of its pool, see WorkerPool.stats()
+    let metricsSeq = 0;
+    const collectStats = function() {
+        const id = ++metricsSeq;
+        const workers = Object.values(cluster.workers);
+
+        return Promise.all(workers.map(w => new Promise((resolve) => {
+            const onMessage = (message) => {
+                if (message?.cmd !== 'stats' || message.id !== id) return;
+                clearTimeout(timeoutID);
+                w.off('message', onMessage);
+                resolve(message.stats);
+            };
+            const timeoutID = setTimeout(() => {
+                w.off('message', onMessage);
+                resolve(null);
+            }, METRICS_TIMEOUT_MS);
+
+            w.on('message', onMessage);
+            w.send({ cmd: 'stats', id });
+        }))).then(WorkerPool.mergeStats);
+    }
+
+    if (metricsPort > 0) {
+        const metricsServer = http.createServer(async (req, res) => {
+            if (req.method !== 'GET' || req.url !== '/stats') {
+                res.writeHead(404, { 'Content-Type': 'text/plain' });
+                return res.end('Not Found');
+            }
+            const stats = await collectStats();
+            res.writeHead(200, { 'Content-Type': 'application/json' });
+            res.end(JSON.stringify(stats));
+        });
+        metricsServer.listen(metricsPort, '127.0.0.1', () => {
+            console.log(`[cluster-primary] metrics on http://127.0.0.1:${metricsPort}/stats`);
+        });
+    }
+
     process.on('SIGTERM', shutdownPrimary);
     process.on('SIGINT', shutdownPrimary);
+    process.on('SIGHUP', reloadRules);
 } else {
     // ================= WORKER PROCES =================
 
@@ -188,6 +352,28 @@ if (cluster.isPrimary || cluster.isMaster) {
         }
     }
 
+    const whitelist = new IpList(whitelistPath, process.env.WAF_WHITELIST_IMAGE);
+    const blacklist = new IpList(blacklistPath, process.env.WAF_BLACKLIST_IMAGE);
+
+    // Sent by the primary, the analyzers recompile regex_patterns.json in the background
+    // (a shared analyzer reloads on its own) and the IP lists are loaded again
+    process.on('SIGHUP', () => {
+        workerPool.reloadRules();
+        try {
+            whitelist.load();
+            blacklist.load();
+        } catch (err) {
+            console.error(`[cluster-worker ${process.pid}] could not reload the IP lists: ${err.message}`);
+        }
+    });
+
+    // Metrics request of the primary
+    process.on('message', async (message) => {
+        if (message?.cmd !== 'stats') return;
+        const stats = await workerPool.stats();
+        process.send({ cmd: 'stats', id: message.id, stats });
+    });
+
     // Start proxy server once worker pool is ready
     workerPool.on('ready', () => {
         console.log(`[cluster-worker ${process.pid}] worker-pool ready, starting proxy...`)
@@ -232,16 +418,21 @@ if (cluster.isPrimary || cluster.isMaster) {
             }
 
             // Check blacklisted
-            if (isListed(blacklist, ip, host)) {
+            if (blacklist.has(ip, host)) {
                 log(`BLOCKED: ip=${ip} host=${host} method=${req.method} url=${req.url}, reason="blacklisted"`);
                 res.writeHead(403, { 'Content-Type': 'text/plain' });
                 return res.end('Forbidden');
             }
 
             // Check whitelisted
-            if (isListed(whitelist, ip, host)) {
+            if (whitelist.has(ip, host)) {
                 return forwardRequestStream(req, res); 
             }
+
+            // Large bodies are inspected while they arrive
+            if (!isBinaryType(req.headers) && workerPool.canStream(req.headers)) {
+                return inspectStreaming(req, res, ip, host);
+            }
             
             // Data for body comes in chunks
             req.on('data', chunk => {
@@ -255,11 +446,12 @@ if (cluster.isPrimary || cluster.isMaster) {
                 try {
                     // Analyse
                     const startTime = Date.now();
+                    const policy = analysisPolicy(req.url);
                     let result;
                     if (!isBinaryType(req.headers)) {
-                        result = await workerPool.analyze(req.url, req.headers, body.toString());
+                        result = await workerPool.analyze(req.url, req.headers, body, policy.deadlineMs);
                     }else {
-                        result = await workerPool.analyze(req.url, req.headers, "");
+                        result = await workerPool.analyze(req.url, req.headers, "", policy.deadlineMs);
                     }
                     const analysisTime = Date.now() - startTime;
 
@@ -276,6 +468,16 @@ if (cluster.isPrimary || cluster.isMaster) {
                         res.writeHead(403, { 'Content-Type': 'text/plain' });
                         return res.end('Forbidden');
                     }
+
+                    // Out of time before every rule ran - the route decides
+                    if (result.incomplete) {
+                        log(`INCOMPLETE: ip=${ip} host=${host} method=${req.method} url=${req.url} ` +
+                            `evaluated="${result.evaluated.join(',')}" ${policy.failOpen ? 'forwarded' : 'refused'}`);
+                        if (!policy.failOpen) {
+                            res.writeHead(503, { 'Content-Type': 'text/plain' });
+                            return res.end('Analysis incomplete');
+                        }
+                    }
                     
                     forwardRequest(req, res, body);
                     
@@ -288,19 +490,59 @@ if (cluster.isPrimary || cluster.isMaster) {
             
         }
 
-        function logAttack(result_s, ip, host, req) {
-            let result;
-            try {
-                result = JSON.parse(result_s);
-            } catch (err) {
-                console.error('Failed to parse analysis result:', err, result_s);
-                return;
-            }
-        
+        // The analyzer gets the body chunk by chunk and an attack is answered without reading the
+        // rest of the upload. A clean body is still forwarded as a whole once it is complete.
+        function inspectStreaming(req, res, ip, host) {
+            const body = [];
+            let settled = false;
+            const startTime = Date.now();
+            const stream = workerPool.openStream(req.url, req.headers);
+
+            req.on('data', chunk => {
+                if (settled) return;
+                body.push(chunk);
+                stream.write(chunk);
+            });
+            req.on('end', () => stream.end());
+            // A dropped upload never ends - its stream is closed instead of waiting for the body
+            let aborted = false;
+            req.on('close', () => {
+                if (req.complete || settled) return;
+                aborted = true;
+                body.length = 0;
+                stream.abort();
+            });
+
+            // A clean verdict only comes after end(), the body is complete by then
+            stream.verdict.then(result => {
+                settled = true;
+                avgAnalysisTime.count++;
+                avgAnalysisTime.sum += Date.now() - startTime;
+
+                const isSafe = logAttack(result, ip, host, req);
+                addSecurityHeaders(req, result);
+
+                if (!isSafe) {
+                    body.length = 0;
+                    res.writeHead(403, { 'Content-Type': 'text/plain', 'Connection': 'close' });
+                    return res.end('Forbidden', () => req.destroy());
+                }
+
+                forwardRequest(req, res, Buffer.concat(body));
+            }).catch(error => {
+                settled = true;
+                body.length = 0;
+                if (aborted) return;
+                console.error(`[cluster-worker ${process.pid}] Analysis error:`, error.message);
+                res.writeHead(500, { 'Content-Type': 'text/plain', 'Connection': 'close' });
+                res.end('Analysis failed', () => req.destroy());
+            });
+        }
+
+        // result is the verdict object resolved by the worker pool
+        function logAttack(result, ip, host, req) {
             if (result.status === 'attack' && Array.isArray(result.findings)) {
-                result.findings = groupFindings(result.findings);
-        
-                const reason = result.findings
+                const reason = groupFindings(result.findings)
                     .map(f => `${f.attack}@${f.location}: [${f.severities.join(', ')}]`)
                     .join('; ');
         
@@ -384,7 +626,7 @@ if (cluster.isPrimary || cluster.isMaster) {
         function addSecurityHeaders(req, result) {
             if (result.status == 'attack') {
                 req.headers['x-security-status'] = 'attack';
-                console.log(`[cluster-worker ${process.pid}] ATTACK DETECTED: Type ${result}`);
+                console.log(`[cluster-worker ${process.pid}] ATTACK DETECTED: Type ${result.findings.map(f => f.attack).join(',')}`);
                 // console.dir(result, { depth: null, colors: true });
                 // req.headers['x-security-findings'] = JSON.stringify(result.findings);
 
@@ -395,8 +637,9 @@ if (cluster.isPrimary || cluster.isMaster) {
                 req.headers['x-security-attack-types'] = attackTypes;
                 req.headers['x-security-severities'] = severities;
                 req.headers['x-security-locations'] = locations;
+                req.headers['x-security-score'] = String(result.score ?? '');
             } else {
-                req.headers['x-security-status'] = 'clean';
+                req.headers['x-security-status'] = result.incomplete ? 'incomplete' : 'clean';
             }
         }
 
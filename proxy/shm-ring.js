@@ -0,0 +1,76 @@
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+const shmDir = process.env.SHM_DIR || (fs.existsSync('/dev/shm') ? '/dev/shm' : os.tmpdir());
+
+// Ring of request bodies shared with one analyzer connection. The file lives in shared
+// memory (/dev/shm), the analyzer maps it and reads the bodies in place - every body is
+// copied once, by the positional write into the ring.
+// Space is handed out in order and released batch by batch, oldest first.
+class ShmRing {
+    constructor(size, name) {
+        this.size = size;
+        this.path = path.join(shmDir, `waf-ring-${process.pid}-${name}`);
+        // A new file only - never one (or a link) someone else put in the shared directory
+        const { O_RDWR, O_CREAT, O_EXCL, O_NOFOLLOW } = fs.constants;
+        this.fd = fs.openSync(this.path, O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW, 0o600);
+        fs.ftruncateSync(this.fd, size);
+
+        this.head = 0;      // Next free byte
+        this.tail = 0;      // Oldest byte still in use
+        this.pending = 0;   // Batches holding space
+    }
+
+    // Copies buf into the ring, returns its offset or -1 if there is no room
+    write(buf) {
+        const offset = this.alloc(buf.length);
+        if (offset < 0) return -1;
+        fs.writeSync(this.fd, buf, 0, buf.length, offset);
+        return offset;
+    }
+
+    alloc(len) {
+        if (len > this.size) return -1;
+
+        let offset = -1;
+        if (this.head >= this.tail && (this.pending == 0 || this.head > this.tail)) {
+            if (this.size - this.head >= len) offset = this.head;
+            else if (this.tail >= len) offset = 0; // Wrap around
+        } else if (this.tail - this.head >= len) {
+            offset = this.head;
+        }
+
+        if (offset >= 0) this.head = offset + len;
+        return offset;
+    }
+
+    // Called after the allocations of a batch - the mark is released with the batch
+    mark() {
+        this.pending++;
+        return this.head;
+    }
+
+    release(mark) {
+        if (this.pending == 0) return;
+        this.pending--;
+        this.tail = mark;
+
+        // Nothing in use - start over at the beginning
+        if (this.pending == 0 && this.tail == this.head) {
+            this.head = this.tail = 0;
+        }
+    }
+
+    // The analyzer has the file mapped, the name is no longer needed
+    unlink() {
+        fs.unlink(this.path, () => {});
+    }
+
+    close() {
+        this.unlink();
+        try { fs.closeSync(this.fd); } catch {}
+    }
+}
+
+module.exports = ShmRing;
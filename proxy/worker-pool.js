@@ -1,9 +1,93 @@
 const {spawn} = require('child_process');
+const net = require('net');
 const { randomUUID } = require('crypto');
+const { performance } = require('perf_hooks');
 const EventEmitter = require('events');
+const path = require('path');
+const ShmRing = require('./shm-ring');
 
 const analyzer = process.env.ANALYZER_NAME || 'analyze';
+// Upper bound of a batch. The size in use adapts: it grows while tasks queue up and is
+// halved when a batch takes longer than batchLatencyTarget ms to come back.
 const batchSize = parseInt(process.env.BATCH_SIZE) || 32;
+const batchLatencyTarget = parseFloat(process.env.BATCH_LATENCY_TARGET_MS) || 5;
+// Batches in flight per analyzer - it reads the next one while it scans the current one
+const pipelineDepth = parseInt(process.env.PIPELINE_DEPTH) || 2;
+// 'json' - one JSON line per batch, 'binary' - length-prefixed frames (analyzer/binary-protocol.h)
+const ipcMode = process.env.IPC_MODE === 'binary' ? 'binary' : 'json';
+// Set by the cluster primary when a shared, threaded analyzer serves the whole host
+const analyzerSocket = process.env.ANALYZER_SOCKET || '';
+// Set by the cluster primary when analyzers are forked by a zygote - every connection
+// gets its own analyzer process, with the rules already compiled
+const analyzerZygote = process.env.ANALYZER_ZYGOTE_SOCKET || '';
+// Binary mode only: bodies of at least shmMinBody bytes go through a shared-memory ring
+// of shmRingSize bytes per analyzer connection (0 - disabled)
+const shmRingSize = parseInt(process.env.SHM_RING_SIZE) || 0;
+const shmMinBody = parseInt(process.env.SHM_MIN_BODY) || 16 * 1024;
+// Binary mode only: bodies of at least streamMinBody bytes (or of unknown length) are sent to
+// the analyzer in chunks while they arrive, instead of in a batch after the last one (0 - disabled)
+const streamMinBody = parseInt(process.env.STREAM_MIN_BODY) || 0;
+// Body bytes of a streamed request that are inspected, the rest is forwarded unscanned
+const streamMaxInspect = parseInt(process.env.STREAM_MAX_INSPECT) || 1024 * 1024;
+// Entries of the analyzer verdict cache (analyzer/verdict-cache.h), unset - its default, 0 - disabled
+const verdictCacheSize = process.env.VERDICT_CACHE_SIZE || '';
+// ANALYZER_MODE=addon - the analyzer runs inside this process (proxy/addon/analyzer-addon.c, built
+// by compile.sh), batches go to the libuv thread pool as Buffers instead of through a pipe.
+// Without the addon the analyzer processes are used.
+let nativeAnalyzer = null;
+if (process.env.ANALYZER_MODE === 'addon') {
+    try {
+        nativeAnalyzer = require('./addon/analyzer.node');
+    } catch (e) {
+        console.error(`Analyzer addon not available, using analyzer processes: ${e.message}`);
+    }
+}
+
+const FRAME_HEADER_SIZE = 5;
+const FRAME_BATCH = 1;
+const FRAME_CONTROL = 2;
+const FRAME_BATCH_SHM = 3;
+const FRAME_STREAM_BEGIN = 4;
+const FRAME_STREAM_CHUNK = 5;
+const FRAME_STREAM_END = 6;
+const FRAME_STREAM_VERDICT = 7;
+const FRAME_STREAM_ABORT = 8;
+const VERDICT_ERROR = 2;
+const VERDICT_INCOMPLETE = 0x80;
+const BATCH_DEADLINES = 0x80000000;
+const BODY_INLINE = 0;
+const BODY_SHM = 1;
+const LOCATIONS = ['url', 'headers', 'body'];
+
+// Passed to the analyzer explicitly, reloads (SIGHUP) read the same file
+const rulesPath = path.join(__dirname, 'rules/regex_patterns.json');
+// A worker that does not answer the stats command in time is left out of the numbers
+const STATS_TIMEOUT_MS = 2000;
+// Same buckets as the analyzer (analyzer/stats.h): bucket b counts [2^(b-1), 2^b) ns
+const LATENCY_BUCKETS = 28;
+
+// Log2 latency histogram, serialized like the analyzer's
+class LatencyHistogram {
+    constructor() {
+        this.count = 0;
+        this.total_ns = 0;
+        this.buckets = new Array(LATENCY_BUCKETS).fill(0);
+    }
+
+    record(ms) {
+        const ns = Math.round(ms * 1e6);
+        const bucket = ns > 0 ? Math.min(Math.floor(Math.log2(ns)) + 1, LATENCY_BUCKETS - 1) : 0;
+        this.count++;
+        this.total_ns += ns;
+        this.buckets[bucket]++;
+    }
+
+    toJSON() {
+        let used = this.buckets.length;
+        while (used > 0 && this.buckets[used - 1] === 0) used--;
+        return { count: this.count, total_ns: this.total_ns, buckets: this.buckets.slice(0, used) };
+    }
+}
 
 
 // Worker class - worker is a Node object that represents C process
@@ -11,49 +95,106 @@ class AnalyzerWorker extends EventEmitter {
     constructor(id) {
         super();
         this.id = id;
-        this.busy = false;
-        this.currentTasks = new Map(); // task.id -> {resolve, reject}
+        this.batches = [];      // In flight, in the order they were sent (and are scanned)
+        this.currentTasks = new Map(); // task.id -> {resolve, reject, batch}
         this.responseBuffer = '';
+        this.taskSeq = 0;
+        this.ring = null;
+        this.ringAttached = false;
+        this.ringGeneration = 0;
+        // Binary verdicts carry rule ids (index in the rules file). The analyzer sends the
+        // table before the first verdict of every rules generation, it is kept per worker.
+        this.rules = [];
+        // Streamed bodies, independent of the batch in flight: stream id -> {resolve, reject}
+        this.streams = new Map();
+        this.streamSeq = 0;
+        // Resolvers of the stats commands in flight, answered in order
+        this.statsRequests = [];
         
         this.spawn();
     }
 
+    get load() {
+        return this.batches.length;
+    }
+
+    get busy() {
+        return this.batches.length >= pipelineDepth;
+    }
+
+    // Starts an own analyzer process, or connects to the shared one (or the zygote)
     spawn() {
-        this.process = spawn(`./${analyzer}`, [], {
-            stdio: ['pipe', 'pipe', 'pipe']
-        });
+        this.pid = 0;
 
-        this.process.stdout.on('data', (data) => {
-            this.responseBuffer += data.toString();
-            this.processResponses();
-        });
-        
-        this.process.stderr.on('data', (data) => {
-            console.error(`Worker ${this.id} error: ${data.toString()}`);
-        });
+        if (analyzerSocket || analyzerZygote) {
+            this.socket = net.createConnection(analyzerSocket || analyzerZygote);
+            this.input = this.socket;
+            this.output = this.socket;
 
-        this.process.on('exit', (code) => {
-            console.error(`C worker ${this.id} exited with code ${code}`);
-            this.active = false;
-            
-            if (this.timeoutID) {
-                clearTimeout(this.timeoutID);
-                this.timeoutID = null;
-            }
+            this.socket.on('error', (err) => {
+                console.error(`Worker ${this.id} connection error: ${err.message}`);
+            });
+            this.socket.on('close', () => this.onExit('connection closed'));
+        } else {
+            const args = ['--rules', rulesPath];
+            if (ipcMode === 'binary') args.push('--binary');
+            if (verdictCacheSize) args.push('--cache', verdictCacheSize);
+            this.process = spawn(`./${analyzer}`, args, {
+                stdio: ['pipe', 'pipe', 'pipe']
+            });
+            this.input = this.process.stdin;
+            this.output = this.process.stdout;
 
-            if (this.currentTasks.size > 0) {
-                for (const [id, handlers] of this.currentTasks){
-                    handlers.reject(new Error('Worker crashed'));
-                    this.currentTasks.delete(id);
-                }
-            }
-            this.busy = false;
-            setTimeout(() => this.spawn(), 1000);
-        });
+            this.process.stderr.on('data', (data) => {
+                console.error(`Worker ${this.id} error: ${data.toString()}`);
+            });
+            this.process.on('exit', (code) => this.onExit(`exited with code ${code}`));
+        }
+
+        if (ipcMode === 'binary') {
+            this.responseBuffer = Buffer.alloc(0);
+            this.output.on('data', (data) => {
+                this.responseBuffer = this.responseBuffer.length
+                    ? Buffer.concat([this.responseBuffer, data])
+                    : data;
+                this.processFrames();
+            });
+        } else {
+            this.responseBuffer = '';
+            this.output.on('data', (data) => {
+                this.responseBuffer += data.toString();
+                this.processResponses();
+            });
+        }
 
         this.active = true
     }
 
+    onExit(reason) {
+        console.error(`C worker ${this.id} ${reason}`);
+        this.active = false;
+        this.closeRing();
+
+        for (const batch of this.batches) {
+            clearTimeout(batch.timeoutID);
+        }
+        this.batches = [];
+
+        if (this.currentTasks.size > 0) {
+            for (const [id, handlers] of this.currentTasks){
+                handlers.reject(new Error('Worker crashed'));
+                this.currentTasks.delete(id);
+            }
+        }
+        for (const stream of this.streams.values()) {
+            clearTimeout(stream.timeoutID);
+            stream.reject(new Error('Worker crashed'));
+        }
+        this.streams.clear();
+        this.statsRequests.splice(0).forEach(resolve => resolve(null));
+        setTimeout(() => this.spawn(), 1000);
+    }
+
     // Callback that is called when C sends data on stdout
     processResponses(){
         // Process only a completed line
@@ -68,24 +209,12 @@ class AnalyzerWorker extends EventEmitter {
                     // the status is ready (on its start)
                     // the analyze is completed
                     if (response.status == 'ready') {
+                        this.pid = response.pid || 0;
                         this.emit('ready');
+                    } else if (response.status == 'stats') {
+                        this.settleStats(response);
                     } else if (Array.isArray(response)) {
-
-                        // Clear timeout
-                        if (this.timeoutID) {
-                            clearTimeout(this.timeoutID);
-                            this.timeoutID = null;
-                        }
-
-                        for (const res of response) {
-                            const task = this.currentTasks.get(res.id);
-                            if (!task) continue;
-                            if (res.error) task.reject(res.error);
-                            else task.resolve(res.result);
-                            this.currentTasks.delete(res.id);
-                        }   
-                        this.busy = false;
-                        this.emit('available');
+                        this.settle(response.map(parseResponse));
                     }
                 }catch (e) {
                     console.error(`Worker ${this.id} JSON parse error: ${e}`);
@@ -94,8 +223,195 @@ class AnalyzerWorker extends EventEmitter {
         }
     }
 
+    // Callback for the binary mode - handles every complete frame in the buffer
+    processFrames() {
+        let buf = this.responseBuffer;
+
+        while (buf.length >= FRAME_HEADER_SIZE) {
+            const len = buf.readUInt32LE(0);
+            if (buf.length < FRAME_HEADER_SIZE + len) break;
+
+            const type = buf[4];
+            const payload = buf.subarray(FRAME_HEADER_SIZE, FRAME_HEADER_SIZE + len);
+            buf = buf.subarray(FRAME_HEADER_SIZE + len);
+
+            try {
+                if (type === FRAME_BATCH) {
+                    this.settle(decodeVerdicts(payload, this.rules));
+                } else if (type === FRAME_STREAM_VERDICT) {
+                    this.settleStream(decodeVerdict(payload, 0, this.rules).response);
+                } else if (type === FRAME_CONTROL) {
+                    const message = JSON.parse(payload.toString());
+                    if (message.status == 'rules') {
+                        this.rules = decodeRules(message.rules);
+                    } else if (message.status == 'ready') {
+                        this.pid = message.pid || 0;
+                        this.attachRing();
+                        this.emit('ready');
+                    } else if (message.status == 'stats') {
+                        this.settleStats(message);
+                    } else if (message.status == 'shm_attached' && this.ring) {
+                        this.ringAttached = true;
+                        this.ring.unlink();
+                    } else if (message.error) {
+                        console.error(`Worker ${this.id} control error: ${message.error}`);
+                        if (message.error == 'shm_attach_failed') this.closeRing();
+                    }
+                }
+            } catch (e) {
+                console.error(`Worker ${this.id} frame decode error: ${e}`);
+            }
+        }
+
+        this.responseBuffer = buf;
+    }
+
+    // Creates a fresh ring for the (re)started analyzer, bodies go inline until it is attached
+    attachRing() {
+        this.closeRing();
+        if (shmRingSize <= 0) return;
+
+        try {
+            this.ring = new ShmRing(shmRingSize, `${this.id}-${++this.ringGeneration}`);
+        } catch (e) {
+            console.error(`Worker ${this.id} could not create shm ring: ${e.message}`);
+            return;
+        }
+        this.input.write(encodeControl({ cmd: 'shm_attach', path: this.ring.path, size: shmRingSize }));
+    }
+
+    closeRing() {
+        if (this.ring) this.ring.close();
+        this.ring = null;
+        this.ringAttached = false;
+    }
+
+    // Resolves the tasks that have a verdict. The analyzer answers as the requests are done,
+    // the verdicts of a batch can come in several parts and in any order.
+    settle(responses) {
+        for (const res of responses) {
+            const task = this.currentTasks.get(res.id);
+            if (!task) continue;
+            if (res.error) task.reject(res.error);
+            else task.resolve(res.result);
+            this.currentTasks.delete(res.id);
+
+            if (--task.batch.pending == 0) this.finishBatch(task.batch);
+        }
+    }
+
+    // Last verdict of a batch arrived. Batches are scanned in the order they were sent,
+    // so the ones before it are done as well.
+    finishBatch(batch) {
+        clearTimeout(batch.timeoutID);
+        this.batches.splice(this.batches.indexOf(batch), 1);
+
+        // The analyzer is done reading the bodies of this batch
+        if (batch.ringMark !== null && this.ring) {
+            this.ring.release(batch.ringMark);
+        }
+
+        this.emit('batch', performance.now() - batch.startedAt, batch.size);
+        this.emit('available');
+    }
+
+    // Streamed body, see WorkerPool.openStream(). The analyzer scans every chunk when it
+    // arrives and answers once - after endStream(), or earlier if the body is an attack.
+    beginStream(url, headers, maxBytes, handlers) {
+        this.streamSeq = (this.streamSeq + 1) >>> 0;
+        const id = this.streamSeq;
+        this.streams.set(id, handlers);
+        this.input.write(encodeStreamBegin(id, maxBytes, url, headers));
+        return id;
+    }
+
+    streamChunk(id, chunk) {
+        // A stream with a verdict (or lost with a crashed analyzer) needs no more data
+        if (!this.active || !this.streams.has(id)) return;
+        this.input.write(encodeStreamFrame(FRAME_STREAM_CHUNK, id, chunk));
+    }
+
+    endStream(id) {
+        const stream = this.streams.get(id);
+        if (!this.active || !stream) return;
+        this.input.write(encodeStreamFrame(FRAME_STREAM_END, id));
+
+        stream.timeoutID = setTimeout(() => {
+            this.streams.delete(id);
+            stream.reject(new Error('Stream timeout'));
+        }, 5000);
+    }
+
+    // The client dropped the upload: the analyzer closes the stream, the verdict is not awaited
+    abortStream(id) {
+        const stream = this.streams.get(id);
+        if (!stream) return;
+
+        this.streams.delete(id);
+        clearTimeout(stream.timeoutID);
+        if (this.active) this.input.write(encodeStreamFrame(FRAME_STREAM_ABORT, id));
+        stream.reject(new Error('Upload aborted'));
+    }
+
+    settleStream(res) {
+        const stream = this.streams.get(res.id);
+        if (!stream) return;
+
+        this.streams.delete(res.id);
+        clearTimeout(stream.timeoutID);
+        if (res.error) stream.reject(res.error);
+        else stream.resolve(res.result);
+    }
+
+    nextTaskId() {
+        if (ipcMode === 'binary') {
+            this.taskSeq = (this.taskSeq + 1) >>> 0;
+            return this.taskSeq;
+        }
+        return randomUUID();
+    }
+
+    // Asks the analyzer to recompile its rules, the verdicts switch over batch by batch
+    reloadRules() {
+        if (!this.active) return;
+        if (ipcMode === 'binary') {
+            this.input.write(encodeControl({ cmd: 'reload' }));
+        } else {
+            this.input.write(JSON.stringify({ cmd: 'reload' }) + '\n');
+        }
+    }
+
+    // Runtime counters of the analyzer ({"cmd":"stats"}), null if it does not answer
+    requestStats() {
+        if (!this.active) return Promise.resolve(null);
+
+        return new Promise((resolve) => {
+            const settle = (stats) => {
+                clearTimeout(timeoutID);
+                resolve(stats);
+            };
+            const timeoutID = setTimeout(() => {
+                const i = this.statsRequests.indexOf(settle);
+                if (i >= 0) this.statsRequests.splice(i, 1);
+                resolve(null);
+            }, STATS_TIMEOUT_MS);
+
+            this.statsRequests.push(settle);
+            if (ipcMode === 'binary') {
+                this.input.write(encodeControl({ cmd: 'stats' }));
+            } else {
+                this.input.write(JSON.stringify({ cmd: 'stats' }) + '\n');
+            }
+        });
+    }
+
+    settleStats(stats) {
+        const settle = this.statsRequests.shift();
+        if (settle) settle(stats);
+    }
+
     analyze(tasks) {
-        // If the worker is already busy
+        // If the worker has pipelineDepth batches in flight already
         if (this.busy) {
             return new Error('Worker is busy!');
         }
@@ -104,29 +420,47 @@ class AnalyzerWorker extends EventEmitter {
             return new Error('Worker is not active!');
         }
 
-        this.busy = true;
+        const batch = {
+            size: tasks.length,
+            pending: tasks.length,  // Tasks without a verdict yet
+            startedAt: performance.now(),
+            ringMark: null,
+            timeoutID: null,
+        };
+        this.batches.push(batch);
         for (const t of tasks){
-            this.currentTasks.set(t.id, {resolve: t.resolve, reject: t.reject});
+            this.currentTasks.set(t.id, {resolve: t.resolve, reject: t.reject, batch});
         }
-        const payload = tasks.map(t => ({
-            id: t.id,
-            url: t.url, 
-            headers: JSON.stringify(t.headers),
-            body: t.body ? t.body.toString() : ''
-        }));
 
         // Send request to a stdin of the C proces
-        this.process.stdin.write(JSON.stringify(payload) + '\n');
+        const budgets = taskBudgets(tasks, batch.startedAt);
+        if (ipcMode === 'binary') {
+            const ring = this.ringAttached ? this.ring : null;
+            this.input.write(encodeBatch(tasks, ring, budgets));
+            if (ring) batch.ringMark = ring.mark();
+        } else {
+            const payload = tasks.map((t, i) => {
+                const request = {
+                    id: t.id,
+                    url: t.url, 
+                    headers: JSON.stringify(t.headers),
+                    body: t.body ? t.body.toString() : ''
+                };
+                if (budgets && budgets[i]) request.budget_us = budgets[i];
+                return request;
+            });
+            this.input.write(JSON.stringify(payload) + '\n');
+        }
         
-        // If task is not completed in 5s, abort
-        this.timeoutID = setTimeout(() => {
+        // If task is not completed in 5s, abort. Requests with a deadline get an incomplete
+        // verdict once it passed, this only catches an analyzer that is stuck.
+        batch.timeoutID = setTimeout(() => {
             for (const t of tasks) {
                 if (this.currentTasks.has(t.id)) {
                     this.currentTasks.get(t.id).reject(new Error('Worker timeout'));
                     this.currentTasks.delete(t.id);
                 }
             }
-            this.busy = false;
             this.active = false;
             this.kill();
         }, 5000);
@@ -135,27 +469,319 @@ class AnalyzerWorker extends EventEmitter {
     }
 
     kill() {
-        if (this.process){
+        if (this.socket) {
+            // A zygote child busy with a batch would only notice the closed connection afterwards.
+            // The zygote kills it (through the cluster primary) - it knows whether the pid still is
+            // its child, a pid reused by another process by now is left alone.
+            if (this.pid && process.send) {
+                try { process.send({ cmd: 'zygote_kill', pid: this.pid }); } catch {}
+            }
+            this.socket.destroy();
+        } else if (this.process){
             this.process.kill('SIGKILL');
         }
     }
 };
 
 
+// Slot for one batch of the in-process analyzer, in flight on the libuv thread pool.
+// The pool uses it like an AnalyzerWorker; the rules and the counters are shared by all slots.
+class AddonWorker extends EventEmitter {
+    constructor(id) {
+        super();
+        this.id = id;
+        this.busy = false;
+        this.active = true;
+        this.streams = new Map(); // Bodies are not streamed in this mode, see WorkerPool.canStream()
+        this.taskSeq = 0;
+
+        // After the pool has registered its listeners
+        setImmediate(() => this.emit('ready'));
+    }
+
+    get load() {
+        return this.busy ? 1 : 0;
+    }
+
+    nextTaskId() {
+        this.taskSeq = (this.taskSeq + 1) >>> 0;
+        return this.taskSeq;
+    }
+
+    // No timeout - a batch on the thread pool can not be cancelled, and RE2 runs in linear time
+    analyze(tasks) {
+        if (this.busy) {
+            return new Error('Worker is busy!');
+        }
+
+        const fields = new Array(tasks.length * 3);
+        tasks.forEach((t, i) => {
+            fields[i * 3] = t.url || '';
+            fields[i * 3 + 1] = JSON.stringify(t.headers || {});
+            fields[i * 3 + 2] = t.body || '';
+        });
+
+        const startedAt = performance.now();
+        const callback = (err, verdicts) => {
+            this.emit('batch', performance.now() - startedAt, tasks.length);
+            tasks.forEach((t, i) => err ? t.reject(err) : t.resolve(verdicts[i]));
+            this.busy = false;
+            this.emit('available');
+        };
+        try {
+            const budgets = taskBudgets(tasks, startedAt);
+            if (budgets) nativeAnalyzer.analyze(fields, callback, budgets);
+            else nativeAnalyzer.analyze(fields, callback);
+        } catch (e) {
+            return e;
+        }
+
+        this.busy = true;
+        return null;
+    }
+
+    requestStats() {
+        return Promise.resolve(JSON.parse(nativeAnalyzer.stats()));
+    }
+
+    kill() {}
+}
+
+
+// JSON mode response -> {id, result}, the result comes as a JSON string
+function parseResponse(res) {
+    if (res.error) return res;
+    try {
+        return { id: res.id, result: JSON.parse(res.result) };
+    } catch (e) {
+        return { id: res.id, error: e };
+    }
+}
+
+// Microseconds every task has left at now (ms, performance.now()), null if none has a deadline.
+// A task without one gets 0, the analyzer scans it to the end.
+function taskBudgets(tasks, now) {
+    if (!tasks.some(t => t.deadline)) return null;
+    return tasks.map(t => t.deadline ? Math.max(1, Math.round((t.deadline - now) * 1000)) : 0);
+}
+
+// Verdict of a task whose deadline passed before it was sent - no rule ran
+function expiredVerdict() {
+    return { status: 'clean', score: 0, findings: [], incomplete: true, evaluated: [] };
+}
+
+// FRAME_BATCH request: u32 count, per task: u32 id, then url, headers and body as u32 length + bytes.
+// With a ring, large bodies are written into it instead and the frame becomes a FRAME_BATCH_SHM.
+// With budgets, BATCH_DEADLINES is set in the count and every id is followed by a u32 budget.
+function encodeBatch(tasks, ring, budgets) {
+    const fields = tasks.map(t => [
+        t.url || '',
+        JSON.stringify(t.headers || {}),
+        t.body || ''
+    ]);
+
+    // Ring offset of every body, -1 for the ones sent inline
+    const offsets = tasks.map(t =>
+        ring && Buffer.isBuffer(t.body) && t.body.length >= shmMinBody ? ring.write(t.body) : -1);
+    const shm = offsets.some(offset => offset >= 0);
+
+    let size = FRAME_HEADER_SIZE + 4;
+    for (let i = 0; i < tasks.length; i++) {
+        size += budgets ? 8 : 4;
+        for (const v of fields[i]) size += 4 + (Buffer.isBuffer(v) ? v.length : Buffer.byteLength(v));
+        if (shm) size += offsets[i] >= 0 ? 5 - fields[i][2].length : 1;
+    }
+
+    const buf = Buffer.allocUnsafe(size);
+    buf.writeUInt32LE(size - FRAME_HEADER_SIZE, 0);
+    buf[4] = shm ? FRAME_BATCH_SHM : FRAME_BATCH;
+    let off = buf.writeUInt32LE(budgets ? (tasks.length | BATCH_DEADLINES) >>> 0 : tasks.length, FRAME_HEADER_SIZE);
+
+    for (let i = 0; i < tasks.length; i++) {
+        off = buf.writeUInt32LE(tasks[i].id, off);
+        if (budgets) off = buf.writeUInt32LE(Math.min(budgets[i], 0xFFFFFFFF), off);
+        for (let f = 0; f < 3; f++) {
+            const v = fields[i][f];
+            if (f == 2 && shm) {
+                buf[off++] = offsets[i] >= 0 ? BODY_SHM : BODY_INLINE;
+                if (offsets[i] >= 0) {
+                    off = buf.writeUInt32LE(offsets[i], off);
+                    off = buf.writeUInt32LE(v.length, off);
+                    continue;
+                }
+            }
+            const len = Buffer.isBuffer(v) ? v.copy(buf, off + 4) : buf.write(v, off + 4);
+            buf.writeUInt32LE(len, off);
+            off += 4 + len;
+        }
+    }
+    return buf;
+}
+
+// FRAME_STREAM_BEGIN: u32 stream id, u32 inspection limit, url and headers as u32 length + bytes
+function encodeStreamBegin(id, maxBytes, url, headers) {
+    const fields = [Buffer.from(url || ''), Buffer.from(JSON.stringify(headers || {}))];
+    const size = FRAME_HEADER_SIZE + 8 + fields.reduce((sum, v) => sum + 4 + v.length, 0);
+
+    const buf = Buffer.allocUnsafe(size);
+    buf.writeUInt32LE(size - FRAME_HEADER_SIZE, 0);
+    buf[4] = FRAME_STREAM_BEGIN;
+    let off = buf.writeUInt32LE(id, FRAME_HEADER_SIZE);
+    off = buf.writeUInt32LE(maxBytes, off);
+    for (const v of fields) {
+        off = buf.writeUInt32LE(v.length, off);
+        off += v.copy(buf, off);
+    }
+    return buf;
+}
+
+// FRAME_STREAM_CHUNK / FRAME_STREAM_END / FRAME_STREAM_ABORT: u32 stream id, then the chunk
+function encodeStreamFrame(type, id, chunk) {
+    const len = chunk ? chunk.length : 0;
+    const buf = Buffer.allocUnsafe(FRAME_HEADER_SIZE + 4 + len);
+    buf.writeUInt32LE(4 + len, 0);
+    buf[4] = type;
+    buf.writeUInt32LE(id, FRAME_HEADER_SIZE);
+    if (len) chunk.copy(buf, FRAME_HEADER_SIZE + 4);
+    return buf;
+}
+
+function encodeControl(message) {
+    const text = Buffer.from(JSON.stringify(message));
+    const buf = Buffer.allocUnsafe(FRAME_HEADER_SIZE + text.length);
+    buf.writeUInt32LE(text.length, 0);
+    buf[4] = FRAME_CONTROL;
+    text.copy(buf, FRAME_HEADER_SIZE);
+    return buf;
+}
+
+// Rules table of a "rules" control message: [[rule id, attack, description], ...]
+function decodeRules(table) {
+    const rules = [];
+    for (const [id, attack, severity] of table) {
+        rules[id] = { attack, severity };
+    }
+    return rules;
+}
+
+// FRAME_BATCH response -> [{id, result}], result has the shape of the JSON mode verdict
+function decodeVerdicts(payload, rules) {
+    const count = payload.readUInt32LE(0);
+    const responses = new Array(count);
+    let off = 4;
+
+    for (let i = 0; i < count; i++) {
+        ({ response: responses[i], off } = decodeVerdict(payload, off, rules));
+    }
+    return responses;
+}
+
+// One verdict at off -> {response: {id, result} or {id, error}, off: just past it}
+function decodeVerdict(payload, off, rules) {
+    const id = payload.readUInt32LE(off);
+    const flags = payload[off + 4];
+    const status = flags & ~VERDICT_INCOMPLETE;
+    const score = payload.readUInt16LE(off + 5);
+    const findingCount = payload.readUInt16LE(off + 7);
+    off += 9;
+
+    const findings = new Array(findingCount);
+    for (let k = 0; k < findingCount; k++) {
+        const rule = rules[payload.readUInt16LE(off)] || { attack: 'unknown', severity: 'unknown' };
+        findings[k] = {
+            attack: rule.attack,
+            location: LOCATIONS[payload[off + 2]] || 'unknown',
+            severity: rule.severity
+        };
+        off += 3;
+    }
+
+    if (status === VERDICT_ERROR) {
+        return { response: { id, error: new Error('Analyzer could not inspect the stream') }, off };
+    }
+    const result = { status: status ? 'attack' : 'clean', score, findings };
+
+    // Ids of the rules that did not run - every category without one of them was evaluated
+    if (flags & VERDICT_INCOMPLETE) {
+        const skipped = new Set();
+        const skippedCount = payload.readUInt16LE(off);
+        off += 2;
+        for (let k = 0; k < skippedCount; k++, off += 2) {
+            const rule = rules[payload.readUInt16LE(off)];
+            if (rule) skipped.add(rule.attack);
+        }
+
+        const categories = new Set(rules.filter(Boolean).map(rule => rule.attack));
+        result.incomplete = true;
+        result.evaluated = [...categories].filter(category => !skipped.has(category));
+    }
+    return { response: { id, result }, off };
+}
+
+
+// Body of one request on its way to the analyzer: write() the chunks as they arrive, then end().
+// verdict resolves after end(), or before it if the body already is an attack. abort() drops
+// the stream of an upload that will not complete, verdict rejects then.
+class BodyStream {
+    constructor(worker, url, headers) {
+        this.worker = worker;
+        this.sent = 0;
+        this.verdict = new Promise((resolve, reject) => {
+            if (!worker) return reject(new Error('No active worker'));
+            this.id = worker.beginStream(url, headers, streamMaxInspect, { resolve, reject });
+        });
+    }
+
+    write(chunk) {
+        // Bytes past the limit would not be scanned anyway
+        if (!this.worker || this.sent >= streamMaxInspect) return;
+
+        const part = chunk.length > streamMaxInspect - this.sent
+            ? chunk.subarray(0, streamMaxInspect - this.sent)
+            : chunk;
+        this.sent += part.length;
+        this.worker.streamChunk(this.id, part);
+    }
+
+    end() {
+        if (this.worker) this.worker.endStream(this.id);
+    }
+
+    abort() {
+        if (this.worker) this.worker.abortStream(this.id);
+    }
+}
+
+
 class WorkerPool extends EventEmitter {
     constructor(size = 10) {
         super();
         this.workers = [];
         this.taskQueue = [];
         this.readyWorkers = 0;
+        this.batchSize = batchSize;     // Adapted in adaptBatchSize()
+        // Measured on this side of the pipe - the analyzer reports its own phases
+        this.metrics = {
+            batches: 0,
+            requests: 0,
+            queue: new LatencyHistogram(),      // Task waiting for a free worker
+            roundTrip: new LatencyHistogram(),  // Batch written until its verdicts arrived
+            expired: 0,                         // Tasks whose deadline passed in the queue
+        };
 
+        if (nativeAnalyzer) {
+            const cacheEntries = verdictCacheSize === '' ? undefined : Number(verdictCacheSize);
+            if (!nativeAnalyzer.load(rulesPath, cacheEntries)) {
+                console.error(`Could not compile the rules from ${rulesPath}, nothing is matched`);
+            }
+        }
         this.initWorkers(size);
     }
 
     // Creates worker objects, register callbacks on 'ready' nad 'available' events
     initWorkers(size) {
         for (let i = 0; i < size; i++) {
-            const worker = new AnalyzerWorker(i);
+            const worker = nativeAnalyzer ? new AddonWorker(i) : new AnalyzerWorker(i);
 
             worker.on('ready', () => {
                 this.readyWorkers++;
@@ -171,41 +797,88 @@ class WorkerPool extends EventEmitter {
                 this.processQueue();
             });
 
+            worker.on('batch', (ms, size) => {
+                this.metrics.roundTrip.record(ms);
+                this.adaptBatchSize(ms, size);
+            });
+
             this.workers.push(worker);
         }
     }
 
+    // The worker with the fewest batches in flight that can take one more
     getFreeWorker() {
-        return this.workers.find(worker => !worker.busy && worker.active);
+        let free = null;
+        for (const worker of this.workers) {
+            if (worker.active && !worker.busy && (!free || worker.load < free.load)) free = worker;
+        }
+        return free;
     }
 
     processQueue() {
-        if (this.taskQueue.length == 0) return;
+        while (this.taskQueue.length > 0) {
+            const freeWorker = this.getFreeWorker();
+            if (!freeWorker) return;
 
-        const freeWorker = this.getFreeWorker();
-        if (!freeWorker) return;
+            // If there is more tasks waiting in queue -> send them in a batch
+            const taskNumber = Math.min(this.batchSize, this.taskQueue.length);
+
+            const tasks = this.expireTasks(this.taskQueue.splice(0, taskNumber));
+            if (tasks.length && !this.executeTask(freeWorker, tasks)) return;
+        }
+    }
 
-        // If there is more tasks waiting in queue -> send them in a batch
-        const taskNumber = Math.min(batchSize, this.taskQueue.length);
+    // Tasks that ran out of time in the queue are not sent, they get an incomplete verdict
+    // right away and the route's policy decides. Returns the ones that still have time.
+    expireTasks(tasks) {
+        const now = performance.now();
+        return tasks.filter(t => {
+            if (!t.deadline || t.deadline > now) return true;
 
-        const tasks = this.taskQueue.splice(0, taskNumber);
-        this.executeTask(freeWorker, tasks);
+            this.metrics.expired++;
+            this.metrics.queue.record(now - t.queuedAt);
+            t.resolve(expiredVerdict());
+            return false;
+        });
+    }
+
+    // Additive increase while the queue holds a full batch - under a backlog large batches
+    // pay off. Otherwise multiplicative decrease when a batch came back later than
+    // batchLatencyTarget, a request should not wait for many others in its batch.
+    adaptBatchSize(ms, size) {
+        if (this.taskQueue.length >= this.batchSize) {
+            this.batchSize = Math.min(batchSize, this.batchSize + 1);
+        } else if (ms > batchLatencyTarget && size > 1) {
+            this.batchSize = Math.max(1, Math.min(this.batchSize, size) >> 1);
+        }
     }
 
     executeTask(worker, tasks) {
         for (const t of tasks) {
-            t.id = randomUUID();
+            t.id = worker.nextTaskId();
         }
         const err = worker.analyze(tasks);
         if (err instanceof Error) {
             this.taskQueue.unshift(...tasks);
             setImmediate(() => this.processQueue());
+            return false;
+        }
+
+        const now = performance.now();
+        this.metrics.batches++;
+        this.metrics.requests += tasks.length;
+        for (const t of tasks) {
+            this.metrics.queue.record(now - t.queuedAt);
         }
+        return true;
     }
 
-    analyze(url, headers, body) {
+    // deadlineMs > 0 - the verdict is due that many ms from now. A scan that runs out of time
+    // stops and resolves with incomplete: true and the rule categories it did evaluate.
+    analyze(url, headers, body, deadlineMs = 0) {
         return new Promise((resolve, reject) => {
-            const task = { url, headers, body, resolve, reject };
+            const queuedAt = performance.now();
+            const task = { url, headers, body, resolve, reject, queuedAt, deadline: deadlineMs > 0 ? queuedAt + deadlineMs : 0 };
             const freeWorker = this.getFreeWorker();
             if (freeWorker) {
                 this.executeTask(freeWorker, [task]);
@@ -215,9 +888,180 @@ class WorkerPool extends EventEmitter {
         });
     }
 
+    // Whether the body of a request is worth streaming to the analyzer instead of buffering it first
+    canStream(headers) {
+        if (nativeAnalyzer || ipcMode !== 'binary' || streamMinBody <= 0) return false;
+
+        const length = headers['content-length'];
+        if (length === undefined) return headers['transfer-encoding'] !== undefined;
+        return Number(length) >= streamMinBody;
+    }
+
+    // Streamed inspection on the worker with the fewest open streams, see BodyStream
+    openStream(url, headers) {
+        let worker = null;
+        for (const w of this.workers) {
+            if (w.active && (!worker || w.streams.size < worker.streams.size)) worker = w;
+        }
+        return new BodyStream(worker, url, headers);
+    }
+
+    // Pool timings and the analyzer counters summed over the workers, see mergeStats()
+    async stats() {
+        // A shared analyzer answers the same on every connection, one of them is enough,
+        // the same for the slots of the in-process one
+        const workers = this.workers.filter(w => w.active);
+        const targets = analyzerSocket || nativeAnalyzer ? workers.slice(0, 1) : workers;
+        const replies = await Promise.all(targets.map(w => w.requestStats()));
+
+        return {
+            shared: Boolean(analyzerSocket),
+            workers: workers.length,
+            pool: {
+                batches: this.metrics.batches,
+                requests: this.metrics.requests,
+                expired: this.metrics.expired,
+                queue: this.metrics.queue.toJSON(),
+                round_trip: this.metrics.roundTrip.toJSON(),
+            },
+            analyzer: mergeAnalyzerStats(replies.filter(Boolean)),
+        };
+    }
+
+    // One shared analyzer is reloaded by the primary, own analyzers by every pool
+    reloadRules() {
+        if (analyzerSocket) return;
+        if (nativeAnalyzer) return nativeAnalyzer.reload();
+        this.workers.forEach(worker => worker.reloadRules());
+    }
+
     shutdown() {
         this.workers.forEach(worker => worker.kill());
     }
 }
 
-module.exports = WorkerPool;
\ No newline at end of file
+// Shared analyzer: one threaded process per host that holds the only copy of the compiled
+// rules. Started by the cluster primary, the pools of all cluster workers connect to it.
+function startSharedAnalyzer(socketPath, threads, onReady) {
+    return startServer(['--listen', socketPath, '--threads', String(threads)], onReady);
+}
+
+// Zygote: compiles the rules once and forks an analyzer for every pool connection.
+// Respawns take a fork instead of a rules compile, the children share the rule memory.
+function startZygote(socketPath, onReady) {
+    return startServer(['--zygote', socketPath], onReady);
+}
+
+// Starts a socket server of the analyzer, onReady is called once it accepts connections
+function startServer(serverArgs, onReady) {
+    const args = [...serverArgs, '--rules', rulesPath];
+    if (ipcMode === 'binary') args.push('--binary');
+    if (verdictCacheSize) args.push('--cache', verdictCacheSize);
+
+    // stdin carries the commands of the primary (zygote: killZygoteChild)
+    const child = spawn(`./${analyzer}`, args, {
+        stdio: ['pipe', 'pipe', 'inherit']
+    });
+    child.stdin.on('error', () => {});   // Gone - the exit handler of the primary restarts it
+
+    let output = '';
+    const onData = (data) => {
+        output += data.toString();
+        if (!output.includes('\n')) return;
+
+        child.stdout.off('data', onData);
+        try {
+            if (JSON.parse(output.split('\n')[0]).status == 'ready') onReady();
+        } catch (e) {
+            console.error(`Analyzer server sent an invalid ready signal: ${e}`);
+        }
+    };
+    child.stdout.on('data', onData);
+
+    return child;
+}
+
+// Asks the zygote to kill a child stuck on a batch. The zygote only kills its own children
+// it did not reap yet (serve_zygote in analyzer.c).
+function killZygoteChild(zygote, pid) {
+    if (!Number.isInteger(pid) || pid <= 0 || !zygote?.stdin?.writable) return;
+    zygote.stdin.write(JSON.stringify({ cmd: 'kill', pid }) + '\n');
+}
+
+// Stats of several pools (cluster workers) as one. Counters and histograms are summed, the
+// analyzer part of a shared analyzer is the same in every pool and is taken once.
+function mergeStats(list) {
+    const valid = list.filter(Boolean);
+    if (!valid.length) return null;
+
+    const shared = valid.some(s => s.shared);
+    const merged = {
+        shared,
+        workers: 0,
+        pool: {},
+        analyzer: shared
+            ? (valid.find(s => s.analyzer) || {}).analyzer || null
+            : mergeAnalyzerStats(valid.map(s => s.analyzer).filter(Boolean)),
+    };
+    for (const stats of valid) {
+        merged.workers += stats.workers;
+        addCounters(merged.pool, stats.pool);
+    }
+    return merged;
+}
+
+// Replies of several analyzers to {"cmd":"stats"} as one, rules are matched by id
+function mergeAnalyzerStats(replies) {
+    if (!replies.length) return null;
+
+    const merged = {
+        generation: 0,
+        buckets_ns: replies[0].buckets_ns,
+        batch: {},
+        locations: {},
+        rules: [],
+    };
+    const rules = new Map();
+
+    for (const reply of replies) {
+        merged.generation = Math.max(merged.generation, reply.generation);
+        addCounters(merged.batch, reply.batch);
+        addCounters(merged.locations, reply.locations);
+
+        for (const rule of reply.rules) {
+            let total = rules.get(rule.id);
+            if (!total) {
+                total = { id: rule.id, attack: rule.attack, description: rule.description };
+                rules.set(rule.id, total);
+                merged.rules.push(total);
+            }
+            for (const location of LOCATIONS) {
+                if (rule[location]) addCounters(total[location] || (total[location] = {}), rule[location]);
+            }
+        }
+    }
+    return merged;
+}
+
+// Adds every number of from to into, recursively - arrays (histogram buckets) element by element
+function addCounters(into, from) {
+    for (const [key, value] of Object.entries(from || {})) {
+        if (typeof value === 'number') {
+            into[key] = (into[key] || 0) + value;
+        } else if (Array.isArray(value)) {
+            const sum = into[key] || (into[key] = []);
+            value.forEach((n, i) => { sum[i] = (sum[i] || 0) + n; });
+        } else if (value && typeof value === 'object') {
+            addCounters(into[key] || (into[key] = {}), value);
+        }
+    }
+    return into;
+}
+
+module.exports = WorkerPool;
+module.exports.mergeStats = mergeStats;
+module.exports.startSharedAnalyzer = startSharedAnalyzer;
+module.exports.startZygote = startZygote;
+module.exports.killZygoteChild = killZygoteChild;
+// True when the analyzer runs in this process - no shared analyzer or zygote is needed
+module.exports.inProcess = nativeAnalyzer !== null;
\ No newline at end of file
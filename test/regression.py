@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+# usage: python3 test/regression.py [analyzer] - from the repository root, after ./compile.sh
+# Inputs that once got the wrong verdict. Each names the rule (its description) that must
+# report it, or "clean" if nothing may. The detector cases run on the lexical detectors alone,
+# the shipped rules file does not enable them.
+analyzer = sys.argv[1] if len(sys.argv) > 1 else "./analyze"
+rules = "proxy/rules/regex_patterns.json"
+
+cases = [
+    # A comment removed by a transform must not hide the value from the rule, the rule
+    # also runs on the input itself
+    ("html comment before union select", "Quoted/Paren UNION SELECT",
+     {"url": "/search", "headers": "{}", "body": "q=<!-- ') union select password from users"}),
+    ("block comment before union select", "Quoted/Paren UNION SELECT",
+     {"url": "/search", "headers": "{}", "body": "q=/* ') union select password from users"}),
+    ("comments between union and select", "Quoted/Paren UNION SELECT",
+     {"url": "/search?q=1%27)/**/union/**/select/**/password/**/from/**/users", "headers": "{}", "body": ""}),
+    # A percent sign that decodes nothing ahead of one that does
+    ("double encoded comments after a percent sign", "Quoted/Paren UNION SELECT",
+     {"url": "/search?q=100%25%20off%27)union%252f**%252fselect%2520password", "headers": "{}", "body": ""}),
+    ("search for a union", "clean",
+     {"url": "/search?q=credit+union+opening+hours", "headers": "{}", "body": ""}),
+    # Values of a location are matched one by one - a rule does not run from one into the next
+    ("union and select in two form fields", "clean",
+     {"url": "/signup", "headers": json.dumps({"content-type": "application/x-www-form-urlencoded"}),
+      "body": "bank=credit+union&plan=select+premium"}),
+    ("union and select in two headers", "clean",
+     {"url": "/account", "headers": json.dumps({"x-bank": "credit union", "x-plan": "select premium"}), "body": ""}),
+    # A part without a file name is a form field, whatever its Content-Type says
+    ("form field typed as an image", "Quoted/Paren UNION SELECT",
+     {"url": "/upload", "headers": json.dumps({"content-type": "multipart/form-data; boundary=XB"}),
+      "body": "--XB\r\nContent-Disposition: form-data; name=\"id\"\r\nContent-Type: image/png\r\n\r\n"
+              "1' union select password from users\r\n--XB--\r\n"}),
+]
+
+def get(url, body=""):
+    return {"url": url, "headers": "{}", "body": body}
+
+
+# Values are url-encoded as a client sends them
+detector_cases = [
+    ("tautology after a quote", "SQL injection token fingerprint", get("/item?id=1%27%20or%20%271%27%3D%271")),
+    ("union select after a quote", "SQL injection token fingerprint", get("/item?id=1%27%20union%20select%20password%20from%20users--")),
+    ("comment after a quote", "SQL injection token fingerprint", get("/login?user=admin%27%23")),
+    ("stacked query", "SQL injection token fingerprint", get("/item?id=1%3B%20drop%20table%20users")),
+    ("and with arithmetic in text", "clean", get("/search?q=rock%20and%202-3%20players")),
+    ("quoted word and a hashtag", "clean", get("/post?text=%22hello%22%20%23tag")),
+    ("o'reilly", "clean", get("/search?q=o%27reilly%20books")),
+    ("script tag", "Markup that runs script (tag, handler, url)", get("/search?q=%3Cscript%3Ealert(1)%3C%2Fscript%3E")),
+    ("event handler", "Markup that runs script (tag, handler, url)", get("/search?q=%3Cimg%20src%3Dx%20onerror%3Dalert(1)%3E")),
+    ("javascript url", "Markup that runs script (tag, handler, url)", get("/go?next=javascript:alert(1)")),
+    ("javascript url in href", "Markup that runs script (tag, handler, url)", get("/c?html=%3Ca%20href%3D%22javascript:%20alert(1)%22%3Ex%3C%2Fa%3E")),
+    ("data url", "Markup that runs script (tag, handler, url)", get("/go?next=data:text/html;base64,PHNjcmlwdD4=")),
+    ("attribute breakout", "Markup that runs script (tag, handler, url)", get("/p?name=x%22%20onmouseover%3D%22alert(1)")),
+    ("javascript in a book title", "clean", get("/search?q=javascript:%20the%20good%20parts")),
+    ("data in a sentence", "clean", get("/notes?text=data:%20the%20numbers%20look%20fine")),
+    ("less than in text", "clean", get("/search?q=a%20%3C%20b%20and%20c%20%3E%20d")),
+]
+
+detector_rules = {"rules": [
+    {"detector": "sqli", "description": "SQL injection token fingerprint", "severity": 5,
+     "category": "SQL_INJECTION"},
+    {"detector": "xss", "description": "Markup that runs script (tag, handler, url)", "severity": 8,
+     "category": "XSS", "transforms": ["url_decode", "url_decode_uni", "escape_decode"]},
+]}
+
+
+def run(rules, cases):
+    batch = [dict(request, id=str(i)) for i, (_, _, request) in enumerate(cases)]
+    result = subprocess.run([analyzer, "--rules", rules], input=json.dumps(batch) + "\n",
+                            capture_output=True, text=True, timeout=60)
+
+    verdicts = {}
+    for line in result.stdout.splitlines():
+        if not line.startswith("["):
+            continue
+        for verdict in json.loads(line):
+            verdicts[verdict["id"]] = json.loads(verdict["result"])
+
+    failed = 0
+    for i, (name, expect, _) in enumerate(cases):
+        verdict = verdicts.get(str(i))
+        # The verdict carries a finding's description under "severity"
+        reported = [f["severity"] for f in verdict["findings"]] if verdict else None
+        passed = reported == [] if expect == "clean" else reported is not None and expect in reported
+        if not passed:
+            failed += 1
+            print(f"FAIL {name}: expected {expect}, got {reported}")
+    return failed
+
+
+failed = run(rules, cases)
+with tempfile.NamedTemporaryFile("w", suffix=".json", delete=False) as f:
+    json.dump(detector_rules, f)
+try:
+    failed += run(f.name, detector_cases)
+finally:
+    os.unlink(f.name)
+
+total = len(cases) + len(detector_cases)
+print(f"{total - failed} of {total} passed")
+sys.exit(1 if failed else 0)